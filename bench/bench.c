@@ -0,0 +1,478 @@
+/*
+ * microbenchmarks for ranmath, build it once per backend (see test/build.sh)
+ *
+ * every function gets a latency run, one dependent chain where each call
+ * waits for the last one, and a throughput run over independent chains. the
+ * batch kernels only get a throughput run and report per element. results
+ * are csv on stdout, or json with --json. cycles come from the tsc so they
+ * are reference cycles, not core cycles, and are 0 on arm.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../ranmath.h"
+
+#if RM_ARCH == RM_ARCH_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define bench_cycles() ((u64)__rdtsc())
+#else
+#define bench_cycles() ((u64)0)
+#endif
+
+#if defined(RM_AVX2)
+#define BENCH_BACKEND "avx2"
+#elif defined(RM_AVX)
+#define BENCH_BACKEND "avx"
+#elif defined(RM_SSE4_1)
+#define BENCH_BACKEND "sse4_1"
+#elif defined(RM_SSE2)
+#define BENCH_BACKEND "sse2"
+#elif defined(RM_NEON)
+#define BENCH_BACKEND "neon"
+#else
+#define BENCH_BACKEND "scalar"
+#endif
+
+#define BENCH_ITERS   (1 << 16)
+#define BENCH_STREAMS 8
+#define BENCH_REPEATS 5
+#define BENCH_BATCH_N 1024
+#define BENCH_ROUNDS  64
+
+/* volatile so the compiler can not fold the inputs */
+static volatile f64 bench_seed = 0.5;
+static volatile u8 bench_sink;
+static bool bench_json;
+static bool bench_first = true;
+
+static f64
+bench_now(void) {
+    struct timespec ts;
+
+    timespec_get(&ts, TIME_UTC);
+    return (f64)ts.tv_sec * 1e9 + (f64)ts.tv_nsec;
+}
+static void
+bench_consume(const void *p, const size_t size) {
+    const u8 *b;
+    size_t i;
+    u8 s;
+
+    b = p;
+    s = 0;
+    for (i = 0; i < size; ++i) { s ^= b[i]; }
+    bench_sink = s;
+}
+static void
+bench_report(const char *group,
+             const char *name,
+             const char *kind,
+             const f64 ns,
+             const f64 cycles) {
+    if (bench_json) {
+        printf("%s\n  {\"backend\": \"%s\", \"group\": \"%s\", \"name\": "
+               "\"%s\", \"kind\": \"%s\", \"ns_per_op\": %.3f, "
+               "\"cycles_per_op\": %.3f}",
+               bench_first ? "[" : ",", BENCH_BACKEND, group, name, kind, ns,
+               cycles);
+    } else {
+        if (bench_first) {
+            printf("backend,group,name,kind,ns_per_op,cycles_per_op\n");
+        }
+        printf("%s,%s,%s,%s,%.3f,%.3f\n", BENCH_BACKEND, group, name, kind, ns,
+               cycles);
+    }
+    bench_first = false;
+}
+
+/*
+ * x is the state of type _T that goes through the chain and c a constant of
+ * type _C, both are built from the seed s. step has to keep x bounded and
+ * away from subnormals so the timings stay honest
+ */
+#define BENCH_DEFINE(_group, _name, _T, _C, _x, _c, _step)                     \
+    static _T                                                                  \
+    bench_step_##_name(const _T x, const _C c) {                               \
+        (void)c;                                                               \
+        return _step;                                                          \
+    }                                                                          \
+    static void                                                                \
+    bench_##_name(void) {                                                      \
+        _T x[BENCH_STREAMS];                                                   \
+        _C c;                                                                  \
+        f64 s, t, lat, tput;                                                   \
+        u64 cyc, lat_cyc, tput_cyc;                                            \
+        u32 i, k, r;                                                           \
+                                                                               \
+        lat  = tput = 1e300;                                                   \
+        lat_cyc = tput_cyc = ~(u64)0;                                          \
+        for (r = 0; r < BENCH_REPEATS; ++r) {                                  \
+            for (k = 0; k < BENCH_STREAMS; ++k) {                              \
+                s    = bench_seed + 0.001 * k;                                 \
+                x[k] = (_x);                                                   \
+            }                                                                  \
+            s = bench_seed;                                                    \
+            c = (_c);                                                          \
+                                                                               \
+            t   = bench_now();                                                 \
+            cyc = bench_cycles();                                              \
+            for (i = 0; i < BENCH_ITERS; ++i) {                                \
+                x[0] = bench_step_##_name(x[0], c);                            \
+            }                                                                  \
+            cyc = bench_cycles() - cyc;                                        \
+            t   = bench_now() - t;                                             \
+            lat     = RM_MIN(lat, t);                                          \
+            lat_cyc = RM_MIN(lat_cyc, cyc);                                    \
+                                                                               \
+            t   = bench_now();                                                 \
+            cyc = bench_cycles();                                              \
+            for (i = 0; i < BENCH_ITERS / BENCH_STREAMS; ++i) {                \
+                for (k = 0; k < BENCH_STREAMS; ++k) {                          \
+                    x[k] = bench_step_##_name(x[k], c);                        \
+                }                                                              \
+            }                                                                  \
+            cyc = bench_cycles() - cyc;                                        \
+            t   = bench_now() - t;                                             \
+            tput     = RM_MIN(tput, t);                                        \
+            tput_cyc = RM_MIN(tput_cyc, cyc);                                  \
+                                                                               \
+            bench_consume(x, sizeof(x));                                       \
+        }                                                                      \
+        bench_report(#_group, #_name, "latency", lat / BENCH_ITERS,            \
+                     (f64)lat_cyc / BENCH_ITERS);                              \
+        bench_report(#_group, #_name, "throughput", tput / BENCH_ITERS,        \
+                     (f64)tput_cyc / BENCH_ITERS);                             \
+    }
+#define BENCH_ENTRY(_group, _name, ...) bench_##_name,
+
+/*
+ * tan is pulled back by -x + c so the chain settles at atan(c), exp and log
+ * settle at the fixed points of exp(c - x) and log(x + 1)
+ */
+#define BENCH_SCALAR(X, _S)                                                    \
+    X(scalar, sqrt_##_S, _S, _S, (_S)s, (_S)s, rm_sqrt_##_S(x))                \
+    X(scalar, rsqrt_##_S, _S, _S, (_S)s, (_S)s, rm_rsqrt_##_S(x))              \
+    X(scalar, sin_##_S, _S, _S, (_S)s, (_S)s, rm_sin_##_S(x))                  \
+    X(scalar, cos_##_S, _S, _S, (_S)s, (_S)s, rm_cos_##_S(x))                  \
+    X(scalar, tan_##_S, _S, _S, (_S)s, (_S)s, rm_tan_##_S(x) - x + c)          \
+    X(scalar, exp_##_S, _S, _S, (_S)s, (_S)s, rm_exp_##_S(c - x))              \
+    X(scalar, log_##_S, _S, _S, (_S)s, (_S)s, rm_log_##_S(x + 1))              \
+    X(scalar, sin_fast_##_S, _S, _S, (_S)s, (_S)s, rm_sin_fast_##_S(x))        \
+    X(scalar, exp_fast_##_S, _S, _S, (_S)s, (_S)s, rm_exp_fast_##_S(c - x))    \
+    X(scalar, log_fast_##_S, _S, _S, (_S)s, (_S)s, rm_log_fast_##_S(x + 1))    \
+    X(scalar, floor_##_S, _S, _S, (_S)s, (_S)s, rm_floor_##_S(x))              \
+    X(scalar, ceil_##_S, _S, _S, (_S)s, (_S)s, rm_ceil_##_S(x))                \
+    X(scalar, round_##_S, _S, _S, (_S)s, (_S)s, rm_round_##_S(x))              \
+    X(scalar, trunc_##_S, _S, _S, (_S)s, (_S)s, rm_trunc_##_S(x))              \
+    X(scalar, fract_##_S, _S, _S, (_S)s, (_S)s, rm_fract_##_S(x))              \
+    X(scalar, mod_##_S, _S, _S, (_S)(s * 8), (_S)(s * 3), rm_mod_##_S(x, c))   \
+    X(scalar, abs_##_S, _S, _S, (_S)s, (_S)s, rm_abs_##_S(x))                  \
+    X(scalar, min_##_S, _S, _S, (_S)s, (_S)s, rm_min_##_S(x, c))
+
+/*
+ * c is 1 / _W in every lane, which keeps the reductions at the mean. mul and
+ * div get 1 + s * 1e-6 so the compiler cannot fold x * 1 and x / 1 away
+ */
+#define BENCH_VECTOR(X, _T, _S, _W)                                            \
+    X(vector, add_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1 / _W),     \
+      rm_add_##_T(x, c))                                                       \
+    X(vector, mul_##_T, _T, _T, rm_##_T##s((_S)s),                            \
+      rm_##_T##s((_S)(1 + s * 1e-6)), rm_mul_##_T(x, c))                      \
+    X(vector, div_##_T, _T, _T, rm_##_T##s((_S)s),                            \
+      rm_##_T##s((_S)(1 + s * 1e-6)), rm_div_##_T(x, c))                      \
+    X(vector, fma_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1 / _W),     \
+      rm_fma_##_T(x, c, c))                                                    \
+    X(vector, max_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1 / _W),     \
+      rm_max_##_T(x, c))                                                       \
+    X(vector, clamp_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1 / _W),   \
+      rm_clamp_##_T(x, c, rm_##_T##s((_S)1)))                                  \
+    X(vector, floor_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1),        \
+      rm_floor_##_T(x))                                                        \
+    X(vector, round_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1),        \
+      rm_round_##_T(x))                                                        \
+    X(vector, trunc_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1),        \
+      rm_trunc_##_T(x))                                                        \
+    X(vector, sin_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1),          \
+      rm_sin_##_T(x))                                                          \
+    X(vector, cos_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1),          \
+      rm_cos_##_T(x))                                                          \
+    X(vector, exp_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1),          \
+      rm_exp_##_T(rm_sub_##_T(c, x)))                                          \
+    X(vector, log_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1),          \
+      rm_log_##_T(rm_add_##_T(x, c)))                                          \
+    X(vector, sin_fast_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1),     \
+      rm_sin_fast_##_T(x))                                                     \
+    X(vector, exp_fast_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1),     \
+      rm_exp_fast_##_T(rm_sub_##_T(c, x)))                                     \
+    X(vector, log_fast_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1),     \
+      rm_log_fast_##_T(rm_add_##_T(x, c)))                                     \
+    X(vector, dot_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1 / _W),     \
+      rm_##_T##s(rm_dot_##_T(x, c)))                                           \
+    X(vector, hadd_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1 / _W),    \
+      rm_##_T##s(rm_hadd_##_T(x) * c.x))                                       \
+    X(vector, norm_##_T, _T, _T, rm_##_T##s((_S)s),                            \
+      rm_##_T##s((_S)1 / rm_sqrt_##_S(_W)),                                    \
+      rm_##_T##s(rm_norm_##_T(x) * c.x))                                       \
+    X(vector, normalize_##_T, _T, _T, rm_##_T##s((_S)s), rm_##_T##s((_S)1),    \
+      rm_normalize_##_T(x))                                                    \
+    X(vector, distance_##_T, _T, _T, rm_##_T##s((_S)s),                        \
+      rm_##_T##s((_S)1 / rm_sqrt_##_S(_W)),                                    \
+      rm_##_T##s(rm_distance_##_T(x, c) * c.x))
+
+/* the constant is the identity with s in the first column */
+#define BENCH_MATRIX(X, _T, _V, _S)                                            \
+    X(matrix, mul_##_T, _T, _T, rm_muls_##_T(rm_identity_##_T(), (_S)s),       \
+      bench_shear_##_T((_S)s), rm_mul_##_T(x, c))                              \
+    X(matrix, mulv_##_T, _V, _T, rm_##_V##s((_S)s),                            \
+      rm_identity_##_T(), rm_mulv_##_T(c, x))                                  \
+    X(matrix, transpose_##_T, _T, _T, bench_shear_##_T((_S)s),                 \
+      rm_identity_##_T(), rm_transpose_##_T(x))                                \
+    X(matrix, inverse_##_T, _T, _T, rm_muls_##_T(rm_identity_##_T(), (_S)s),   \
+      rm_identity_##_T(), rm_inverse_##_T(x))                                  \
+    X(matrix, det_##_T, _T, _T, bench_shear_##_T((_S)s),                       \
+      bench_shear_##_T((_S)s), rm_muls_##_T(c, rm_det_##_T(x)))
+
+/*
+ * c is a turn of 1 radian around z, slerp towards the conjugate of x has a
+ * fixed point a third of the way so it never settles into the nlerp case
+ */
+#define BENCH_QUAT(X)                                                          \
+    X(quat, mul_quatf32, quatf32, quatf32,                                     \
+      rm_axis_angle_quatf32(rm_f32x3(0.0f, 0.0f, 1.0f), (f32)s),               \
+      rm_axis_angle_quatf32(rm_f32x3(0.0f, 0.0f, 1.0f), 1.0f),                 \
+      rm_mul_quatf32(x, c))                                                    \
+    X(quat, rotate_quatf32, f32x3, quatf32, rm_f32x3s((f32)s),                 \
+      rm_axis_angle_quatf32(rm_f32x3(0.0f, 0.0f, 1.0f), 1.0f),                 \
+      rm_rotate_quatf32(c, x))                                                 \
+    X(quat, slerp_quatf32, quatf32, quatf32,                                   \
+      rm_axis_angle_quatf32(rm_f32x3(0.0f, 0.0f, 1.0f), (f32)s),               \
+      rm_axis_angle_quatf32(rm_f32x3(0.0f, 0.0f, 1.0f), 1.0f),                 \
+      rm_slerp_quatf32(c, rm_conjugate_quatf32(x), 0.5f))                      \
+    X(quat, to_f32x4x4_quatf32, quatf32, quatf32,                              \
+      rm_axis_angle_quatf32(rm_f32x3(0.0f, 0.0f, 1.0f), (f32)s),               \
+      rm_identity_quatf32(),                                                   \
+      rm_from_f32x4x4_quatf32(rm_to_f32x4x4_quatf32(x)))
+
+/*
+ * the same chain through the struct api and the register api, the gap is
+ * what the loads and stores between the calls cost
+ */
+#define BENCH_CHAIN(X)                                                         \
+    X(chain, chain_f32x4, f32x4, f32x4, rm_f32x4s((f32)s), rm_f32x4s(0.5f),    \
+      rm_normalize_f32x4(                                                      \
+          rm_fma_f32x4(x, c, rm_abs_f32x4(rm_sub_f32x4(x, c)))))               \
+    X(chain, chain_rmv_f32x4, rmv_f32x4, rmv_f32x4, rmv_set1_f32x4((f32)s),    \
+      rmv_set1_f32x4(0.5f),                                                    \
+      rmv_normalize_f32x4(                                                     \
+          rmv_fma_f32x4(x, c, rmv_abs_f32x4(rmv_sub_f32x4(x, c)))))
+
+#define BENCH_SHEAR(_T, _S)                                                    \
+    static _T                                                                  \
+    bench_shear_##_T(const _S s) {                                             \
+        _T dest;                                                               \
+                                                                               \
+        dest = rm_identity_##_T();                                             \
+        dest.raw[0][1] += s;                                                   \
+        return dest;                                                           \
+    }
+
+#define BENCH_BATCH_DEFINE(_name, _call)                                       \
+    static void                                                                \
+    bench_##_name(void) {                                                      \
+        f64 t, best;                                                           \
+        u64 cyc, best_cyc;                                                     \
+        u32 i, r;                                                              \
+                                                                               \
+        best     = 1e300;                                                      \
+        best_cyc = ~(u64)0;                                                    \
+        for (r = 0; r < BENCH_REPEATS; ++r) {                                  \
+            t   = bench_now();                                                 \
+            cyc = bench_cycles();                                              \
+            for (i = 0; i < BENCH_ROUNDS; ++i) { _call; }                      \
+            cyc      = bench_cycles() - cyc;                                   \
+            t        = bench_now() - t;                                        \
+            best     = RM_MIN(best, t);                                        \
+            best_cyc = RM_MIN(best_cyc, cyc);                                  \
+        }                                                                      \
+        bench_report("batch", #_name, "throughput",                            \
+                     best / (BENCH_ROUNDS * BENCH_BATCH_N),                    \
+                     (f64)best_cyc / (BENCH_ROUNDS * BENCH_BATCH_N));          \
+    }
+#define BENCH_BATCH_ENTRY(_name, _call) bench_##_name,
+
+#define BENCH_BATCH(X)                                                         \
+    X(transform_points_f32x4x4,                                                \
+      rm_transform_points_f32x4x4(&bench_m, bench_v3, bench_v3, BENCH_BATCH_N))\
+    X(transform_f32x4x4,                                                       \
+      rm_transform_f32x4x4(&bench_m, bench_v4, bench_v4, BENCH_BATCH_N))       \
+    X(add_f32x3_soa,                                                           \
+      rm_add_f32x3_soa(bench_a, bench_b, bench_a, BENCH_BATCH_N))              \
+    X(fma_f32x3_soa,                                                           \
+      rm_fma_f32x3_soa(bench_a, bench_b, bench_b, bench_c, BENCH_BATCH_N))     \
+    X(dot_f32x3_soa,                                                           \
+      rm_dot_f32x3_soa(bench_a, bench_b, bench_d, BENCH_BATCH_N))              \
+    X(cross_f32x3_soa,                                                         \
+      rm_cross_f32x3_soa(bench_a, bench_b, bench_c, BENCH_BATCH_N))            \
+    X(normalize_f32x3_soa,                                                     \
+      rm_normalize_f32x3_soa(bench_a, bench_a, BENCH_BATCH_N))                 \
+    X(distance_f32x3_soa,                                                      \
+      rm_distance_f32x3_soa(bench_a, bench_b, bench_d, BENCH_BATCH_N))         \
+    X(deinterleave_f32x3,                                                      \
+      rm_deinterleave_f32x3(bench_v3, bench_c, BENCH_BATCH_N))                 \
+    X(interleave_f32x3, rm_interleave_f32x3(bench_b, bench_v3, BENCH_BATCH_N)) \
+    X(deinterleave_u8x4,                                                       \
+      rm_deinterleave_u8x4(bench_px, bench_planes, BENCH_BATCH_N))             \
+    X(interleave_u8x4,                                                         \
+      rm_interleave_u8x4(bench_planes, bench_px, BENCH_BATCH_N))               \
+    X(skin_f32x4x3,                                                            \
+      rm_skin_f32x4x3(bench_bones, bench_bi, bench_bw, bench_v3, bench_sk[0],  \
+                      bench_v3, bench_sk[1], BENCH_BATCH_N))                   \
+    X(nlerp_batch_quatf32,                                                     \
+      rm_nlerp_batch_quatf32(bench_qa, bench_qb, bench_t, bench_qc,            \
+                             BENCH_BATCH_N))                                   \
+    X(slerp_batch_quatf32,                                                     \
+      rm_slerp_batch_quatf32(bench_qa, bench_qb, bench_t, bench_qc,            \
+                             BENCH_BATCH_N))                                   \
+    X(frustum_cull_batch_aabbf32,                                              \
+      rm_frustum_cull_batch_aabbf32(bench_frustum, bench_bb, bench_visible,    \
+                                    BENCH_BATCH_N))                            \
+    X(raycast4_aabbf32, bench_raycast4())                                      \
+    X(raycast_packet_aabbf32, bench_raycast_packet())
+
+BENCH_SHEAR(f32x2x2, f32)
+BENCH_SHEAR(f32x3x3, f32)
+BENCH_SHEAR(f32x4x4, f32)
+BENCH_SHEAR(f64x2x2, f64)
+BENCH_SHEAR(f64x3x3, f64)
+BENCH_SHEAR(f64x4x4, f64)
+
+#define BENCH_LIST(X)                                                          \
+    BENCH_SCALAR(X, f32)                                                       \
+    BENCH_SCALAR(X, f64)                                                       \
+    BENCH_VECTOR(X, f32x2, f32, 2)                                             \
+    BENCH_VECTOR(X, f32x3, f32, 3)                                             \
+    BENCH_VECTOR(X, f32x4, f32, 4)                                             \
+    BENCH_VECTOR(X, f64x2, f64, 2)                                             \
+    BENCH_VECTOR(X, f64x3, f64, 3)                                             \
+    BENCH_VECTOR(X, f64x4, f64, 4)                                             \
+    BENCH_MATRIX(X, f32x2x2, f32x2, f32)                                       \
+    BENCH_MATRIX(X, f32x3x3, f32x3, f32)                                       \
+    BENCH_MATRIX(X, f32x4x4, f32x4, f32)                                       \
+    BENCH_MATRIX(X, f64x2x2, f64x2, f64)                                       \
+    BENCH_MATRIX(X, f64x3x3, f64x3, f64)                                       \
+    BENCH_MATRIX(X, f64x4x4, f64x4, f64)                                       \
+    BENCH_QUAT(X)                                                              \
+    BENCH_CHAIN(X)
+
+static f32x4x4 bench_m;
+static f32x3 bench_v3[BENCH_BATCH_N];
+static f32x4 bench_v4[BENCH_BATCH_N];
+static u8x4 bench_px[BENCH_BATCH_N];
+static quatf32 bench_qa[BENCH_BATCH_N];
+static quatf32 bench_qb[BENCH_BATCH_N];
+static quatf32 bench_qc[BENCH_BATCH_N];
+static f32 bench_t[BENCH_BATCH_N];
+static f32x4x3 bench_bones[64];
+static u16x4 bench_bi[BENCH_BATCH_N];
+static f32x4 bench_bw[BENCH_BATCH_N];
+static f32x3 bench_sk[2][BENCH_BATCH_N];
+static f32x4 bench_frustum[6];
+static aabbf32 bench_bb[BENCH_BATCH_N];
+static u8 bench_visible[(BENCH_BATCH_N + 7) / 8];
+static ray_packetf32 bench_rays;
+static f32 bench_rt[RM_RAY_PACKET];
+static f32 bench_d[BENCH_BATCH_N];
+static f32 bench_soa[9][BENCH_BATCH_N];
+static u8 bench_plane[4][BENCH_BATCH_N];
+static f32x3_soa bench_a, bench_b, bench_c;
+static u8x4_soa bench_planes;
+
+/* the ray kernels are per node, so these walk all boxes like a flat bvh */
+static void
+bench_raycast4(void) {
+    size_t i;
+    int m;
+
+    m = 0;
+    for (i = 0; i < BENCH_BATCH_N; i += 4) {
+        m ^= rm_raycast4_aabbf32(rm_get_ray_packetf32(&bench_rays, 0),
+                                 bench_bb + i, bench_rt);
+    }
+    bench_sink = (u8)m;
+}
+static void
+bench_raycast_packet(void) {
+    size_t i;
+    int m;
+
+    m = 0;
+    for (i = 0; i < BENCH_BATCH_N; ++i) {
+        m ^= rm_raycast_packet_aabbf32(&bench_rays, bench_bb[i], bench_rt);
+    }
+    bench_sink = (u8)m;
+}
+
+BENCH_LIST(BENCH_DEFINE)
+BENCH_BATCH(BENCH_BATCH_DEFINE)
+
+static void (*const bench_all[])(void) = {
+    BENCH_LIST(BENCH_ENTRY) BENCH_BATCH(BENCH_BATCH_ENTRY)};
+
+static void
+bench_init(void) {
+    size_t i, k;
+
+    bench_m         = rm_identity_f32x4x4();
+    bench_m.cols[3] = rm_f32x4(0.001f, 0.002f, 0.003f, 1.0f);
+    for (i = 0; i < BENCH_BATCH_N; ++i) {
+        bench_v3[i] = rm_f32x3s((f32)i);
+        bench_v4[i] = rm_f32x4((f32)i, 1.0f, 2.0f, 1.0f);
+        bench_px[i] = rm_u8x4(i, i >> 1, i >> 2, 255);
+        bench_qa[i] = rm_axis_angle_quatf32(rm_f32x3(0.0f, 0.0f, 1.0f),
+                                            (f32)i * 0.01f);
+        bench_qb[i] = rm_axis_angle_quatf32(rm_f32x3(0.6f, 0.8f, 0.0f),
+                                            (f32)i * 0.02f);
+        bench_t[i]  = (f32)i / BENCH_BATCH_N;
+        bench_bi[i] = rm_u16x4(i % 64, (i * 7) % 64, (i * 13) % 64, 0);
+        bench_bw[i] = rm_f32x4(0.5f, 0.25f, 0.25f, 0.0f);
+        bench_bb[i] = rm_aabbf32(rm_f32x3s((f32)i * 0.001f - 2.0f),
+                                 rm_f32x3s((f32)i * 0.001f - 1.9f));
+        for (k = 0; k < 9; ++k) { bench_soa[k][i] = (f32)(k + 1); }
+    }
+    for (i = 0; i < 64; ++i) {
+        bench_bones[i] = rm_affine_rows_f32x4x4(bench_m);
+    }
+    rm_frustum_planes_f32x4x4(bench_m, bench_frustum);
+    for (i = 0; i < RM_RAY_PACKET; ++i) {
+        rm_set_ray_packetf32(&bench_rays, i,
+                             rm_dir_rayf32(rm_f32x3((f32)i * 0.05f, 0.0f, 0.0f),
+                                           rm_f32x3(-1.0f, -1.01f, -0.99f),
+                                           0.0f, RM_INF_F32));
+    }
+    bench_a      = rm_f32x3_soa(bench_soa[0], bench_soa[1], bench_soa[2]);
+    bench_b      = rm_f32x3_soa(bench_soa[3], bench_soa[4], bench_soa[5]);
+    bench_c      = rm_f32x3_soa(bench_soa[6], bench_soa[7], bench_soa[8]);
+    bench_planes = rm_u8x4_soa(bench_plane[0], bench_plane[1], bench_plane[2],
+                               bench_plane[3]);
+}
+
+int
+main(int argc, char **argv) {
+    size_t i;
+
+    bench_json = argc > 1 && strcmp(argv[1], "--json") == 0;
+    bench_init();
+    for (i = 0; i < sizeof(bench_all) / sizeof(bench_all[0]); ++i) {
+        bench_all[i]();
+    }
+    if (bench_json) { printf("\n]\n"); }
+    bench_consume(bench_soa, sizeof(bench_soa));
+    bench_consume(bench_plane, sizeof(bench_plane));
+    bench_consume(bench_visible, sizeof(bench_visible));
+    return 0;
+}
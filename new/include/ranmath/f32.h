@@ -77,12 +77,91 @@ rm_sqrt_f32(const f32 x) {
     return sqrtf(x);
 }
 RM_INLINE f32
+rm_rsqrt_f32(const f32 x) {
+    return 1.0f / rm_sqrt_f32(x);
+}
+/* reduce x to [-pi/4, pi/4], q gets the quadrant */
+RM_INLINE f32
+rm_trig_reduce_f32(const f32 x, i32 *q) {
+    f32 k, r;
+
+    *q = (i32)(x * RM_2_PI_F32 + ((x < 0) ? -0.5f : 0.5f));
+    k  = (f32)*q;
+
+    r = x - k * RM_PI_2_A_F32;
+    r = r - k * RM_PI_2_B_F32;
+    r = r - k * RM_PI_2_C_F32;
+    return r - k * RM_PI_2_D_F32;
+}
+RM_INLINE f32
+rm_sin_kernel_f32(const f32 r) {
+    f32 z, y;
+
+    z = r * r;
+    y = r + r * z * (RM_SIN_P0_F32 + z * (RM_SIN_P1_F32 + z * RM_SIN_P2_F32));
+
+    /* r + (+0) is +0 for r = -0, keep the sign of r */
+    return (r == 0.0f) ? r : y;
+}
+RM_INLINE f32
+rm_cos_kernel_f32(const f32 r) {
+    f32 z;
+
+    z = r * r;
+    return 1.0f - 0.5f * z +
+           z * z * (RM_COS_P0_F32 + z * (RM_COS_P1_F32 + z * RM_COS_P2_F32));
+}
+/* max error is 2.5 ulp for |x| <= RM_TRIG_MAX_F32 */
+RM_INLINE f32
 rm_cos_f32(const f32 x) {
-    return cosf(x);
+    f32 r, y;
+    i32 q;
+
+    /* also catches inf and nan */
+    if (!(rm_abs_f32(x) <= RM_TRIG_MAX_F32)) { return cosf(x); }
+
+    r = rm_trig_reduce_f32(x, &q);
+    q = q + 1;
+    y = (q & 1) ? rm_cos_kernel_f32(r) : rm_sin_kernel_f32(r);
+
+    return (q & 2) ? -y : y;
 }
+/* max error is 2.5 ulp for |x| <= RM_TRIG_MAX_F32 */
 RM_INLINE f32
 rm_sin_f32(const f32 x) {
-    return sinf(x);
+    f32 r, y;
+    i32 q;
+
+    /* also catches inf and nan */
+    if (!(rm_abs_f32(x) <= RM_TRIG_MAX_F32)) { return sinf(x); }
+
+    r = rm_trig_reduce_f32(x, &q);
+    y = (q & 1) ? rm_cos_kernel_f32(r) : rm_sin_kernel_f32(r);
+
+    return (q & 2) ? -y : y;
+}
+/* sin and cos with a single range reduction */
+RM_INLINE void
+rm_sincos_f32(const f32 x, f32 *s, f32 *c) {
+    f32 r, ks, kc;
+    i32 q;
+
+    /* also catches inf and nan */
+    if (!(rm_abs_f32(x) <= RM_TRIG_MAX_F32)) {
+        *s = sinf(x);
+        *c = cosf(x);
+        return;
+    }
+
+    r  = rm_trig_reduce_f32(x, &q);
+    ks = rm_sin_kernel_f32(r);
+    kc = rm_cos_kernel_f32(r);
+
+    *s = (q & 1) ? kc : ks;
+    *c = (q & 1) ? ks : kc;
+
+    if (q & 2) { *s = -*s; }
+    if ((q + 1) & 2) { *c = -*c; }
 }
 
 #endif /* _RANMATH_F32_H_ */
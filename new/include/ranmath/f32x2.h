@@ -234,20 +234,26 @@ rm_distance_f32x2(const f32x2 a, const f32x2 b) {
 RM_INLINE f32x2
 rm_rotate_origin_f32x2(const f32x2 v, const f32 a) {
     f32x2 tmp, tmp1;
+    f32 s, c;
 
-    tmp  = rm_muls_f32x2(v, rm_cos_f32(a));
-    tmp1 = rm_muls_f32x2(v, rm_sin_f32(a));
+    rm_sincos_f32(a, &s, &c);
+
+    tmp  = rm_muls_f32x2(v, c);
+    tmp1 = rm_muls_f32x2(v, s);
 
     return rm_f32x2(tmp.x - tmp1.y, tmp1.x + tmp.y);
 }
 RM_INLINE f32x2
 rm_rotate_point_f32x2(const f32x2 v, const f32x2 p, const f32 a) {
     f32x2 tmp, tmp1, tmp2;
+    f32 s, c;
+
+    rm_sincos_f32(a, &s, &c);
 
     tmp = rm_f32x2(v.x - p.x, p.y - v.y);
 
-    tmp1 = rm_muls_f32x2(tmp, rm_cos_f32(a));
-    tmp2 = rm_muls_f32x2(tmp, rm_sin_f32(a));
+    tmp1 = rm_muls_f32x2(tmp, c);
+    tmp2 = rm_muls_f32x2(tmp, s);
 
     return rm_f32x2(p.x + (tmp1.x - tmp2.y), p.y - (tmp2.x + tmp1.y));
 }
@@ -298,4 +298,23 @@ struct f64_cvt_t {
 #define RM_DEG2RAD_F32  ((f32)RM_DEG2RAD_F64)
 #define RM_RAD2DEG_F32  ((f32)RM_RAD2DEG_F64)
 
+/*
+ * pi/2 split into 4 parts for the cody-waite range reduction in sin/cos.
+ * A, B and C have at most 12 significant bits so k * part is exact for the
+ * k's we get below RM_TRIG_MAX_F32, above that we let libm do the work.
+ */
+#define RM_PI_2_A_F32   0x1.92p+0f
+#define RM_PI_2_B_F32   0x1.fb4p-12f
+#define RM_PI_2_C_F32   0x1.444p-24f
+#define RM_PI_2_D_F32   0x1.68c234p-39f
+#define RM_TRIG_MAX_F32 8192.0f
+
+/* minimax polynomials for sin and cos on [-pi/4, pi/4], from cephes */
+#define RM_SIN_P0_F32 -1.6666654611e-1f
+#define RM_SIN_P1_F32 8.3321608736e-3f
+#define RM_SIN_P2_F32 -1.9515295891e-4f
+#define RM_COS_P0_F32 4.166664568298827e-2f
+#define RM_COS_P1_F32 -1.388731625493765e-3f
+#define RM_COS_P2_F32 2.443315711809948e-5f
+
 #endif /* _RANMATH_TYPES_H_ */
@@ -41,13 +41,13 @@
 
 #define RM_ARCH_X86 (1 << 0)
 /* 32-bit arm and 64-bit arm, RM_ARCH_ARM is for either */
-#define RM_ARCH_AARCH32 (1 << 0)
-#define RM_ARCH_AARCH64 (1 << 1)
+#define RM_ARCH_AARCH32 (1 << 1)
+#define RM_ARCH_AARCH64 (1 << 2)
 #if defined(__x86_64__) || defined(_M_X64) || defined(__amd64__) ||            \
     defined(_M_AMD64) || defined(__i386__) || defined(_M_IX86)
 #define RM_ARCH RM_ARCH_X86
 #elif defined(__aarch64__) || defined(_M_ARM64)
-#define RM_ARCH_ARM RM_ARCH_AARCH64 | RM_ARCH_AARCH32
+#define RM_ARCH_ARM (RM_ARCH_AARCH64 | RM_ARCH_AARCH32)
 #define RM_ARCH     RM_ARCH_ARM
 #elif defined(__arm__) || defined(_M_ARM)
 #define RM_ARCH_ARM RM_ARCH_AARCH32
@@ -104,6 +104,13 @@
 #endif
 #endif /* AVX2 INTRINSICS */
 
+/* msvc has no fma macro but every avx2 target has fma */
+#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+#if !defined(RM_FMA)
+#define RM_FMA 1
+#endif
+#endif /* FMA INTRINSICS */
+
 #if defined(__AVX__) || defined(RM_AVX2)
 #if !defined(RM_AVX)
 #define RM_AVX 1
@@ -157,8 +164,57 @@
 #endif
 #endif /* NEON INTRINSICS */
 #endif /* ARM SIMD INTRINSICS */
+
+/*
+ * the f32x4 paths are written against the rmm_* layer, which needs sse2 on
+ * x86 and the a64 additions (vdivq, vsqrtq, vaddvq) on arm
+ */
+#if defined(RM_SSE2) || (defined(RM_NEON) && (RM_ARCH_ARM & RM_ARCH_AARCH64))
+#if !defined(RM_SIMD_F32X4)
+#define RM_SIMD_F32X4 1
+#endif
+#endif /* F32X4 SIMD LAYER */
 #endif /* NO INTRINSICS */
 
+/*
+ * precision of sqrt, rsqrt, sin, cos, sincos, tan, exp, exp2, log and log2
+ * for every width, define one of these before the include:
+ *
+ * RM_PRECISION_FAST, the plain names go to the _fast variants and
+ * RM_FAST_RSQRT is turned on. max error for f32 is 4.5 ulp for sqrt and
+ * rsqrt, 4 ulp for tan, 2.5 ulp for sin and cos, 3 ulp for exp and exp2 and
+ * 2 ulp for log and log2. for f64 it is 1.5 ulp for sin and cos and 3 ulp
+ * for tan. the _fast functions say which inputs they do not handle, the
+ * plain sin, cos, sincos and tan still hand |x| > RM_TRIG_MAX to libm. for
+ * the plain names nan and inf give what libm gives in every tier.
+ *
+ * RM_PRECISION_DEFAULT (the default), the polynomials in this file. max
+ * error for f32 is 2.5 ulp for sin and cos, 1.5 ulp for rsqrt, exp2 and
+ * log2 and 1 ulp for the rest, for f64 it is 1 ulp, 1.5 ulp for rsqrt and
+ * exp2. rsqrt is 1 / sqrt(x), which rounds twice.
+ *
+ * RM_PRECISION_EXACT, libm, lane by lane for the vectors.
+ *
+ * the _fast variants are there no matter which one is picked. f64 only has
+ * faster sin, cos and tan, its other _fast variants are the default ones.
+ */
+#if defined(RM_PRECISION_FAST) + defined(RM_PRECISION_DEFAULT) +              \
+        defined(RM_PRECISION_EXACT) >                                          \
+    1
+#error define at most one RM_PRECISION_* tier
+#endif
+#if defined(RM_PRECISION_FAST)
+#if !defined(RM_FAST_RSQRT)
+#define RM_FAST_RSQRT 1
+#endif
+#elif defined(RM_PRECISION_EXACT)
+#if defined(RM_FAST_RSQRT)
+#error RM_FAST_RSQRT and RM_PRECISION_EXACT do not go together
+#endif
+#elif !defined(RM_PRECISION_DEFAULT)
+#define RM_PRECISION_DEFAULT 1
+#endif /* PRECISION TIER */
+
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -193,6 +249,15 @@
 #endif /* ARM INTRINSICS */
 #endif /* NO INTRINSICS */
 
+/* only for the cpuid probe used by the runtime dispatch */
+#if RM_ARCH == RM_ARCH_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
 #define RM_INLINE static inline
 
 #if !defined(RM_UNALIGNED)
@@ -355,6 +420,14 @@ typedef struct f64x3x4_t f64x3x4;
 typedef struct f64x4x2_t f64x4x2;
 typedef struct f64x4x3_t f64x4x3;
 typedef struct f64x4x4_t f64x4x4;
+typedef struct quatf32_t quatf32;
+typedef struct quatf64_t quatf64;
+typedef struct aabbf32_t aabbf32;
+typedef struct rayf32_t rayf32;
+typedef struct ray_packetf32_t ray_packetf32;
+typedef struct f32x3_soa_t f32x3_soa;
+typedef struct f32x4_soa_t f32x4_soa;
+typedef struct u8x4_soa_t  u8x4_soa;
 
 struct f32_cvt_t {
     union {
@@ -2004,6 +2077,78 @@ struct f64x4x4_t {
         f64 raw[4][4];
     };
 };
+/* x, y, z is the vector part and w the scalar, same layout as f32x4 */
+struct quatf32_t {
+    union {
+        struct {
+            f32 x, y, z, w;
+        };
+        struct {
+            f32x3 xyz;
+            f32 _0;
+        };
+
+        f32x4 v;
+        f32 raw[4];
+    };
+};
+struct quatf64_t {
+    union {
+        struct {
+            f64 x, y, z, w;
+        };
+        struct {
+            f64x3 xyz;
+            f64 _0;
+        };
+
+        f64x4 v;
+        f64 raw[4];
+    };
+};
+/* axis aligned box, min <= max on every axis unless it is empty */
+struct aabbf32_t {
+    union {
+        struct {
+            f32x3 min, max;
+        };
+        f32 raw[6];
+    };
+};
+/* the slab tests want 1 / direction, a zero component gives an infinity */
+struct rayf32_t {
+    f32x3 origin, inv_dir;
+    f32 tmin, tmax;
+};
+/* RM_RAY_PACKET rays as structure of arrays, filled by rm_set_ray_packetf32 */
+#define RM_RAY_PACKET 8
+struct ray_packetf32_t {
+    f32 ox[RM_RAY_PACKET], oy[RM_RAY_PACKET], oz[RM_RAY_PACKET];
+    f32 ix[RM_RAY_PACKET], iy[RM_RAY_PACKET], iz[RM_RAY_PACKET];
+    f32 tmin[RM_RAY_PACKET], tmax[RM_RAY_PACKET];
+};
+
+/*
+ * structure of arrays view over n f32x3, the arrays are owned by the caller
+ * and element i is (x[i], y[i], z[i])
+ */
+struct f32x3_soa_t {
+    f32 *x;
+    f32 *y;
+    f32 *z;
+};
+struct f32x4_soa_t {
+    f32 *x;
+    f32 *y;
+    f32 *z;
+    f32 *w;
+};
+struct u8x4_soa_t {
+    u8 *x;
+    u8 *y;
+    u8 *z;
+    u8 *w;
+};
 
 #define f32_as_u32(_x)        (((f32_cvt) {.f = (_x)}).u)
 #define f64_as_u64(_x)        (((f64_cvt) {.f = (_x)}).u)
@@ -2230,6 +2375,22 @@ struct f64x4x4_t {
     ((f64x4) {.x = (_x), .y = (_v).x, .z = (_v).y, .w = (_v).z})
 #define rm_f64x4v3s(_v, _w)                                                    \
     ((f64x4) {.x = (_v).x, .y = (_v).y, .z = (_v).z, .w = (_w)})
+#define rm_f32x3_soa(_x, _y, _z)                                               \
+    ((f32x3_soa) {.x = (_x), .y = (_y), .z = (_z)})
+#define rm_f32x4_soa(_x, _y, _z, _w)                                           \
+    ((f32x4_soa) {.x = (_x), .y = (_y), .z = (_z), .w = (_w)})
+#define rm_u8x4_soa(_x, _y, _z, _w)                                            \
+    ((u8x4_soa) {.x = (_x), .y = (_y), .z = (_z), .w = (_w)})
+#define rm_quatf32(_x, _y, _z, _w)                                             \
+    ((quatf32) {.x = (_x), .y = (_y), .z = (_z), .w = (_w)})
+#define rm_quatf32v(_v) ((quatf32) {.v = (_v)})
+#define rm_quatf64(_x, _y, _z, _w)                                             \
+    ((quatf64) {.x = (_x), .y = (_y), .z = (_z), .w = (_w)})
+#define rm_quatf64v(_v) ((quatf64) {.v = (_v)})
+#define rm_aabbf32(_min, _max) ((aabbf32) {.min = (_min), .max = (_max)})
+#define rm_rayf32(_o, _inv, _tmin, _tmax)                                      \
+    ((rayf32) {                                                                \
+        .origin = (_o), .inv_dir = (_inv), .tmin = (_tmin), .tmax = (_tmax)})
 #define rm_splat2(_v) (_v).x, (_v).y
 #define rm_splat3(_v) (_v).x, (_v).y, (_v).z
 #define rm_splat4(_v) (_v).x, (_v).y, (_v).z, (_v).w
@@ -2282,6 +2443,142 @@ struct f64x4x4_t {
 #define RM_DEG2RAD_F32  ((f32)RM_DEG2RAD_F64)
 #define RM_RAD2DEG_F32  ((f32)RM_RAD2DEG_F64)
 
+/*
+ * pi/2 split into 4 parts for the cody-waite range reduction in sin/cos.
+ * A, B and C have at most 12 significant bits so k * part is exact for the
+ * k's we get below RM_TRIG_MAX_F32, above that we let libm do the work.
+ */
+#define RM_PI_2_A_F32   0x1.92p+0f
+#define RM_PI_2_B_F32   0x1.fb4p-12f
+#define RM_PI_2_C_F32   0x1.444p-24f
+#define RM_PI_2_D_F32   0x1.68c234p-39f
+#define RM_TRIG_MAX_F32 8192.0f
+
+/* minimax polynomials for sin and cos on [-pi/4, pi/4], from cephes */
+#define RM_SIN_P0_F32 -1.6666654611e-1f
+#define RM_SIN_P1_F32 8.3321608736e-3f
+#define RM_SIN_P2_F32 -1.9515295891e-4f
+#define RM_COS_P0_F32 4.166664568298827e-2f
+#define RM_COS_P1_F32 -1.388731625493765e-3f
+#define RM_COS_P2_F32 2.443315711809948e-5f
+
+/* minimax polynomial for asin on [0, 0.5], from cephes */
+#define RM_ASIN_P0_F32 1.6666752422e-1f
+#define RM_ASIN_P1_F32 7.4953002686e-2f
+#define RM_ASIN_P2_F32 4.5470025998e-2f
+#define RM_ASIN_P3_F32 2.4181311049e-2f
+#define RM_ASIN_P4_F32 4.2163199048e-2f
+
+/*
+ * same idea for f64 with the 33 bit parts of pi/2 from fdlibm, B_T is the
+ * tail after A and B. two rounds are enough for |x| <= RM_TRIG_MAX_F64
+ */
+#define RM_PI_2_A_F64   1.57079632673412561417e+00
+#define RM_PI_2_B_F64   6.07710050630396597660e-11
+#define RM_PI_2_BT_F64  2.02226624879595063154e-21
+#define RM_TRIG_MAX_F64 1048576.0
+
+/* polynomials for sin and cos on [-pi/4, pi/4], from fdlibm */
+#define RM_SIN_P0_F64 -1.66666666666666324348e-01
+#define RM_SIN_P1_F64 8.33333333332248946124e-03
+#define RM_SIN_P2_F64 -1.98412698298579493134e-04
+#define RM_SIN_P3_F64 2.75573137070700676789e-06
+#define RM_SIN_P4_F64 -2.50507602534068634195e-08
+#define RM_SIN_P5_F64 1.58969099521155010221e-10
+#define RM_COS_P0_F64 4.16666666666666019037e-02
+#define RM_COS_P1_F64 -1.38888888888741095749e-03
+#define RM_COS_P2_F64 2.48015872894767294178e-05
+#define RM_COS_P3_F64 -2.75573143513906633035e-07
+#define RM_COS_P4_F64 2.08757232129817482790e-09
+#define RM_COS_P5_F64 -1.13596475577881948265e-11
+
+/*
+ * exp and log for f32 from cephes, ln2 = C1 + C2 with C1 short enough that
+ * k * C1 is exact. the exp inputs are clamped to where the result is still
+ * finite and nonzero, the clamp takes care of overflow and underflow
+ */
+#define RM_LN2_C1_F32   0.693359375f
+#define RM_LN2_C2_F32   -2.12194440e-4f
+#define RM_EXP_MIN_F32  -104.0f
+#define RM_EXP_MAX_F32  89.0f
+#define RM_EXP2_MIN_F32 -151.0f
+#define RM_EXP2_MAX_F32 129.0f
+#define RM_LOG2EA_F32   0.44269504088896340736f
+
+/* exp(r) = 1 + r + r^2 * P(r) on [-ln2/2, ln2/2] */
+#define RM_EXP_P0_F32 5.0000001201e-1f
+#define RM_EXP_P1_F32 1.6666665459e-1f
+#define RM_EXP_P2_F32 4.1665795894e-2f
+#define RM_EXP_P3_F32 8.3334519073e-3f
+#define RM_EXP_P4_F32 1.3981999507e-3f
+#define RM_EXP_P5_F32 1.9875691500e-4f
+/* 2^r = 1 + r * P(r) on [-1/2, 1/2] */
+#define RM_EXP2_P0_F32 6.931472028550421e-1f
+#define RM_EXP2_P1_F32 2.402264791363012e-1f
+#define RM_EXP2_P2_F32 5.550332471162809e-2f
+#define RM_EXP2_P3_F32 9.618437357674640e-3f
+#define RM_EXP2_P4_F32 1.339887440266574e-3f
+#define RM_EXP2_P5_F32 1.535336188319500e-4f
+/* log(1 + f) = f - f^2 / 2 + f^3 * P(f) on [sqrt(1/2) - 1, sqrt(2) - 1] */
+#define RM_LOG_P0_F32 3.3333331174e-1f
+#define RM_LOG_P1_F32 -2.4999993993e-1f
+#define RM_LOG_P2_F32 2.0000714765e-1f
+#define RM_LOG_P3_F32 -1.6668057665e-1f
+#define RM_LOG_P4_F32 1.4249322787e-1f
+#define RM_LOG_P5_F32 -1.2420140846e-1f
+#define RM_LOG_P6_F32 1.1676998740e-1f
+#define RM_LOG_P7_F32 -1.1514610310e-1f
+#define RM_LOG_P8_F32 7.0376836292e-2f
+
+/*
+ * the _fast versions, exp drops to degree 5 and log to degree 9. the
+ * polynomials are minimax for the relative error on the same intervals,
+ * the clamps are the ones above
+ */
+
+#define RM_EXP_FAST_P0_F32  4.9998995662e-1f
+#define RM_EXP_FAST_P1_F32  1.6666522622e-1f
+#define RM_EXP_FAST_P2_F32  4.1917528957e-2f
+#define RM_EXP_FAST_P3_F32  8.3691505715e-3f
+#define RM_EXP2_FAST_P0_F32 6.9314700365e-1f
+#define RM_EXP2_FAST_P1_F32 2.4022242427e-1f
+#define RM_EXP2_FAST_P2_F32 5.5507335812e-2f
+#define RM_EXP2_FAST_P3_F32 9.6715129912e-3f
+#define RM_EXP2_FAST_P4_F32 1.3264727313e-3f
+#define RM_LOG_FAST_P0_F32  3.3333909512e-1f
+#define RM_LOG_FAST_P1_F32  -2.5001338124e-1f
+#define RM_LOG_FAST_P2_F32  1.9963063300e-1f
+#define RM_LOG_FAST_P3_F32  -1.6577585042e-1f
+#define RM_LOG_FAST_P4_F32  1.4914767444e-1f
+#define RM_LOG_FAST_P5_F32  -1.4267486334e-1f
+#define RM_LOG_FAST_P6_F32  8.7004363537e-2f
+
+/*
+ * exp and log for f64 from fdlibm, LN2_HI has 32 trailing zero bits so
+ * k * LN2_HI is exact. same clamping as for f32
+ */
+#define RM_LN2_HI_F64   6.93147180369123816490e-01
+#define RM_LN2_LO_F64   1.90821492927058770002e-10
+#define RM_LOG2E_HI_F64 1.44269504072144627571e+00
+#define RM_LOG2E_LO_F64 1.67517131648865118353e-10
+#define RM_EXP_MIN_F64  -746.0
+#define RM_EXP_MAX_F64  710.0
+#define RM_EXP2_MIN_F64 -1076.0
+#define RM_EXP2_MAX_F64 1025.0
+
+#define RM_EXP_P1_F64 1.66666666666666019037e-01
+#define RM_EXP_P2_F64 -2.77777777770155933842e-03
+#define RM_EXP_P3_F64 6.61375632143793436117e-05
+#define RM_EXP_P4_F64 -1.65339022054652515390e-06
+#define RM_EXP_P5_F64 4.13813679705723846039e-08
+#define RM_LOG_P1_F64 6.666666666666735130e-01
+#define RM_LOG_P2_F64 3.999999999940941908e-01
+#define RM_LOG_P3_F64 2.857142874366239149e-01
+#define RM_LOG_P4_F64 2.222219843214978396e-01
+#define RM_LOG_P5_F64 1.818357216161805012e-01
+#define RM_LOG_P6_F64 1.531383769920937332e-01
+#define RM_LOG_P7_F64 1.479819860511658591e-01
+
 #define RM_ABS(_x)                 (((_x) < 0) ? -(_x) : (_x))
 #define RM_MIN(_a, _b)             (((_a) < (_b)) ? (_a) : (_b))
 #define RM_MAX(_a, _b)             (((_a) > (_b)) ? (_a) : (_b))
@@ -2289,7 +2586,7 @@ struct f64x4x4_t {
 #define RM_CLAMP(_val, _min, _max) (RM_MIN(RM_MAX((_val), (_min)), (_max)))
 
 #if !defined(RM_NO_INTRINSICS)
-#if defined(RM_ARCH_X86)
+#if RM_ARCH == RM_ARCH_X86 && defined(RM_SSE)
 
 #if !defined(RM_UNALIGNED)
 #define rmm_load(_v) _mm_load_ps((_v))
@@ -2303,6 +2600,43 @@ struct f64x4x4_t {
     _mm_shuffle_ps((xmm), (xmm), _MM_SHUFFLE((z), (y), (x), (w)))
 #define rmm_splat(v, lane) rmm_shuff1((v), (lane), (lane), (lane), (lane))
 
+/* the register type and ops that the neon backend provides as well */
+typedef __m128 rmv_f32x4;
+
+#define rmm_loadu(_v) _mm_loadu_ps((_v))
+#define rmm_storeu(_a, _b) _mm_storeu_ps((_a), _b);
+#define rmm_set1(_s) _mm_set1_ps((_s))
+#define rmm_setr(_x, _y, _z, _w) _mm_setr_ps((_x), (_y), (_z), (_w))
+#define rmm_setzero() _mm_setzero_ps()
+#define rmm_cvtf32(_v) _mm_cvtss_f32((_v))
+
+#define rmm_add(_a, _b) _mm_add_ps((_a), (_b))
+#define rmm_sub(_a, _b) _mm_sub_ps((_a), (_b))
+#define rmm_mul(_a, _b) _mm_mul_ps((_a), (_b))
+#define rmm_div(_a, _b) _mm_div_ps((_a), (_b))
+#define rmm_min(_a, _b) _mm_min_ps((_a), (_b))
+#define rmm_max(_a, _b) _mm_max_ps((_a), (_b))
+#define rmm_sqrt(_v) _mm_sqrt_ps((_v))
+#define rmm_and(_a, _b) _mm_and_ps((_a), (_b))
+#define rmm_or(_a, _b) _mm_or_ps((_a), (_b))
+#define rmm_not(_v)                                                            \
+    _mm_xor_ps((_v), _mm_cmpeq_ps(_mm_setzero_ps(), _mm_setzero_ps()))
+#define rmm_any(_v) (_mm_movemask_ps((_v)) != 0)
+#define rmm_all(_v) (_mm_movemask_ps((_v)) == 0xF)
+/* bit i is set when lane i of the mask is */
+#define rmm_movemask(_v) _mm_movemask_ps((_v))
+/* [a[x], a[y], b[z], b[w]], the lanes have to be constants */
+#define rmm_shuffle(_a, _b, _x, _y, _z, _w)                                    \
+    _mm_shuffle_ps((_a), (_b), _MM_SHUFFLE((_w), (_z), (_y), (_x)))
+#define rmm_swizzle(_v, _x, _y, _z, _w) rmm_shuffle((_v), (_v), _x, _y, _z, _w)
+
+#define rmm_cmpeq(_a, _b) _mm_cmpeq_ps((_a), (_b))
+#define rmm_cmpneq(_a, _b) _mm_cmpneq_ps((_a), (_b))
+#define rmm_cmplt(_a, _b) _mm_cmplt_ps((_a), (_b))
+#define rmm_cmple(_a, _b) _mm_cmple_ps((_a), (_b))
+#define rmm_cmpgt(_a, _b) _mm_cmpgt_ps((_a), (_b))
+#define rmm_cmpge(_a, _b) _mm_cmpge_ps((_a), (_b))
+
 #if defined(RM_SSE2)
 #define RMM_SIGNMASK_NEG_F32X4 _mm_castsi128_ps(_mm_set1_epi32(0x80000000))
 #else
@@ -2313,6 +2647,16 @@ RM_INLINE __m128
 rmm_abs(__m128 v) {
     return _mm_andnot_ps(RMM_SIGNMASK_NEG_F32X4, v);
 }
+RM_INLINE __m128
+rmm_neg(__m128 v) {
+    return _mm_xor_ps(v, RMM_SIGNMASK_NEG_F32X4);
+}
+RM_INLINE boolx4
+rmm_boolx4(__m128 mask) {
+    i32 m;
+    m = _mm_movemask_ps(mask);
+    return rm_boolx4(m & 1, (m >> 1) & 1, (m >> 2) & 1, (m >> 3) & 1);
+}
 
 RM_INLINE __m128
 rmm_vhmax(__m128 v) {
@@ -2380,7388 +2724,16239 @@ rmm_norm_inf(__m128 a) {
 
 RM_INLINE __m128
 rmm_fmadd(__m128 a, __m128 b, __m128 c) {
-#if defined(RM_AVX2)
+#if defined(RM_FMA)
     return _mm_fmadd_ps(a, b, c);
 #else
     return _mm_add_ps(_mm_mul_ps(a, b), c);
 #endif
 }
 
+/* same as _mm_blendv_ps, mask needs to be all ones or all zeros per lane */
+RM_INLINE __m128
+rmm_blendv(__m128 a, __m128 b, __m128 mask) {
+#if defined(RM_SSE4_1)
+    return _mm_blendv_ps(a, b, mask);
+#else
+    return _mm_or_ps(_mm_andnot_ps(mask, a), _mm_and_ps(mask, b));
 #endif
-#endif
-
-// SCALARS
-RM_INLINE u8
-rm_min_u8(const u8 a, const u8 b) {
-    return RM_MIN(a, b);
 }
-RM_INLINE u16
-rm_min_u16(const u16 a, const u16 b) {
-    return RM_MIN(a, b);
+/* transposes the 4x4 block made up by the 4 registers in place */
+RM_INLINE void
+rmm_transpose(__m128 *c0, __m128 *c1, __m128 *c2, __m128 *c3) {
+    _MM_TRANSPOSE4_PS(*c0, *c1, *c2, *c3);
 }
-RM_INLINE u32
-rm_min_u32(const u32 a, const u32 b) {
-    return RM_MIN(a, b);
+/* splits 4 packed xyz triplets (12 floats) into x, y and z */
+RM_INLINE void
+rmm_load3(const f32 *p, __m128 *x, __m128 *y, __m128 *z) {
+    __m128 a, b, c;
+
+    a  = _mm_loadu_ps(p);     /* [x0, y0, z0, x1] */
+    b  = _mm_loadu_ps(p + 4); /* [y1, z1, x2, y2] */
+    c  = _mm_loadu_ps(p + 8); /* [z2, x3, y3, z3] */
+    *x = rmm_shuffle(a, rmm_shuffle(b, c, 2, 2, 1, 1), 0, 3, 0, 2);
+    *y = rmm_shuffle(rmm_shuffle(a, b, 1, 1, 0, 0),
+                     rmm_shuffle(b, c, 3, 3, 2, 2), 0, 2, 0, 2);
+    *z = rmm_shuffle(rmm_shuffle(a, b, 2, 2, 1, 1), c, 0, 2, 0, 3);
+}
+RM_INLINE void
+rmm_store3(f32 *p, __m128 x, __m128 y, __m128 z) {
+    _mm_storeu_ps(p, rmm_shuffle(rmm_shuffle(x, y, 0, 0, 0, 0),
+                                 rmm_shuffle(z, x, 0, 0, 1, 1), 0, 2, 0, 2));
+    _mm_storeu_ps(p + 4, rmm_shuffle(rmm_shuffle(y, z, 1, 1, 1, 1),
+                                     rmm_shuffle(x, y, 2, 2, 2, 2), 0, 2, 0,
+                                     2));
+    _mm_storeu_ps(p + 8, rmm_shuffle(rmm_shuffle(z, x, 2, 2, 3, 3),
+                                     rmm_shuffle(y, z, 3, 3, 3, 3), 0, 2, 0,
+                                     2));
+}
+/* splits 4 packed f32x4 (16 floats) into x, y, z and w */
+RM_INLINE void
+rmm_load4(const f32 *p, __m128 *x, __m128 *y, __m128 *z, __m128 *w) {
+    *x = _mm_loadu_ps(p);
+    *y = _mm_loadu_ps(p + 4);
+    *z = _mm_loadu_ps(p + 8);
+    *w = _mm_loadu_ps(p + 12);
+    rmm_transpose(x, y, z, w);
+}
+RM_INLINE void
+rmm_store4(f32 *p, __m128 x, __m128 y, __m128 z, __m128 w) {
+    rmm_transpose(&x, &y, &z, &w);
+    _mm_storeu_ps(p, x);
+    _mm_storeu_ps(p + 4, y);
+    _mm_storeu_ps(p + 8, z);
+    _mm_storeu_ps(p + 12, w);
 }
-RM_INLINE u64
-rm_min_u64(const u64 a, const u64 b) {
-    return RM_MIN(a, b);
+
+/*
+ * 1 / sqrt(v), the estimate is only good to 12 bits so one newton-raphson
+ * step brings it to ~22 bits. 0 and inf skip the step so they still give
+ * inf and 0 instead of nan. rsqrtps gives inf for subnormals, those are
+ * scaled by 2^24 first and the result by 2^12
+ */
+RM_INLINE __m128
+rmm_rsqrt(__m128 v) {
+    __m128 y, nr, special, tiny;
+
+    tiny = _mm_cmplt_ps(v, _mm_set1_ps(0x1p-126f));
+    v    = _mm_mul_ps(v, rmm_blendv(_mm_set1_ps(1.0f), _mm_set1_ps(0x1p24f),
+                                    tiny));
+    y    = _mm_rsqrt_ps(v);
+    nr   = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), v), _mm_mul_ps(y, y));
+    nr   = _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), nr));
+
+    special = _mm_or_ps(_mm_cmpeq_ps(v, _mm_setzero_ps()),
+                        _mm_cmpeq_ps(v, _mm_set1_ps(RM_INF_F32)));
+    return _mm_mul_ps(rmm_blendv(nr, y, special),
+                      rmm_blendv(_mm_set1_ps(1.0f), _mm_set1_ps(0x1p12f),
+                                 tiny));
 }
-RM_INLINE i8
-rm_min_i8(const i8 a, const i8 b) {
-    return RM_MIN(a, b);
+
+#if defined(RM_SSE2)
+/*
+ * without sse4.1 every |v| at or above 2^23 is kept, those are integral.
+ * the sign of v is put back on every result so -0 and (-1, 0) give -0 like
+ * _mm_round_ps does
+ */
+RM_INLINE __m128
+rmm_trunc(__m128 v) {
+#if defined(RM_SSE4_1)
+    return _mm_round_ps(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+#else
+    __m128 big, t;
+    big = _mm_cmpnlt_ps(rmm_abs(v), _mm_set1_ps(8388608.0f));
+    t   = rmm_blendv(_mm_cvtepi32_ps(_mm_cvttps_epi32(v)), v, big);
+    return _mm_or_ps(t, _mm_and_ps(v, RMM_SIGNMASK_NEG_F32X4));
+#endif
 }
-RM_INLINE i16
-rm_min_i16(const i16 a, const i16 b) {
-    return RM_MIN(a, b);
+RM_INLINE __m128
+rmm_floor(__m128 v) {
+#if defined(RM_SSE4_1)
+    return _mm_round_ps(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+#else
+    __m128 t;
+    t = rmm_trunc(v);
+    t = _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, v), _mm_set1_ps(1.0f)));
+    return _mm_or_ps(t, _mm_and_ps(v, RMM_SIGNMASK_NEG_F32X4));
+#endif
 }
-RM_INLINE i32
-rm_min_i32(const i32 a, const i32 b) {
-    return RM_MIN(a, b);
+RM_INLINE __m128
+rmm_ceil(__m128 v) {
+#if defined(RM_SSE4_1)
+    return _mm_round_ps(v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+#else
+    __m128 t;
+    t = rmm_trunc(v);
+    t = _mm_add_ps(t, _mm_and_ps(_mm_cmplt_ps(t, v), _mm_set1_ps(1.0f)));
+    return _mm_or_ps(t, _mm_and_ps(v, RMM_SIGNMASK_NEG_F32X4));
+#endif
 }
-RM_INLINE i64
-rm_min_i64(const i64 a, const i64 b) {
-    return RM_MIN(a, b);
+/* halfway cases away from zero, 0.49999997f is the f32 right below 0.5 */
+RM_INLINE __m128
+rmm_round(__m128 v) {
+    __m128 h;
+    h = _mm_or_ps(_mm_and_ps(v, RMM_SIGNMASK_NEG_F32X4),
+                  _mm_set1_ps(0.49999997f));
+    return rmm_trunc(_mm_add_ps(v, h));
 }
-RM_INLINE f32
-rm_min_f32(const f32 a, const f32 b) {
-    return RM_MIN(a, b);
+/*
+ * 2^k for integral k in [-126, 127]. k + 2^23 + 127 has k + 127 in the low
+ * mantissa bits and the shift drops everything above them
+ */
+RM_INLINE __m128
+rmm_pow2i(__m128 k) {
+    return _mm_castsi128_ps(_mm_slli_epi32(
+        _mm_castps_si128(_mm_add_ps(k, _mm_set1_ps(8388735.0f))), 23));
 }
-RM_INLINE f64
-rm_min_f64(const f64 a, const f64 b) {
-    return RM_MIN(a, b);
+/* the biased exponent of a positive v as a float, the reverse of the above */
+RM_INLINE __m128
+rmm_exponent(__m128 v) {
+    return _mm_sub_ps(
+        _mm_castsi128_ps(_mm_or_si128(_mm_srli_epi32(_mm_castps_si128(v), 23),
+                                      _mm_set1_epi32(0x4b000000))),
+        _mm_set1_ps(8388608.0f));
 }
-RM_INLINE u8
-rm_max_u8(const u8 a, const u8 b) {
-    return RM_MAX(a, b);
+/* the mantissa of v in [1, 2) */
+RM_INLINE __m128
+rmm_mantissa(__m128 v) {
+    return _mm_castsi128_ps(
+        _mm_or_si128(_mm_and_si128(_mm_castps_si128(v),
+                                   _mm_set1_epi32(0x007fffff)),
+                     _mm_set1_epi32(0x3f800000)));
 }
-RM_INLINE u16
-rm_max_u16(const u16 a, const u16 b) {
-    return RM_MAX(a, b);
+
+/* reduce v to [-pi/4, pi/4], q gets the quadrant */
+RM_INLINE __m128
+rmm_trig_reduce(__m128 v, __m128i *q) {
+    __m128 k, r;
+
+    *q = _mm_cvtps_epi32(_mm_mul_ps(v, _mm_set1_ps(RM_2_PI_F32)));
+    k  = _mm_cvtepi32_ps(*q);
+
+    r = _mm_sub_ps(v, _mm_mul_ps(k, _mm_set1_ps(RM_PI_2_A_F32)));
+    r = _mm_sub_ps(r, _mm_mul_ps(k, _mm_set1_ps(RM_PI_2_B_F32)));
+    r = _mm_sub_ps(r, _mm_mul_ps(k, _mm_set1_ps(RM_PI_2_C_F32)));
+    return _mm_sub_ps(r, _mm_mul_ps(k, _mm_set1_ps(RM_PI_2_D_F32)));
 }
-RM_INLINE u32
-rm_max_u32(const u32 a, const u32 b) {
-    return RM_MAX(a, b);
+RM_INLINE __m128
+rmm_sin_kernel(__m128 r) {
+    __m128 z, y;
+
+    z = _mm_mul_ps(r, r);
+    y = rmm_fmadd(z, _mm_set1_ps(RM_SIN_P2_F32), _mm_set1_ps(RM_SIN_P1_F32));
+    y = rmm_fmadd(z, y, _mm_set1_ps(RM_SIN_P0_F32));
+    y = rmm_fmadd(_mm_mul_ps(z, r), y, r);
+
+    /* same as rm_sin_kernel_f32, -0 stays -0 */
+    return _mm_or_ps(y, _mm_and_ps(r, RMM_SIGNMASK_NEG_F32X4));
 }
-RM_INLINE u64
-rm_max_u64(const u64 a, const u64 b) {
-    return RM_MAX(a, b);
+RM_INLINE __m128
+rmm_cos_kernel(__m128 r) {
+    __m128 z, y;
+
+    z = _mm_mul_ps(r, r);
+    y = rmm_fmadd(z, _mm_set1_ps(RM_COS_P2_F32), _mm_set1_ps(RM_COS_P1_F32));
+    y = rmm_fmadd(z, y, _mm_set1_ps(RM_COS_P0_F32));
+    y = _mm_mul_ps(_mm_mul_ps(z, z), y);
+    return _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f),
+                                 _mm_mul_ps(z, _mm_set1_ps(0.5f))),
+                      y);
+}
+/* picks sin or cos of r and its sign from the quadrant */
+RM_INLINE __m128
+rmm_trig_select(__m128 r, __m128i q) {
+    __m128 y, swap, sign;
+
+    swap = _mm_castsi128_ps(
+        _mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)),
+                        _mm_set1_epi32(1)));
+    sign = _mm_castsi128_ps(
+        _mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30));
+
+    y = rmm_blendv(rmm_sin_kernel(r), rmm_cos_kernel(r), swap);
+    return _mm_xor_ps(y, sign);
 }
-RM_INLINE i8
-rm_max_i8(const i8 a, const i8 b) {
-    return RM_MAX(a, b);
+/*
+ * max error is 2.5 ulp for |x| <= RM_TRIG_MAX_F32, lanes above that
+ * (and inf/nan) are rare enough to just hand over to libm
+ */
+RM_INLINE __m128
+rmm_sin(__m128 v) {
+    __m128 r, y;
+    __m128i q;
+    f32 tv[4], ty[4];
+    int big, i;
+
+    r = rmm_trig_reduce(v, &q);
+    y = rmm_trig_select(r, q);
+
+    big = _mm_movemask_ps(
+        _mm_cmpnle_ps(rmm_abs(v), _mm_set1_ps(RM_TRIG_MAX_F32)));
+    if (big) {
+        _mm_storeu_ps(tv, v);
+        _mm_storeu_ps(ty, y);
+        for (i = 0; i < 4; ++i) {
+            if (big & (1 << i)) { ty[i] = sinf(tv[i]); }
+        }
+        y = _mm_loadu_ps(ty);
+    }
+
+    return y;
 }
-RM_INLINE i16
-rm_max_i16(const i16 a, const i16 b) {
-    return RM_MAX(a, b);
+RM_INLINE __m128
+rmm_cos(__m128 v) {
+    __m128 r, y;
+    __m128i q;
+    f32 tv[4], ty[4];
+    int big, i;
+
+    r = rmm_trig_reduce(v, &q);
+    y = rmm_trig_select(r, _mm_add_epi32(q, _mm_set1_epi32(1)));
+
+    big = _mm_movemask_ps(
+        _mm_cmpnle_ps(rmm_abs(v), _mm_set1_ps(RM_TRIG_MAX_F32)));
+    if (big) {
+        _mm_storeu_ps(tv, v);
+        _mm_storeu_ps(ty, y);
+        for (i = 0; i < 4; ++i) {
+            if (big & (1 << i)) { ty[i] = cosf(tv[i]); }
+        }
+        y = _mm_loadu_ps(ty);
+    }
+
+    return y;
 }
-RM_INLINE i32
-rm_max_i32(const i32 a, const i32 b) {
-    return RM_MAX(a, b);
+/*
+ * the _fast versions never go to libm, lanes above RM_TRIG_MAX_F32 get
+ * whatever the reduction gives
+ */
+RM_INLINE __m128
+rmm_sin_fast(__m128 v) {
+    __m128i q;
+    __m128 r;
+
+    r = rmm_trig_reduce(v, &q);
+    return rmm_trig_select(r, q);
 }
-RM_INLINE i64
-rm_max_i64(const i64 a, const i64 b) {
-    return RM_MAX(a, b);
+RM_INLINE __m128
+rmm_cos_fast(__m128 v) {
+    __m128i q;
+    __m128 r;
+
+    r = rmm_trig_reduce(v, &q);
+    return rmm_trig_select(r, _mm_add_epi32(q, _mm_set1_epi32(1)));
 }
-RM_INLINE f32
-rm_max_f32(const f32 a, const f32 b) {
-    return RM_MAX(a, b);
+RM_INLINE void
+rmm_sincos_fast(__m128 v, __m128 *s, __m128 *c) {
+    __m128 r, ks, kc, swap;
+    __m128i q;
+
+    r  = rmm_trig_reduce(v, &q);
+    ks = rmm_sin_kernel(r);
+    kc = rmm_cos_kernel(r);
+
+    swap = _mm_castsi128_ps(
+        _mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)),
+                        _mm_set1_epi32(1)));
+
+    *s = _mm_xor_ps(rmm_blendv(ks, kc, swap),
+                    _mm_castsi128_ps(_mm_slli_epi32(
+                        _mm_and_si128(q, _mm_set1_epi32(2)), 30)));
+    *c = _mm_xor_ps(
+        rmm_blendv(kc, ks, swap),
+        _mm_castsi128_ps(_mm_slli_epi32(
+            _mm_and_si128(_mm_add_epi32(q, _mm_set1_epi32(1)),
+                          _mm_set1_epi32(2)),
+            30)));
+}
+/* sin and cos with a single range reduction */
+RM_INLINE void
+rmm_sincos(__m128 v, __m128 *s, __m128 *c) {
+    __m128 r, ks, kc, swap;
+    __m128i q;
+    f32 tv[4], ts[4], tc[4];
+    int big, i;
+
+    r  = rmm_trig_reduce(v, &q);
+    ks = rmm_sin_kernel(r);
+    kc = rmm_cos_kernel(r);
+
+    swap = _mm_castsi128_ps(
+        _mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)),
+                        _mm_set1_epi32(1)));
+
+    *s = _mm_xor_ps(rmm_blendv(ks, kc, swap),
+                    _mm_castsi128_ps(_mm_slli_epi32(
+                        _mm_and_si128(q, _mm_set1_epi32(2)), 30)));
+    *c = _mm_xor_ps(
+        rmm_blendv(kc, ks, swap),
+        _mm_castsi128_ps(_mm_slli_epi32(
+            _mm_and_si128(_mm_add_epi32(q, _mm_set1_epi32(1)),
+                          _mm_set1_epi32(2)),
+            30)));
+
+    big = _mm_movemask_ps(
+        _mm_cmpnle_ps(rmm_abs(v), _mm_set1_ps(RM_TRIG_MAX_F32)));
+    if (big) {
+        _mm_storeu_ps(tv, v);
+        _mm_storeu_ps(ts, *s);
+        _mm_storeu_ps(tc, *c);
+        for (i = 0; i < 4; ++i) {
+            if (big & (1 << i)) {
+                ts[i] = sinf(tv[i]);
+                tc[i] = cosf(tv[i]);
+            }
+        }
+        *s = _mm_loadu_ps(ts);
+        *c = _mm_loadu_ps(tc);
+    }
 }
-RM_INLINE f64
-rm_max_f64(const f64 a, const f64 b) {
-    return RM_MAX(a, b);
+#endif
+
+#if defined(RM_SSE2)
+/* f64x2 is only 8 byte aligned so the 128 bit helpers never assume more */
+#define rmmd_load(_v) _mm_loadu_pd((_v))
+#define rmmd_store(_a, _b) _mm_storeu_pd((_a), _b);
+
+#define RMMD_SIGNMASK_NEG_F64X2 _mm_set1_pd(-0.0)
+
+RM_INLINE __m128d
+rmmd_abs(__m128d v) {
+    return _mm_andnot_pd(RMMD_SIGNMASK_NEG_F64X2, v);
 }
-RM_INLINE u8
-rm_clamp_u8(const u8 val, const u8 min, const u8 max) {
-    return RM_CLAMP(val, min, max);
+RM_INLINE boolx2
+rmmd_boolx2(__m128d mask) {
+    i32 m;
+    m = _mm_movemask_pd(mask);
+    return rm_boolx2(m & 1, (m >> 1) & 1);
 }
-RM_INLINE u16
-rm_clamp_u16(const u16 val, const u16 min, const u16 max) {
-    return RM_CLAMP(val, min, max);
+
+RM_INLINE __m128d
+rmmd_vhmin(__m128d v) {
+    return _mm_min_sd(v, _mm_unpackhi_pd(v, v));
 }
-RM_INLINE u32
-rm_clamp_u32(const u32 val, const u32 min, const u32 max) {
-    return RM_CLAMP(val, min, max);
+RM_INLINE __m128d
+rmmd_vhmax(__m128d v) {
+    return _mm_max_sd(v, _mm_unpackhi_pd(v, v));
 }
-RM_INLINE u64
-rm_clamp_u64(const u64 val, const u64 min, const u64 max) {
-    return RM_CLAMP(val, min, max);
+RM_INLINE __m128d
+rmmd_vhadds(__m128d v) {
+    return _mm_add_sd(v, _mm_unpackhi_pd(v, v));
 }
-RM_INLINE i8
-rm_clamp_i8(const i8 val, const i8 min, const i8 max) {
-    return RM_CLAMP(val, min, max);
+RM_INLINE f64
+rmmd_hadd(__m128d v) {
+    return _mm_cvtsd_f64(rmmd_vhadds(v));
 }
-RM_INLINE i16
-rm_clamp_i16(const i16 val, const i16 min, const i16 max) {
-    return RM_CLAMP(val, min, max);
+
+RM_INLINE __m128d
+rmmd_vdots(__m128d a, __m128d b) {
+#if defined(RM_SSE4_1)
+    return _mm_dp_pd(a, b, 0x33);
+#else
+    __m128d x0;
+    x0 = _mm_mul_pd(a, b);
+    return _mm_add_pd(x0, _mm_shuffle_pd(x0, x0, 1));
+#endif
 }
-RM_INLINE i32
-rm_clamp_i32(const i32 val, const i32 min, const i32 max) {
-    return RM_CLAMP(val, min, max);
+RM_INLINE f64
+rmmd_dot(__m128d a, __m128d b) {
+    return _mm_cvtsd_f64(rmmd_vhadds(_mm_mul_pd(a, b)));
 }
-RM_INLINE i64
-rm_clamp_i64(const i64 val, const i64 min, const i64 max) {
-    return RM_CLAMP(val, min, max);
-}
-RM_INLINE f32
-rm_clamp_f32(const f32 val, const f32 min, const f32 max) {
-    return RM_CLAMP(val, min, max);
+RM_INLINE f64
+rmmd_norm2(__m128d v) {
+    return _mm_cvtsd_f64(rmmd_vhadds(_mm_mul_pd(v, v)));
 }
 RM_INLINE f64
-rm_clamp_f64(const f64 val, const f64 min, const f64 max) {
-    return RM_CLAMP(val, min, max);
+rmmd_norm(__m128d v) {
+    __m128d x0;
+    x0 = rmmd_vhadds(_mm_mul_pd(v, v));
+    return _mm_cvtsd_f64(_mm_sqrt_sd(x0, x0));
 }
-RM_INLINE f32
-rm_trunc_f32(const f32 x) {
-    return (i32)x;
+RM_INLINE f64
+rmmd_norm_one(__m128d v) {
+    return _mm_cvtsd_f64(rmmd_vhadds(rmmd_abs(v)));
 }
 RM_INLINE f64
-rm_trunc_f64(const f64 x) {
-    return (i64)x;
+rmmd_norm_inf(__m128d v) {
+    return _mm_cvtsd_f64(rmmd_vhmax(rmmd_abs(v)));
 }
-RM_INLINE u8
-rm_mod_u8(const u8 a, const u8 b) {
-    return a % b;
+
+RM_INLINE __m128d
+rmmd_fmadd(__m128d a, __m128d b, __m128d c) {
+#if defined(RM_FMA)
+    return _mm_fmadd_pd(a, b, c);
+#else
+    return _mm_add_pd(_mm_mul_pd(a, b), c);
+#endif
 }
-RM_INLINE u16
-rm_mod_u16(const u16 a, const u16 b) {
-    return a % b;
+
+/*
+ * without sse4.1 |v| is rounded through 2^52 and fixed up towards zero,
+ * every |v| at or above 2^52 is kept, those are integral
+ */
+RM_INLINE __m128d
+rmmd_trunc(__m128d v) {
+#if defined(RM_SSE4_1)
+    return _mm_round_pd(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+#else
+    __m128d a, r, big, magic;
+
+    magic = _mm_set1_pd(4503599627370496.0);
+    a     = rmmd_abs(v);
+    r     = _mm_sub_pd(_mm_add_pd(a, magic), magic);
+    r     = _mm_sub_pd(r, _mm_and_pd(_mm_cmpgt_pd(r, a), _mm_set1_pd(1.0)));
+    r     = _mm_or_pd(r, _mm_and_pd(v, RMMD_SIGNMASK_NEG_F64X2));
+    big   = _mm_cmpnlt_pd(a, magic);
+    return _mm_or_pd(_mm_and_pd(big, v), _mm_andnot_pd(big, r));
+#endif
 }
-RM_INLINE u32
-rm_mod_u32(const u32 a, const u32 b) {
-    return a % b;
+RM_INLINE __m128d
+rmmd_floor(__m128d v) {
+#if defined(RM_SSE4_1)
+    return _mm_round_pd(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+#else
+    __m128d t;
+    t = rmmd_trunc(v);
+    t = _mm_sub_pd(t, _mm_and_pd(_mm_cmpgt_pd(t, v), _mm_set1_pd(1.0)));
+    return _mm_or_pd(t, _mm_and_pd(v, RMMD_SIGNMASK_NEG_F64X2));
+#endif
 }
-RM_INLINE u64
-rm_mod_u64(const u64 a, const u64 b) {
-    return a % b;
+RM_INLINE __m128d
+rmmd_ceil(__m128d v) {
+#if defined(RM_SSE4_1)
+    return _mm_round_pd(v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+#else
+    __m128d t;
+    t = rmmd_trunc(v);
+    t = _mm_add_pd(t, _mm_and_pd(_mm_cmplt_pd(t, v), _mm_set1_pd(1.0)));
+    return _mm_or_pd(t, _mm_and_pd(v, RMMD_SIGNMASK_NEG_F64X2));
+#endif
 }
-RM_INLINE i8
-rm_mod_i8(const i8 a, const i8 b) {
-    return a % b;
+/* halfway cases away from zero, the constant is the f64 right below 0.5 */
+RM_INLINE __m128d
+rmmd_round(__m128d v) {
+    __m128d h;
+    h = _mm_or_pd(_mm_and_pd(v, RMMD_SIGNMASK_NEG_F64X2),
+                  _mm_set1_pd(0.49999999999999994));
+    return rmmd_trunc(_mm_add_pd(v, h));
 }
-RM_INLINE i16
-rm_mod_i16(const i16 a, const i16 b) {
-    return a % b;
+RM_INLINE __m128d
+rmmd_blendv(__m128d a, __m128d b, __m128d mask) {
+#if defined(RM_SSE4_1)
+    return _mm_blendv_pd(a, b, mask);
+#else
+    return _mm_or_pd(_mm_andnot_pd(mask, a), _mm_and_pd(mask, b));
+#endif
 }
-RM_INLINE i32
-rm_mod_i32(const i32 a, const i32 b) {
-    return a % b;
+/* same as rmm_pow2i for k in [-1022, 1023] */
+RM_INLINE __m128d
+rmmd_pow2i(__m128d k) {
+    return _mm_castsi128_pd(_mm_slli_epi64(
+        _mm_castpd_si128(_mm_add_pd(k, _mm_set1_pd(4503599627371519.0))),
+        52));
+}
+RM_INLINE __m128d
+rmmd_exponent(__m128d v) {
+    return _mm_sub_pd(
+        _mm_castsi128_pd(
+            _mm_or_si128(_mm_srli_epi64(_mm_castpd_si128(v), 52),
+                         _mm_set1_epi64x(0x4330000000000000))),
+        _mm_set1_pd(4503599627370496.0));
+}
+RM_INLINE __m128d
+rmmd_mantissa(__m128d v) {
+    return _mm_castsi128_pd(
+        _mm_or_si128(_mm_and_si128(_mm_castpd_si128(v),
+                                   _mm_set1_epi64x(0x000fffffffffffff)),
+                     _mm_set1_epi64x(0x3ff0000000000000)));
+}
+RM_INLINE __m128d
+rmmd_exp_scale(__m128d v, __m128d k) {
+    __m128d k1;
+    k1 = rmmd_trunc(_mm_mul_pd(k, _mm_set1_pd(0.5)));
+    return _mm_mul_pd(_mm_mul_pd(v, rmmd_pow2i(k1)),
+                      rmmd_pow2i(_mm_sub_pd(k, k1)));
+}
+/* exp(hi - lo) for |hi - lo| <= ln2 / 2, same as rm_exp_kernel_f64 */
+RM_INLINE __m128d
+rmmd_exp_kernel(__m128d hi, __m128d lo) {
+    __m128d r, t, c;
+
+    r = _mm_sub_pd(hi, lo);
+    t = _mm_mul_pd(r, r);
+    c = rmmd_fmadd(t, _mm_set1_pd(RM_EXP_P5_F64), _mm_set1_pd(RM_EXP_P4_F64));
+    c = rmmd_fmadd(t, c, _mm_set1_pd(RM_EXP_P3_F64));
+    c = rmmd_fmadd(t, c, _mm_set1_pd(RM_EXP_P2_F64));
+    c = rmmd_fmadd(t, c, _mm_set1_pd(RM_EXP_P1_F64));
+    c = _mm_sub_pd(r, _mm_mul_pd(t, c));
+
+    c = _mm_div_pd(_mm_mul_pd(r, c), _mm_sub_pd(_mm_set1_pd(2.0), c));
+    return _mm_sub_pd(_mm_set1_pd(1.0),
+                      _mm_sub_pd(_mm_sub_pd(lo, c), hi));
 }
-RM_INLINE i64
-rm_mod_i64(const i64 a, const i64 b) {
-    return a % b;
+RM_INLINE __m128d
+rmmd_exp(__m128d v) {
+    __m128d x, k, hi, lo;
+
+    x  = _mm_min_pd(_mm_max_pd(v, _mm_set1_pd(RM_EXP_MIN_F64)),
+                    _mm_set1_pd(RM_EXP_MAX_F64));
+    k  = rmmd_round(_mm_mul_pd(x, _mm_set1_pd(RM_LOG2E_F64)));
+    hi = _mm_sub_pd(x, _mm_mul_pd(k, _mm_set1_pd(RM_LN2_HI_F64)));
+    lo = _mm_mul_pd(k, _mm_set1_pd(RM_LN2_LO_F64));
+
+    return rmmd_blendv(rmmd_exp_scale(rmmd_exp_kernel(hi, lo), k), v,
+                       _mm_cmpunord_pd(v, v));
 }
-RM_INLINE f32
-rm_mod_f32(const f32 a, const f32 b) {
-    return a - (rm_trunc_f32(a / b) * b);
+RM_INLINE __m128d
+rmmd_exp2(__m128d v) {
+    __m128d x, k, hi;
+
+    x  = _mm_min_pd(_mm_max_pd(v, _mm_set1_pd(RM_EXP2_MIN_F64)),
+                    _mm_set1_pd(RM_EXP2_MAX_F64));
+    k  = rmmd_round(x);
+    hi = _mm_mul_pd(_mm_sub_pd(x, k), _mm_set1_pd(RM_LN2_F64));
+
+    return rmmd_blendv(
+        rmmd_exp_scale(rmmd_exp_kernel(hi, _mm_setzero_pd()), k), v,
+        _mm_cmpunord_pd(v, v));
+}
+/* same as rmm_log_reduce, subnormals are scaled up by 2^54 */
+RM_INLINE __m128d
+rmmd_log_reduce(__m128d v, __m128d *e) {
+    __m128d sub, m, big;
+
+    sub = _mm_cmplt_pd(v, _mm_set1_pd(0x1p-1022));
+    v   = rmmd_blendv(v, _mm_mul_pd(v, _mm_set1_pd(0x1p54)), sub);
+    *e  = _mm_sub_pd(rmmd_exponent(v),
+                     _mm_add_pd(_mm_set1_pd(1023.0),
+                                _mm_and_pd(sub, _mm_set1_pd(54.0))));
+
+    m   = rmmd_mantissa(v);
+    big = _mm_cmpgt_pd(m, _mm_set1_pd(RM_SQRT2_F64));
+    m   = rmmd_blendv(m, _mm_mul_pd(m, _mm_set1_pd(0.5)), big);
+    *e  = _mm_add_pd(*e, _mm_and_pd(big, _mm_set1_pd(1.0)));
+    return _mm_sub_pd(m, _mm_set1_pd(1.0));
+}
+/* same as rm_log_kernel_f64 */
+RM_INLINE __m128d
+rmmd_log_kernel(__m128d f, __m128d hfsq) {
+    __m128d s, z, w, t1, t2;
+
+    s  = _mm_div_pd(f, _mm_add_pd(f, _mm_set1_pd(2.0)));
+    z  = _mm_mul_pd(s, s);
+    w  = _mm_mul_pd(z, z);
+    t1 = rmmd_fmadd(w, _mm_set1_pd(RM_LOG_P6_F64), _mm_set1_pd(RM_LOG_P4_F64));
+    t1 = rmmd_fmadd(w, t1, _mm_set1_pd(RM_LOG_P2_F64));
+    t1 = _mm_mul_pd(w, t1);
+    t2 = rmmd_fmadd(w, _mm_set1_pd(RM_LOG_P7_F64), _mm_set1_pd(RM_LOG_P5_F64));
+    t2 = rmmd_fmadd(w, t2, _mm_set1_pd(RM_LOG_P3_F64));
+    t2 = rmmd_fmadd(w, t2, _mm_set1_pd(RM_LOG_P1_F64));
+    t2 = _mm_mul_pd(z, t2);
+    return _mm_mul_pd(s, _mm_add_pd(hfsq, _mm_add_pd(t1, t2)));
+}
+RM_INLINE __m128d
+rmmd_log_special(__m128d v, __m128d y) {
+    y = rmmd_blendv(y, _mm_set1_pd(-RM_INF_F64),
+                    _mm_cmpeq_pd(v, _mm_setzero_pd()));
+    y = rmmd_blendv(y, v, _mm_cmpeq_pd(v, _mm_set1_pd(RM_INF_F64)));
+    return rmmd_blendv(y, _mm_set1_pd(RM_NAN_F64),
+                       _mm_cmpnge_pd(v, _mm_setzero_pd()));
+}
+RM_INLINE __m128d
+rmmd_log(__m128d v) {
+    __m128d f, e, hfsq, y;
+
+    f    = rmmd_log_reduce(v, &e);
+    hfsq = _mm_mul_pd(_mm_mul_pd(f, f), _mm_set1_pd(0.5));
+    y    = rmmd_log_kernel(f, hfsq);
+    y    = _mm_add_pd(y, _mm_mul_pd(e, _mm_set1_pd(RM_LN2_LO_F64)));
+    y    = _mm_sub_pd(_mm_sub_pd(hfsq, y), f);
+    y    = _mm_sub_pd(_mm_mul_pd(e, _mm_set1_pd(RM_LN2_HI_F64)), y);
+    return rmmd_log_special(v, y);
+}
+/* same as rm_log2_f64 */
+RM_INLINE __m128d
+rmmd_log2(__m128d v) {
+    __m128d f, e, hfsq, r, hi, lo, vh, vl, w;
+
+    f    = rmmd_log_reduce(v, &e);
+    hfsq = _mm_mul_pd(_mm_mul_pd(f, f), _mm_set1_pd(0.5));
+    r    = rmmd_log_kernel(f, hfsq);
+
+    hi = _mm_and_pd(_mm_sub_pd(f, hfsq),
+                    _mm_castsi128_pd(_mm_set1_epi64x(-4294967296)));
+    lo = _mm_add_pd(_mm_sub_pd(_mm_sub_pd(f, hi), hfsq), r);
+    vh = _mm_mul_pd(hi, _mm_set1_pd(RM_LOG2E_HI_F64));
+    vl = _mm_mul_pd(_mm_add_pd(lo, hi), _mm_set1_pd(RM_LOG2E_LO_F64));
+    vl = _mm_add_pd(vl, _mm_mul_pd(lo, _mm_set1_pd(RM_LOG2E_HI_F64)));
+
+    w  = _mm_add_pd(e, vh);
+    vl = _mm_add_pd(vl, _mm_add_pd(_mm_sub_pd(e, w), vh));
+    return rmmd_log_special(v, _mm_add_pd(vl, w));
 }
-RM_INLINE f64
-rm_mod_f64(const f64 a, const f64 b) {
-    return a - (rm_trunc_f64(a / b) * b);
+#endif
+
+#if defined(RM_SSE2)
+/* i16x4 lives in the low 64 bits and u8x4 in the low 32 bits */
+#define rmmi_load(_v) _mm_loadu_si128((const __m128i *)(_v))
+#define rmmi_store(_a, _b) _mm_storeu_si128((__m128i *)(_a), _b);
+#define rmmi_loadl(_v) _mm_loadl_epi64((const __m128i *)(_v))
+#define rmmi_storel(_a, _b) _mm_storel_epi64((__m128i *)(_a), _b);
+
+RM_INLINE __m128i
+rmmi_from_u8x4(const u8x4 v) {
+    return _mm_cvtsi32_si128((i32)((u32)v.x | (u32)v.y << 8 |
+                                   (u32)v.z << 16 | (u32)v.w << 24));
 }
-RM_INLINE i8
-rm_abs_i8(const i8 x) {
-    return RM_ABS(x);
+RM_INLINE u8x4
+rmmi_to_u8x4(__m128i v) {
+    u32 bits;
+    bits = (u32)_mm_cvtsi128_si32(v);
+    return rm_u8x4(bits & 0xFF, (bits >> 8) & 0xFF, (bits >> 16) & 0xFF,
+                   bits >> 24);
 }
-RM_INLINE i16
-rm_abs_i16(const i16 x) {
-    return RM_ABS(x);
+/* step is the lane width in bytes */
+RM_INLINE boolx4
+rmmi_boolx4(__m128i mask, const i32 step) {
+    i32 m;
+    m = _mm_movemask_epi8(mask);
+    return rm_boolx4(m & 1, (m >> step) & 1, (m >> (2 * step)) & 1,
+                     (m >> (3 * step)) & 1);
 }
-RM_INLINE i32
-rm_abs_i32(const i32 x) {
-    return RM_ABS(x);
+RM_INLINE __m128i
+rmmi_not(__m128i v) {
+    return _mm_xor_si128(v, _mm_set1_epi32(-1));
 }
-RM_INLINE i64
-rm_abs_i64(const i64 x) {
-    return RM_ABS(x);
+
+RM_INLINE __m128i
+rmmi_mullo_epi32(__m128i a, __m128i b) {
+#if defined(RM_SSE4_1)
+    return _mm_mullo_epi32(a, b);
+#else
+    __m128i even, odd;
+    even = _mm_mul_epu32(a, b); /* [0, _, 2, _] */
+    odd  = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
 }
-RM_INLINE f32
-rm_abs_f32(const f32 x) {
-    return RM_ABS(x);
+/* only the low 8 lanes are multiplied, enough for u8x4 */
+RM_INLINE __m128i
+rmmi_mullo_epi8(__m128i a, __m128i b) {
+    __m128i zero, x0;
+    zero = _mm_setzero_si128();
+    x0   = _mm_mullo_epi16(_mm_unpacklo_epi8(a, zero),
+                           _mm_unpacklo_epi8(b, zero));
+    return _mm_packus_epi16(_mm_and_si128(x0, _mm_set1_epi16(0xFF)), zero);
+}
+RM_INLINE __m128i
+rmmi_min_epi32(__m128i a, __m128i b) {
+#if defined(RM_SSE4_1)
+    return _mm_min_epi32(a, b);
+#else
+    __m128i mask;
+    mask = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(mask, b), _mm_andnot_si128(mask, a));
+#endif
 }
-RM_INLINE f64
-rm_abs_f64(const f64 x) {
-    return RM_ABS(x);
+RM_INLINE __m128i
+rmmi_max_epi32(__m128i a, __m128i b) {
+#if defined(RM_SSE4_1)
+    return _mm_max_epi32(a, b);
+#else
+    __m128i mask;
+    mask = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+#endif
 }
-RM_INLINE i8
-rm_sign_i8(const i8 x) {
-    return (x > 0) - (x < 0);
+/* sse2 only compares signed, flipping the sign bit maps unsigned onto it */
+#define RMMI_SIGNBIAS_EPI32 _mm_set1_epi32((i32)0x80000000)
+RM_INLINE __m128i
+rmmi_min_epu32(__m128i a, __m128i b) {
+#if defined(RM_SSE4_1)
+    return _mm_min_epu32(a, b);
+#else
+    return _mm_xor_si128(rmmi_min_epi32(_mm_xor_si128(a, RMMI_SIGNBIAS_EPI32),
+                                        _mm_xor_si128(b, RMMI_SIGNBIAS_EPI32)),
+                         RMMI_SIGNBIAS_EPI32);
+#endif
 }
-RM_INLINE i16
-rm_sign_i16(const i16 x) {
-    return (x > 0) - (x < 0);
+RM_INLINE __m128i
+rmmi_max_epu32(__m128i a, __m128i b) {
+#if defined(RM_SSE4_1)
+    return _mm_max_epu32(a, b);
+#else
+    return _mm_xor_si128(rmmi_max_epi32(_mm_xor_si128(a, RMMI_SIGNBIAS_EPI32),
+                                        _mm_xor_si128(b, RMMI_SIGNBIAS_EPI32)),
+                         RMMI_SIGNBIAS_EPI32);
+#endif
 }
-RM_INLINE i32
-rm_sign_i32(const i32 x) {
-    return (x > 0) - (x < 0);
+RM_INLINE __m128i
+rmmi_cmplt_epu32(__m128i a, __m128i b) {
+    return _mm_cmplt_epi32(_mm_xor_si128(a, RMMI_SIGNBIAS_EPI32),
+                           _mm_xor_si128(b, RMMI_SIGNBIAS_EPI32));
 }
-RM_INLINE i64
-rm_sign_i64(const i64 x) {
-    return (x > 0) - (x < 0);
+RM_INLINE __m128i
+rmmi_cmpgt_epu32(__m128i a, __m128i b) {
+    return _mm_cmpgt_epi32(_mm_xor_si128(a, RMMI_SIGNBIAS_EPI32),
+                           _mm_xor_si128(b, RMMI_SIGNBIAS_EPI32));
 }
-RM_INLINE f32
-rm_sign_f32(const f32 x) {
-    return (x > 0) - (x < 0);
+RM_INLINE __m128i
+rmmi_abs_epi32(__m128i v) {
+#if defined(RM_SSSE3)
+    return _mm_abs_epi32(v);
+#else
+    __m128i sign;
+    sign = _mm_srai_epi32(v, 31);
+    return _mm_sub_epi32(_mm_xor_si128(v, sign), sign);
+#endif
 }
-RM_INLINE f64
-rm_sign_f64(const f64 x) {
-    return (x > 0) - (x < 0);
+RM_INLINE __m128i
+rmmi_abs_epi16(__m128i v) {
+#if defined(RM_SSSE3)
+    return _mm_abs_epi16(v);
+#else
+    return _mm_max_epi16(v, _mm_sub_epi16(_mm_setzero_si128(), v));
+#endif
 }
-RM_INLINE i8
-rm_copysign_i8(const i8 x, const i8 s) {
-    return rm_abs_i8(x) * rm_sign_i8(s);
+/* narrows the 32 bit lanes of a, b, c and d to 16 bytes, lanes must be u8 */
+RM_INLINE __m128i
+rmmi_pack4_u8(__m128i a, __m128i b, __m128i c, __m128i d) {
+    return _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
 }
-RM_INLINE i16
-rm_copysign_i16(const i16 x, const i16 s) {
-    return rm_abs_i16(x) * rm_sign_i16(s);
+/* splits 16 packed u8x4 (64 bytes) into x, y, z and w */
+RM_INLINE void
+rmmi_load4_u8(const u8 *p, __m128i *x, __m128i *y, __m128i *z, __m128i *w) {
+    __m128i a, b, c, d, m;
+
+    a = rmmi_load(p);
+    b = rmmi_load(p + 16);
+    c = rmmi_load(p + 32);
+    d = rmmi_load(p + 48);
+    m = _mm_set1_epi32(0xFF);
+
+    *x = rmmi_pack4_u8(_mm_and_si128(a, m), _mm_and_si128(b, m),
+                       _mm_and_si128(c, m), _mm_and_si128(d, m));
+    a  = _mm_srli_epi32(a, 8);
+    b  = _mm_srli_epi32(b, 8);
+    c  = _mm_srli_epi32(c, 8);
+    d  = _mm_srli_epi32(d, 8);
+    *y = rmmi_pack4_u8(_mm_and_si128(a, m), _mm_and_si128(b, m),
+                       _mm_and_si128(c, m), _mm_and_si128(d, m));
+    a  = _mm_srli_epi32(a, 8);
+    b  = _mm_srli_epi32(b, 8);
+    c  = _mm_srli_epi32(c, 8);
+    d  = _mm_srli_epi32(d, 8);
+    *z = rmmi_pack4_u8(_mm_and_si128(a, m), _mm_and_si128(b, m),
+                       _mm_and_si128(c, m), _mm_and_si128(d, m));
+    *w = rmmi_pack4_u8(_mm_srli_epi32(a, 8), _mm_srli_epi32(b, 8),
+                       _mm_srli_epi32(c, 8), _mm_srli_epi32(d, 8));
+}
+RM_INLINE void
+rmmi_store4_u8(u8 *p, __m128i x, __m128i y, __m128i z, __m128i w) {
+    __m128i xy, zw;
+
+    xy = _mm_unpacklo_epi8(x, y);
+    zw = _mm_unpacklo_epi8(z, w);
+    rmmi_store(p, _mm_unpacklo_epi16(xy, zw));
+    rmmi_store(p + 16, _mm_unpackhi_epi16(xy, zw));
+    xy = _mm_unpackhi_epi8(x, y);
+    zw = _mm_unpackhi_epi8(z, w);
+    rmmi_store(p + 32, _mm_unpacklo_epi16(xy, zw));
+    rmmi_store(p + 48, _mm_unpackhi_epi16(xy, zw));
 }
-RM_INLINE i32
-rm_copysign_i32(const i32 x, const i32 s) {
-    return rm_abs_i32(x) * rm_sign_i32(s);
+#endif
+
+#if defined(RM_AVX)
+/* f64x4 is only 8 byte aligned so the 256 bit helpers never assume more */
+#define rmm256d_load(_v) _mm256_loadu_pd((_v))
+#define rmm256d_store(_a, _b) _mm256_storeu_pd((_a), _b);
+
+#define RMM256D_SIGNMASK_NEG_F64X4 _mm256_set1_pd(-0.0)
+
+RM_INLINE __m256d
+rmm256d_abs(__m256d v) {
+    return _mm256_andnot_pd(RMM256D_SIGNMASK_NEG_F64X4, v);
 }
-RM_INLINE i64
-rm_copysign_i64(const i64 x, const i64 s) {
-    return rm_abs_i64(x) * rm_sign_i64(s);
+RM_INLINE boolx4
+rmm256d_boolx4(__m256d mask) {
+    i32 m;
+    m = _mm256_movemask_pd(mask);
+    return rm_boolx4(m & 1, (m >> 1) & 1, (m >> 2) & 1, (m >> 3) & 1);
 }
-RM_INLINE f32
-rm_copysign_f32(const f32 x, const f32 s) {
-    return rm_abs_f32(x) * rm_sign_f32(s);
+
+RM_INLINE __m128d
+rmm256d_vhmin(__m256d v) {
+    __m128d x0;
+    x0 = _mm_min_pd(_mm256_castpd256_pd128(v),
+                    _mm256_extractf128_pd(v, 1)); /* [0|2, 1|3] */
+    return _mm_min_sd(x0, _mm_unpackhi_pd(x0, x0));
+}
+RM_INLINE __m128d
+rmm256d_vhmax(__m256d v) {
+    __m128d x0;
+    x0 = _mm_max_pd(_mm256_castpd256_pd128(v),
+                    _mm256_extractf128_pd(v, 1)); /* [0|2, 1|3] */
+    return _mm_max_sd(x0, _mm_unpackhi_pd(x0, x0));
+}
+RM_INLINE __m128d
+rmm256d_vhadds(__m256d v) {
+    __m128d x0;
+    x0 = _mm_add_pd(_mm256_castpd256_pd128(v),
+                    _mm256_extractf128_pd(v, 1)); /* [0+2, 1+3] */
+    return _mm_add_sd(x0, _mm_unpackhi_pd(x0, x0));
 }
 RM_INLINE f64
-rm_copysign_f64(const f64 x, const f64 s) {
-    return rm_abs_f64(x) * rm_sign_f64(s);
+rmm256d_hadd(__m256d v) {
+    return _mm_cvtsd_f64(rmm256d_vhadds(v));
 }
-RM_INLINE f32
-rm_floor_f32(const f32 x) {
-    return (x < 0) ? rm_trunc_f32(x - 1) : rm_trunc_f32(x);
+
+RM_INLINE __m256d
+rmm256d_vdots(__m256d a, __m256d b) {
+    __m256d x0;
+    x0 = _mm256_mul_pd(a, b);
+    x0 = _mm256_add_pd(x0, _mm256_permute2f128_pd(x0, x0, 1));
+    return _mm256_add_pd(x0, _mm256_permute_pd(x0, 0x5));
 }
 RM_INLINE f64
-rm_floor_f64(const f64 x) {
-    return (x < 0) ? rm_trunc_f64(x - 1) : rm_trunc_f64(x);
+rmm256d_dot(__m256d a, __m256d b) {
+    return _mm_cvtsd_f64(rmm256d_vhadds(_mm256_mul_pd(a, b)));
 }
-RM_INLINE f32
-rm_ceil_f32(const f32 x) {
-    return (x < 0) ? rm_trunc_f32(x) : rm_trunc_f32(x + 1);
+RM_INLINE f64
+rmm256d_norm2(__m256d v) {
+    return _mm_cvtsd_f64(rmm256d_vhadds(_mm256_mul_pd(v, v)));
 }
 RM_INLINE f64
-rm_ceil_f64(const f64 x) {
-    return (x < 0) ? rm_trunc_f64(x) : rm_trunc_f64(x + 1);
+rmm256d_norm(__m256d v) {
+    __m128d x0;
+    x0 = rmm256d_vhadds(_mm256_mul_pd(v, v));
+    return _mm_cvtsd_f64(_mm_sqrt_sd(x0, x0));
 }
-RM_INLINE f32
-rm_round_f32(const f32 x) {
-    f32 t;
-
-    if (x < 0) {
-        t = rm_floor_f32(-x);
-        return ((t + x) <= -0.5F) ? -(t + 1) : -t;
-    }
-
-    t = rm_floor_f32(x);
-    return ((t - x) <= -0.5F) ? (t + 1) : t;
+RM_INLINE f64
+rmm256d_norm_one(__m256d v) {
+    return _mm_cvtsd_f64(rmm256d_vhadds(rmm256d_abs(v)));
 }
 RM_INLINE f64
-rm_round_f64(const f64 x) {
-    f64 t;
+rmm256d_norm_inf(__m256d v) {
+    return _mm_cvtsd_f64(rmm256d_vhmax(rmm256d_abs(v)));
+}
 
-    if (x < 0) {
-        t = rm_floor_f64(-x);
-        return ((t + x) <= -0.5) ? -(t + 1) : -t;
-    }
+RM_INLINE __m256d
+rmm256d_fmadd(__m256d a, __m256d b, __m256d c) {
+#if defined(RM_FMA)
+    return _mm256_fmadd_pd(a, b, c);
+#else
+    return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+}
 
-    t = rm_floor_f64(x);
-    return ((t - x) <= -0.5) ? (t + 1) : t;
+#define rmm256d_trunc(_v)                                                      \
+    _mm256_round_pd((_v), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)
+#define rmm256d_floor(_v)                                                      \
+    _mm256_round_pd((_v), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)
+#define rmm256d_ceil(_v)                                                       \
+    _mm256_round_pd((_v), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC)
+/* same as rmmd_round */
+RM_INLINE __m256d
+rmm256d_round(__m256d v) {
+    __m256d h;
+    h = _mm256_or_pd(_mm256_and_pd(v, _mm256_set1_pd(-0.0)),
+                     _mm256_set1_pd(0.49999999999999994));
+    return rmm256d_trunc(_mm256_add_pd(v, h));
 }
-RM_INLINE f32
-rm_fract_f32(const f32 x) {
-    return x - rm_floor_f32(x);
+/*
+ * same as the rmmd versions. avx has no 256 bit integer shifts so without
+ * avx2 the two halves go through sse2
+ */
+RM_INLINE __m256d
+rmm256d_pow2i(__m256d k) {
+#if defined(RM_AVX2)
+    return _mm256_castsi256_pd(_mm256_slli_epi64(
+        _mm256_castpd_si256(
+            _mm256_add_pd(k, _mm256_set1_pd(4503599627371519.0))),
+        52));
+#else
+    return _mm256_insertf128_pd(
+        _mm256_castpd128_pd256(rmmd_pow2i(_mm256_castpd256_pd128(k))),
+        rmmd_pow2i(_mm256_extractf128_pd(k, 1)), 1);
+#endif
 }
-RM_INLINE f64
-rm_fract_f64(const f64 x) {
-    return x - rm_floor_f64(x);
+RM_INLINE __m256d
+rmm256d_exponent(__m256d v) {
+#if defined(RM_AVX2)
+    return _mm256_sub_pd(
+        _mm256_castsi256_pd(
+            _mm256_or_si256(_mm256_srli_epi64(_mm256_castpd_si256(v), 52),
+                            _mm256_set1_epi64x(0x4330000000000000))),
+        _mm256_set1_pd(4503599627370496.0));
+#else
+    return _mm256_insertf128_pd(
+        _mm256_castpd128_pd256(rmmd_exponent(_mm256_castpd256_pd128(v))),
+        rmmd_exponent(_mm256_extractf128_pd(v, 1)), 1);
+#endif
 }
-RM_INLINE f32
-rm_deg2rad_f32(const f32 x) {
-    return x * RM_DEG2RAD_F32;
+RM_INLINE __m256d
+rmm256d_mantissa(__m256d v) {
+    return _mm256_or_pd(
+        _mm256_and_pd(v, _mm256_castsi256_pd(
+                             _mm256_set1_epi64x(0x000fffffffffffff))),
+        _mm256_set1_pd(1.0));
+}
+RM_INLINE __m256d
+rmm256d_exp_scale(__m256d v, __m256d k) {
+    __m256d k1;
+    k1 = rmm256d_trunc(_mm256_mul_pd(k, _mm256_set1_pd(0.5)));
+    return _mm256_mul_pd(_mm256_mul_pd(v, rmm256d_pow2i(k1)),
+                         rmm256d_pow2i(_mm256_sub_pd(k, k1)));
+}
+RM_INLINE __m256d
+rmm256d_exp_kernel(__m256d hi, __m256d lo) {
+    __m256d r, t, c;
+
+    r = _mm256_sub_pd(hi, lo);
+    t = _mm256_mul_pd(r, r);
+    c = rmm256d_fmadd(t, _mm256_set1_pd(RM_EXP_P5_F64),
+                      _mm256_set1_pd(RM_EXP_P4_F64));
+    c = rmm256d_fmadd(t, c, _mm256_set1_pd(RM_EXP_P3_F64));
+    c = rmm256d_fmadd(t, c, _mm256_set1_pd(RM_EXP_P2_F64));
+    c = rmm256d_fmadd(t, c, _mm256_set1_pd(RM_EXP_P1_F64));
+    c = _mm256_sub_pd(r, _mm256_mul_pd(t, c));
+
+    c = _mm256_div_pd(_mm256_mul_pd(r, c),
+                      _mm256_sub_pd(_mm256_set1_pd(2.0), c));
+    return _mm256_sub_pd(_mm256_set1_pd(1.0),
+                         _mm256_sub_pd(_mm256_sub_pd(lo, c), hi));
+}
+RM_INLINE __m256d
+rmm256d_exp(__m256d v) {
+    __m256d x, k, hi, lo;
+
+    x  = _mm256_min_pd(_mm256_max_pd(v, _mm256_set1_pd(RM_EXP_MIN_F64)),
+                       _mm256_set1_pd(RM_EXP_MAX_F64));
+    k  = rmm256d_round(_mm256_mul_pd(x, _mm256_set1_pd(RM_LOG2E_F64)));
+    hi = _mm256_sub_pd(x, _mm256_mul_pd(k, _mm256_set1_pd(RM_LN2_HI_F64)));
+    lo = _mm256_mul_pd(k, _mm256_set1_pd(RM_LN2_LO_F64));
+
+    return _mm256_blendv_pd(rmm256d_exp_scale(rmm256d_exp_kernel(hi, lo), k),
+                            v, _mm256_cmp_pd(v, v, _CMP_UNORD_Q));
 }
-RM_INLINE f64
-rm_deg2rad_f64(const f64 x) {
-    return x * RM_DEG2RAD_F64;
+RM_INLINE __m256d
+rmm256d_exp2(__m256d v) {
+    __m256d x, k, hi;
+
+    x  = _mm256_min_pd(_mm256_max_pd(v, _mm256_set1_pd(RM_EXP2_MIN_F64)),
+                       _mm256_set1_pd(RM_EXP2_MAX_F64));
+    k  = rmm256d_round(x);
+    hi = _mm256_mul_pd(_mm256_sub_pd(x, k), _mm256_set1_pd(RM_LN2_F64));
+
+    return _mm256_blendv_pd(
+        rmm256d_exp_scale(rmm256d_exp_kernel(hi, _mm256_setzero_pd()), k), v,
+        _mm256_cmp_pd(v, v, _CMP_UNORD_Q));
 }
-RM_INLINE f32
-rm_rad2deg_f32(const f32 x) {
-    return x * RM_RAD2DEG_F32;
+RM_INLINE __m256d
+rmm256d_log_reduce(__m256d v, __m256d *e) {
+    __m256d sub, m, big;
+
+    sub = _mm256_cmp_pd(v, _mm256_set1_pd(0x1p-1022), _CMP_LT_OQ);
+    v   = _mm256_blendv_pd(v, _mm256_mul_pd(v, _mm256_set1_pd(0x1p54)), sub);
+    *e  = _mm256_sub_pd(
+        rmm256d_exponent(v),
+        _mm256_add_pd(_mm256_set1_pd(1023.0),
+                      _mm256_and_pd(sub, _mm256_set1_pd(54.0))));
+
+    m   = rmm256d_mantissa(v);
+    big = _mm256_cmp_pd(m, _mm256_set1_pd(RM_SQRT2_F64), _CMP_GT_OQ);
+    m   = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), big);
+    *e  = _mm256_add_pd(*e, _mm256_and_pd(big, _mm256_set1_pd(1.0)));
+    return _mm256_sub_pd(m, _mm256_set1_pd(1.0));
+}
+RM_INLINE __m256d
+rmm256d_log_kernel(__m256d f, __m256d hfsq) {
+    __m256d s, z, w, t1, t2;
+
+    s  = _mm256_div_pd(f, _mm256_add_pd(f, _mm256_set1_pd(2.0)));
+    z  = _mm256_mul_pd(s, s);
+    w  = _mm256_mul_pd(z, z);
+    t1 = rmm256d_fmadd(w, _mm256_set1_pd(RM_LOG_P6_F64),
+                       _mm256_set1_pd(RM_LOG_P4_F64));
+    t1 = rmm256d_fmadd(w, t1, _mm256_set1_pd(RM_LOG_P2_F64));
+    t1 = _mm256_mul_pd(w, t1);
+    t2 = rmm256d_fmadd(w, _mm256_set1_pd(RM_LOG_P7_F64),
+                       _mm256_set1_pd(RM_LOG_P5_F64));
+    t2 = rmm256d_fmadd(w, t2, _mm256_set1_pd(RM_LOG_P3_F64));
+    t2 = rmm256d_fmadd(w, t2, _mm256_set1_pd(RM_LOG_P1_F64));
+    t2 = _mm256_mul_pd(z, t2);
+    return _mm256_mul_pd(s, _mm256_add_pd(hfsq, _mm256_add_pd(t1, t2)));
+}
+RM_INLINE __m256d
+rmm256d_log_special(__m256d v, __m256d y) {
+    y = _mm256_blendv_pd(y, _mm256_set1_pd(-RM_INF_F64),
+                         _mm256_cmp_pd(v, _mm256_setzero_pd(), _CMP_EQ_OQ));
+    y = _mm256_blendv_pd(
+        y, v, _mm256_cmp_pd(v, _mm256_set1_pd(RM_INF_F64), _CMP_EQ_OQ));
+    return _mm256_blendv_pd(
+        y, _mm256_set1_pd(RM_NAN_F64),
+        _mm256_cmp_pd(v, _mm256_setzero_pd(), _CMP_NGE_UQ));
+}
+RM_INLINE __m256d
+rmm256d_log(__m256d v) {
+    __m256d f, e, hfsq, y;
+
+    f    = rmm256d_log_reduce(v, &e);
+    hfsq = _mm256_mul_pd(_mm256_mul_pd(f, f), _mm256_set1_pd(0.5));
+    y    = rmm256d_log_kernel(f, hfsq);
+    y    = _mm256_add_pd(y, _mm256_mul_pd(e, _mm256_set1_pd(RM_LN2_LO_F64)));
+    y    = _mm256_sub_pd(_mm256_sub_pd(hfsq, y), f);
+    y    = _mm256_sub_pd(_mm256_mul_pd(e, _mm256_set1_pd(RM_LN2_HI_F64)), y);
+    return rmm256d_log_special(v, y);
+}
+RM_INLINE __m256d
+rmm256d_log2(__m256d v) {
+    __m256d f, e, hfsq, r, hi, lo, vh, vl, w;
+
+    f    = rmm256d_log_reduce(v, &e);
+    hfsq = _mm256_mul_pd(_mm256_mul_pd(f, f), _mm256_set1_pd(0.5));
+    r    = rmm256d_log_kernel(f, hfsq);
+
+    hi = _mm256_and_pd(_mm256_sub_pd(f, hfsq),
+                       _mm256_castsi256_pd(_mm256_set1_epi64x(-4294967296)));
+    lo = _mm256_add_pd(_mm256_sub_pd(_mm256_sub_pd(f, hi), hfsq), r);
+    vh = _mm256_mul_pd(hi, _mm256_set1_pd(RM_LOG2E_HI_F64));
+    vl = _mm256_mul_pd(_mm256_add_pd(lo, hi), _mm256_set1_pd(RM_LOG2E_LO_F64));
+    vl = _mm256_add_pd(vl, _mm256_mul_pd(lo, _mm256_set1_pd(RM_LOG2E_HI_F64)));
+
+    w  = _mm256_add_pd(e, vh);
+    vl = _mm256_add_pd(vl, _mm256_add_pd(_mm256_sub_pd(e, w), vh));
+    return rmm256d_log_special(v, _mm256_add_pd(vl, w));
 }
-RM_INLINE f64
-rm_rad2deg_f64(const f64 x) {
-    return x * RM_RAD2DEG_F64;
+
+RM_INLINE __m256
+rmm256_fmadd(__m256 a, __m256 b, __m256 c) {
+#if defined(RM_FMA)
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
 }
-RM_INLINE f32
-rm_sqrt_f32(const f32 x) {
-    return sqrtf(x);
+
+/* same as rmm_rsqrt, 8 wide */
+RM_INLINE __m256
+rmm256_rsqrt(__m256 v) {
+    __m256 y, nr, special, tiny;
+
+    tiny = _mm256_cmp_ps(v, _mm256_set1_ps(0x1p-126f), _CMP_LT_OQ);
+    v    = _mm256_mul_ps(v, _mm256_blendv_ps(_mm256_set1_ps(1.0f),
+                                             _mm256_set1_ps(0x1p24f), tiny));
+    y    = _mm256_rsqrt_ps(v);
+    nr   = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), v),
+                         _mm256_mul_ps(y, y));
+    nr   = _mm256_mul_ps(y, _mm256_sub_ps(_mm256_set1_ps(1.5f), nr));
+
+    special = _mm256_or_ps(_mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_EQ_OQ),
+                           _mm256_cmp_ps(v, _mm256_set1_ps(RM_INF_F32),
+                                         _CMP_EQ_OQ));
+    return _mm256_mul_ps(_mm256_blendv_ps(nr, y, special),
+                         _mm256_blendv_ps(_mm256_set1_ps(1.0f),
+                                          _mm256_set1_ps(0x1p12f), tiny));
+}
+#define rmm256_shuffle(_a, _b, _x, _y, _z, _w)                                 \
+    _mm256_shuffle_ps((_a), (_b), _MM_SHUFFLE((_w), (_z), (_y), (_x)))
+
+RM_INLINE __m256
+rmm256_loadu2(const f32 *lo, const f32 *hi) {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo)),
+                                _mm_loadu_ps(hi), 1);
 }
-RM_INLINE f64
-rm_sqrt_f64(const f64 x) {
-    return sqrt(x);
+RM_INLINE void
+rmm256_storeu2(f32 *lo, f32 *hi, __m256 v) {
+    _mm_storeu_ps(lo, _mm256_castps256_ps128(v));
+    _mm_storeu_ps(hi, _mm256_extractf128_ps(v, 1));
 }
-RM_INLINE u8
-rm_pow2_u8(const u8 x) {
-    return RM_POW2(x);
+/*
+ * rmm_load3 for 8 triplets (24 floats), every half gets 4 triplets so the
+ * in-lane shuffles are the same as in the 128 bit version
+ */
+RM_INLINE void
+rmm256_load3(const f32 *p, __m256 *x, __m256 *y, __m256 *z) {
+    __m256 a, b, c;
+
+    a  = rmm256_loadu2(p, p + 12);
+    b  = rmm256_loadu2(p + 4, p + 16);
+    c  = rmm256_loadu2(p + 8, p + 20);
+    *x = rmm256_shuffle(a, rmm256_shuffle(b, c, 2, 2, 1, 1), 0, 3, 0, 2);
+    *y = rmm256_shuffle(rmm256_shuffle(a, b, 1, 1, 0, 0),
+                        rmm256_shuffle(b, c, 3, 3, 2, 2), 0, 2, 0, 2);
+    *z = rmm256_shuffle(rmm256_shuffle(a, b, 2, 2, 1, 1), c, 0, 2, 0, 3);
+}
+RM_INLINE void
+rmm256_store3(f32 *p, __m256 x, __m256 y, __m256 z) {
+    rmm256_storeu2(p, p + 12,
+                   rmm256_shuffle(rmm256_shuffle(x, y, 0, 0, 0, 0),
+                                  rmm256_shuffle(z, x, 0, 0, 1, 1), 0, 2, 0,
+                                  2));
+    rmm256_storeu2(p + 4, p + 16,
+                   rmm256_shuffle(rmm256_shuffle(y, z, 1, 1, 1, 1),
+                                  rmm256_shuffle(x, y, 2, 2, 2, 2), 0, 2, 0,
+                                  2));
+    rmm256_storeu2(p + 8, p + 20,
+                   rmm256_shuffle(rmm256_shuffle(z, x, 2, 2, 3, 3),
+                                  rmm256_shuffle(y, z, 3, 3, 3, 3), 0, 2, 0,
+                                  2));
 }
-RM_INLINE u16
-rm_pow2_u16(const u16 x) {
-    return RM_POW2(x);
+/*
+ * rmm_mulv4 for two vectors at once, c0 to c3 hold the same column in both
+ * halves and v holds one vector per half
+ */
+RM_INLINE __m256
+rmm256_mulv4(__m256 c0, __m256 c1, __m256 c2, __m256 c3, __m256 v) {
+    __m256 x0;
+    x0 = _mm256_mul_ps(c0, _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+    x0 = rmm256_fmadd(c1, _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), x0);
+    x0 = rmm256_fmadd(c2, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), x0);
+    return rmm256_fmadd(c3, _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), x0);
+}
+/* rmm_transpose on both halves */
+RM_INLINE void
+rmm256_transpose(__m256 *c0, __m256 *c1, __m256 *c2, __m256 *c3) {
+    __m256 t0, t1, t2, t3;
+
+    t0  = _mm256_unpacklo_ps(*c0, *c1);
+    t1  = _mm256_unpackhi_ps(*c0, *c1);
+    t2  = _mm256_unpacklo_ps(*c2, *c3);
+    t3  = _mm256_unpackhi_ps(*c2, *c3);
+    *c0 = rmm256_shuffle(t0, t2, 0, 1, 0, 1);
+    *c1 = rmm256_shuffle(t0, t2, 2, 3, 2, 3);
+    *c2 = rmm256_shuffle(t1, t3, 0, 1, 0, 1);
+    *c3 = rmm256_shuffle(t1, t3, 2, 3, 2, 3);
+}
+/* rmm_load4 for 8 vectors (32 floats), every half gets 4 vectors */
+RM_INLINE void
+rmm256_load4(const f32 *p, __m256 *x, __m256 *y, __m256 *z, __m256 *w) {
+    *x = rmm256_loadu2(p, p + 16);
+    *y = rmm256_loadu2(p + 4, p + 20);
+    *z = rmm256_loadu2(p + 8, p + 24);
+    *w = rmm256_loadu2(p + 12, p + 28);
+    rmm256_transpose(x, y, z, w);
+}
+RM_INLINE void
+rmm256_store4(f32 *p, __m256 x, __m256 y, __m256 z, __m256 w) {
+    rmm256_transpose(&x, &y, &z, &w);
+    rmm256_storeu2(p, p + 16, x);
+    rmm256_storeu2(p + 4, p + 20, y);
+    rmm256_storeu2(p + 8, p + 24, z);
+    rmm256_storeu2(p + 12, p + 28, w);
+}
+RM_INLINE __m256
+rmm256_sin_kernel(__m256 r) {
+    __m256 z, y;
+
+    z = _mm256_mul_ps(r, r);
+    y = rmm256_fmadd(z, _mm256_set1_ps(RM_SIN_P2_F32),
+                     _mm256_set1_ps(RM_SIN_P1_F32));
+    y = rmm256_fmadd(z, y, _mm256_set1_ps(RM_SIN_P0_F32));
+    return rmm256_fmadd(_mm256_mul_ps(z, r), y, r);
+}
+RM_INLINE __m256
+rmm256_cos_kernel(__m256 r) {
+    __m256 z, y;
+
+    z = _mm256_mul_ps(r, r);
+    y = rmm256_fmadd(z, _mm256_set1_ps(RM_COS_P2_F32),
+                     _mm256_set1_ps(RM_COS_P1_F32));
+    y = rmm256_fmadd(z, y, _mm256_set1_ps(RM_COS_P0_F32));
+    y = _mm256_mul_ps(_mm256_mul_ps(z, z), y);
+    return _mm256_add_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f),
+                                       _mm256_mul_ps(z, _mm256_set1_ps(0.5f))),
+                         y);
 }
-RM_INLINE u32
-rm_pow2_u32(const u32 x) {
-    return RM_POW2(x);
+/*
+ * sin and cos of v in [0, pi/2] only. folding at pi/4 is all the reduction
+ * that needs, which keeps it to float ops so plain avx is enough
+ */
+RM_INLINE void
+rmm256_sincos_pi_2(__m256 v, __m256 *s, __m256 *c) {
+    __m256 r, ks, kc, fold;
+
+    fold = _mm256_cmp_ps(v, _mm256_set1_ps(RM_PI_4_F32), _CMP_GT_OQ);
+    r    = _mm256_sub_ps(_mm256_set1_ps(RM_PI_2_A_F32), v);
+    r    = _mm256_add_ps(r, _mm256_set1_ps(RM_PI_2_B_F32));
+    r    = _mm256_add_ps(r, _mm256_set1_ps(RM_PI_2_C_F32));
+    r    = _mm256_add_ps(r, _mm256_set1_ps(RM_PI_2_D_F32));
+    r    = _mm256_blendv_ps(v, r, fold);
+
+    ks = rmm256_sin_kernel(r);
+    kc = rmm256_cos_kernel(r);
+    *s = _mm256_blendv_ps(ks, kc, fold);
+    *c = _mm256_blendv_ps(kc, ks, fold);
+}
+/* same as rmm_acos, 8 wide */
+RM_INLINE __m256
+rmm256_acos(__m256 v) {
+    __m256 a, z, s, p, big;
+
+    a   = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v);
+    big = _mm256_cmp_ps(a, _mm256_set1_ps(0.5f), _CMP_GT_OQ);
+    z   = _mm256_blendv_ps(_mm256_mul_ps(a, a),
+                           _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), a),
+                                         _mm256_set1_ps(0.5f)),
+                           big);
+    s   = _mm256_blendv_ps(a, _mm256_sqrt_ps(z), big);
+
+    p = rmm256_fmadd(z, _mm256_set1_ps(RM_ASIN_P4_F32),
+                     _mm256_set1_ps(RM_ASIN_P3_F32));
+    p = rmm256_fmadd(z, p, _mm256_set1_ps(RM_ASIN_P2_F32));
+    p = rmm256_fmadd(z, p, _mm256_set1_ps(RM_ASIN_P1_F32));
+    p = rmm256_fmadd(z, p, _mm256_set1_ps(RM_ASIN_P0_F32));
+    s = rmm256_fmadd(_mm256_mul_ps(s, z), p, s);
+
+    s = _mm256_blendv_ps(_mm256_sub_ps(_mm256_set1_ps(RM_PI_2_F32), s),
+                         _mm256_add_ps(s, s), big);
+    return _mm256_blendv_ps(s, _mm256_sub_ps(_mm256_set1_ps(RM_PI_F32), s),
+                            _mm256_cmp_ps(v, _mm256_setzero_ps(),
+                                          _CMP_LT_OQ));
+}
+/* same as rmm_slerp_weights, 8 wide */
+RM_INLINE __m256
+rmm256_slerp_weights(__m256 d, __m256 t, __m256 *wa, __m256 *wb) {
+    __m256 one, neg, near, theta, st, ct, s;
+
+    one  = _mm256_set1_ps(1.0f);
+    neg  = _mm256_cmp_ps(d, _mm256_setzero_ps(), _CMP_LT_OQ);
+    d    = _mm256_min_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), d), one);
+    near = _mm256_cmp_ps(d, _mm256_set1_ps(0.9995f), _CMP_GT_OQ);
+
+    theta = rmm256_acos(d);
+    s     = _mm256_sqrt_ps(
+        _mm256_mul_ps(_mm256_sub_ps(one, d), _mm256_add_ps(one, d)));
+    rmm256_sincos_pi_2(_mm256_mul_ps(t, theta), &st, &ct);
+
+    *wb = _mm256_div_ps(st, s);
+    *wa = _mm256_sub_ps(ct, _mm256_mul_ps(d, *wb));
+
+    *wa = _mm256_blendv_ps(*wa, _mm256_sub_ps(one, t), near);
+    *wb = _mm256_blendv_ps(*wb, t, near);
+    *wb = _mm256_blendv_ps(*wb, _mm256_xor_ps(*wb, _mm256_set1_ps(-0.0f)),
+                           neg);
+    return near;
 }
-RM_INLINE u64
-rm_pow2_u64(const u64 x) {
-    return RM_POW2(x);
+/*
+ * rmm_load_aabbf32 for 8 boxes, the halves work on 4 boxes each so the
+ * lanes hold boxes 0 1 4 5 2 3 6 7
+ */
+RM_INLINE void
+rmm256_load_aabbf32(const aabbf32 *b, __m256 *min, __m256 *max) {
+    __m256 ax, ay, az, bx, by, bz;
+
+    rmm256_load3(b[0].raw, &ax, &ay, &az);
+    rmm256_load3(b[4].raw, &bx, &by, &bz);
+    min[0] = rmm256_shuffle(ax, bx, 0, 2, 0, 2);
+    min[1] = rmm256_shuffle(ay, by, 0, 2, 0, 2);
+    min[2] = rmm256_shuffle(az, bz, 0, 2, 0, 2);
+    max[0] = rmm256_shuffle(ax, bx, 1, 3, 1, 3);
+    max[1] = rmm256_shuffle(ay, by, 1, 3, 1, 3);
+    max[2] = rmm256_shuffle(az, bz, 1, 3, 1, 3);
+}
+/* same as rmm_slab, 8 wide */
+RM_INLINE void
+rmm256_slab(__m256 min,
+            __m256 max,
+            __m256 o,
+            __m256 inv,
+            __m256 *tn,
+            __m256 *tf) {
+    __m256 t0, t1;
+
+    t0  = _mm256_mul_ps(_mm256_sub_ps(min, o), inv);
+    t1  = _mm256_mul_ps(_mm256_sub_ps(max, o), inv);
+    *tn = _mm256_max_ps(_mm256_min_ps(t0, t1), *tn);
+    *tf = _mm256_min_ps(_mm256_max_ps(t0, t1), *tf);
 }
-RM_INLINE i8
-rm_pow2_i8(const i8 x) {
-    return RM_POW2(x);
+
+#if defined(RM_AVX2)
+/*
+ * rmmi_pack4_u8 for 32 lanes, the packs work per half so the result is fixed
+ * up with a lane permute
+ */
+RM_INLINE __m256i
+rmm256i_pack4_u8(__m256i a, __m256i b, __m256i c, __m256i d) {
+    __m256i v;
+
+    v = _mm256_packus_epi16(_mm256_packs_epi32(a, b),
+                            _mm256_packs_epi32(c, d));
+    return _mm256_permutevar8x32_epi32(v,
+                                       _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3,
+                                                         7));
+}
+/* splits 32 packed u8x4 (128 bytes) into x, y, z and w */
+RM_INLINE void
+rmm256i_load4_u8(const u8 *p,
+                 __m256i *x,
+                 __m256i *y,
+                 __m256i *z,
+                 __m256i *w) {
+    __m256i a, b, c, d, m;
+
+    a = _mm256_loadu_si256((const __m256i *)p);
+    b = _mm256_loadu_si256((const __m256i *)(p + 32));
+    c = _mm256_loadu_si256((const __m256i *)(p + 64));
+    d = _mm256_loadu_si256((const __m256i *)(p + 96));
+    m = _mm256_set1_epi32(0xFF);
+
+    *x = rmm256i_pack4_u8(_mm256_and_si256(a, m), _mm256_and_si256(b, m),
+                          _mm256_and_si256(c, m), _mm256_and_si256(d, m));
+    a  = _mm256_srli_epi32(a, 8);
+    b  = _mm256_srli_epi32(b, 8);
+    c  = _mm256_srli_epi32(c, 8);
+    d  = _mm256_srli_epi32(d, 8);
+    *y = rmm256i_pack4_u8(_mm256_and_si256(a, m), _mm256_and_si256(b, m),
+                          _mm256_and_si256(c, m), _mm256_and_si256(d, m));
+    a  = _mm256_srli_epi32(a, 8);
+    b  = _mm256_srli_epi32(b, 8);
+    c  = _mm256_srli_epi32(c, 8);
+    d  = _mm256_srli_epi32(d, 8);
+    *z = rmm256i_pack4_u8(_mm256_and_si256(a, m), _mm256_and_si256(b, m),
+                          _mm256_and_si256(c, m), _mm256_and_si256(d, m));
+    *w = rmm256i_pack4_u8(_mm256_srli_epi32(a, 8), _mm256_srli_epi32(b, 8),
+                          _mm256_srli_epi32(c, 8), _mm256_srli_epi32(d, 8));
 }
-RM_INLINE i16
-rm_pow2_i16(const i16 x) {
-    return RM_POW2(x);
+/*
+ * the unpacks also work per half, so the 64 bit quarters are swapped first
+ * to have pixels 0-7 | 8-15 after the low byte unpack
+ */
+RM_INLINE void
+rmm256i_store4_u8(u8 *p, __m256i x, __m256i y, __m256i z, __m256i w) {
+    __m256i xy, zw, lo, hi;
+
+    x = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(3, 1, 2, 0));
+    y = _mm256_permute4x64_epi64(y, _MM_SHUFFLE(3, 1, 2, 0));
+    z = _mm256_permute4x64_epi64(z, _MM_SHUFFLE(3, 1, 2, 0));
+    w = _mm256_permute4x64_epi64(w, _MM_SHUFFLE(3, 1, 2, 0));
+
+    xy = _mm256_unpacklo_epi8(x, y);
+    zw = _mm256_unpacklo_epi8(z, w);
+    lo = _mm256_unpacklo_epi16(xy, zw);
+    hi = _mm256_unpackhi_epi16(xy, zw);
+    _mm256_storeu_si256((__m256i *)p, _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm256_storeu_si256((__m256i *)(p + 32),
+                        _mm256_permute2x128_si256(lo, hi, 0x31));
+    xy = _mm256_unpackhi_epi8(x, y);
+    zw = _mm256_unpackhi_epi8(z, w);
+    lo = _mm256_unpacklo_epi16(xy, zw);
+    hi = _mm256_unpackhi_epi16(xy, zw);
+    _mm256_storeu_si256((__m256i *)(p + 64),
+                        _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm256_storeu_si256((__m256i *)(p + 96),
+                        _mm256_permute2x128_si256(lo, hi, 0x31));
 }
-RM_INLINE i32
-rm_pow2_i32(const i32 x) {
-    return RM_POW2(x);
+#endif
+#endif
+
+#endif
+
+#if defined(RM_NEON)
+RM_INLINE uint8x8_t
+rmn_from_u8x4(const u8x4 v) {
+    return vreinterpret_u8_u32(vdup_n_u32((u32)v.x | (u32)v.y << 8 |
+                                          (u32)v.z << 16 | (u32)v.w << 24));
 }
-RM_INLINE i64
-rm_pow2_i64(const i64 x) {
-    return RM_POW2(x);
+RM_INLINE u8x4
+rmn_to_u8x4(uint8x8_t v) {
+    return rm_u8x4(vget_lane_u8(v, 0), vget_lane_u8(v, 1), vget_lane_u8(v, 2),
+                   vget_lane_u8(v, 3));
 }
-RM_INLINE f32
-rm_pow2_f32(const f32 x) {
-    return RM_POW2(x);
+RM_INLINE boolx4
+rmn_boolx4_u32(uint32x4_t mask) {
+    return rm_boolx4(vgetq_lane_u32(mask, 0) & 1, vgetq_lane_u32(mask, 1) & 1,
+                     vgetq_lane_u32(mask, 2) & 1, vgetq_lane_u32(mask, 3) & 1);
 }
-RM_INLINE f64
-rm_pow2_f64(const f64 x) {
-    return RM_POW2(x);
+RM_INLINE boolx4
+rmn_boolx4_u16(uint16x4_t mask) {
+    return rm_boolx4(vget_lane_u16(mask, 0) & 1, vget_lane_u16(mask, 1) & 1,
+                     vget_lane_u16(mask, 2) & 1, vget_lane_u16(mask, 3) & 1);
 }
-RM_INLINE f32
-rm_sin_f32(const f32 x) {
-    return sinf(x);
+RM_INLINE boolx4
+rmn_boolx4_u8(uint8x8_t mask) {
+    return rm_boolx4(vget_lane_u8(mask, 0) & 1, vget_lane_u8(mask, 1) & 1,
+                     vget_lane_u8(mask, 2) & 1, vget_lane_u8(mask, 3) & 1);
 }
-RM_INLINE f64
-rm_sin_f64(const f64 x) {
-    return sin(x);
+
+#if defined(RM_SIMD_F32X4)
+typedef float32x4_t rmv_f32x4;
+
+/* vld1q/vst1q only need element alignment */
+#define rmm_load(_v) vld1q_f32((_v))
+#define rmm_store(_a, _b) vst1q_f32((_a), _b);
+#define rmm_loadu(_v) vld1q_f32((_v))
+#define rmm_storeu(_a, _b) vst1q_f32((_a), _b);
+#define rmm_set1(_s) vdupq_n_f32((_s))
+#define rmm_setzero() vdupq_n_f32(0.0f)
+#define rmm_cvtf32(_v) vgetq_lane_f32((_v), 0)
+#define rmm_splat(_v, _lane) vdupq_laneq_f32((_v), (_lane))
+#define rmm_shuffle(_a, _b, _x, _y, _z, _w)                                    \
+    vcombine_f32(                                                              \
+        vset_lane_f32(vgetq_lane_f32((_a), (_y)), vdup_laneq_f32((_a), (_x)),  \
+                      1),                                                      \
+        vset_lane_f32(vgetq_lane_f32((_b), (_w)), vdup_laneq_f32((_b), (_z)),  \
+                      1))
+#define rmm_swizzle(_v, _x, _y, _z, _w) rmm_shuffle((_v), (_v), _x, _y, _z, _w)
+
+#define rmm_add(_a, _b) vaddq_f32((_a), (_b))
+#define rmm_sub(_a, _b) vsubq_f32((_a), (_b))
+#define rmm_mul(_a, _b) vmulq_f32((_a), (_b))
+#define rmm_div(_a, _b) vdivq_f32((_a), (_b))
+#define rmm_sqrt(_v) vsqrtq_f32((_v))
+#define rmm_neg(_v) vnegq_f32((_v))
+#define rmm_abs(_v) vabsq_f32((_v))
+#define rmm_trunc(_v) vrndq_f32((_v))
+#define rmm_floor(_v) vrndmq_f32((_v))
+#define rmm_ceil(_v) vrndpq_f32((_v))
+#define rmm_round(_v) vrndaq_f32((_v))
+/* same as the sse versions */
+#define rmm_pow2i(_k)                                                          \
+    vreinterpretq_f32_u32(vshlq_n_u32(                                         \
+        vreinterpretq_u32_f32(vaddq_f32((_k), vdupq_n_f32(8388735.0f))), 23))
+#define rmm_exponent(_v)                                                       \
+    vsubq_f32(vreinterpretq_f32_u32(                                           \
+                  vorrq_u32(vshrq_n_u32(vreinterpretq_u32_f32((_v)), 23),      \
+                            vdupq_n_u32(0x4b000000))),                         \
+              vdupq_n_f32(8388608.0f))
+#define rmm_mantissa(_v)                                                       \
+    vreinterpretq_f32_u32(                                                     \
+        vorrq_u32(vandq_u32(vreinterpretq_u32_f32((_v)),                       \
+                            vdupq_n_u32(0x007fffff)),                          \
+                  vdupq_n_u32(0x3f800000)))
+
+/* masks are kept as float vectors so they pass through the same type */
+#define rmm_and(_a, _b)                                                        \
+    vreinterpretq_f32_u32(                                                     \
+        vandq_u32(vreinterpretq_u32_f32((_a)), vreinterpretq_u32_f32((_b))))
+#define rmm_or(_a, _b)                                                         \
+    vreinterpretq_f32_u32(                                                     \
+        vorrq_u32(vreinterpretq_u32_f32((_a)), vreinterpretq_u32_f32((_b))))
+#define rmm_not(_v)                                                            \
+    vreinterpretq_f32_u32(vmvnq_u32(vreinterpretq_u32_f32((_v))))
+#define rmm_any(_v) (vmaxvq_u32(vreinterpretq_u32_f32((_v))) != 0)
+#define rmm_all(_v) (vminvq_u32(vreinterpretq_u32_f32((_v))) != 0)
+#define rmm_cmpeq(_a, _b) vreinterpretq_f32_u32(vceqq_f32((_a), (_b)))
+#define rmm_cmpneq(_a, _b)                                                     \
+    vreinterpretq_f32_u32(vmvnq_u32(vceqq_f32((_a), (_b))))
+#define rmm_cmplt(_a, _b) vreinterpretq_f32_u32(vcltq_f32((_a), (_b)))
+#define rmm_cmple(_a, _b) vreinterpretq_f32_u32(vcleq_f32((_a), (_b)))
+#define rmm_cmpgt(_a, _b) vreinterpretq_f32_u32(vcgtq_f32((_a), (_b)))
+#define rmm_cmpge(_a, _b) vreinterpretq_f32_u32(vcgeq_f32((_a), (_b)))
+
+/* bit i is set when lane i of the mask is */
+RM_INLINE int
+rmm_movemask(float32x4_t mask) {
+    static const u32 bits[4] = {1, 2, 4, 8};
+
+    return (int)vaddvq_u32(
+        vandq_u32(vreinterpretq_u32_f32(mask), vld1q_u32(bits)));
 }
-RM_INLINE f32
-rm_cos_f32(const f32 x) {
-    return cosf(x);
+
+RM_INLINE float32x4_t
+rmm_setr(const f32 x, const f32 y, const f32 z, const f32 w) {
+    f32 tmp[4];
+    tmp[0] = x;
+    tmp[1] = y;
+    tmp[2] = z;
+    tmp[3] = w;
+    return vld1q_f32(tmp);
+}
+/* vminq/vmaxq return nan for any nan input, these keep the sse semantics */
+RM_INLINE float32x4_t
+rmm_min(float32x4_t a, float32x4_t b) {
+    return vbslq_f32(vcltq_f32(a, b), a, b);
+}
+RM_INLINE float32x4_t
+rmm_max(float32x4_t a, float32x4_t b) {
+    return vbslq_f32(vcgtq_f32(a, b), a, b);
 }
-RM_INLINE f64
-rm_cos_f64(const f64 x) {
-    return cos(x);
+RM_INLINE boolx4
+rmm_boolx4(float32x4_t mask) {
+    return rmn_boolx4_u32(vreinterpretq_u32_f32(mask));
 }
-RM_INLINE f32
-rm_tan_f32(const f32 x) {
-    return tanf(x);
+RM_INLINE float32x4_t
+rmm_blendv(float32x4_t a, float32x4_t b, float32x4_t mask) {
+    return vbslq_f32(vreinterpretq_u32_f32(mask), b, a);
 }
-RM_INLINE f64
-rm_tan_f64(const f64 x) {
-    return tan(x);
+RM_INLINE float32x4_t
+rmm_fmadd(float32x4_t a, float32x4_t b, float32x4_t c) {
+    return vfmaq_f32(c, a, b);
 }
+RM_INLINE void
+rmm_load3(const f32 *p, float32x4_t *x, float32x4_t *y, float32x4_t *z) {
+    float32x4x3_t v;
 
-// VECTORS
-RM_INLINE bool
-rm_any_u8x2(const u8x2 v) {
-    return v.x || v.y;
-}
-RM_INLINE bool
-rm_any_u8x3(const u8x2 v) {
-    return (v.x || v.y) || v.z;
+    v  = vld3q_f32(p);
+    *x = v.val[0];
+    *y = v.val[1];
+    *z = v.val[2];
+}
+RM_INLINE void
+rmm_store3(f32 *p, float32x4_t x, float32x4_t y, float32x4_t z) {
+    float32x4x3_t v;
+
+    v.val[0] = x;
+    v.val[1] = y;
+    v.val[2] = z;
+    vst3q_f32(p, v);
+}
+RM_INLINE void
+rmm_load4(const f32 *p,
+          float32x4_t *x,
+          float32x4_t *y,
+          float32x4_t *z,
+          float32x4_t *w) {
+    float32x4x4_t v;
+
+    v  = vld4q_f32(p);
+    *x = v.val[0];
+    *y = v.val[1];
+    *z = v.val[2];
+    *w = v.val[3];
+}
+RM_INLINE void
+rmm_store4(f32 *p, float32x4_t x, float32x4_t y, float32x4_t z, float32x4_t w) {
+    float32x4x4_t v;
+
+    v.val[0] = x;
+    v.val[1] = y;
+    v.val[2] = z;
+    v.val[3] = w;
+    vst4q_f32(p, v);
+}
+RM_INLINE void
+rmm_transpose(float32x4_t *c0, float32x4_t *c1, float32x4_t *c2,
+              float32x4_t *c3) {
+    float32x4x2_t t0, t1;
+
+    t0  = vtrnq_f32(*c0, *c1); /* [0x, 1x, 0z, 1z], [0y, 1y, 0w, 1w] */
+    t1  = vtrnq_f32(*c2, *c3);
+    *c0 = vcombine_f32(vget_low_f32(t0.val[0]), vget_low_f32(t1.val[0]));
+    *c1 = vcombine_f32(vget_low_f32(t0.val[1]), vget_low_f32(t1.val[1]));
+    *c2 = vcombine_f32(vget_high_f32(t0.val[0]), vget_high_f32(t1.val[0]));
+    *c3 = vcombine_f32(vget_high_f32(t0.val[1]), vget_high_f32(t1.val[1]));
 }
-RM_INLINE bool
-rm_any_u8x4(const u8x2 v) {
-    return (v.x || v.y) || (v.z || v.w);
+
+RM_INLINE f32
+rmm_hadd(float32x4_t v) {
+    return vaddvq_f32(v);
 }
-RM_INLINE bool
-rm_any_u16x2(const u16x2 v) {
-    return v.x || v.y;
+RM_INLINE f32
+rmm_dot(float32x4_t a, float32x4_t b) {
+    return vaddvq_f32(vmulq_f32(a, b));
 }
-RM_INLINE bool
-rm_any_u16x3(const u16x2 v) {
-    return (v.x || v.y) || v.z;
+RM_INLINE float32x4_t
+rmm_vdots(float32x4_t a, float32x4_t b) {
+    return vdupq_n_f32(rmm_dot(a, b));
 }
-RM_INLINE bool
-rm_any_u16x4(const u16x2 v) {
-    return (v.x || v.y) || (v.z || v.w);
+RM_INLINE f32
+rmm_norm2(float32x4_t v) {
+    return vaddvq_f32(vmulq_f32(v, v));
 }
-RM_INLINE bool
-rm_any_u32x2(const u32x2 v) {
-    return v.x || v.y;
+RM_INLINE f32
+rmm_norm(float32x4_t v) {
+    return sqrtf(rmm_norm2(v));
 }
-RM_INLINE bool
-rm_any_u32x3(const u32x2 v) {
-    return (v.x || v.y) || v.z;
+RM_INLINE f32
+rmm_norm_one(float32x4_t v) {
+    return vaddvq_f32(vabsq_f32(v));
 }
-RM_INLINE bool
-rm_any_u32x4(const u32x2 v) {
-    return (v.x || v.y) || (v.z || v.w);
+RM_INLINE f32
+rmm_norm_inf(float32x4_t v) {
+    return vmaxvq_f32(vabsq_f32(v));
 }
-RM_INLINE bool
-rm_any_u64x2(const u64x2 v) {
-    return v.x || v.y;
+
+/* the estimate is only ~8 bits so neon needs two newton-raphson steps */
+RM_INLINE float32x4_t
+rmm_rsqrt(float32x4_t v) {
+    float32x4_t y;
+    y = vrsqrteq_f32(v);
+    y = vmulq_f32(y, vrsqrtsq_f32(v, vmulq_f32(y, y)));
+    return vmulq_f32(y, vrsqrtsq_f32(v, vmulq_f32(y, y)));
 }
-RM_INLINE bool
-rm_any_u64x3(const u64x2 v) {
-    return (v.x || v.y) || v.z;
+
+/* same reduction and kernels as the sse2 version */
+RM_INLINE float32x4_t
+rmm_trig_reduce(float32x4_t v, int32x4_t *q) {
+    float32x4_t k, r;
+
+    *q = vcvtnq_s32_f32(vmulq_n_f32(v, RM_2_PI_F32));
+    k  = vcvtq_f32_s32(*q);
+
+    r = vmlsq_f32(v, k, vdupq_n_f32(RM_PI_2_A_F32));
+    r = vmlsq_f32(r, k, vdupq_n_f32(RM_PI_2_B_F32));
+    r = vmlsq_f32(r, k, vdupq_n_f32(RM_PI_2_C_F32));
+    return vmlsq_f32(r, k, vdupq_n_f32(RM_PI_2_D_F32));
+}
+RM_INLINE float32x4_t
+rmm_sin_kernel(float32x4_t r) {
+    float32x4_t z, y;
+
+    z = vmulq_f32(r, r);
+    y = rmm_fmadd(z, vdupq_n_f32(RM_SIN_P2_F32), vdupq_n_f32(RM_SIN_P1_F32));
+    y = rmm_fmadd(z, y, vdupq_n_f32(RM_SIN_P0_F32));
+    y = rmm_fmadd(vmulq_f32(z, r), y, r);
+
+    /* same as rm_sin_kernel_f32, -0 stays -0 */
+    return vreinterpretq_f32_u32(vorrq_u32(
+        vreinterpretq_u32_f32(y),
+        vandq_u32(vreinterpretq_u32_f32(r), vdupq_n_u32(0x80000000))));
+}
+RM_INLINE float32x4_t
+rmm_cos_kernel(float32x4_t r) {
+    float32x4_t z, y;
+
+    z = vmulq_f32(r, r);
+    y = rmm_fmadd(z, vdupq_n_f32(RM_COS_P2_F32), vdupq_n_f32(RM_COS_P1_F32));
+    y = rmm_fmadd(z, y, vdupq_n_f32(RM_COS_P0_F32));
+    y = vmulq_f32(vmulq_f32(z, z), y);
+    return vaddq_f32(vmlsq_f32(vdupq_n_f32(1.0f), z, vdupq_n_f32(0.5f)), y);
+}
+/* sin or cos of r with its sign, picked from the quadrant */
+RM_INLINE float32x4_t
+rmm_trig_select(float32x4_t ks, float32x4_t kc, int32x4_t q) {
+    uint32x4_t swap, sign;
+
+    swap = vtstq_u32(vreinterpretq_u32_s32(q), vdupq_n_u32(1));
+    sign = vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(q), vdupq_n_u32(2)),
+                       30);
+    return vreinterpretq_f32_u32(
+        veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, kc, ks)), sign));
+}
+/* lanes libm has to handle, same rule as the sse2 version */
+RM_INLINE uint32x4_t
+rmm_trig_big(float32x4_t v) {
+    return vmvnq_u32(vcleq_f32(vabsq_f32(v), vdupq_n_f32(RM_TRIG_MAX_F32)));
+}
+RM_INLINE float32x4_t
+rmm_sin(float32x4_t v) {
+    float32x4_t r, y;
+    int32x4_t q;
+    uint32x4_t big;
+    f32 tv[4], ty[4];
+    int i;
+
+    r = rmm_trig_reduce(v, &q);
+    y = rmm_trig_select(rmm_sin_kernel(r), rmm_cos_kernel(r), q);
+
+    big = rmm_trig_big(v);
+    if (vmaxvq_u32(big)) {
+        vst1q_f32(tv, v);
+        vst1q_f32(ty, y);
+        for (i = 0; i < 4; ++i) {
+            if (!(tv[i] <= RM_TRIG_MAX_F32 && tv[i] >= -RM_TRIG_MAX_F32)) {
+                ty[i] = sinf(tv[i]);
+            }
+        }
+        y = vld1q_f32(ty);
+    }
+
+    return y;
+}
+RM_INLINE float32x4_t
+rmm_cos(float32x4_t v) {
+    float32x4_t r, y;
+    int32x4_t q;
+    uint32x4_t big;
+    f32 tv[4], ty[4];
+    int i;
+
+    r = rmm_trig_reduce(v, &q);
+    y = rmm_trig_select(rmm_sin_kernel(r), rmm_cos_kernel(r),
+                        vaddq_s32(q, vdupq_n_s32(1)));
+
+    big = rmm_trig_big(v);
+    if (vmaxvq_u32(big)) {
+        vst1q_f32(tv, v);
+        vst1q_f32(ty, y);
+        for (i = 0; i < 4; ++i) {
+            if (!(tv[i] <= RM_TRIG_MAX_F32 && tv[i] >= -RM_TRIG_MAX_F32)) {
+                ty[i] = cosf(tv[i]);
+            }
+        }
+        y = vld1q_f32(ty);
+    }
+
+    return y;
 }
-RM_INLINE bool
-rm_any_u64x4(const u64x2 v) {
-    return (v.x || v.y) || (v.z || v.w);
+/* same as the sse2 _fast versions */
+RM_INLINE float32x4_t
+rmm_sin_fast(float32x4_t v) {
+    float32x4_t r;
+    int32x4_t q;
+
+    r = rmm_trig_reduce(v, &q);
+    return rmm_trig_select(rmm_sin_kernel(r), rmm_cos_kernel(r), q);
 }
-RM_INLINE bool
-rm_any_i8x2(const i8x2 v) {
-    return v.x || v.y;
+RM_INLINE float32x4_t
+rmm_cos_fast(float32x4_t v) {
+    float32x4_t r;
+    int32x4_t q;
+
+    r = rmm_trig_reduce(v, &q);
+    return rmm_trig_select(rmm_sin_kernel(r), rmm_cos_kernel(r),
+                           vaddq_s32(q, vdupq_n_s32(1)));
+}
+RM_INLINE void
+rmm_sincos_fast(float32x4_t v, float32x4_t *s, float32x4_t *c) {
+    float32x4_t r, ks, kc;
+    int32x4_t q;
+
+    r  = rmm_trig_reduce(v, &q);
+    ks = rmm_sin_kernel(r);
+    kc = rmm_cos_kernel(r);
+    *s = rmm_trig_select(ks, kc, q);
+    *c = rmm_trig_select(ks, kc, vaddq_s32(q, vdupq_n_s32(1)));
+}
+RM_INLINE void
+rmm_sincos(float32x4_t v, float32x4_t *s, float32x4_t *c) {
+    float32x4_t r, ks, kc;
+    int32x4_t q;
+    uint32x4_t big;
+    f32 tv[4], ts[4], tc[4];
+    int i;
+
+    r  = rmm_trig_reduce(v, &q);
+    ks = rmm_sin_kernel(r);
+    kc = rmm_cos_kernel(r);
+    *s = rmm_trig_select(ks, kc, q);
+    *c = rmm_trig_select(ks, kc, vaddq_s32(q, vdupq_n_s32(1)));
+
+    big = rmm_trig_big(v);
+    if (vmaxvq_u32(big)) {
+        vst1q_f32(tv, v);
+        vst1q_f32(ts, *s);
+        vst1q_f32(tc, *c);
+        for (i = 0; i < 4; ++i) {
+            if (!(tv[i] <= RM_TRIG_MAX_F32 && tv[i] >= -RM_TRIG_MAX_F32)) {
+                ts[i] = sinf(tv[i]);
+                tc[i] = cosf(tv[i]);
+            }
+        }
+        *s = vld1q_f32(ts);
+        *c = vld1q_f32(tc);
+    }
 }
-RM_INLINE bool
-rm_any_i8x3(const i8x2 v) {
-    return (v.x || v.y) || v.z;
+#endif
+#endif
+#endif
+
+/*
+ * result of the rm_*m_f32x4 comparisons. it stays a register on the simd
+ * backends, every lane is all ones or all zeros. without simd rmv_f32x4 is
+ * the struct itself so the register api below works everywhere
+ */
+#if defined(RM_SIMD_F32X4)
+typedef rmv_f32x4 maskf32x4;
+#else
+typedef f32x4 rmv_f32x4;
+typedef boolx4 maskf32x4;
+#endif
+
+#if defined(RM_SIMD_F32X4)
+/* v * 2^k in two steps so k can go from -252 to 254 */
+RM_INLINE rmv_f32x4
+rmm_exp_scale(rmv_f32x4 v, rmv_f32x4 k) {
+    rmv_f32x4 k1;
+    k1 = rmm_trunc(rmm_mul(k, rmm_set1(0.5f)));
+    return rmm_mul(rmm_mul(v, rmm_pow2i(k1)), rmm_pow2i(rmm_sub(k, k1)));
+}
+/* max error is 1 ulp, the same as rm_exp_f32 */
+RM_INLINE rmv_f32x4
+rmm_exp(rmv_f32x4 v) {
+    rmv_f32x4 x, k, r, y;
+
+    x = rmm_min(rmm_max(v, rmm_set1(RM_EXP_MIN_F32)), rmm_set1(RM_EXP_MAX_F32));
+    k = rmm_round(rmm_mul(x, rmm_set1(RM_LOG2E_F32)));
+    r = rmm_sub(x, rmm_mul(k, rmm_set1(RM_LN2_C1_F32)));
+    r = rmm_sub(r, rmm_mul(k, rmm_set1(RM_LN2_C2_F32)));
+
+    y = rmm_fmadd(r, rmm_set1(RM_EXP_P5_F32), rmm_set1(RM_EXP_P4_F32));
+    y = rmm_fmadd(r, y, rmm_set1(RM_EXP_P3_F32));
+    y = rmm_fmadd(r, y, rmm_set1(RM_EXP_P2_F32));
+    y = rmm_fmadd(r, y, rmm_set1(RM_EXP_P1_F32));
+    y = rmm_fmadd(r, y, rmm_set1(RM_EXP_P0_F32));
+    y = rmm_add(rmm_fmadd(rmm_mul(r, r), y, r), rmm_set1(1.0f));
+
+    /* the clamp turns nan into a number, put it back */
+    return rmm_blendv(rmm_exp_scale(y, k), v, rmm_cmpneq(v, v));
 }
-RM_INLINE bool
-rm_any_i8x4(const i8x2 v) {
-    return (v.x || v.y) || (v.z || v.w);
+RM_INLINE rmv_f32x4
+rmm_exp2(rmv_f32x4 v) {
+    rmv_f32x4 x, k, r, y;
+
+    x = rmm_min(rmm_max(v, rmm_set1(RM_EXP2_MIN_F32)),
+                rmm_set1(RM_EXP2_MAX_F32));
+    k = rmm_round(x);
+    r = rmm_sub(x, k);
+
+    y = rmm_fmadd(r, rmm_set1(RM_EXP2_P5_F32), rmm_set1(RM_EXP2_P4_F32));
+    y = rmm_fmadd(r, y, rmm_set1(RM_EXP2_P3_F32));
+    y = rmm_fmadd(r, y, rmm_set1(RM_EXP2_P2_F32));
+    y = rmm_fmadd(r, y, rmm_set1(RM_EXP2_P1_F32));
+    y = rmm_fmadd(r, y, rmm_set1(RM_EXP2_P0_F32));
+    y = rmm_fmadd(r, y, rmm_set1(1.0f));
+
+    return rmm_blendv(rmm_exp_scale(y, k), v, rmm_cmpneq(v, v));
 }
-RM_INLINE bool
-rm_any_i16x2(const i16x2 v) {
-    return v.x || v.y;
+/*
+ * v = 2^e * (1 + f) with 1 + f in [sqrt(1/2), sqrt(2)), returns f. v has to
+ * be positive, subnormals are scaled up by 2^23 first
+ */
+RM_INLINE rmv_f32x4
+rmm_log_reduce(rmv_f32x4 v, rmv_f32x4 *e) {
+    rmv_f32x4 sub, m, big;
+
+    sub = rmm_cmplt(v, rmm_set1(0x1p-126f));
+    v   = rmm_blendv(v, rmm_mul(v, rmm_set1(8388608.0f)), sub);
+    *e  = rmm_sub(rmm_exponent(v),
+                  rmm_add(rmm_set1(127.0f), rmm_and(sub, rmm_set1(23.0f))));
+
+    m   = rmm_mantissa(v);
+    big = rmm_cmpgt(m, rmm_set1(RM_SQRT2_F32));
+    m   = rmm_blendv(m, rmm_mul(m, rmm_set1(0.5f)), big);
+    *e  = rmm_add(*e, rmm_and(big, rmm_set1(1.0f)));
+    return rmm_sub(m, rmm_set1(1.0f));
+}
+/* f^3 * P(f) - f^2 / 2, the part of log(1 + f) after f */
+RM_INLINE rmv_f32x4
+rmm_log_kernel(rmv_f32x4 f) {
+    rmv_f32x4 z, y;
+
+    z = rmm_mul(f, f);
+    y = rmm_fmadd(f, rmm_set1(RM_LOG_P8_F32), rmm_set1(RM_LOG_P7_F32));
+    y = rmm_fmadd(f, y, rmm_set1(RM_LOG_P6_F32));
+    y = rmm_fmadd(f, y, rmm_set1(RM_LOG_P5_F32));
+    y = rmm_fmadd(f, y, rmm_set1(RM_LOG_P4_F32));
+    y = rmm_fmadd(f, y, rmm_set1(RM_LOG_P3_F32));
+    y = rmm_fmadd(f, y, rmm_set1(RM_LOG_P2_F32));
+    y = rmm_fmadd(f, y, rmm_set1(RM_LOG_P1_F32));
+    y = rmm_fmadd(f, y, rmm_set1(RM_LOG_P0_F32));
+    return rmm_fmadd(rmm_mul(f, z), y, rmm_mul(z, rmm_set1(-0.5f)));
+}
+/* 0 gives -inf, inf gives inf, negatives and nan give nan */
+RM_INLINE rmv_f32x4
+rmm_log_special(rmv_f32x4 v, rmv_f32x4 y) {
+    y = rmm_blendv(y, rmm_set1(-RM_INF_F32), rmm_cmpeq(v, rmm_setzero()));
+    y = rmm_blendv(y, v, rmm_cmpeq(v, rmm_set1(RM_INF_F32)));
+    return rmm_blendv(y, rmm_set1(RM_NAN_F32),
+                      rmm_not(rmm_cmpge(v, rmm_setzero())));
+}
+/* max error is 1 ulp, the same as rm_log_f32 */
+RM_INLINE rmv_f32x4
+rmm_log(rmv_f32x4 v) {
+    rmv_f32x4 f, e, y;
+
+    f = rmm_log_reduce(v, &e);
+    y = rmm_fmadd(e, rmm_set1(RM_LN2_C2_F32), rmm_log_kernel(f));
+    y = rmm_fmadd(e, rmm_set1(RM_LN2_C1_F32), rmm_add(f, y));
+    return rmm_log_special(v, y);
+}
+RM_INLINE rmv_f32x4
+rmm_log2(rmv_f32x4 v) {
+    rmv_f32x4 f, e, y, z;
+
+    f = rmm_log_reduce(v, &e);
+    y = rmm_log_kernel(f);
+    z = rmm_mul(f, rmm_set1(RM_LOG2EA_F32));
+    z = rmm_fmadd(y, rmm_set1(RM_LOG2EA_F32), z);
+    z = rmm_add(rmm_add(rmm_add(z, y), f), e);
+    return rmm_log_special(v, z);
+}
+/* v * rsqrt(v), max error is 4.5 ulp. 0 and inf are passed through */
+RM_INLINE rmv_f32x4
+rmm_sqrt_fast(rmv_f32x4 v) {
+    return rmm_blendv(rmm_mul(v, rmm_rsqrt(v)), v,
+                      rmm_or(rmm_cmpeq(v, rmm_setzero()),
+                             rmm_cmpeq(v, rmm_set1(RM_INF_F32))));
+}
+/* max error is 3 ulp. k is rounded by adding and subtracting 1.5 * 2^23 */
+RM_INLINE rmv_f32x4
+rmm_exp_fast(rmv_f32x4 v) {
+    rmv_f32x4 x, k, r, y;
+
+    x = rmm_min(rmm_max(v, rmm_set1(RM_EXP_MIN_F32)), rmm_set1(RM_EXP_MAX_F32));
+    k = rmm_add(rmm_mul(x, rmm_set1(RM_LOG2E_F32)), rmm_set1(12582912.0f));
+    k = rmm_sub(k, rmm_set1(12582912.0f));
+    r = rmm_sub(x, rmm_mul(k, rmm_set1(RM_LN2_C1_F32)));
+    r = rmm_sub(r, rmm_mul(k, rmm_set1(RM_LN2_C2_F32)));
+
+    y = rmm_fmadd(r, rmm_set1(RM_EXP_FAST_P3_F32),
+                  rmm_set1(RM_EXP_FAST_P2_F32));
+    y = rmm_fmadd(r, y, rmm_set1(RM_EXP_FAST_P1_F32));
+    y = rmm_fmadd(r, y, rmm_set1(RM_EXP_FAST_P0_F32));
+    y = rmm_add(rmm_fmadd(rmm_mul(r, r), y, r), rmm_set1(1.0f));
+
+    return rmm_blendv(rmm_exp_scale(y, k), v, rmm_cmpneq(v, v));
 }
-RM_INLINE bool
-rm_any_i16x3(const i16x2 v) {
-    return (v.x || v.y) || v.z;
+/* same as rmm_exp_fast */
+RM_INLINE rmv_f32x4
+rmm_exp2_fast(rmv_f32x4 v) {
+    rmv_f32x4 x, k, r, y;
+
+    x = rmm_min(rmm_max(v, rmm_set1(RM_EXP2_MIN_F32)),
+                rmm_set1(RM_EXP2_MAX_F32));
+    k = rmm_sub(rmm_add(x, rmm_set1(12582912.0f)), rmm_set1(12582912.0f));
+    r = rmm_sub(x, k);
+
+    y = rmm_fmadd(r, rmm_set1(RM_EXP2_FAST_P4_F32),
+                  rmm_set1(RM_EXP2_FAST_P3_F32));
+    y = rmm_fmadd(r, y, rmm_set1(RM_EXP2_FAST_P2_F32));
+    y = rmm_fmadd(r, y, rmm_set1(RM_EXP2_FAST_P1_F32));
+    y = rmm_fmadd(r, y, rmm_set1(RM_EXP2_FAST_P0_F32));
+    y = rmm_fmadd(r, y, rmm_set1(1.0f));
+
+    return rmm_blendv(rmm_exp_scale(y, k), v, rmm_cmpneq(v, v));
 }
-RM_INLINE bool
-rm_any_i16x4(const i16x2 v) {
-    return (v.x || v.y) || (v.z || v.w);
+/* rmm_log_reduce without the subnormal scaling */
+RM_INLINE rmv_f32x4
+rmm_log_reduce_fast(rmv_f32x4 v, rmv_f32x4 *e) {
+    rmv_f32x4 m, big;
+
+    m   = rmm_mantissa(v);
+    big = rmm_cmpgt(m, rmm_set1(RM_SQRT2_F32));
+    m   = rmm_blendv(m, rmm_mul(m, rmm_set1(0.5f)), big);
+    *e  = rmm_sub(rmm_exponent(v), rmm_set1(127.0f));
+    *e  = rmm_add(*e, rmm_and(big, rmm_set1(1.0f)));
+    return rmm_sub(m, rmm_set1(1.0f));
+}
+RM_INLINE rmv_f32x4
+rmm_log_kernel_fast(rmv_f32x4 f) {
+    rmv_f32x4 z, y;
+
+    z = rmm_mul(f, f);
+    y = rmm_fmadd(f, rmm_set1(RM_LOG_FAST_P6_F32),
+                  rmm_set1(RM_LOG_FAST_P5_F32));
+    y = rmm_fmadd(f, y, rmm_set1(RM_LOG_FAST_P4_F32));
+    y = rmm_fmadd(f, y, rmm_set1(RM_LOG_FAST_P3_F32));
+    y = rmm_fmadd(f, y, rmm_set1(RM_LOG_FAST_P2_F32));
+    y = rmm_fmadd(f, y, rmm_set1(RM_LOG_FAST_P1_F32));
+    y = rmm_fmadd(f, y, rmm_set1(RM_LOG_FAST_P0_F32));
+    return rmm_fmadd(rmm_mul(f, z), y, rmm_mul(z, rmm_set1(-0.5f)));
+}
+/* rmm_log_special, subnormals give -inf like they do in rm_log_fast_f32 */
+RM_INLINE rmv_f32x4
+rmm_log_special_fast(rmv_f32x4 v, rmv_f32x4 y) {
+    y = rmm_blendv(y, rmm_set1(-RM_INF_F32),
+                   rmm_cmplt(v, rmm_set1(0x1p-126f)));
+    return rmm_log_special(v, y);
+}
+/* max error is 2 ulp for positive normal v */
+RM_INLINE rmv_f32x4
+rmm_log_fast(rmv_f32x4 v) {
+    rmv_f32x4 f, e, y;
+
+    f = rmm_log_reduce_fast(v, &e);
+    y = rmm_fmadd(e, rmm_set1(RM_LN2_C2_F32), rmm_log_kernel_fast(f));
+    y = rmm_fmadd(e, rmm_set1(RM_LN2_C1_F32), rmm_add(f, y));
+    return rmm_log_special_fast(v, y);
+}
+/* same as rmm_log_fast */
+RM_INLINE rmv_f32x4
+rmm_log2_fast(rmv_f32x4 v) {
+    rmv_f32x4 f, e, y, z;
+
+    f = rmm_log_reduce_fast(v, &e);
+    y = rmm_log_kernel_fast(f);
+    z = rmm_mul(f, rmm_set1(RM_LOG2EA_F32));
+    z = rmm_fmadd(y, rmm_set1(RM_LOG2EA_F32), z);
+    z = rmm_add(rmm_add(rmm_add(z, y), f), e);
+    return rmm_log_special_fast(v, z);
 }
-RM_INLINE bool
-rm_any_i32x2(const i32x2 v) {
-    return v.x || v.y;
+
+/* c0 * v.x + c1 * v.y + c2 * v.z + c3 * v.w, a 4x4 matrix times v */
+RM_INLINE rmv_f32x4
+rmm_mulv4(rmv_f32x4 c0, rmv_f32x4 c1, rmv_f32x4 c2, rmv_f32x4 c3,
+          rmv_f32x4 v) {
+    rmv_f32x4 x0;
+    x0 = rmm_mul(c0, rmm_splat(v, 0));
+    x0 = rmm_fmadd(c1, rmm_splat(v, 1), x0);
+    x0 = rmm_fmadd(c2, rmm_splat(v, 2), x0);
+    return rmm_fmadd(c3, rmm_splat(v, 3), x0);
 }
-RM_INLINE bool
-rm_any_i32x3(const i32x2 v) {
-    return (v.x || v.y) || v.z;
+
+/*
+ * the 4x4 inverse and determinant work on 2x2 blocks, each kept in one
+ * register as [0x, 0y, 1x, 1y]. see "Fast 4x4 Matrix Inverse with SSE SIMD,
+ * Explained" by Eric Zhang for the derivation
+ */
+RM_INLINE rmv_f32x4
+rmm_mat2_mul(rmv_f32x4 a, rmv_f32x4 b) {
+    return rmm_fmadd(rmm_swizzle(a, 1, 0, 3, 2), rmm_swizzle(b, 2, 1, 2, 1),
+                     rmm_mul(a, rmm_swizzle(b, 0, 3, 0, 3)));
+}
+/* adj(a) * b */
+RM_INLINE rmv_f32x4
+rmm_mat2_adjmul(rmv_f32x4 a, rmv_f32x4 b) {
+    return rmm_sub(rmm_mul(rmm_swizzle(a, 3, 3, 0, 0), b),
+                   rmm_mul(rmm_swizzle(a, 1, 1, 2, 2),
+                           rmm_swizzle(b, 2, 3, 0, 1)));
+}
+/* a * adj(b) */
+RM_INLINE rmv_f32x4
+rmm_mat2_muladj(rmv_f32x4 a, rmv_f32x4 b) {
+    return rmm_sub(rmm_mul(a, rmm_swizzle(b, 3, 0, 3, 0)),
+                   rmm_mul(rmm_swizzle(a, 1, 0, 3, 2),
+                           rmm_swizzle(b, 2, 1, 2, 1)));
+}
+/* the determinants of the 4 blocks, [|a|, |b|, |c|, |d|] */
+RM_INLINE rmv_f32x4
+rmm_mat2_dets(rmv_f32x4 c0, rmv_f32x4 c1, rmv_f32x4 c2, rmv_f32x4 c3) {
+    return rmm_sub(rmm_mul(rmm_shuffle(c0, c2, 0, 2, 0, 2),
+                           rmm_shuffle(c1, c3, 1, 3, 1, 3)),
+                   rmm_mul(rmm_shuffle(c0, c2, 1, 3, 1, 3),
+                           rmm_shuffle(c1, c3, 0, 2, 0, 2)));
 }
-RM_INLINE bool
-rm_any_i32x4(const i32x2 v) {
-    return (v.x || v.y) || (v.z || v.w);
+RM_INLINE f32
+rmm_det4(rmv_f32x4 c0, rmv_f32x4 c1, rmv_f32x4 c2, rmv_f32x4 c3) {
+    rmv_f32x4 a, b, c, d, dets, ab, dc;
+
+    a    = rmm_shuffle(c0, c1, 0, 1, 0, 1);
+    b    = rmm_shuffle(c0, c1, 2, 3, 2, 3);
+    c    = rmm_shuffle(c2, c3, 0, 1, 0, 1);
+    d    = rmm_shuffle(c2, c3, 2, 3, 2, 3);
+    dets = rmm_mat2_dets(c0, c1, c2, c3);
+    ab   = rmm_mat2_adjmul(a, b);
+    dc   = rmm_mat2_adjmul(d, c);
+
+    /* |m| = |a| * |d| + |b| * |c| - tr(adj(a) * b * adj(d) * c) */
+    return rmm_cvtf32(dets) * rmm_cvtf32(rmm_splat(dets, 3)) +
+           rmm_cvtf32(rmm_splat(dets, 1)) * rmm_cvtf32(rmm_splat(dets, 2)) -
+           rmm_hadd(rmm_mul(ab, rmm_swizzle(dc, 0, 2, 1, 3)));
+}
+/* inverts the matrix made up by the 4 columns in place */
+RM_INLINE void
+rmm_inverse4(rmv_f32x4 *c0, rmv_f32x4 *c1, rmv_f32x4 *c2, rmv_f32x4 *c3) {
+    rmv_f32x4 a, b, c, d, dets, deta, detb, detc, detd, ab, dc, x, y, z, w;
+    f32 det;
+
+    a    = rmm_shuffle(*c0, *c1, 0, 1, 0, 1);
+    b    = rmm_shuffle(*c0, *c1, 2, 3, 2, 3);
+    c    = rmm_shuffle(*c2, *c3, 0, 1, 0, 1);
+    d    = rmm_shuffle(*c2, *c3, 2, 3, 2, 3);
+    dets = rmm_mat2_dets(*c0, *c1, *c2, *c3);
+    deta = rmm_splat(dets, 0);
+    detb = rmm_splat(dets, 1);
+    detc = rmm_splat(dets, 2);
+    detd = rmm_splat(dets, 3);
+    ab   = rmm_mat2_adjmul(a, b);
+    dc   = rmm_mat2_adjmul(d, c);
+
+    /* the adjugates of the 4 blocks of the inverse */
+    x = rmm_sub(rmm_mul(detd, a), rmm_mat2_mul(b, dc));
+    w = rmm_sub(rmm_mul(deta, d), rmm_mat2_mul(c, ab));
+    y = rmm_sub(rmm_mul(detb, c), rmm_mat2_muladj(d, ab));
+    z = rmm_sub(rmm_mul(detc, b), rmm_mat2_muladj(a, dc));
+
+    det = rmm_cvtf32(deta) * rmm_cvtf32(detd) +
+          rmm_cvtf32(detb) * rmm_cvtf32(detc) -
+          rmm_hadd(rmm_mul(ab, rmm_swizzle(dc, 0, 2, 1, 3)));
+
+    /* the signs of the adjugate go in with 1 / det */
+    d = rmm_div(rmm_setr(1.0f, -1.0f, -1.0f, 1.0f), rmm_set1(det));
+    x = rmm_mul(x, d);
+    y = rmm_mul(y, d);
+    z = rmm_mul(z, d);
+    w = rmm_mul(w, d);
+
+    *c0 = rmm_shuffle(x, y, 3, 1, 3, 1);
+    *c1 = rmm_shuffle(x, y, 2, 0, 2, 0);
+    *c2 = rmm_shuffle(z, w, 3, 1, 3, 1);
+    *c3 = rmm_shuffle(z, w, 2, 0, 2, 0);
+}
+/* cross product of the xyz lanes, the w lane comes out 0 */
+RM_INLINE rmv_f32x4
+rmm_cross3(rmv_f32x4 a, rmv_f32x4 b) {
+    rmv_f32x4 t;
+
+    /* [z, x, y] of the cross product, one swizzle puts it back in order */
+    t = rmm_sub(rmm_mul(a, rmm_swizzle(b, 1, 2, 0, 3)),
+                rmm_mul(rmm_swizzle(a, 1, 2, 0, 3), b));
+    return rmm_swizzle(t, 1, 2, 0, 3);
 }
-RM_INLINE bool
-rm_any_i64x2(const i64x2 v) {
-    return v.x || v.y;
+/*
+ * hamilton product a * b with q = [x, y, z, w]. every lane is
+ * aw * b + a.xyzx * b.www-x + a.yzxy * b.zxy-y - a.zxyz * b.yzxz
+ */
+RM_INLINE rmv_f32x4
+rmm_quat_mul(rmv_f32x4 a, rmv_f32x4 b) {
+    rmv_f32x4 r, sign;
+
+    sign = rmm_setr(1.0f, 1.0f, 1.0f, -1.0f);
+
+    r = rmm_mul(rmm_splat(a, 3), b);
+    r = rmm_fmadd(rmm_mul(rmm_swizzle(a, 0, 1, 2, 0),
+                          rmm_swizzle(b, 3, 3, 3, 0)),
+                  sign, r);
+    r = rmm_fmadd(rmm_mul(rmm_swizzle(a, 1, 2, 0, 1),
+                          rmm_swizzle(b, 2, 0, 1, 1)),
+                  sign, r);
+    return rmm_sub(r, rmm_mul(rmm_swizzle(a, 2, 0, 1, 2),
+                              rmm_swizzle(b, 1, 2, 0, 2)));
+}
+/* q * v * q^-1 for unit q as v + w * t + q.xyz x t with t = 2 q.xyz x v */
+RM_INLINE rmv_f32x4
+rmm_quat_rotate(rmv_f32x4 q, rmv_f32x4 v) {
+    rmv_f32x4 t;
+
+    t = rmm_cross3(q, v);
+    t = rmm_add(t, t);
+    return rmm_add(rmm_fmadd(rmm_splat(q, 3), t, v), rmm_cross3(q, t));
+}
+/* the columns of the rotation matrix of unit q, the w lanes are 0 */
+RM_INLINE void
+rmm_quat_cols(rmv_f32x4 q, rmv_f32x4 *c0, rmv_f32x4 *c1, rmv_f32x4 *c2) {
+    rmv_f32x4 q2, t0, t1;
+
+    q2 = rmm_add(q, q);
+
+    /* [1 - 2(yy + zz), 2(xy + wz), 2(xz - wy)] */
+    t0  = rmm_mul(rmm_swizzle(q, 1, 0, 0, 3), rmm_swizzle(q2, 1, 1, 2, 3));
+    t1  = rmm_mul(rmm_swizzle(q, 2, 3, 3, 3), rmm_swizzle(q2, 2, 2, 1, 3));
+    *c0 = rmm_fmadd(t0, rmm_setr(-1.0f, 1.0f, 1.0f, 0.0f),
+                    rmm_setr(1.0f, 0.0f, 0.0f, 0.0f));
+    *c0 = rmm_fmadd(t1, rmm_setr(-1.0f, 1.0f, -1.0f, 0.0f), *c0);
+
+    /* [2(xy - wz), 1 - 2(xx + zz), 2(yz + wx)] */
+    t0  = rmm_mul(rmm_swizzle(q, 0, 0, 1, 3), rmm_swizzle(q2, 1, 0, 2, 3));
+    t1  = rmm_mul(rmm_swizzle(q, 3, 2, 3, 3), rmm_swizzle(q2, 2, 2, 0, 3));
+    *c1 = rmm_fmadd(t0, rmm_setr(1.0f, -1.0f, 1.0f, 0.0f),
+                    rmm_setr(0.0f, 1.0f, 0.0f, 0.0f));
+    *c1 = rmm_fmadd(t1, rmm_setr(-1.0f, -1.0f, 1.0f, 0.0f), *c1);
+
+    /* [2(xz + wy), 2(yz - wx), 1 - 2(xx + yy)] */
+    t0  = rmm_mul(rmm_swizzle(q, 0, 1, 0, 3), rmm_swizzle(q2, 2, 2, 0, 3));
+    t1  = rmm_mul(rmm_swizzle(q, 3, 3, 1, 3), rmm_swizzle(q2, 1, 0, 1, 3));
+    *c2 = rmm_fmadd(t0, rmm_setr(1.0f, 1.0f, -1.0f, 0.0f),
+                    rmm_setr(0.0f, 0.0f, 1.0f, 0.0f));
+    *c2 = rmm_fmadd(t1, rmm_setr(1.0f, -1.0f, -1.0f, 0.0f), *c2);
 }
-RM_INLINE bool
-rm_any_i64x3(const i64x2 v) {
-    return (v.x || v.y) || v.z;
+/*
+ * acos of v in [-1, 1] as pi/2 - asin(|v|), above 0.5 asin(|v|) comes from
+ * 2 asin(sqrt((1 - |v|) / 2)) so the polynomial only sees [0, 0.5]
+ */
+RM_INLINE rmv_f32x4
+rmm_acos(rmv_f32x4 v) {
+    rmv_f32x4 a, z, s, p, big;
+
+    a   = rmm_abs(v);
+    big = rmm_cmpgt(a, rmm_set1(0.5f));
+    z   = rmm_blendv(rmm_mul(a, a),
+                     rmm_mul(rmm_sub(rmm_set1(1.0f), a), rmm_set1(0.5f)), big);
+    s   = rmm_blendv(a, rmm_sqrt(z), big);
+
+    p = rmm_fmadd(z, rmm_set1(RM_ASIN_P4_F32), rmm_set1(RM_ASIN_P3_F32));
+    p = rmm_fmadd(z, p, rmm_set1(RM_ASIN_P2_F32));
+    p = rmm_fmadd(z, p, rmm_set1(RM_ASIN_P1_F32));
+    p = rmm_fmadd(z, p, rmm_set1(RM_ASIN_P0_F32));
+    s = rmm_fmadd(rmm_mul(s, z), p, s);
+
+    s = rmm_blendv(rmm_sub(rmm_set1(RM_PI_2_F32), s), rmm_add(s, s), big);
+    return rmm_blendv(s, rmm_sub(rmm_set1(RM_PI_F32), s),
+                      rmm_cmplt(v, rmm_setzero()));
 }
-RM_INLINE bool
-rm_any_i64x4(const i64x2 v) {
-    return (v.x || v.y) || (v.z || v.w);
+/*
+ * slerp weights for 4 lanes of d = dot(a, b) and t, the result is
+ * a * wa + b * wb. wb is negated where d < 0 to take the shorter arc.
+ * lanes with |d| > 0.9995 get the nlerp weights and are set in the
+ * returned mask, those still have to be normalized
+ */
+RM_INLINE rmv_f32x4
+rmm_slerp_weights(rmv_f32x4 d, rmv_f32x4 t, rmv_f32x4 *wa, rmv_f32x4 *wb) {
+    rmv_f32x4 one, neg, near, theta, st, ct, s;
+
+    one  = rmm_set1(1.0f);
+    neg  = rmm_cmplt(d, rmm_setzero());
+    d    = rmm_min(rmm_abs(d), one);
+    near = rmm_cmpgt(d, rmm_set1(0.9995f));
+
+    /* sin(theta) from (1 - d)(1 + d), 1 - d is exact here */
+    theta = rmm_acos(d);
+    s     = rmm_sqrt(rmm_mul(rmm_sub(one, d), rmm_add(one, d)));
+    rmm_sincos_fast(rmm_mul(t, theta), &st, &ct);
+
+    /* sin((1 - t) theta) / sin(theta) = cos(t theta) - d * wb */
+    *wb = rmm_div(st, s);
+    *wa = rmm_sub(ct, rmm_mul(d, *wb));
+
+    *wa = rmm_blendv(*wa, rmm_sub(one, t), near);
+    *wb = rmm_blendv(*wb, t, near);
+    *wb = rmm_blendv(*wb, rmm_neg(*wb), neg);
+    return near;
 }
-RM_INLINE bool
-rm_any_f32x2(const f32x2 v) {
-    return v.x || v.y;
-}
-RM_INLINE bool
-rm_any_f32x3(const f32x2 v) {
-    return (v.x || v.y) || v.z;
+/*
+ * the 3 rows of the 4 bones of one vertex scaled by w.x to w.w and summed.
+ * the weights are broadcast straight from memory, which is a load instead
+ * of a shuffle with avx
+ */
+RM_INLINE void
+rmm_skin_rows(const f32x4x3 *bones,
+              const u16x4 idx,
+              const f32x4 *w,
+              rmv_f32x4 *r0,
+              rmv_f32x4 *r1,
+              rmv_f32x4 *r2) {
+    const f32x4x3 *b0, *b1, *b2, *b3;
+    rmv_f32x4 w0, w1, w2, w3;
+
+    b0 = bones + idx.x;
+    b1 = bones + idx.y;
+    b2 = bones + idx.z;
+    b3 = bones + idx.w;
+    w0 = rmm_set1(w->x);
+    w1 = rmm_set1(w->y);
+    w2 = rmm_set1(w->z);
+    w3 = rmm_set1(w->w);
+
+    *r0 = rmm_mul(rmm_loadu(b0->cols[0].raw), w0);
+    *r0 = rmm_fmadd(rmm_loadu(b1->cols[0].raw), w1, *r0);
+    *r0 = rmm_fmadd(rmm_loadu(b2->cols[0].raw), w2, *r0);
+    *r0 = rmm_fmadd(rmm_loadu(b3->cols[0].raw), w3, *r0);
+    *r1 = rmm_mul(rmm_loadu(b0->cols[1].raw), w0);
+    *r1 = rmm_fmadd(rmm_loadu(b1->cols[1].raw), w1, *r1);
+    *r1 = rmm_fmadd(rmm_loadu(b2->cols[1].raw), w2, *r1);
+    *r1 = rmm_fmadd(rmm_loadu(b3->cols[1].raw), w3, *r1);
+    *r2 = rmm_mul(rmm_loadu(b0->cols[2].raw), w0);
+    *r2 = rmm_fmadd(rmm_loadu(b1->cols[2].raw), w1, *r2);
+    *r2 = rmm_fmadd(rmm_loadu(b2->cols[2].raw), w2, *r2);
+    *r2 = rmm_fmadd(rmm_loadu(b3->cols[2].raw), w3, *r2);
+}
+/* the corners of 4 boxes transposed, min and max alternate as triplets */
+RM_INLINE void
+rmm_load_aabbf32(const aabbf32 *b, rmv_f32x4 *min, rmv_f32x4 *max) {
+    rmv_f32x4 ax, ay, az, bx, by, bz;
+
+    rmm_load3(b[0].raw, &ax, &ay, &az);
+    rmm_load3(b[2].raw, &bx, &by, &bz);
+    min[0] = rmm_shuffle(ax, bx, 0, 2, 0, 2);
+    min[1] = rmm_shuffle(ay, by, 0, 2, 0, 2);
+    min[2] = rmm_shuffle(az, bz, 0, 2, 0, 2);
+    max[0] = rmm_shuffle(ax, bx, 1, 3, 1, 3);
+    max[1] = rmm_shuffle(ay, by, 1, 3, 1, 3);
+    max[2] = rmm_shuffle(az, bz, 1, 3, 1, 3);
 }
-RM_INLINE bool
-rm_any_f32x4(const f32x2 v) {
-    return (v.x || v.y) || (v.z || v.w);
+/*
+ * clips [tn, tf] to the slab between min and max on one axis. a ray lying
+ * exactly in a face plane gets 0 * inf = nan there and may miss
+ */
+RM_INLINE void
+rmm_slab(rmv_f32x4 min,
+         rmv_f32x4 max,
+         rmv_f32x4 o,
+         rmv_f32x4 inv,
+         rmv_f32x4 *tn,
+         rmv_f32x4 *tf) {
+    rmv_f32x4 t0, t1;
+
+    t0  = rmm_mul(rmm_sub(min, o), inv);
+    t1  = rmm_mul(rmm_sub(max, o), inv);
+    *tn = rmm_max(rmm_min(t0, t1), *tn);
+    *tf = rmm_min(rmm_max(t0, t1), *tf);
 }
-RM_INLINE bool
-rm_any_f64x2(const f64x2 v) {
-    return v.x || v.y;
+#endif
+
+// SCALARS
+RM_INLINE u8
+rm_min_u8(const u8 a, const u8 b) {
+    return RM_MIN(a, b);
 }
-RM_INLINE bool
-rm_any_f64x3(const f64x2 v) {
-    return (v.x || v.y) || v.z;
+RM_INLINE u16
+rm_min_u16(const u16 a, const u16 b) {
+    return RM_MIN(a, b);
 }
-RM_INLINE bool
-rm_any_f64x4(const f64x2 v) {
-    return (v.x || v.y) || (v.z || v.w);
+RM_INLINE u32
+rm_min_u32(const u32 a, const u32 b) {
+    return RM_MIN(a, b);
 }
-RM_INLINE bool
-rm_all_u8x2(const u8x2 v) {
-    return v.x && v.y;
+RM_INLINE u64
+rm_min_u64(const u64 a, const u64 b) {
+    return RM_MIN(a, b);
 }
-RM_INLINE bool
-rm_all_u8x3(const u8x2 v) {
-    return (v.x && v.y) && v.z;
+RM_INLINE i8
+rm_min_i8(const i8 a, const i8 b) {
+    return RM_MIN(a, b);
 }
-RM_INLINE bool
-rm_all_u8x4(const u8x2 v) {
-    return (v.x && v.y) && (v.z && v.w);
+RM_INLINE i16
+rm_min_i16(const i16 a, const i16 b) {
+    return RM_MIN(a, b);
 }
-RM_INLINE bool
-rm_all_u16x2(const u16x2 v) {
-    return v.x && v.y;
+RM_INLINE i32
+rm_min_i32(const i32 a, const i32 b) {
+    return RM_MIN(a, b);
 }
-RM_INLINE bool
-rm_all_u16x3(const u16x2 v) {
-    return (v.x && v.y) && v.z;
+RM_INLINE i64
+rm_min_i64(const i64 a, const i64 b) {
+    return RM_MIN(a, b);
 }
-RM_INLINE bool
-rm_all_u16x4(const u16x2 v) {
-    return (v.x && v.y) && (v.z && v.w);
+RM_INLINE f32
+rm_min_f32(const f32 a, const f32 b) {
+    return RM_MIN(a, b);
 }
-RM_INLINE bool
-rm_all_u32x2(const u32x2 v) {
-    return v.x && v.y;
+RM_INLINE f64
+rm_min_f64(const f64 a, const f64 b) {
+    return RM_MIN(a, b);
 }
-RM_INLINE bool
-rm_all_u32x3(const u32x2 v) {
-    return (v.x && v.y) && v.z;
+RM_INLINE u8
+rm_max_u8(const u8 a, const u8 b) {
+    return RM_MAX(a, b);
 }
-RM_INLINE bool
-rm_all_u32x4(const u32x2 v) {
-    return (v.x && v.y) && (v.z && v.w);
+RM_INLINE u16
+rm_max_u16(const u16 a, const u16 b) {
+    return RM_MAX(a, b);
 }
-RM_INLINE bool
-rm_all_u64x2(const u64x2 v) {
-    return v.x && v.y;
+RM_INLINE u32
+rm_max_u32(const u32 a, const u32 b) {
+    return RM_MAX(a, b);
 }
-RM_INLINE bool
-rm_all_u64x3(const u64x2 v) {
-    return (v.x && v.y) && v.z;
+RM_INLINE u64
+rm_max_u64(const u64 a, const u64 b) {
+    return RM_MAX(a, b);
 }
-RM_INLINE bool
-rm_all_u64x4(const u64x2 v) {
-    return (v.x && v.y) && (v.z && v.w);
+RM_INLINE i8
+rm_max_i8(const i8 a, const i8 b) {
+    return RM_MAX(a, b);
 }
-RM_INLINE bool
-rm_all_i8x2(const i8x2 v) {
-    return v.x && v.y;
+RM_INLINE i16
+rm_max_i16(const i16 a, const i16 b) {
+    return RM_MAX(a, b);
 }
-RM_INLINE bool
-rm_all_i8x3(const i8x2 v) {
-    return (v.x && v.y) && v.z;
+RM_INLINE i32
+rm_max_i32(const i32 a, const i32 b) {
+    return RM_MAX(a, b);
 }
-RM_INLINE bool
-rm_all_i8x4(const i8x2 v) {
-    return (v.x && v.y) && (v.z && v.w);
+RM_INLINE i64
+rm_max_i64(const i64 a, const i64 b) {
+    return RM_MAX(a, b);
 }
-RM_INLINE bool
-rm_all_i16x2(const i16x2 v) {
-    return v.x && v.y;
+RM_INLINE f32
+rm_max_f32(const f32 a, const f32 b) {
+    return RM_MAX(a, b);
 }
-RM_INLINE bool
-rm_all_i16x3(const i16x2 v) {
-    return (v.x && v.y) && v.z;
+RM_INLINE f64
+rm_max_f64(const f64 a, const f64 b) {
+    return RM_MAX(a, b);
 }
-RM_INLINE bool
-rm_all_i16x4(const i16x2 v) {
-    return (v.x && v.y) && (v.z && v.w);
+RM_INLINE u8
+rm_clamp_u8(const u8 val, const u8 min, const u8 max) {
+    return RM_CLAMP(val, min, max);
 }
-RM_INLINE bool
-rm_all_i32x2(const i32x2 v) {
-    return v.x && v.y;
+RM_INLINE u16
+rm_clamp_u16(const u16 val, const u16 min, const u16 max) {
+    return RM_CLAMP(val, min, max);
 }
-RM_INLINE bool
-rm_all_i32x3(const i32x2 v) {
-    return (v.x && v.y) && v.z;
+RM_INLINE u32
+rm_clamp_u32(const u32 val, const u32 min, const u32 max) {
+    return RM_CLAMP(val, min, max);
 }
-RM_INLINE bool
-rm_all_i32x4(const i32x2 v) {
-    return (v.x && v.y) && (v.z && v.w);
+RM_INLINE u64
+rm_clamp_u64(const u64 val, const u64 min, const u64 max) {
+    return RM_CLAMP(val, min, max);
 }
-RM_INLINE bool
-rm_all_i64x2(const i64x2 v) {
-    return v.x && v.y;
+RM_INLINE i8
+rm_clamp_i8(const i8 val, const i8 min, const i8 max) {
+    return RM_CLAMP(val, min, max);
 }
-RM_INLINE bool
-rm_all_i64x3(const i64x2 v) {
-    return (v.x && v.y) && v.z;
+RM_INLINE i16
+rm_clamp_i16(const i16 val, const i16 min, const i16 max) {
+    return RM_CLAMP(val, min, max);
 }
-RM_INLINE bool
-rm_all_i64x4(const i64x2 v) {
-    return (v.x && v.y) && (v.z && v.w);
+RM_INLINE i32
+rm_clamp_i32(const i32 val, const i32 min, const i32 max) {
+    return RM_CLAMP(val, min, max);
 }
-RM_INLINE bool
-rm_all_f32x2(const f32x2 v) {
-    return v.x && v.y;
+RM_INLINE i64
+rm_clamp_i64(const i64 val, const i64 min, const i64 max) {
+    return RM_CLAMP(val, min, max);
 }
-RM_INLINE bool
-rm_all_f32x3(const f32x2 v) {
-    return (v.x && v.y) && v.z;
+RM_INLINE f32
+rm_clamp_f32(const f32 val, const f32 min, const f32 max) {
+    return RM_CLAMP(val, min, max);
 }
-RM_INLINE bool
-rm_all_f32x4(const f32x2 v) {
-    return (v.x && v.y) && (v.z && v.w);
+RM_INLINE f64
+rm_clamp_f64(const f64 val, const f64 min, const f64 max) {
+    return RM_CLAMP(val, min, max);
 }
-RM_INLINE bool
-rm_all_f64x2(const f64x2 v) {
-    return v.x && v.y;
+/*
+ * every |x| at or above 2^23 (2^52 for f64) is integral, nan fails the test.
+ * the int round trip gives +0 for (-1, -0], the sign of x goes back on, so
+ * floor, ceil and round keep -0 too
+ */
+RM_INLINE f32
+rm_trunc_f32(const f32 x) {
+    if (!(x < 8388608.0f && x > -8388608.0f)) { return x; }
+    return u32_as_f32(f32_as_u32((f32)(i32)x) | (f32_as_u32(x) & 0x80000000));
 }
-RM_INLINE bool
-rm_all_f64x3(const f64x2 v) {
-    return (v.x && v.y) && v.z;
+RM_INLINE f64
+rm_trunc_f64(const f64 x) {
+    if (!(x < 4503599627370496.0 && x > -4503599627370496.0)) { return x; }
+    return u64_as_f64(f64_as_u64((f64)(i64)x) |
+                      (f64_as_u64(x) & 0x8000000000000000));
 }
-RM_INLINE bool
-rm_all_f64x4(const f64x2 v) {
-    return (v.x && v.y) && (v.z && v.w);
+RM_INLINE u8
+rm_mod_u8(const u8 a, const u8 b) {
+    return a % b;
 }
-RM_INLINE boolx2
-rm_not_u8x2(const u8x2 v) {
-    return rm_boolx2(!v.x, !v.y);
+RM_INLINE u16
+rm_mod_u16(const u16 a, const u16 b) {
+    return a % b;
 }
-RM_INLINE boolx3
-rm_not_u8x3(const u8x3 v) {
-    return rm_boolx3(!v.x, !v.y, !v.z);
+RM_INLINE u32
+rm_mod_u32(const u32 a, const u32 b) {
+    return a % b;
 }
-RM_INLINE boolx4
-rm_not_u8x4(const u8x4 v) {
-    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
+RM_INLINE u64
+rm_mod_u64(const u64 a, const u64 b) {
+    return a % b;
 }
-RM_INLINE boolx2
-rm_not_u16x2(const u16x2 v) {
-    return rm_boolx2(!v.x, !v.y);
+RM_INLINE i8
+rm_mod_i8(const i8 a, const i8 b) {
+    return a % b;
 }
-RM_INLINE boolx3
-rm_not_u16x3(const u16x3 v) {
-    return rm_boolx3(!v.x, !v.y, !v.z);
+RM_INLINE i16
+rm_mod_i16(const i16 a, const i16 b) {
+    return a % b;
 }
-RM_INLINE boolx4
-rm_not_u16x4(const u16x4 v) {
-    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
+RM_INLINE i32
+rm_mod_i32(const i32 a, const i32 b) {
+    return a % b;
 }
-RM_INLINE boolx2
-rm_not_u32x2(const u32x2 v) {
-    return rm_boolx2(!v.x, !v.y);
+RM_INLINE i64
+rm_mod_i64(const i64 a, const i64 b) {
+    return a % b;
 }
-RM_INLINE boolx3
-rm_not_u32x3(const u32x3 v) {
-    return rm_boolx3(!v.x, !v.y, !v.z);
+RM_INLINE f32
+rm_mod_f32(const f32 a, const f32 b) {
+    return a - (rm_trunc_f32(a / b) * b);
 }
-RM_INLINE boolx4
-rm_not_u32x4(const u32x4 v) {
-    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
+RM_INLINE f64
+rm_mod_f64(const f64 a, const f64 b) {
+    return a - (rm_trunc_f64(a / b) * b);
 }
-RM_INLINE boolx2
-rm_not_u64x2(const u64x2 v) {
-    return rm_boolx2(!v.x, !v.y);
+RM_INLINE i8
+rm_abs_i8(const i8 x) {
+    return RM_ABS(x);
 }
-RM_INLINE boolx3
-rm_not_u64x3(const u64x3 v) {
-    return rm_boolx3(!v.x, !v.y, !v.z);
+RM_INLINE i16
+rm_abs_i16(const i16 x) {
+    return RM_ABS(x);
 }
-RM_INLINE boolx4
-rm_not_u64x4(const u64x4 v) {
-    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
+RM_INLINE i32
+rm_abs_i32(const i32 x) {
+    return RM_ABS(x);
 }
-RM_INLINE boolx2
-rm_not_i8x2(const i8x2 v) {
-    return rm_boolx2(!v.x, !v.y);
+RM_INLINE i64
+rm_abs_i64(const i64 x) {
+    return RM_ABS(x);
 }
-RM_INLINE boolx3
-rm_not_i8x3(const i8x3 v) {
-    return rm_boolx3(!v.x, !v.y, !v.z);
+RM_INLINE f32
+rm_abs_f32(const f32 x) {
+    return RM_ABS(x);
 }
-RM_INLINE boolx4
-rm_not_i8x4(const i8x4 v) {
-    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
+RM_INLINE f64
+rm_abs_f64(const f64 x) {
+    return RM_ABS(x);
 }
-RM_INLINE boolx2
-rm_not_i16x2(const i16x2 v) {
-    return rm_boolx2(!v.x, !v.y);
+RM_INLINE i8
+rm_sign_i8(const i8 x) {
+    return (x > 0) - (x < 0);
 }
-RM_INLINE boolx3
-rm_not_i16x3(const i16x3 v) {
-    return rm_boolx3(!v.x, !v.y, !v.z);
+RM_INLINE i16
+rm_sign_i16(const i16 x) {
+    return (x > 0) - (x < 0);
 }
-RM_INLINE boolx4
-rm_not_i16x4(const i16x4 v) {
-    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
+RM_INLINE i32
+rm_sign_i32(const i32 x) {
+    return (x > 0) - (x < 0);
 }
-RM_INLINE boolx2
-rm_not_i32x2(const i32x2 v) {
-    return rm_boolx2(!v.x, !v.y);
+RM_INLINE i64
+rm_sign_i64(const i64 x) {
+    return (x > 0) - (x < 0);
 }
-RM_INLINE boolx3
-rm_not_i32x3(const i32x3 v) {
-    return rm_boolx3(!v.x, !v.y, !v.z);
+RM_INLINE f32
+rm_sign_f32(const f32 x) {
+    return (x > 0) - (x < 0);
 }
-RM_INLINE boolx4
-rm_not_i32x4(const i32x4 v) {
-    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
+RM_INLINE f64
+rm_sign_f64(const f64 x) {
+    return (x > 0) - (x < 0);
 }
-RM_INLINE boolx2
-rm_not_i64x2(const i64x2 v) {
-    return rm_boolx2(!v.x, !v.y);
+RM_INLINE i8
+rm_copysign_i8(const i8 x, const i8 s) {
+    return rm_abs_i8(x) * rm_sign_i8(s);
 }
-RM_INLINE boolx3
-rm_not_i64x3(const i64x3 v) {
-    return rm_boolx3(!v.x, !v.y, !v.z);
+RM_INLINE i16
+rm_copysign_i16(const i16 x, const i16 s) {
+    return rm_abs_i16(x) * rm_sign_i16(s);
 }
-RM_INLINE boolx4
-rm_not_i64x4(const i64x4 v) {
-    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
+RM_INLINE i32
+rm_copysign_i32(const i32 x, const i32 s) {
+    return rm_abs_i32(x) * rm_sign_i32(s);
 }
-RM_INLINE boolx2
-rm_not_f32x2(const f32x2 v) {
-    return rm_boolx2(!v.x, !v.y);
+RM_INLINE i64
+rm_copysign_i64(const i64 x, const i64 s) {
+    return rm_abs_i64(x) * rm_sign_i64(s);
 }
-RM_INLINE boolx3
-rm_not_f32x3(const f32x3 v) {
-    return rm_boolx3(!v.x, !v.y, !v.z);
+RM_INLINE f32
+rm_copysign_f32(const f32 x, const f32 s) {
+    return rm_abs_f32(x) * rm_sign_f32(s);
 }
-RM_INLINE boolx4
-rm_not_f32x4(const f32x4 v) {
-    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
+RM_INLINE f64
+rm_copysign_f64(const f64 x, const f64 s) {
+    return rm_abs_f64(x) * rm_sign_f64(s);
 }
-RM_INLINE boolx2
-rm_not_f64x2(const f64x2 v) {
-    return rm_boolx2(!v.x, !v.y);
+RM_INLINE f32
+rm_floor_f32(const f32 x) {
+    f32 t;
+    t = rm_trunc_f32(x);
+    return (t > x) ? t - 1 : t;
 }
-RM_INLINE boolx3
-rm_not_f64x3(const f64x3 v) {
-    return rm_boolx3(!v.x, !v.y, !v.z);
+RM_INLINE f64
+rm_floor_f64(const f64 x) {
+    f64 t;
+    t = rm_trunc_f64(x);
+    return (t > x) ? t - 1 : t;
 }
-RM_INLINE boolx4
-rm_not_f64x4(const f64x4 v) {
-    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
+RM_INLINE f32
+rm_ceil_f32(const f32 x) {
+    f32 t;
+    t = rm_trunc_f32(x);
+    return (t < x) ? t + 1 : t;
 }
-RM_INLINE boolx2
-rm_eq_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_boolx2(a.x == b.x, a.y == b.y);
+RM_INLINE f64
+rm_ceil_f64(const f64 x) {
+    f64 t;
+    t = rm_trunc_f64(x);
+    return (t < x) ? t + 1 : t;
 }
-RM_INLINE boolx3
-rm_eq_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
+/* halfway cases go away from zero, x - t is exact */
+RM_INLINE f32
+rm_round_f32(const f32 x) {
+    f32 t, d;
+
+    t = rm_trunc_f32(x);
+    d = x - t;
+    if (d >= 0.5f) { return t + 1; }
+    if (d <= -0.5f) { return t - 1; }
+    return t;
 }
-RM_INLINE boolx4
-rm_eq_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+RM_INLINE f64
+rm_round_f64(const f64 x) {
+    f64 t, d;
+
+    t = rm_trunc_f64(x);
+    d = x - t;
+    if (d >= 0.5) { return t + 1; }
+    if (d <= -0.5) { return t - 1; }
+    return t;
 }
-RM_INLINE boolx2
-rm_eq_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_boolx2(a.x == b.x, a.y == b.y);
+RM_INLINE f32
+rm_fract_f32(const f32 x) {
+    return x - rm_floor_f32(x);
 }
-RM_INLINE boolx3
-rm_eq_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
+RM_INLINE f64
+rm_fract_f64(const f64 x) {
+    return x - rm_floor_f64(x);
 }
-RM_INLINE boolx4
-rm_eq_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+RM_INLINE f32
+rm_deg2rad_f32(const f32 x) {
+    return x * RM_DEG2RAD_F32;
 }
-RM_INLINE boolx2
-rm_eq_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_boolx2(a.x == b.x, a.y == b.y);
+RM_INLINE f64
+rm_deg2rad_f64(const f64 x) {
+    return x * RM_DEG2RAD_F64;
 }
-RM_INLINE boolx3
-rm_eq_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
+RM_INLINE f32
+rm_rad2deg_f32(const f32 x) {
+    return x * RM_RAD2DEG_F32;
 }
-RM_INLINE boolx4
-rm_eq_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+RM_INLINE f64
+rm_rad2deg_f64(const f64 x) {
+    return x * RM_RAD2DEG_F64;
 }
-RM_INLINE boolx2
-rm_eq_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_boolx2(a.x == b.x, a.y == b.y);
+/*
+ * the hardware estimate refined with newton-raphson (~2^-22 relative error,
+ * 4.5 ulp)
+ */
+RM_INLINE f32
+rm_rsqrt_fast_f32(const f32 x) {
+#if defined(RM_SSE)
+    return _mm_cvtss_f32(rmm_rsqrt(_mm_set_ss(x)));
+#elif defined(RM_NEON)
+    float32x2_t v, y;
+
+    /* the estimate is only ~8 bits so neon needs two steps */
+    v = vdup_n_f32(x);
+    y = vrsqrte_f32(v);
+    y = vmul_f32(y, vrsqrts_f32(v, vmul_f32(y, y)));
+    y = vmul_f32(y, vrsqrts_f32(v, vmul_f32(y, y)));
+    return vget_lane_f32(y, 0);
+#else
+    f32 v, y, s;
+
+    /* no estimate instruction, start from the bit trick and do 3 steps */
+    if (!(x > 0.0f && x < RM_INF_F32)) { return 1.0f / sqrtf(x); }
+
+    /* the trick needs a normal exponent, subnormals are scaled by 2^24 */
+    v = x;
+    s = 1.0f;
+    if (v < 0x1p-126f) {
+        v *= 0x1p24f;
+        s  = 0x1p12f;
+    }
+    y = u32_as_f32(0x5f375a86 - (f32_as_u32(v) >> 1));
+    y = y * (1.5f - 0.5f * v * y * y);
+    y = y * (1.5f - 0.5f * v * y * y);
+    return s * y * (1.5f - 0.5f * v * y * y);
+#endif
 }
-RM_INLINE boolx3
-rm_eq_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
+/* x * rsqrt(x), same as rmm_sqrt_fast */
+RM_INLINE f32
+rm_sqrt_fast_f32(const f32 x) {
+    return (x == 0.0f || x == RM_INF_F32) ? x : x * rm_rsqrt_fast_f32(x);
 }
-RM_INLINE boolx4
-rm_eq_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+RM_INLINE f32
+rm_sqrt_f32(const f32 x) {
+#if defined(RM_PRECISION_FAST)
+    return rm_sqrt_fast_f32(x);
+#else
+    return sqrtf(x);
+#endif
 }
-RM_INLINE boolx2
-rm_eq_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_boolx2(a.x == b.x, a.y == b.y);
+RM_INLINE f64
+rm_sqrt_f64(const f64 x) {
+    return sqrt(x);
 }
-RM_INLINE boolx3
-rm_eq_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
+/*
+ * by default this is just 1 / sqrt(x), define RM_FAST_RSQRT (or
+ * RM_PRECISION_FAST) to use rm_rsqrt_fast_f32 instead. rm_normalize,
+ * rm_crossn and rm_distance for f32 follow the flag
+ */
+RM_INLINE f32
+rm_rsqrt_f32(const f32 x) {
+#if defined(RM_FAST_RSQRT)
+    return rm_rsqrt_fast_f32(x);
+#else
+    return 1.0f / rm_sqrt_f32(x);
+#endif
 }
-RM_INLINE boolx4
-rm_eq_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+RM_INLINE f64
+rm_rsqrt_f64(const f64 x) {
+    return 1.0 / rm_sqrt_f64(x);
 }
-RM_INLINE boolx2
-rm_eq_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_boolx2(a.x == b.x, a.y == b.y);
+/* sqrtsd is already fast, these are here so code can switch types */
+RM_INLINE f64
+rm_sqrt_fast_f64(const f64 x) {
+    return rm_sqrt_f64(x);
 }
-RM_INLINE boolx3
-rm_eq_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
+RM_INLINE f64
+rm_rsqrt_fast_f64(const f64 x) {
+    return rm_rsqrt_f64(x);
 }
-RM_INLINE boolx4
-rm_eq_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+RM_INLINE u8
+rm_pow2_u8(const u8 x) {
+    return RM_POW2(x);
 }
-RM_INLINE boolx2
-rm_eq_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_boolx2(a.x == b.x, a.y == b.y);
+RM_INLINE u16
+rm_pow2_u16(const u16 x) {
+    return RM_POW2(x);
 }
-RM_INLINE boolx3
-rm_eq_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
+RM_INLINE u32
+rm_pow2_u32(const u32 x) {
+    return RM_POW2(x);
 }
-RM_INLINE boolx4
-rm_eq_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+RM_INLINE u64
+rm_pow2_u64(const u64 x) {
+    return RM_POW2(x);
 }
-RM_INLINE boolx2
-rm_eq_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_boolx2(a.x == b.x, a.y == b.y);
+RM_INLINE i8
+rm_pow2_i8(const i8 x) {
+    return RM_POW2(x);
 }
-RM_INLINE boolx3
-rm_eq_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
+RM_INLINE i16
+rm_pow2_i16(const i16 x) {
+    return RM_POW2(x);
 }
-RM_INLINE boolx4
-rm_eq_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+RM_INLINE i32
+rm_pow2_i32(const i32 x) {
+    return RM_POW2(x);
 }
-RM_INLINE boolx2
-rm_eq_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_boolx2(a.x == b.x, a.y == b.y);
+RM_INLINE i64
+rm_pow2_i64(const i64 x) {
+    return RM_POW2(x);
 }
-RM_INLINE boolx3
-rm_eq_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
+RM_INLINE f32
+rm_pow2_f32(const f32 x) {
+    return RM_POW2(x);
 }
-RM_INLINE boolx4
-rm_eq_f32x4(const f32x4 a, const f32x4 b) {
-    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+RM_INLINE f64
+rm_pow2_f64(const f64 x) {
+    return RM_POW2(x);
 }
-RM_INLINE boolx2
-rm_eq_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_boolx2(a.x == b.x, a.y == b.y);
+/* reduce x to [-pi/4, pi/4], q gets the quadrant */
+RM_INLINE f32
+rm_trig_reduce_f32(const f32 x, i32 *q) {
+    f32 k, r;
+
+    *q = (i32)(x * RM_2_PI_F32 + ((x < 0) ? -0.5f : 0.5f));
+    k  = (f32)*q;
+
+    r = x - k * RM_PI_2_A_F32;
+    r = r - k * RM_PI_2_B_F32;
+    r = r - k * RM_PI_2_C_F32;
+    return r - k * RM_PI_2_D_F32;
 }
-RM_INLINE boolx3
-rm_eq_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
+RM_INLINE f32
+rm_sin_kernel_f32(const f32 r) {
+    f32 z, y;
+
+    z = r * r;
+    y = r + r * z * (RM_SIN_P0_F32 + z * (RM_SIN_P1_F32 + z * RM_SIN_P2_F32));
+
+    /* r + (+0) is +0 for r = -0, the result always has the sign of r */
+    return u32_as_f32(f32_as_u32(y) | (f32_as_u32(r) & 0x80000000));
 }
-RM_INLINE boolx4
-rm_eq_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+RM_INLINE f32
+rm_cos_kernel_f32(const f32 r) {
+    f32 z;
+
+    z = r * r;
+    return 1.0f - 0.5f * z +
+           z * z * (RM_COS_P0_F32 + z * (RM_COS_P1_F32 + z * RM_COS_P2_F32));
 }
-RM_INLINE boolx2
-rm_eqs_u8x2(const u8x2 v, const u8 s) {
-    return rm_eq_u8x2(v, rm_u8x2s(s));
+/*
+ * the _fast versions never go to libm, they give nan above RM_TRIG_MAX_F32
+ * and skip the check for it in the simd versions
+ */
+RM_INLINE f32
+rm_sin_fast_f32(const f32 x) {
+    f32 r, y;
+    i32 q;
+
+    if (!(rm_abs_f32(x) <= RM_TRIG_MAX_F32)) { return RM_NAN_F32; }
+
+    r = rm_trig_reduce_f32(x, &q);
+    y = (q & 1) ? rm_cos_kernel_f32(r) : rm_sin_kernel_f32(r);
+
+    return (q & 2) ? -y : y;
 }
-RM_INLINE boolx3
-rm_eqs_u8x3(const u8x3 v, const u8 s) {
-    return rm_eq_u8x3(v, rm_u8x3s(s));
+RM_INLINE f32
+rm_cos_fast_f32(const f32 x) {
+    f32 r, y;
+    i32 q;
+
+    if (!(rm_abs_f32(x) <= RM_TRIG_MAX_F32)) { return RM_NAN_F32; }
+
+    r = rm_trig_reduce_f32(x, &q);
+    q = q + 1;
+    y = (q & 1) ? rm_cos_kernel_f32(r) : rm_sin_kernel_f32(r);
+
+    return (q & 2) ? -y : y;
 }
-RM_INLINE boolx4
-rm_eqs_u8x4(const u8x4 v, const u8 s) {
-    return rm_eq_u8x4(v, rm_u8x4s(s));
+RM_INLINE void
+rm_sincos_fast_f32(const f32 x, f32 *s, f32 *c) {
+    f32 r, ks, kc;
+    i32 q;
+
+    if (!(rm_abs_f32(x) <= RM_TRIG_MAX_F32)) {
+        *s = RM_NAN_F32;
+        *c = RM_NAN_F32;
+        return;
+    }
+
+    r  = rm_trig_reduce_f32(x, &q);
+    ks = rm_sin_kernel_f32(r);
+    kc = rm_cos_kernel_f32(r);
+
+    *s = (q & 1) ? kc : ks;
+    *c = (q & 1) ? ks : kc;
+
+    if (q & 2) { *s = -*s; }
+    if ((q + 1) & 2) { *c = -*c; }
 }
-RM_INLINE boolx2
-rm_eqs_u16x2(const u16x2 v, const u16 s) {
-    return rm_eq_u16x2(v, rm_u16x2s(s));
+/* sin / cos, max error is 4 ulp */
+RM_INLINE f32
+rm_tan_fast_f32(const f32 x) {
+    f32 s, c;
+
+    rm_sincos_fast_f32(x, &s, &c);
+    return s / c;
 }
-RM_INLINE boolx3
-rm_eqs_u16x3(const u16x3 v, const u16 s) {
-    return rm_eq_u16x3(v, rm_u16x3s(s));
+/* max error is 2.5 ulp for |x| <= RM_TRIG_MAX_F32 */
+RM_INLINE f32
+rm_sin_f32(const f32 x) {
+#if defined(RM_PRECISION_EXACT)
+    return sinf(x);
+#else
+    f32 r, y;
+    i32 q;
+
+    /* also catches inf and nan */
+    if (!(rm_abs_f32(x) <= RM_TRIG_MAX_F32)) { return sinf(x); }
+
+    r = rm_trig_reduce_f32(x, &q);
+    y = (q & 1) ? rm_cos_kernel_f32(r) : rm_sin_kernel_f32(r);
+
+    return (q & 2) ? -y : y;
+#endif
 }
-RM_INLINE boolx4
-rm_eqs_u16x4(const u16x4 v, const u16 s) {
-    return rm_eq_u16x4(v, rm_u16x4s(s));
+/* reduce x to [-pi/4, pi/4] as hi + lo, q gets the quadrant */
+RM_INLINE f64
+rm_trig_reduce_f64(const f64 x, f64 *lo, i32 *q) {
+    f64 k, t, r, w, hi;
+
+    *q = (i32)(x * RM_2_PI_F64 + ((x < 0) ? -0.5 : 0.5));
+    k  = (f64)*q;
+
+    t = x - k * RM_PI_2_A_F64;
+    w = k * RM_PI_2_B_F64;
+    r = t - w;
+    w = k * RM_PI_2_BT_F64 - ((t - r) - w);
+
+    hi  = r - w;
+    *lo = (r - hi) - w;
+    return hi;
 }
-RM_INLINE boolx2
-rm_eqs_u32x2(const u32x2 v, const u32 s) {
-    return rm_eq_u32x2(v, rm_u32x2s(s));
+RM_INLINE f64
+rm_sin_kernel_f64(const f64 x, const f64 y) {
+    f64 z, v, r;
+
+    z = x * x;
+    v = z * x;
+    r = RM_SIN_P1_F64 +
+        z * (RM_SIN_P2_F64 +
+             z * (RM_SIN_P3_F64 + z * (RM_SIN_P4_F64 + z * RM_SIN_P5_F64)));
+
+    return x - ((z * (0.5 * y - v * r) - y) - v * RM_SIN_P0_F64);
 }
-RM_INLINE boolx3
-rm_eqs_u32x3(const u32x3 v, const u32 s) {
-    return rm_eq_u32x3(v, rm_u32x3s(s));
+RM_INLINE f64
+rm_cos_kernel_f64(const f64 x, const f64 y) {
+    f64 z, r, hz, w;
+
+    z = x * x;
+    r = z * (RM_COS_P0_F64 +
+             z * (RM_COS_P1_F64 +
+                  z * (RM_COS_P2_F64 +
+                       z * (RM_COS_P3_F64 +
+                            z * (RM_COS_P4_F64 + z * RM_COS_P5_F64)))));
+
+    hz = 0.5 * z;
+    w  = 1.0 - hz;
+    return w + (((1.0 - w) - hz) + (z * r - x * y));
 }
-RM_INLINE boolx4
-rm_eqs_u32x4(const u32x4 v, const u32 s) {
-    return rm_eq_u32x4(v, rm_u32x4s(s));
+/*
+ * the _fast versions drop the lo part of the reduced argument and never go
+ * to libm, they give nan above RM_TRIG_MAX_F64. max error is 1.5 ulp, 3 ulp
+ * for tan
+ */
+RM_INLINE f64
+rm_sin_fast_f64(const f64 x) {
+    f64 r, lo, y;
+    i32 q;
+
+    if (!(rm_abs_f64(x) <= RM_TRIG_MAX_F64)) { return RM_NAN_F64; }
+
+    r = rm_trig_reduce_f64(x, &lo, &q);
+    y = (q & 1) ? rm_cos_kernel_f64(r, 0.0) : rm_sin_kernel_f64(r, 0.0);
+
+    return (q & 2) ? -y : y;
 }
-RM_INLINE boolx2
-rm_eqs_u64x2(const u64x2 v, const u64 s) {
-    return rm_eq_u64x2(v, rm_u64x2s(s));
+RM_INLINE f64
+rm_cos_fast_f64(const f64 x) {
+    f64 r, lo, y;
+    i32 q;
+
+    if (!(rm_abs_f64(x) <= RM_TRIG_MAX_F64)) { return RM_NAN_F64; }
+
+    r = rm_trig_reduce_f64(x, &lo, &q);
+    q = q + 1;
+    y = (q & 1) ? rm_cos_kernel_f64(r, 0.0) : rm_sin_kernel_f64(r, 0.0);
+
+    return (q & 2) ? -y : y;
 }
-RM_INLINE boolx3
-rm_eqs_u64x3(const u64x3 v, const u64 s) {
-    return rm_eq_u64x3(v, rm_u64x3s(s));
+RM_INLINE void
+rm_sincos_fast_f64(const f64 x, f64 *s, f64 *c) {
+    f64 r, lo, ks, kc;
+    i32 q;
+
+    if (!(rm_abs_f64(x) <= RM_TRIG_MAX_F64)) {
+        *s = RM_NAN_F64;
+        *c = RM_NAN_F64;
+        return;
+    }
+
+    r  = rm_trig_reduce_f64(x, &lo, &q);
+    ks = rm_sin_kernel_f64(r, 0.0);
+    kc = rm_cos_kernel_f64(r, 0.0);
+
+    *s = (q & 1) ? kc : ks;
+    *c = (q & 1) ? ks : kc;
+
+    if (q & 2) { *s = -*s; }
+    if ((q + 1) & 2) { *c = -*c; }
 }
-RM_INLINE boolx4
-rm_eqs_u64x4(const u64x4 v, const u64 s) {
-    return rm_eq_u64x4(v, rm_u64x4s(s));
+RM_INLINE f64
+rm_tan_fast_f64(const f64 x) {
+    f64 s, c;
+
+    rm_sincos_fast_f64(x, &s, &c);
+    return s / c;
 }
-RM_INLINE boolx2
-rm_eqs_i8x2(const i8x2 v, const i8 s) {
-    return rm_eq_i8x2(v, rm_i8x2s(s));
+/* max error is 0.8 ulp for |x| <= RM_TRIG_MAX_F64 */
+RM_INLINE f64
+rm_sin_f64(const f64 x) {
+#if defined(RM_PRECISION_FAST)
+    /* only the _fast name drops the libm fallback */
+    if (!(rm_abs_f64(x) <= RM_TRIG_MAX_F64)) { return sin(x); }
+    return rm_sin_fast_f64(x);
+#elif defined(RM_PRECISION_EXACT)
+    return sin(x);
+#else
+    f64 r, lo, y;
+    i32 q;
+
+    /* also catches inf and nan */
+    if (!(rm_abs_f64(x) <= RM_TRIG_MAX_F64)) { return sin(x); }
+
+    r = rm_trig_reduce_f64(x, &lo, &q);
+    y = (q & 1) ? rm_cos_kernel_f64(r, lo) : rm_sin_kernel_f64(r, lo);
+
+    return (q & 2) ? -y : y;
+#endif
 }
-RM_INLINE boolx3
-rm_eqs_i8x3(const i8x3 v, const i8 s) {
-    return rm_eq_i8x3(v, rm_i8x3s(s));
+/* max error is 2.5 ulp for |x| <= RM_TRIG_MAX_F32 */
+RM_INLINE f32
+rm_cos_f32(const f32 x) {
+#if defined(RM_PRECISION_EXACT)
+    return cosf(x);
+#else
+    f32 r, y;
+    i32 q;
+
+    /* also catches inf and nan */
+    if (!(rm_abs_f32(x) <= RM_TRIG_MAX_F32)) { return cosf(x); }
+
+    r = rm_trig_reduce_f32(x, &q);
+    q = q + 1;
+    y = (q & 1) ? rm_cos_kernel_f32(r) : rm_sin_kernel_f32(r);
+
+    return (q & 2) ? -y : y;
+#endif
 }
-RM_INLINE boolx4
-rm_eqs_i8x4(const i8x4 v, const i8 s) {
-    return rm_eq_i8x4(v, rm_i8x4s(s));
+/* max error is 0.8 ulp for |x| <= RM_TRIG_MAX_F64 */
+RM_INLINE f64
+rm_cos_f64(const f64 x) {
+#if defined(RM_PRECISION_FAST)
+    if (!(rm_abs_f64(x) <= RM_TRIG_MAX_F64)) { return cos(x); }
+    return rm_cos_fast_f64(x);
+#elif defined(RM_PRECISION_EXACT)
+    return cos(x);
+#else
+    f64 r, lo, y;
+    i32 q;
+
+    /* also catches inf and nan */
+    if (!(rm_abs_f64(x) <= RM_TRIG_MAX_F64)) { return cos(x); }
+
+    r = rm_trig_reduce_f64(x, &lo, &q);
+    q = q + 1;
+    y = (q & 1) ? rm_cos_kernel_f64(r, lo) : rm_sin_kernel_f64(r, lo);
+
+    return (q & 2) ? -y : y;
+#endif
 }
-RM_INLINE boolx2
-rm_eqs_i16x2(const i16x2 v, const i16 s) {
-    return rm_eq_i16x2(v, rm_i16x2s(s));
+/* sin and cos with a single range reduction */
+RM_INLINE void
+rm_sincos_f32(const f32 x, f32 *s, f32 *c) {
+#if defined(RM_PRECISION_EXACT)
+    *s = sinf(x);
+    *c = cosf(x);
+#else
+    f32 r, ks, kc;
+    i32 q;
+
+    /* also catches inf and nan */
+    if (!(rm_abs_f32(x) <= RM_TRIG_MAX_F32)) {
+        *s = sinf(x);
+        *c = cosf(x);
+        return;
+    }
+
+    r  = rm_trig_reduce_f32(x, &q);
+    ks = rm_sin_kernel_f32(r);
+    kc = rm_cos_kernel_f32(r);
+
+    *s = (q & 1) ? kc : ks;
+    *c = (q & 1) ? ks : kc;
+
+    if (q & 2) { *s = -*s; }
+    if ((q + 1) & 2) { *c = -*c; }
+#endif
 }
-RM_INLINE boolx3
-rm_eqs_i16x3(const i16x3 v, const i16 s) {
-    return rm_eq_i16x3(v, rm_i16x3s(s));
+RM_INLINE void
+rm_sincos_f64(const f64 x, f64 *s, f64 *c) {
+#if defined(RM_PRECISION_FAST)
+    if (!(rm_abs_f64(x) <= RM_TRIG_MAX_F64)) {
+        *s = sin(x);
+        *c = cos(x);
+        return;
+    }
+    rm_sincos_fast_f64(x, s, c);
+#elif defined(RM_PRECISION_EXACT)
+    *s = sin(x);
+    *c = cos(x);
+#else
+    f64 r, lo, ks, kc;
+    i32 q;
+
+    /* also catches inf and nan */
+    if (!(rm_abs_f64(x) <= RM_TRIG_MAX_F64)) {
+        *s = sin(x);
+        *c = cos(x);
+        return;
+    }
+
+    r  = rm_trig_reduce_f64(x, &lo, &q);
+    ks = rm_sin_kernel_f64(r, lo);
+    kc = rm_cos_kernel_f64(r, lo);
+
+    *s = (q & 1) ? kc : ks;
+    *c = (q & 1) ? ks : kc;
+
+    if (q & 2) { *s = -*s; }
+    if ((q + 1) & 2) { *c = -*c; }
+#endif
 }
-RM_INLINE boolx4
-rm_eqs_i16x4(const i16x4 v, const i16 s) {
-    return rm_eq_i16x4(v, rm_i16x4s(s));
+RM_INLINE f32
+rm_tan_f32(const f32 x) {
+#if defined(RM_PRECISION_FAST)
+    if (!(rm_abs_f32(x) <= RM_TRIG_MAX_F32)) { return tanf(x); }
+    return rm_tan_fast_f32(x);
+#else
+    return tanf(x);
+#endif
 }
-RM_INLINE boolx2
-rm_eqs_i32x2(const i32x2 v, const i32 s) {
-    return rm_eq_i32x2(v, rm_i32x2s(s));
+RM_INLINE f64
+rm_tan_f64(const f64 x) {
+#if defined(RM_PRECISION_FAST)
+    if (!(rm_abs_f64(x) <= RM_TRIG_MAX_F64)) { return tan(x); }
+    return rm_tan_fast_f64(x);
+#else
+    return tan(x);
+#endif
 }
-RM_INLINE boolx3
-rm_eqs_i32x3(const i32x3 v, const i32 s) {
-    return rm_eq_i32x3(v, rm_i32x3s(s));
+RM_INLINE f32
+rm_acos_f32(const f32 x) {
+    return acosf(x);
 }
-RM_INLINE boolx4
-rm_eqs_i32x4(const i32x4 v, const i32 s) {
-    return rm_eq_i32x4(v, rm_i32x4s(s));
+RM_INLINE f64
+rm_acos_f64(const f64 x) {
+    return acos(x);
 }
-RM_INLINE boolx2
-rm_eqs_i64x2(const i64x2 v, const i64 s) {
-    return rm_eq_i64x2(v, rm_i64x2s(s));
+/* y * 2^k in two steps so k can go from -252 to 254 */
+RM_INLINE f32
+rm_exp_scale_f32(const f32 y, const i32 k) {
+    i32 k1;
+
+    k1 = k / 2;
+    return y * u32_as_f32((u32)(k1 + 127) << 23) *
+           u32_as_f32((u32)(k - k1 + 127) << 23);
 }
-RM_INLINE boolx3
-rm_eqs_i64x3(const i64x3 v, const i64 s) {
-    return rm_eq_i64x3(v, rm_i64x3s(s));
+/* same for f64, k can go from -2044 to 2046 */
+RM_INLINE f64
+rm_exp_scale_f64(const f64 y, const i32 k) {
+    i32 k1;
+
+    k1 = k / 2;
+    return y * u64_as_f64((u64)(k1 + 1023) << 52) *
+           u64_as_f64((u64)(k - k1 + 1023) << 52);
 }
-RM_INLINE boolx4
-rm_eqs_i64x4(const i64x4 v, const i64 s) {
-    return rm_eq_i64x4(v, rm_i64x4s(s));
+/* the _fast versions use a shorter polynomial, max error is 3 ulp */
+RM_INLINE f32
+rm_exp_fast_f32(const f32 x) {
+    f32 c, k, r, y;
+
+    if (x != x) { return x; }
+
+    c = rm_clamp_f32(x, RM_EXP_MIN_F32, RM_EXP_MAX_F32);
+    k = rm_round_f32(c * RM_LOG2E_F32);
+    r = c - k * RM_LN2_C1_F32;
+    r = r - k * RM_LN2_C2_F32;
+
+    y = RM_EXP_FAST_P0_F32 +
+        r * (RM_EXP_FAST_P1_F32 +
+             r * (RM_EXP_FAST_P2_F32 + r * RM_EXP_FAST_P3_F32));
+    y = r * r * y + r + 1.0f;
+
+    return rm_exp_scale_f32(y, (i32)k);
 }
-RM_INLINE boolx2
-rm_eqs_f32x2(const f32x2 v, const f32 s) {
-    return rm_eq_f32x2(v, rm_f32x2s(s));
+RM_INLINE f32
+rm_exp2_fast_f32(const f32 x) {
+    f32 c, k, r, y;
+
+    if (x != x) { return x; }
+
+    c = rm_clamp_f32(x, RM_EXP2_MIN_F32, RM_EXP2_MAX_F32);
+    k = rm_round_f32(c);
+    r = c - k;
+
+    y = RM_EXP2_FAST_P0_F32 +
+        r * (RM_EXP2_FAST_P1_F32 +
+             r * (RM_EXP2_FAST_P2_F32 +
+                  r * (RM_EXP2_FAST_P3_F32 + r * RM_EXP2_FAST_P4_F32)));
+    y = r * y + 1.0f;
+
+    return rm_exp_scale_f32(y, (i32)k);
 }
-RM_INLINE boolx3
-rm_eqs_f32x3(const f32x3 v, const f32 s) {
-    return rm_eq_f32x3(v, rm_f32x3s(s));
-}
-RM_INLINE boolx4
-rm_eqs_f32x4(const f32x4 v, const f32 s) {
-    return rm_eq_f32x4(v, rm_f32x4s(s));
+/* max error is 1 ulp */
+RM_INLINE f32
+rm_exp_f32(const f32 x) {
+#if defined(RM_PRECISION_FAST)
+    return rm_exp_fast_f32(x);
+#elif defined(RM_PRECISION_EXACT)
+    return expf(x);
+#else
+    f32 c, k, r, y;
+
+    if (x != x) { return x; }
+
+    c = rm_clamp_f32(x, RM_EXP_MIN_F32, RM_EXP_MAX_F32);
+    k = rm_round_f32(c * RM_LOG2E_F32);
+    r = c - k * RM_LN2_C1_F32;
+    r = r - k * RM_LN2_C2_F32;
+
+    y = RM_EXP_P0_F32 +
+        r * (RM_EXP_P1_F32 +
+             r * (RM_EXP_P2_F32 +
+                  r * (RM_EXP_P3_F32 +
+                       r * (RM_EXP_P4_F32 + r * RM_EXP_P5_F32))));
+    y = r * r * y + r + 1.0f;
+
+    return rm_exp_scale_f32(y, (i32)k);
+#endif
 }
-RM_INLINE boolx2
-rm_eqs_f64x2(const f64x2 v, const f64 s) {
-    return rm_eq_f64x2(v, rm_f64x2s(s));
+/* exp(hi - lo) for |hi - lo| <= ln2 / 2 */
+RM_INLINE f64
+rm_exp_kernel_f64(const f64 hi, const f64 lo) {
+    f64 r, t, c;
+
+    r = hi - lo;
+    t = r * r;
+    c = r - t * (RM_EXP_P1_F64 +
+                 t * (RM_EXP_P2_F64 +
+                      t * (RM_EXP_P3_F64 +
+                           t * (RM_EXP_P4_F64 + t * RM_EXP_P5_F64))));
+
+    return 1.0 - ((lo - (r * c) / (2.0 - c)) - hi);
 }
-RM_INLINE boolx3
-rm_eqs_f64x3(const f64x3 v, const f64 s) {
-    return rm_eq_f64x3(v, rm_f64x3s(s));
+/* max error is 1 ulp */
+RM_INLINE f64
+rm_exp_f64(const f64 x) {
+#if defined(RM_PRECISION_EXACT)
+    return exp(x);
+#else
+    f64 c, k;
+
+    if (x != x) { return x; }
+
+    c = rm_clamp_f64(x, RM_EXP_MIN_F64, RM_EXP_MAX_F64);
+    k = rm_round_f64(c * RM_LOG2E_F64);
+
+    return rm_exp_scale_f64(
+        rm_exp_kernel_f64(c - k * RM_LN2_HI_F64, k * RM_LN2_LO_F64), (i32)k);
+#endif
 }
-RM_INLINE boolx4
-rm_eqs_f64x4(const f64x4 v, const f64 s) {
-    return rm_eq_f64x4(v, rm_f64x4s(s));
+/* max error is 1.5 ulp */
+RM_INLINE f32
+rm_exp2_f32(const f32 x) {
+#if defined(RM_PRECISION_FAST)
+    return rm_exp2_fast_f32(x);
+#elif defined(RM_PRECISION_EXACT)
+    return exp2f(x);
+#else
+    f32 c, k, r, y;
+
+    if (x != x) { return x; }
+
+    c = rm_clamp_f32(x, RM_EXP2_MIN_F32, RM_EXP2_MAX_F32);
+    k = rm_round_f32(c);
+    r = c - k;
+
+    y = RM_EXP2_P0_F32 +
+        r * (RM_EXP2_P1_F32 +
+             r * (RM_EXP2_P2_F32 +
+                  r * (RM_EXP2_P3_F32 +
+                       r * (RM_EXP2_P4_F32 + r * RM_EXP2_P5_F32))));
+    y = r * y + 1.0f;
+
+    return rm_exp_scale_f32(y, (i32)k);
+#endif
 }
-RM_INLINE boolx2
-rm_neq_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_boolx2(a.x != b.x, a.y != b.y);
+/* max error is 1.5 ulp, (x - k) * ln2 is rounded once */
+RM_INLINE f64
+rm_exp2_f64(const f64 x) {
+#if defined(RM_PRECISION_EXACT)
+    return exp2(x);
+#else
+    f64 c, k;
+
+    if (x != x) { return x; }
+
+    c = rm_clamp_f64(x, RM_EXP2_MIN_F64, RM_EXP2_MAX_F64);
+    k = rm_round_f64(c);
+
+    return rm_exp_scale_f64(rm_exp_kernel_f64((c - k) * RM_LN2_F64, 0.0),
+                            (i32)k);
+#endif
 }
-RM_INLINE boolx3
-rm_neq_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
+/*
+ * x = 2^e * (1 + f) with 1 + f in [sqrt(1/2), sqrt(2)), returns f. x has to
+ * be positive and finite, subnormals are scaled up by 2^23 first
+ */
+RM_INLINE f32
+rm_log_reduce_f32(const f32 x, f32 *e) {
+    f32 m;
+    u32 u;
+    i32 k;
+
+    u = f32_as_u32(x);
+    k = -127;
+    if (x < 0x1p-126f) {
+        u = f32_as_u32(x * 8388608.0f);
+        k = k - 23;
+    }
+
+    k = k + (i32)(u >> 23);
+    m = u32_as_f32((u & 0x007fffff) | 0x3f800000);
+    if (m > RM_SQRT2_F32) {
+        m = m * 0.5f;
+        k = k + 1;
+    }
+
+    *e = (f32)k;
+    return m - 1.0f;
 }
-RM_INLINE boolx4
-rm_neq_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+/* f^3 * P(f) - f^2 / 2, the part of log(1 + f) after f */
+RM_INLINE f32
+rm_log_kernel_f32(const f32 f) {
+    f32 z, y;
+
+    z = f * f;
+    y = RM_LOG_P8_F32;
+    y = y * f + RM_LOG_P7_F32;
+    y = y * f + RM_LOG_P6_F32;
+    y = y * f + RM_LOG_P5_F32;
+    y = y * f + RM_LOG_P4_F32;
+    y = y * f + RM_LOG_P3_F32;
+    y = y * f + RM_LOG_P2_F32;
+    y = y * f + RM_LOG_P1_F32;
+    y = y * f + RM_LOG_P0_F32;
+
+    return f * z * y - 0.5f * z;
 }
-RM_INLINE boolx2
-rm_neq_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_boolx2(a.x != b.x, a.y != b.y);
+/*
+ * the _fast versions use a shorter polynomial and skip the subnormal
+ * scaling, subnormals give -inf. max error is 2 ulp for normal x
+ */
+RM_INLINE f32
+rm_log_kernel_fast_f32(const f32 f) {
+    f32 z, y;
+
+    z = f * f;
+    y = RM_LOG_FAST_P6_F32;
+    y = y * f + RM_LOG_FAST_P5_F32;
+    y = y * f + RM_LOG_FAST_P4_F32;
+    y = y * f + RM_LOG_FAST_P3_F32;
+    y = y * f + RM_LOG_FAST_P2_F32;
+    y = y * f + RM_LOG_FAST_P1_F32;
+    y = y * f + RM_LOG_FAST_P0_F32;
+
+    return f * z * y - 0.5f * z;
 }
-RM_INLINE boolx3
-rm_neq_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
+RM_INLINE f32
+rm_log_fast_f32(const f32 x) {
+    f32 f, e, y;
+
+    if (!(x >= 0x1p-126f)) { return (x >= 0.0f) ? -RM_INF_F32 : RM_NAN_F32; }
+    if (x == RM_INF_F32) { return x; }
+
+    f = rm_log_reduce_f32(x, &e);
+    y = rm_log_kernel_fast_f32(f) + e * RM_LN2_C2_F32;
+
+    return (f + y) + e * RM_LN2_C1_F32;
 }
-RM_INLINE boolx4
-rm_neq_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+RM_INLINE f32
+rm_log2_fast_f32(const f32 x) {
+    f32 f, e, y, z;
+
+    if (!(x >= 0x1p-126f)) { return (x >= 0.0f) ? -RM_INF_F32 : RM_NAN_F32; }
+    if (x == RM_INF_F32) { return x; }
+
+    f = rm_log_reduce_f32(x, &e);
+    y = rm_log_kernel_fast_f32(f);
+
+    z = y * RM_LOG2EA_F32 + f * RM_LOG2EA_F32;
+    return z + y + f + e;
 }
-RM_INLINE boolx2
-rm_neq_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_boolx2(a.x != b.x, a.y != b.y);
+/* max error is 1 ulp */
+RM_INLINE f32
+rm_log_f32(const f32 x) {
+#if defined(RM_PRECISION_FAST)
+    return rm_log_fast_f32(x);
+#elif defined(RM_PRECISION_EXACT)
+    return logf(x);
+#else
+    f32 f, e, y;
+
+    /* also catches nan */
+    if (!(x > 0.0f)) { return (x == 0.0f) ? -RM_INF_F32 : RM_NAN_F32; }
+    if (x == RM_INF_F32) { return x; }
+
+    f = rm_log_reduce_f32(x, &e);
+    y = rm_log_kernel_f32(f) + e * RM_LN2_C2_F32;
+
+    return (f + y) + e * RM_LN2_C1_F32;
+#endif
 }
-RM_INLINE boolx3
-rm_neq_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
+/* max error is 1.5 ulp */
+RM_INLINE f32
+rm_log2_f32(const f32 x) {
+#if defined(RM_PRECISION_FAST)
+    return rm_log2_fast_f32(x);
+#elif defined(RM_PRECISION_EXACT)
+    return log2f(x);
+#else
+    f32 f, e, y, z;
+
+    if (!(x > 0.0f)) { return (x == 0.0f) ? -RM_INF_F32 : RM_NAN_F32; }
+    if (x == RM_INF_F32) { return x; }
+
+    f = rm_log_reduce_f32(x, &e);
+    y = rm_log_kernel_f32(f);
+
+    z = y * RM_LOG2EA_F32 + f * RM_LOG2EA_F32;
+    return z + y + f + e;
+#endif
 }
-RM_INLINE boolx4
-rm_neq_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+/* same as rm_log_reduce_f32, subnormals are scaled up by 2^54 */
+RM_INLINE f64
+rm_log_reduce_f64(const f64 x, f64 *e) {
+    f64 m;
+    u64 u;
+    i32 k;
+
+    u = f64_as_u64(x);
+    k = -1023;
+    if (x < 0x1p-1022) {
+        u = f64_as_u64(x * 0x1p54);
+        k = k - 54;
+    }
+
+    k = k + (i32)(u >> 52);
+    m = u64_as_f64((u & 0x000fffffffffffff) | 0x3ff0000000000000);
+    if (m > RM_SQRT2_F64) {
+        m = m * 0.5;
+        k = k + 1;
+    }
+
+    *e = (f64)k;
+    return m - 1.0;
 }
-RM_INLINE boolx2
-rm_neq_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_boolx2(a.x != b.x, a.y != b.y);
+/* log(1 + f) - f + hfsq with hfsq = f^2 / 2, in terms of s = f / (2 + f) */
+RM_INLINE f64
+rm_log_kernel_f64(const f64 f, const f64 hfsq) {
+    f64 s, z, w, t1, t2;
+
+    s  = f / (2.0 + f);
+    z  = s * s;
+    w  = z * z;
+    t1 = w * (RM_LOG_P2_F64 + w * (RM_LOG_P4_F64 + w * RM_LOG_P6_F64));
+    t2 = z * (RM_LOG_P1_F64 +
+              w * (RM_LOG_P3_F64 + w * (RM_LOG_P5_F64 + w * RM_LOG_P7_F64)));
+
+    return s * (hfsq + t1 + t2);
 }
-RM_INLINE boolx3
-rm_neq_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
+/* max error is 1 ulp */
+RM_INLINE f64
+rm_log_f64(const f64 x) {
+#if defined(RM_PRECISION_EXACT)
+    return log(x);
+#else
+    f64 f, e, hfsq, r;
+
+    if (!(x > 0.0)) { return (x == 0.0) ? -RM_INF_F64 : RM_NAN_F64; }
+    if (x == RM_INF_F64) { return x; }
+
+    f    = rm_log_reduce_f64(x, &e);
+    hfsq = 0.5 * f * f;
+    r    = rm_log_kernel_f64(f, hfsq);
+
+    return e * RM_LN2_HI_F64 - ((hfsq - (r + e * RM_LN2_LO_F64)) - f);
+#endif
 }
-RM_INLINE boolx4
-rm_neq_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+/*
+ * max error is 1 ulp, f - hfsq is split into hi + lo with a short hi so
+ * the multiplication by 1 / ln2 stays exact
+ */
+RM_INLINE f64
+rm_log2_f64(const f64 x) {
+#if defined(RM_PRECISION_EXACT)
+    return log2(x);
+#else
+    f64 f, e, hfsq, r, hi, lo, vh, vl, w;
+
+    if (!(x > 0.0)) { return (x == 0.0) ? -RM_INF_F64 : RM_NAN_F64; }
+    if (x == RM_INF_F64) { return x; }
+
+    f    = rm_log_reduce_f64(x, &e);
+    hfsq = 0.5 * f * f;
+    r    = rm_log_kernel_f64(f, hfsq);
+
+    hi = u64_as_f64(f64_as_u64(f - hfsq) & 0xffffffff00000000);
+    lo = (f - hi) - hfsq + r;
+    vh = hi * RM_LOG2E_HI_F64;
+    vl = (lo + hi) * RM_LOG2E_LO_F64 + lo * RM_LOG2E_HI_F64;
+
+    w  = e + vh;
+    vl = vl + ((e - w) + vh);
+    return vl + w;
+#endif
 }
-RM_INLINE boolx2
-rm_neq_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_boolx2(a.x != b.x, a.y != b.y);
+/* the f64 defaults are already cheap, these are here so code can switch */
+RM_INLINE f64
+rm_exp_fast_f64(const f64 x) {
+    return rm_exp_f64(x);
 }
-RM_INLINE boolx3
-rm_neq_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
+RM_INLINE f64
+rm_exp2_fast_f64(const f64 x) {
+    return rm_exp2_f64(x);
 }
-RM_INLINE boolx4
-rm_neq_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+RM_INLINE f64
+rm_log_fast_f64(const f64 x) {
+    return rm_log_f64(x);
 }
-RM_INLINE boolx2
-rm_neq_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_boolx2(a.x != b.x, a.y != b.y);
+RM_INLINE f64
+rm_log2_fast_f64(const f64 x) {
+    return rm_log2_f64(x);
 }
-RM_INLINE boolx3
-rm_neq_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
+
+// VECTORS
+RM_INLINE bool
+rm_any_u8x2(const u8x2 v) {
+    return v.x || v.y;
 }
-RM_INLINE boolx4
-rm_neq_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+RM_INLINE bool
+rm_any_u8x3(const u8x2 v) {
+    return (v.x || v.y) || v.z;
 }
-RM_INLINE boolx2
-rm_neq_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_boolx2(a.x != b.x, a.y != b.y);
+RM_INLINE bool
+rm_any_u8x4(const u8x2 v) {
+    return (v.x || v.y) || (v.z || v.w);
 }
-RM_INLINE boolx3
-rm_neq_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
+RM_INLINE bool
+rm_any_u16x2(const u16x2 v) {
+    return v.x || v.y;
 }
-RM_INLINE boolx4
-rm_neq_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+RM_INLINE bool
+rm_any_u16x3(const u16x2 v) {
+    return (v.x || v.y) || v.z;
 }
-RM_INLINE boolx2
-rm_neq_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_boolx2(a.x != b.x, a.y != b.y);
+RM_INLINE bool
+rm_any_u16x4(const u16x2 v) {
+    return (v.x || v.y) || (v.z || v.w);
 }
-RM_INLINE boolx3
-rm_neq_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
+RM_INLINE bool
+rm_any_u32x2(const u32x2 v) {
+    return v.x || v.y;
 }
-RM_INLINE boolx4
-rm_neq_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+RM_INLINE bool
+rm_any_u32x3(const u32x2 v) {
+    return (v.x || v.y) || v.z;
 }
-RM_INLINE boolx2
-rm_neq_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_boolx2(a.x != b.x, a.y != b.y);
+RM_INLINE bool
+rm_any_u32x4(const u32x2 v) {
+    return (v.x || v.y) || (v.z || v.w);
 }
-RM_INLINE boolx3
-rm_neq_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
+RM_INLINE bool
+rm_any_u64x2(const u64x2 v) {
+    return v.x || v.y;
 }
-RM_INLINE boolx4
-rm_neq_f32x4(const f32x4 a, const f32x4 b) {
-    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+RM_INLINE bool
+rm_any_u64x3(const u64x2 v) {
+    return (v.x || v.y) || v.z;
 }
-RM_INLINE boolx2
-rm_neq_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_boolx2(a.x != b.x, a.y != b.y);
+RM_INLINE bool
+rm_any_u64x4(const u64x2 v) {
+    return (v.x || v.y) || (v.z || v.w);
 }
-RM_INLINE boolx3
-rm_neq_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
+RM_INLINE bool
+rm_any_i8x2(const i8x2 v) {
+    return v.x || v.y;
 }
-RM_INLINE boolx4
-rm_neq_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+RM_INLINE bool
+rm_any_i8x3(const i8x2 v) {
+    return (v.x || v.y) || v.z;
 }
-RM_INLINE boolx2
-rm_neqs_u8x2(const u8x2 v, const u8 s) {
-    return rm_neq_u8x2(v, rm_u8x2s(s));
+RM_INLINE bool
+rm_any_i8x4(const i8x2 v) {
+    return (v.x || v.y) || (v.z || v.w);
 }
-RM_INLINE boolx3
-rm_neqs_u8x3(const u8x3 v, const u8 s) {
-    return rm_neq_u8x3(v, rm_u8x3s(s));
+RM_INLINE bool
+rm_any_i16x2(const i16x2 v) {
+    return v.x || v.y;
 }
-RM_INLINE boolx4
-rm_neqs_u8x4(const u8x4 v, const u8 s) {
-    return rm_neq_u8x4(v, rm_u8x4s(s));
-}
-RM_INLINE boolx2
-rm_neqs_u16x2(const u16x2 v, const u16 s) {
-    return rm_neq_u16x2(v, rm_u16x2s(s));
+RM_INLINE bool
+rm_any_i16x3(const i16x2 v) {
+    return (v.x || v.y) || v.z;
 }
-RM_INLINE boolx3
-rm_neqs_u16x3(const u16x3 v, const u16 s) {
-    return rm_neq_u16x3(v, rm_u16x3s(s));
+RM_INLINE bool
+rm_any_i16x4(const i16x2 v) {
+    return (v.x || v.y) || (v.z || v.w);
 }
-RM_INLINE boolx4
-rm_neqs_u16x4(const u16x4 v, const u16 s) {
-    return rm_neq_u16x4(v, rm_u16x4s(s));
+RM_INLINE bool
+rm_any_i32x2(const i32x2 v) {
+    return v.x || v.y;
 }
-RM_INLINE boolx2
-rm_neqs_u32x2(const u32x2 v, const u32 s) {
-    return rm_neq_u32x2(v, rm_u32x2s(s));
+RM_INLINE bool
+rm_any_i32x3(const i32x2 v) {
+    return (v.x || v.y) || v.z;
 }
-RM_INLINE boolx3
-rm_neqs_u32x3(const u32x3 v, const u32 s) {
-    return rm_neq_u32x3(v, rm_u32x3s(s));
+RM_INLINE bool
+rm_any_i32x4(const i32x2 v) {
+    return (v.x || v.y) || (v.z || v.w);
 }
-RM_INLINE boolx4
-rm_neqs_u32x4(const u32x4 v, const u32 s) {
-    return rm_neq_u32x4(v, rm_u32x4s(s));
+RM_INLINE bool
+rm_any_i64x2(const i64x2 v) {
+    return v.x || v.y;
 }
-RM_INLINE boolx2
-rm_neqs_u64x2(const u64x2 v, const u64 s) {
-    return rm_neq_u64x2(v, rm_u64x2s(s));
+RM_INLINE bool
+rm_any_i64x3(const i64x2 v) {
+    return (v.x || v.y) || v.z;
 }
-RM_INLINE boolx3
-rm_neqs_u64x3(const u64x3 v, const u64 s) {
-    return rm_neq_u64x3(v, rm_u64x3s(s));
+RM_INLINE bool
+rm_any_i64x4(const i64x2 v) {
+    return (v.x || v.y) || (v.z || v.w);
 }
-RM_INLINE boolx4
-rm_neqs_u64x4(const u64x4 v, const u64 s) {
-    return rm_neq_u64x4(v, rm_u64x4s(s));
+RM_INLINE bool
+rm_any_f32x2(const f32x2 v) {
+    return v.x || v.y;
 }
-RM_INLINE boolx2
-rm_neqs_i8x2(const i8x2 v, const i8 s) {
-    return rm_neq_i8x2(v, rm_i8x2s(s));
+RM_INLINE bool
+rm_any_f32x3(const f32x2 v) {
+    return (v.x || v.y) || v.z;
 }
-RM_INLINE boolx3
-rm_neqs_i8x3(const i8x3 v, const i8 s) {
-    return rm_neq_i8x3(v, rm_i8x3s(s));
+RM_INLINE bool
+rm_any_f32x4(const f32x2 v) {
+    return (v.x || v.y) || (v.z || v.w);
 }
-RM_INLINE boolx4
-rm_neqs_i8x4(const i8x4 v, const i8 s) {
-    return rm_neq_i8x4(v, rm_i8x4s(s));
+RM_INLINE bool
+rm_any_f64x2(const f64x2 v) {
+#if defined(RM_SSE2)
+    return _mm_movemask_pd(
+               _mm_cmpneq_pd(rmmd_load(v.raw), _mm_setzero_pd())) != 0;
+#else
+    return v.x || v.y;
+#endif
 }
-RM_INLINE boolx2
-rm_neqs_i16x2(const i16x2 v, const i16 s) {
-    return rm_neq_i16x2(v, rm_i16x2s(s));
+RM_INLINE bool
+rm_any_f64x3(const f64x3 v) {
+    return (v.x || v.y) || v.z;
 }
-RM_INLINE boolx3
-rm_neqs_i16x3(const i16x3 v, const i16 s) {
-    return rm_neq_i16x3(v, rm_i16x3s(s));
+RM_INLINE bool
+rm_any_f64x4(const f64x4 v) {
+#if defined(RM_AVX)
+    return _mm256_movemask_pd(_mm256_cmp_pd(rmm256d_load(v.raw),
+                                            _mm256_setzero_pd(),
+                                            _CMP_NEQ_UQ)) != 0;
+#else
+    return (v.x || v.y) || (v.z || v.w);
+#endif
 }
-RM_INLINE boolx4
-rm_neqs_i16x4(const i16x4 v, const i16 s) {
-    return rm_neq_i16x4(v, rm_i16x4s(s));
+RM_INLINE bool
+rm_all_u8x2(const u8x2 v) {
+    return v.x && v.y;
 }
-RM_INLINE boolx2
-rm_neqs_i32x2(const i32x2 v, const i32 s) {
-    return rm_neq_i32x2(v, rm_i32x2s(s));
+RM_INLINE bool
+rm_all_u8x3(const u8x2 v) {
+    return (v.x && v.y) && v.z;
 }
-RM_INLINE boolx3
-rm_neqs_i32x3(const i32x3 v, const i32 s) {
-    return rm_neq_i32x3(v, rm_i32x3s(s));
+RM_INLINE bool
+rm_all_u8x4(const u8x2 v) {
+    return (v.x && v.y) && (v.z && v.w);
 }
-RM_INLINE boolx4
-rm_neqs_i32x4(const i32x4 v, const i32 s) {
-    return rm_neq_i32x4(v, rm_i32x4s(s));
+RM_INLINE bool
+rm_all_u16x2(const u16x2 v) {
+    return v.x && v.y;
 }
-RM_INLINE boolx2
-rm_neqs_i64x2(const i64x2 v, const i64 s) {
-    return rm_neq_i64x2(v, rm_i64x2s(s));
+RM_INLINE bool
+rm_all_u16x3(const u16x2 v) {
+    return (v.x && v.y) && v.z;
 }
-RM_INLINE boolx3
-rm_neqs_i64x3(const i64x3 v, const i64 s) {
-    return rm_neq_i64x3(v, rm_i64x3s(s));
+RM_INLINE bool
+rm_all_u16x4(const u16x2 v) {
+    return (v.x && v.y) && (v.z && v.w);
 }
-RM_INLINE boolx4
-rm_neqs_i64x4(const i64x4 v, const i64 s) {
-    return rm_neq_i64x4(v, rm_i64x4s(s));
+RM_INLINE bool
+rm_all_u32x2(const u32x2 v) {
+    return v.x && v.y;
 }
-RM_INLINE boolx2
-rm_neqs_f32x2(const f32x2 v, const f32 s) {
-    return rm_neq_f32x2(v, rm_f32x2s(s));
+RM_INLINE bool
+rm_all_u32x3(const u32x2 v) {
+    return (v.x && v.y) && v.z;
 }
-RM_INLINE boolx3
-rm_neqs_f32x3(const f32x3 v, const f32 s) {
-    return rm_neq_f32x3(v, rm_f32x3s(s));
+RM_INLINE bool
+rm_all_u32x4(const u32x2 v) {
+    return (v.x && v.y) && (v.z && v.w);
 }
-RM_INLINE boolx4
-rm_neqs_f32x4(const f32x4 v, const f32 s) {
-    return rm_neq_f32x4(v, rm_f32x4s(s));
+RM_INLINE bool
+rm_all_u64x2(const u64x2 v) {
+    return v.x && v.y;
 }
-RM_INLINE boolx2
-rm_neqs_f64x2(const f64x2 v, const f64 s) {
-    return rm_neq_f64x2(v, rm_f64x2s(s));
+RM_INLINE bool
+rm_all_u64x3(const u64x2 v) {
+    return (v.x && v.y) && v.z;
 }
-RM_INLINE boolx3
-rm_neqs_f64x3(const f64x3 v, const f64 s) {
-    return rm_neq_f64x3(v, rm_f64x3s(s));
+RM_INLINE bool
+rm_all_u64x4(const u64x2 v) {
+    return (v.x && v.y) && (v.z && v.w);
 }
-RM_INLINE boolx4
-rm_neqs_f64x4(const f64x4 v, const f64 s) {
-    return rm_neq_f64x4(v, rm_f64x4s(s));
+RM_INLINE bool
+rm_all_i8x2(const i8x2 v) {
+    return v.x && v.y;
 }
-RM_INLINE boolx2
-rm_lt_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_boolx2(a.x < b.x, a.y < b.y);
+RM_INLINE bool
+rm_all_i8x3(const i8x2 v) {
+    return (v.x && v.y) && v.z;
 }
-RM_INLINE boolx3
-rm_lt_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
+RM_INLINE bool
+rm_all_i8x4(const i8x2 v) {
+    return (v.x && v.y) && (v.z && v.w);
 }
-RM_INLINE boolx4
-rm_lt_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+RM_INLINE bool
+rm_all_i16x2(const i16x2 v) {
+    return v.x && v.y;
 }
-RM_INLINE boolx2
-rm_lt_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_boolx2(a.x < b.x, a.y < b.y);
+RM_INLINE bool
+rm_all_i16x3(const i16x2 v) {
+    return (v.x && v.y) && v.z;
 }
-RM_INLINE boolx3
-rm_lt_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
+RM_INLINE bool
+rm_all_i16x4(const i16x2 v) {
+    return (v.x && v.y) && (v.z && v.w);
 }
-RM_INLINE boolx4
-rm_lt_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+RM_INLINE bool
+rm_all_i32x2(const i32x2 v) {
+    return v.x && v.y;
 }
-RM_INLINE boolx2
-rm_lt_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_boolx2(a.x < b.x, a.y < b.y);
+RM_INLINE bool
+rm_all_i32x3(const i32x2 v) {
+    return (v.x && v.y) && v.z;
 }
-RM_INLINE boolx3
-rm_lt_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
+RM_INLINE bool
+rm_all_i32x4(const i32x2 v) {
+    return (v.x && v.y) && (v.z && v.w);
 }
-RM_INLINE boolx4
-rm_lt_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+RM_INLINE bool
+rm_all_i64x2(const i64x2 v) {
+    return v.x && v.y;
 }
-RM_INLINE boolx2
-rm_lt_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_boolx2(a.x < b.x, a.y < b.y);
+RM_INLINE bool
+rm_all_i64x3(const i64x2 v) {
+    return (v.x && v.y) && v.z;
 }
-RM_INLINE boolx3
-rm_lt_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
+RM_INLINE bool
+rm_all_i64x4(const i64x2 v) {
+    return (v.x && v.y) && (v.z && v.w);
 }
-RM_INLINE boolx4
-rm_lt_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+RM_INLINE bool
+rm_all_f32x2(const f32x2 v) {
+    return v.x && v.y;
 }
-RM_INLINE boolx2
-rm_lt_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_boolx2(a.x < b.x, a.y < b.y);
+RM_INLINE bool
+rm_all_f32x3(const f32x2 v) {
+    return (v.x && v.y) && v.z;
 }
-RM_INLINE boolx3
-rm_lt_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
+RM_INLINE bool
+rm_all_f32x4(const f32x2 v) {
+    return (v.x && v.y) && (v.z && v.w);
 }
-RM_INLINE boolx4
-rm_lt_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+RM_INLINE bool
+rm_all_f64x2(const f64x2 v) {
+#if defined(RM_SSE2)
+    return _mm_movemask_pd(
+               _mm_cmpneq_pd(rmmd_load(v.raw), _mm_setzero_pd())) == 0x3;
+#else
+    return v.x && v.y;
+#endif
+}
+RM_INLINE bool
+rm_all_f64x3(const f64x3 v) {
+    return (v.x && v.y) && v.z;
+}
+RM_INLINE bool
+rm_all_f64x4(const f64x4 v) {
+#if defined(RM_AVX)
+    return _mm256_movemask_pd(_mm256_cmp_pd(rmm256d_load(v.raw),
+                                            _mm256_setzero_pd(),
+                                            _CMP_NEQ_UQ)) == 0xF;
+#else
+    return (v.x && v.y) && (v.z && v.w);
+#endif
 }
 RM_INLINE boolx2
-rm_lt_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_boolx2(a.x < b.x, a.y < b.y);
+rm_not_u8x2(const u8x2 v) {
+    return rm_boolx2(!v.x, !v.y);
 }
 RM_INLINE boolx3
-rm_lt_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
+rm_not_u8x3(const u8x3 v) {
+    return rm_boolx3(!v.x, !v.y, !v.z);
 }
 RM_INLINE boolx4
-rm_lt_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+rm_not_u8x4(const u8x4 v) {
+    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
 }
 RM_INLINE boolx2
-rm_lt_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_boolx2(a.x < b.x, a.y < b.y);
+rm_not_u16x2(const u16x2 v) {
+    return rm_boolx2(!v.x, !v.y);
 }
 RM_INLINE boolx3
-rm_lt_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
+rm_not_u16x3(const u16x3 v) {
+    return rm_boolx3(!v.x, !v.y, !v.z);
 }
 RM_INLINE boolx4
-rm_lt_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+rm_not_u16x4(const u16x4 v) {
+    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
 }
 RM_INLINE boolx2
-rm_lt_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_boolx2(a.x < b.x, a.y < b.y);
+rm_not_u32x2(const u32x2 v) {
+    return rm_boolx2(!v.x, !v.y);
 }
 RM_INLINE boolx3
-rm_lt_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
+rm_not_u32x3(const u32x3 v) {
+    return rm_boolx3(!v.x, !v.y, !v.z);
 }
 RM_INLINE boolx4
-rm_lt_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+rm_not_u32x4(const u32x4 v) {
+    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
 }
 RM_INLINE boolx2
-rm_lt_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_boolx2(a.x < b.x, a.y < b.y);
+rm_not_u64x2(const u64x2 v) {
+    return rm_boolx2(!v.x, !v.y);
 }
 RM_INLINE boolx3
-rm_lt_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
+rm_not_u64x3(const u64x3 v) {
+    return rm_boolx3(!v.x, !v.y, !v.z);
 }
 RM_INLINE boolx4
-rm_lt_f32x4(const f32x4 a, const f32x4 b) {
-    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+rm_not_u64x4(const u64x4 v) {
+    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
 }
 RM_INLINE boolx2
-rm_lt_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_boolx2(a.x < b.x, a.y < b.y);
+rm_not_i8x2(const i8x2 v) {
+    return rm_boolx2(!v.x, !v.y);
 }
 RM_INLINE boolx3
-rm_lt_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
+rm_not_i8x3(const i8x3 v) {
+    return rm_boolx3(!v.x, !v.y, !v.z);
 }
 RM_INLINE boolx4
-rm_lt_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+rm_not_i8x4(const i8x4 v) {
+    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
 }
 RM_INLINE boolx2
-rm_lts_u8x2(const u8x2 v, const u8 s) {
-    return rm_lt_u8x2(v, rm_u8x2s(s));
+rm_not_i16x2(const i16x2 v) {
+    return rm_boolx2(!v.x, !v.y);
 }
 RM_INLINE boolx3
-rm_lts_u8x3(const u8x3 v, const u8 s) {
-    return rm_lt_u8x3(v, rm_u8x3s(s));
+rm_not_i16x3(const i16x3 v) {
+    return rm_boolx3(!v.x, !v.y, !v.z);
 }
 RM_INLINE boolx4
-rm_lts_u8x4(const u8x4 v, const u8 s) {
-    return rm_lt_u8x4(v, rm_u8x4s(s));
+rm_not_i16x4(const i16x4 v) {
+    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
 }
 RM_INLINE boolx2
-rm_lts_u16x2(const u16x2 v, const u16 s) {
-    return rm_lt_u16x2(v, rm_u16x2s(s));
+rm_not_i32x2(const i32x2 v) {
+    return rm_boolx2(!v.x, !v.y);
 }
 RM_INLINE boolx3
-rm_lts_u16x3(const u16x3 v, const u16 s) {
-    return rm_lt_u16x3(v, rm_u16x3s(s));
+rm_not_i32x3(const i32x3 v) {
+    return rm_boolx3(!v.x, !v.y, !v.z);
 }
 RM_INLINE boolx4
-rm_lts_u16x4(const u16x4 v, const u16 s) {
-    return rm_lt_u16x4(v, rm_u16x4s(s));
+rm_not_i32x4(const i32x4 v) {
+    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
 }
 RM_INLINE boolx2
-rm_lts_u32x2(const u32x2 v, const u32 s) {
-    return rm_lt_u32x2(v, rm_u32x2s(s));
+rm_not_i64x2(const i64x2 v) {
+    return rm_boolx2(!v.x, !v.y);
 }
 RM_INLINE boolx3
-rm_lts_u32x3(const u32x3 v, const u32 s) {
-    return rm_lt_u32x3(v, rm_u32x3s(s));
+rm_not_i64x3(const i64x3 v) {
+    return rm_boolx3(!v.x, !v.y, !v.z);
 }
 RM_INLINE boolx4
-rm_lts_u32x4(const u32x4 v, const u32 s) {
-    return rm_lt_u32x4(v, rm_u32x4s(s));
+rm_not_i64x4(const i64x4 v) {
+    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
 }
 RM_INLINE boolx2
-rm_lts_u64x2(const u64x2 v, const u64 s) {
-    return rm_lt_u64x2(v, rm_u64x2s(s));
+rm_not_f32x2(const f32x2 v) {
+    return rm_boolx2(!v.x, !v.y);
 }
 RM_INLINE boolx3
-rm_lts_u64x3(const u64x3 v, const u64 s) {
-    return rm_lt_u64x3(v, rm_u64x3s(s));
+rm_not_f32x3(const f32x3 v) {
+    return rm_boolx3(!v.x, !v.y, !v.z);
 }
 RM_INLINE boolx4
-rm_lts_u64x4(const u64x4 v, const u64 s) {
-    return rm_lt_u64x4(v, rm_u64x4s(s));
+rm_not_f32x4(const f32x4 v) {
+    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
 }
 RM_INLINE boolx2
-rm_lts_i8x2(const i8x2 v, const i8 s) {
-    return rm_lt_i8x2(v, rm_i8x2s(s));
+rm_not_f64x2(const f64x2 v) {
+#if defined(RM_SSE2)
+    return rmmd_boolx2(_mm_cmpeq_pd(rmmd_load(v.raw), _mm_setzero_pd()));
+#else
+    return rm_boolx2(!v.x, !v.y);
+#endif
 }
 RM_INLINE boolx3
-rm_lts_i8x3(const i8x3 v, const i8 s) {
-    return rm_lt_i8x3(v, rm_i8x3s(s));
+rm_not_f64x3(const f64x3 v) {
+    return rm_boolx3(!v.x, !v.y, !v.z);
 }
 RM_INLINE boolx4
-rm_lts_i8x4(const i8x4 v, const i8 s) {
-    return rm_lt_i8x4(v, rm_i8x4s(s));
+rm_not_f64x4(const f64x4 v) {
+#if defined(RM_AVX)
+    return rmm256d_boolx4(_mm256_cmp_pd(rmm256d_load(v.raw),
+                                        _mm256_setzero_pd(), _CMP_EQ_OQ));
+#else
+    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
+#endif
 }
 RM_INLINE boolx2
-rm_lts_i16x2(const i16x2 v, const i16 s) {
-    return rm_lt_i16x2(v, rm_i16x2s(s));
+rm_eq_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_boolx2(a.x == b.x, a.y == b.y);
 }
 RM_INLINE boolx3
-rm_lts_i16x3(const i16x3 v, const i16 s) {
-    return rm_lt_i16x3(v, rm_i16x3s(s));
+rm_eq_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
 }
 RM_INLINE boolx4
-rm_lts_i16x4(const i16x4 v, const i16 s) {
-    return rm_lt_i16x4(v, rm_i16x4s(s));
+rm_eq_u8x4(const u8x4 a, const u8x4 b) {
+#if defined(RM_SSE2)
+    __m128i xa, xb;
+
+    xa = rmmi_from_u8x4(a);
+    xb = rmmi_from_u8x4(b);
+
+    return rmmi_boolx4(_mm_cmpeq_epi8(xa, xb), 1);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u8(vceq_u8(rmn_from_u8x4(a), rmn_from_u8x4(b)));
+#else
+    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_lts_i32x2(const i32x2 v, const i32 s) {
-    return rm_lt_i32x2(v, rm_i32x2s(s));
+rm_eq_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_boolx2(a.x == b.x, a.y == b.y);
 }
 RM_INLINE boolx3
-rm_lts_i32x3(const i32x3 v, const i32 s) {
-    return rm_lt_i32x3(v, rm_i32x3s(s));
+rm_eq_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
 }
 RM_INLINE boolx4
-rm_lts_i32x4(const i32x4 v, const i32 s) {
-    return rm_lt_i32x4(v, rm_i32x4s(s));
+rm_eq_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
 }
 RM_INLINE boolx2
-rm_lts_i64x2(const i64x2 v, const i64 s) {
-    return rm_lt_i64x2(v, rm_i64x2s(s));
+rm_eq_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_boolx2(a.x == b.x, a.y == b.y);
 }
 RM_INLINE boolx3
-rm_lts_i64x3(const i64x3 v, const i64 s) {
-    return rm_lt_i64x3(v, rm_i64x3s(s));
+rm_eq_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
 }
 RM_INLINE boolx4
-rm_lts_i64x4(const i64x4 v, const i64 s) {
-    return rm_lt_i64x4(v, rm_i64x4s(s));
+rm_eq_u32x4(const u32x4 a, const u32x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(_mm_cmpeq_epi32(rmmi_load(a.raw), rmmi_load(b.raw)), 4);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u32(vceqq_u32(vld1q_u32(a.raw), vld1q_u32(b.raw)));
+#else
+    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_lts_f32x2(const f32x2 v, const f32 s) {
-    return rm_lt_f32x2(v, rm_f32x2s(s));
+rm_eq_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_boolx2(a.x == b.x, a.y == b.y);
 }
 RM_INLINE boolx3
-rm_lts_f32x3(const f32x3 v, const f32 s) {
-    return rm_lt_f32x3(v, rm_f32x3s(s));
+rm_eq_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
 }
 RM_INLINE boolx4
-rm_lts_f32x4(const f32x4 v, const f32 s) {
-    return rm_lt_f32x4(v, rm_f32x4s(s));
+rm_eq_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
 }
 RM_INLINE boolx2
-rm_lts_f64x2(const f64x2 v, const f64 s) {
-    return rm_lt_f64x2(v, rm_f64x2s(s));
+rm_eq_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_boolx2(a.x == b.x, a.y == b.y);
 }
 RM_INLINE boolx3
-rm_lts_f64x3(const f64x3 v, const f64 s) {
-    return rm_lt_f64x3(v, rm_f64x3s(s));
+rm_eq_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
 }
 RM_INLINE boolx4
-rm_lts_f64x4(const f64x4 v, const f64 s) {
-    return rm_lt_f64x4(v, rm_f64x4s(s));
+rm_eq_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
 }
 RM_INLINE boolx2
-rm_lteq_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_boolx2(a.x <= b.x, a.y <= b.y);
+rm_eq_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_boolx2(a.x == b.x, a.y == b.y);
 }
 RM_INLINE boolx3
-rm_lteq_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
+rm_eq_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
 }
 RM_INLINE boolx4
-rm_lteq_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+rm_eq_i16x4(const i16x4 a, const i16x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(_mm_cmpeq_epi16(rmmi_loadl(a.raw), rmmi_loadl(b.raw)),
+                       2);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u16(vceq_s16(vld1_s16(a.raw), vld1_s16(b.raw)));
+#else
+    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_lteq_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_boolx2(a.x <= b.x, a.y <= b.y);
+rm_eq_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_boolx2(a.x == b.x, a.y == b.y);
 }
 RM_INLINE boolx3
-rm_lteq_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
+rm_eq_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
 }
 RM_INLINE boolx4
-rm_lteq_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+rm_eq_i32x4(const i32x4 a, const i32x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(_mm_cmpeq_epi32(rmmi_load(a.raw), rmmi_load(b.raw)), 4);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u32(vceqq_s32(vld1q_s32(a.raw), vld1q_s32(b.raw)));
+#else
+    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_lteq_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_boolx2(a.x <= b.x, a.y <= b.y);
+rm_eq_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_boolx2(a.x == b.x, a.y == b.y);
 }
 RM_INLINE boolx3
-rm_lteq_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
+rm_eq_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
 }
 RM_INLINE boolx4
-rm_lteq_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+rm_eq_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
 }
 RM_INLINE boolx2
-rm_lteq_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_boolx2(a.x <= b.x, a.y <= b.y);
+rm_eq_f32x2(const f32x2 a, const f32x2 b) {
+    return rm_boolx2(a.x == b.x, a.y == b.y);
 }
 RM_INLINE boolx3
-rm_lteq_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
+rm_eq_f32x3(const f32x3 a, const f32x3 b) {
+    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
 }
 RM_INLINE boolx4
-rm_lteq_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+rm_eq_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_boolx4(rmm_cmpeq(rmm_load(a.raw), rmm_load(b.raw)));
+#else
+    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_lteq_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_boolx2(a.x <= b.x, a.y <= b.y);
+rm_eq_f64x2(const f64x2 a, const f64x2 b) {
+#if defined(RM_SSE2)
+    return rmmd_boolx2(_mm_cmpeq_pd(rmmd_load(a.raw), rmmd_load(b.raw)));
+#else
+    return rm_boolx2(a.x == b.x, a.y == b.y);
+#endif
 }
 RM_INLINE boolx3
-rm_lteq_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
+rm_eq_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_boolx3(a.x == b.x, a.y == b.y, a.z == b.z);
 }
 RM_INLINE boolx4
-rm_lteq_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+rm_eq_f64x4(const f64x4 a, const f64x4 b) {
+#if defined(RM_AVX)
+    return rmm256d_boolx4(_mm256_cmp_pd(rmm256d_load(a.raw),
+                                        rmm256d_load(b.raw), _CMP_EQ_OQ));
+#else
+    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_lteq_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_boolx2(a.x <= b.x, a.y <= b.y);
+rm_eqs_u8x2(const u8x2 v, const u8 s) {
+    return rm_eq_u8x2(v, rm_u8x2s(s));
 }
 RM_INLINE boolx3
-rm_lteq_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
+rm_eqs_u8x3(const u8x3 v, const u8 s) {
+    return rm_eq_u8x3(v, rm_u8x3s(s));
 }
 RM_INLINE boolx4
-rm_lteq_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+rm_eqs_u8x4(const u8x4 v, const u8 s) {
+    return rm_eq_u8x4(v, rm_u8x4s(s));
 }
 RM_INLINE boolx2
-rm_lteq_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_boolx2(a.x <= b.x, a.y <= b.y);
+rm_eqs_u16x2(const u16x2 v, const u16 s) {
+    return rm_eq_u16x2(v, rm_u16x2s(s));
 }
 RM_INLINE boolx3
-rm_lteq_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
+rm_eqs_u16x3(const u16x3 v, const u16 s) {
+    return rm_eq_u16x3(v, rm_u16x3s(s));
 }
 RM_INLINE boolx4
-rm_lteq_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+rm_eqs_u16x4(const u16x4 v, const u16 s) {
+    return rm_eq_u16x4(v, rm_u16x4s(s));
 }
 RM_INLINE boolx2
-rm_lteq_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_boolx2(a.x <= b.x, a.y <= b.y);
+rm_eqs_u32x2(const u32x2 v, const u32 s) {
+    return rm_eq_u32x2(v, rm_u32x2s(s));
 }
 RM_INLINE boolx3
-rm_lteq_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
+rm_eqs_u32x3(const u32x3 v, const u32 s) {
+    return rm_eq_u32x3(v, rm_u32x3s(s));
 }
 RM_INLINE boolx4
-rm_lteq_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+rm_eqs_u32x4(const u32x4 v, const u32 s) {
+    return rm_eq_u32x4(v, rm_u32x4s(s));
 }
 RM_INLINE boolx2
-rm_lteq_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_boolx2(a.x <= b.x, a.y <= b.y);
+rm_eqs_u64x2(const u64x2 v, const u64 s) {
+    return rm_eq_u64x2(v, rm_u64x2s(s));
 }
 RM_INLINE boolx3
-rm_lteq_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
+rm_eqs_u64x3(const u64x3 v, const u64 s) {
+    return rm_eq_u64x3(v, rm_u64x3s(s));
 }
 RM_INLINE boolx4
-rm_lteq_f32x4(const f32x4 a, const f32x4 b) {
-#if defined(RM_SSE2)
-    i32x4 tmp;
-    _mm_store_si128((__m128i*)tmp.raw, _mm_and_si128(_mm_castps_si128(_mm_cmple_ps(rmm_load(a.raw), rmm_load(b.raw))), _mm_set1_epi32(1)));
-    return rm_boolx4(tmp.x, tmp.y, tmp.z, tmp.w);
-#else
-    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
-#endif
+rm_eqs_u64x4(const u64x4 v, const u64 s) {
+    return rm_eq_u64x4(v, rm_u64x4s(s));
 }
 RM_INLINE boolx2
-rm_lteq_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_boolx2(a.x <= b.x, a.y <= b.y);
+rm_eqs_i8x2(const i8x2 v, const i8 s) {
+    return rm_eq_i8x2(v, rm_i8x2s(s));
 }
 RM_INLINE boolx3
-rm_lteq_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
+rm_eqs_i8x3(const i8x3 v, const i8 s) {
+    return rm_eq_i8x3(v, rm_i8x3s(s));
 }
 RM_INLINE boolx4
-rm_lteq_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+rm_eqs_i8x4(const i8x4 v, const i8 s) {
+    return rm_eq_i8x4(v, rm_i8x4s(s));
 }
 RM_INLINE boolx2
-rm_lteqs_u8x2(const u8x2 v, const u8 s) {
-    return rm_lteq_u8x2(v, rm_u8x2s(s));
+rm_eqs_i16x2(const i16x2 v, const i16 s) {
+    return rm_eq_i16x2(v, rm_i16x2s(s));
 }
 RM_INLINE boolx3
-rm_lteqs_u8x3(const u8x3 v, const u8 s) {
-    return rm_lteq_u8x3(v, rm_u8x3s(s));
+rm_eqs_i16x3(const i16x3 v, const i16 s) {
+    return rm_eq_i16x3(v, rm_i16x3s(s));
 }
 RM_INLINE boolx4
-rm_lteqs_u8x4(const u8x4 v, const u8 s) {
-    return rm_lteq_u8x4(v, rm_u8x4s(s));
+rm_eqs_i16x4(const i16x4 v, const i16 s) {
+    return rm_eq_i16x4(v, rm_i16x4s(s));
 }
 RM_INLINE boolx2
-rm_lteqs_u16x2(const u16x2 v, const u16 s) {
-    return rm_lteq_u16x2(v, rm_u16x2s(s));
+rm_eqs_i32x2(const i32x2 v, const i32 s) {
+    return rm_eq_i32x2(v, rm_i32x2s(s));
 }
 RM_INLINE boolx3
-rm_lteqs_u16x3(const u16x3 v, const u16 s) {
-    return rm_lteq_u16x3(v, rm_u16x3s(s));
+rm_eqs_i32x3(const i32x3 v, const i32 s) {
+    return rm_eq_i32x3(v, rm_i32x3s(s));
 }
 RM_INLINE boolx4
-rm_lteqs_u16x4(const u16x4 v, const u16 s) {
-    return rm_lteq_u16x4(v, rm_u16x4s(s));
+rm_eqs_i32x4(const i32x4 v, const i32 s) {
+    return rm_eq_i32x4(v, rm_i32x4s(s));
 }
 RM_INLINE boolx2
-rm_lteqs_u32x2(const u32x2 v, const u32 s) {
-    return rm_lteq_u32x2(v, rm_u32x2s(s));
+rm_eqs_i64x2(const i64x2 v, const i64 s) {
+    return rm_eq_i64x2(v, rm_i64x2s(s));
 }
 RM_INLINE boolx3
-rm_lteqs_u32x3(const u32x3 v, const u32 s) {
-    return rm_lteq_u32x3(v, rm_u32x3s(s));
+rm_eqs_i64x3(const i64x3 v, const i64 s) {
+    return rm_eq_i64x3(v, rm_i64x3s(s));
 }
 RM_INLINE boolx4
-rm_lteqs_u32x4(const u32x4 v, const u32 s) {
-    return rm_lteq_u32x4(v, rm_u32x4s(s));
+rm_eqs_i64x4(const i64x4 v, const i64 s) {
+    return rm_eq_i64x4(v, rm_i64x4s(s));
 }
 RM_INLINE boolx2
-rm_lteqs_u64x2(const u64x2 v, const u64 s) {
-    return rm_lteq_u64x2(v, rm_u64x2s(s));
+rm_eqs_f32x2(const f32x2 v, const f32 s) {
+    return rm_eq_f32x2(v, rm_f32x2s(s));
 }
 RM_INLINE boolx3
-rm_lteqs_u64x3(const u64x3 v, const u64 s) {
-    return rm_lteq_u64x3(v, rm_u64x3s(s));
+rm_eqs_f32x3(const f32x3 v, const f32 s) {
+    return rm_eq_f32x3(v, rm_f32x3s(s));
 }
 RM_INLINE boolx4
-rm_lteqs_u64x4(const u64x4 v, const u64 s) {
-    return rm_lteq_u64x4(v, rm_u64x4s(s));
+rm_eqs_f32x4(const f32x4 v, const f32 s) {
+    return rm_eq_f32x4(v, rm_f32x4s(s));
 }
 RM_INLINE boolx2
-rm_lteqs_i8x2(const i8x2 v, const i8 s) {
-    return rm_lteq_i8x2(v, rm_i8x2s(s));
+rm_eqs_f64x2(const f64x2 v, const f64 s) {
+    return rm_eq_f64x2(v, rm_f64x2s(s));
 }
 RM_INLINE boolx3
-rm_lteqs_i8x3(const i8x3 v, const i8 s) {
-    return rm_lteq_i8x3(v, rm_i8x3s(s));
+rm_eqs_f64x3(const f64x3 v, const f64 s) {
+    return rm_eq_f64x3(v, rm_f64x3s(s));
 }
 RM_INLINE boolx4
-rm_lteqs_i8x4(const i8x4 v, const i8 s) {
-    return rm_lteq_i8x4(v, rm_i8x4s(s));
+rm_eqs_f64x4(const f64x4 v, const f64 s) {
+    return rm_eq_f64x4(v, rm_f64x4s(s));
 }
 RM_INLINE boolx2
-rm_lteqs_i16x2(const i16x2 v, const i16 s) {
-    return rm_lteq_i16x2(v, rm_i16x2s(s));
+rm_neq_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_boolx2(a.x != b.x, a.y != b.y);
 }
 RM_INLINE boolx3
-rm_lteqs_i16x3(const i16x3 v, const i16 s) {
-    return rm_lteq_i16x3(v, rm_i16x3s(s));
+rm_neq_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
 }
 RM_INLINE boolx4
-rm_lteqs_i16x4(const i16x4 v, const i16 s) {
-    return rm_lteq_i16x4(v, rm_i16x4s(s));
+rm_neq_u8x4(const u8x4 a, const u8x4 b) {
+#if defined(RM_SSE2)
+    __m128i xa, xb;
+
+    xa = rmmi_from_u8x4(a);
+    xb = rmmi_from_u8x4(b);
+
+    return rmmi_boolx4(rmmi_not(_mm_cmpeq_epi8(xa, xb)), 1);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u8(vmvn_u8(vceq_u8(rmn_from_u8x4(a), rmn_from_u8x4(b))));
+#else
+    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_lteqs_i32x2(const i32x2 v, const i32 s) {
-    return rm_lteq_i32x2(v, rm_i32x2s(s));
+rm_neq_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_boolx2(a.x != b.x, a.y != b.y);
 }
 RM_INLINE boolx3
-rm_lteqs_i32x3(const i32x3 v, const i32 s) {
-    return rm_lteq_i32x3(v, rm_i32x3s(s));
+rm_neq_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
 }
 RM_INLINE boolx4
-rm_lteqs_i32x4(const i32x4 v, const i32 s) {
-    return rm_lteq_i32x4(v, rm_i32x4s(s));
+rm_neq_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
 }
 RM_INLINE boolx2
-rm_lteqs_i64x2(const i64x2 v, const i64 s) {
-    return rm_lteq_i64x2(v, rm_i64x2s(s));
+rm_neq_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_boolx2(a.x != b.x, a.y != b.y);
 }
 RM_INLINE boolx3
-rm_lteqs_i64x3(const i64x3 v, const i64 s) {
-    return rm_lteq_i64x3(v, rm_i64x3s(s));
+rm_neq_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
 }
 RM_INLINE boolx4
-rm_lteqs_i64x4(const i64x4 v, const i64 s) {
-    return rm_lteq_i64x4(v, rm_i64x4s(s));
+rm_neq_u32x4(const u32x4 a, const u32x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(rmmi_not(_mm_cmpeq_epi32(rmmi_load(a.raw),
+                                                rmmi_load(b.raw))), 4);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u32(vmvnq_u32(vceqq_u32(vld1q_u32(a.raw),
+                                              vld1q_u32(b.raw))));
+#else
+    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_lteqs_f32x2(const f32x2 v, const f32 s) {
-    return rm_lteq_f32x2(v, rm_f32x2s(s));
+rm_neq_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_boolx2(a.x != b.x, a.y != b.y);
 }
 RM_INLINE boolx3
-rm_lteqs_f32x3(const f32x3 v, const f32 s) {
-    return rm_lteq_f32x3(v, rm_f32x3s(s));
+rm_neq_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
 }
 RM_INLINE boolx4
-rm_lteqs_f32x4(const f32x4 v, const f32 s) {
-    return rm_lteq_f32x4(v, rm_f32x4s(s));
+rm_neq_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
 }
 RM_INLINE boolx2
-rm_lteqs_f64x2(const f64x2 v, const f64 s) {
-    return rm_lteq_f64x2(v, rm_f64x2s(s));
+rm_neq_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_boolx2(a.x != b.x, a.y != b.y);
 }
 RM_INLINE boolx3
-rm_lteqs_f64x3(const f64x3 v, const f64 s) {
-    return rm_lteq_f64x3(v, rm_f64x3s(s));
+rm_neq_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
 }
 RM_INLINE boolx4
-rm_lteqs_f64x4(const f64x4 v, const f64 s) {
-    return rm_lteq_f64x4(v, rm_f64x4s(s));
+rm_neq_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
 }
 RM_INLINE boolx2
-rm_gt_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_boolx2(a.x > b.x, a.y > b.y);
+rm_neq_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_boolx2(a.x != b.x, a.y != b.y);
 }
 RM_INLINE boolx3
-rm_gt_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
+rm_neq_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
 }
 RM_INLINE boolx4
-rm_gt_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+rm_neq_i16x4(const i16x4 a, const i16x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(rmmi_not(_mm_cmpeq_epi16(rmmi_loadl(a.raw),
+                                                rmmi_loadl(b.raw))), 2);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u16(vmvn_u16(vceq_s16(vld1_s16(a.raw), vld1_s16(b.raw))));
+#else
+    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_gt_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_boolx2(a.x > b.x, a.y > b.y);
+rm_neq_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_boolx2(a.x != b.x, a.y != b.y);
 }
 RM_INLINE boolx3
-rm_gt_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
+rm_neq_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
 }
 RM_INLINE boolx4
-rm_gt_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+rm_neq_i32x4(const i32x4 a, const i32x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(rmmi_not(_mm_cmpeq_epi32(rmmi_load(a.raw),
+                                                rmmi_load(b.raw))), 4);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u32(vmvnq_u32(vceqq_s32(vld1q_s32(a.raw),
+                                              vld1q_s32(b.raw))));
+#else
+    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_gt_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_boolx2(a.x > b.x, a.y > b.y);
+rm_neq_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_boolx2(a.x != b.x, a.y != b.y);
 }
 RM_INLINE boolx3
-rm_gt_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
+rm_neq_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
 }
 RM_INLINE boolx4
-rm_gt_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+rm_neq_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
 }
 RM_INLINE boolx2
-rm_gt_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_boolx2(a.x > b.x, a.y > b.y);
+rm_neq_f32x2(const f32x2 a, const f32x2 b) {
+    return rm_boolx2(a.x != b.x, a.y != b.y);
 }
 RM_INLINE boolx3
-rm_gt_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
+rm_neq_f32x3(const f32x3 a, const f32x3 b) {
+    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
 }
 RM_INLINE boolx4
-rm_gt_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+rm_neq_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_boolx4(rmm_cmpneq(rmm_load(a.raw), rmm_load(b.raw)));
+#else
+    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_gt_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_boolx2(a.x > b.x, a.y > b.y);
+rm_neq_f64x2(const f64x2 a, const f64x2 b) {
+#if defined(RM_SSE2)
+    return rmmd_boolx2(_mm_cmpneq_pd(rmmd_load(a.raw), rmmd_load(b.raw)));
+#else
+    return rm_boolx2(a.x != b.x, a.y != b.y);
+#endif
 }
 RM_INLINE boolx3
-rm_gt_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
+rm_neq_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_boolx3(a.x != b.x, a.y != b.y, a.z != b.z);
 }
 RM_INLINE boolx4
-rm_gt_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+rm_neq_f64x4(const f64x4 a, const f64x4 b) {
+#if defined(RM_AVX)
+    return rmm256d_boolx4(_mm256_cmp_pd(rmm256d_load(a.raw),
+                                        rmm256d_load(b.raw), _CMP_NEQ_UQ));
+#else
+    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_gt_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_boolx2(a.x > b.x, a.y > b.y);
+rm_neqs_u8x2(const u8x2 v, const u8 s) {
+    return rm_neq_u8x2(v, rm_u8x2s(s));
 }
 RM_INLINE boolx3
-rm_gt_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
+rm_neqs_u8x3(const u8x3 v, const u8 s) {
+    return rm_neq_u8x3(v, rm_u8x3s(s));
 }
 RM_INLINE boolx4
-rm_gt_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+rm_neqs_u8x4(const u8x4 v, const u8 s) {
+    return rm_neq_u8x4(v, rm_u8x4s(s));
 }
 RM_INLINE boolx2
-rm_gt_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_boolx2(a.x > b.x, a.y > b.y);
+rm_neqs_u16x2(const u16x2 v, const u16 s) {
+    return rm_neq_u16x2(v, rm_u16x2s(s));
 }
 RM_INLINE boolx3
-rm_gt_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
+rm_neqs_u16x3(const u16x3 v, const u16 s) {
+    return rm_neq_u16x3(v, rm_u16x3s(s));
 }
 RM_INLINE boolx4
-rm_gt_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+rm_neqs_u16x4(const u16x4 v, const u16 s) {
+    return rm_neq_u16x4(v, rm_u16x4s(s));
 }
 RM_INLINE boolx2
-rm_gt_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_boolx2(a.x > b.x, a.y > b.y);
+rm_neqs_u32x2(const u32x2 v, const u32 s) {
+    return rm_neq_u32x2(v, rm_u32x2s(s));
 }
 RM_INLINE boolx3
-rm_gt_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
+rm_neqs_u32x3(const u32x3 v, const u32 s) {
+    return rm_neq_u32x3(v, rm_u32x3s(s));
 }
 RM_INLINE boolx4
-rm_gt_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+rm_neqs_u32x4(const u32x4 v, const u32 s) {
+    return rm_neq_u32x4(v, rm_u32x4s(s));
 }
 RM_INLINE boolx2
-rm_gt_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_boolx2(a.x > b.x, a.y > b.y);
+rm_neqs_u64x2(const u64x2 v, const u64 s) {
+    return rm_neq_u64x2(v, rm_u64x2s(s));
 }
 RM_INLINE boolx3
-rm_gt_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
+rm_neqs_u64x3(const u64x3 v, const u64 s) {
+    return rm_neq_u64x3(v, rm_u64x3s(s));
 }
 RM_INLINE boolx4
-rm_gt_f32x4(const f32x4 a, const f32x4 b) {
-    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+rm_neqs_u64x4(const u64x4 v, const u64 s) {
+    return rm_neq_u64x4(v, rm_u64x4s(s));
 }
 RM_INLINE boolx2
-rm_gt_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_boolx2(a.x > b.x, a.y > b.y);
+rm_neqs_i8x2(const i8x2 v, const i8 s) {
+    return rm_neq_i8x2(v, rm_i8x2s(s));
 }
 RM_INLINE boolx3
-rm_gt_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
+rm_neqs_i8x3(const i8x3 v, const i8 s) {
+    return rm_neq_i8x3(v, rm_i8x3s(s));
 }
 RM_INLINE boolx4
-rm_gt_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+rm_neqs_i8x4(const i8x4 v, const i8 s) {
+    return rm_neq_i8x4(v, rm_i8x4s(s));
 }
 RM_INLINE boolx2
-rm_gts_u8x2(const u8x2 v, const u8 s) {
-    return rm_gt_u8x2(v, rm_u8x2s(s));
+rm_neqs_i16x2(const i16x2 v, const i16 s) {
+    return rm_neq_i16x2(v, rm_i16x2s(s));
 }
 RM_INLINE boolx3
-rm_gts_u8x3(const u8x3 v, const u8 s) {
-    return rm_gt_u8x3(v, rm_u8x3s(s));
+rm_neqs_i16x3(const i16x3 v, const i16 s) {
+    return rm_neq_i16x3(v, rm_i16x3s(s));
 }
 RM_INLINE boolx4
-rm_gts_u8x4(const u8x4 v, const u8 s) {
-    return rm_gt_u8x4(v, rm_u8x4s(s));
+rm_neqs_i16x4(const i16x4 v, const i16 s) {
+    return rm_neq_i16x4(v, rm_i16x4s(s));
 }
 RM_INLINE boolx2
-rm_gts_u16x2(const u16x2 v, const u16 s) {
-    return rm_gt_u16x2(v, rm_u16x2s(s));
+rm_neqs_i32x2(const i32x2 v, const i32 s) {
+    return rm_neq_i32x2(v, rm_i32x2s(s));
 }
 RM_INLINE boolx3
-rm_gts_u16x3(const u16x3 v, const u16 s) {
-    return rm_gt_u16x3(v, rm_u16x3s(s));
+rm_neqs_i32x3(const i32x3 v, const i32 s) {
+    return rm_neq_i32x3(v, rm_i32x3s(s));
 }
 RM_INLINE boolx4
-rm_gts_u16x4(const u16x4 v, const u16 s) {
-    return rm_gt_u16x4(v, rm_u16x4s(s));
+rm_neqs_i32x4(const i32x4 v, const i32 s) {
+    return rm_neq_i32x4(v, rm_i32x4s(s));
 }
 RM_INLINE boolx2
-rm_gts_u32x2(const u32x2 v, const u32 s) {
-    return rm_gt_u32x2(v, rm_u32x2s(s));
+rm_neqs_i64x2(const i64x2 v, const i64 s) {
+    return rm_neq_i64x2(v, rm_i64x2s(s));
 }
 RM_INLINE boolx3
-rm_gts_u32x3(const u32x3 v, const u32 s) {
-    return rm_gt_u32x3(v, rm_u32x3s(s));
+rm_neqs_i64x3(const i64x3 v, const i64 s) {
+    return rm_neq_i64x3(v, rm_i64x3s(s));
 }
 RM_INLINE boolx4
-rm_gts_u32x4(const u32x4 v, const u32 s) {
-    return rm_gt_u32x4(v, rm_u32x4s(s));
+rm_neqs_i64x4(const i64x4 v, const i64 s) {
+    return rm_neq_i64x4(v, rm_i64x4s(s));
 }
 RM_INLINE boolx2
-rm_gts_u64x2(const u64x2 v, const u64 s) {
-    return rm_gt_u64x2(v, rm_u64x2s(s));
+rm_neqs_f32x2(const f32x2 v, const f32 s) {
+    return rm_neq_f32x2(v, rm_f32x2s(s));
 }
 RM_INLINE boolx3
-rm_gts_u64x3(const u64x3 v, const u64 s) {
-    return rm_gt_u64x3(v, rm_u64x3s(s));
+rm_neqs_f32x3(const f32x3 v, const f32 s) {
+    return rm_neq_f32x3(v, rm_f32x3s(s));
 }
 RM_INLINE boolx4
-rm_gts_u64x4(const u64x4 v, const u64 s) {
-    return rm_gt_u64x4(v, rm_u64x4s(s));
+rm_neqs_f32x4(const f32x4 v, const f32 s) {
+    return rm_neq_f32x4(v, rm_f32x4s(s));
 }
 RM_INLINE boolx2
-rm_gts_i8x2(const i8x2 v, const i8 s) {
-    return rm_gt_i8x2(v, rm_i8x2s(s));
+rm_neqs_f64x2(const f64x2 v, const f64 s) {
+    return rm_neq_f64x2(v, rm_f64x2s(s));
 }
 RM_INLINE boolx3
-rm_gts_i8x3(const i8x3 v, const i8 s) {
-    return rm_gt_i8x3(v, rm_i8x3s(s));
+rm_neqs_f64x3(const f64x3 v, const f64 s) {
+    return rm_neq_f64x3(v, rm_f64x3s(s));
 }
 RM_INLINE boolx4
-rm_gts_i8x4(const i8x4 v, const i8 s) {
-    return rm_gt_i8x4(v, rm_i8x4s(s));
+rm_neqs_f64x4(const f64x4 v, const f64 s) {
+    return rm_neq_f64x4(v, rm_f64x4s(s));
 }
 RM_INLINE boolx2
-rm_gts_i16x2(const i16x2 v, const i16 s) {
-    return rm_gt_i16x2(v, rm_i16x2s(s));
+rm_lt_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_boolx2(a.x < b.x, a.y < b.y);
 }
 RM_INLINE boolx3
-rm_gts_i16x3(const i16x3 v, const i16 s) {
-    return rm_gt_i16x3(v, rm_i16x3s(s));
+rm_lt_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
 }
 RM_INLINE boolx4
-rm_gts_i16x4(const i16x4 v, const i16 s) {
-    return rm_gt_i16x4(v, rm_i16x4s(s));
+rm_lt_u8x4(const u8x4 a, const u8x4 b) {
+#if defined(RM_SSE2)
+    __m128i xa, xb;
+
+    xa = rmmi_from_u8x4(a);
+    xb = rmmi_from_u8x4(b);
+
+    return rmmi_boolx4(rmmi_not(_mm_cmpeq_epi8(_mm_max_epu8(xa, xb), xa)), 1);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u8(vclt_u8(rmn_from_u8x4(a), rmn_from_u8x4(b)));
+#else
+    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_gts_i32x2(const i32x2 v, const i32 s) {
-    return rm_gt_i32x2(v, rm_i32x2s(s));
+rm_lt_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_boolx2(a.x < b.x, a.y < b.y);
 }
 RM_INLINE boolx3
-rm_gts_i32x3(const i32x3 v, const i32 s) {
-    return rm_gt_i32x3(v, rm_i32x3s(s));
+rm_lt_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
 }
 RM_INLINE boolx4
-rm_gts_i32x4(const i32x4 v, const i32 s) {
-    return rm_gt_i32x4(v, rm_i32x4s(s));
+rm_lt_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
 }
 RM_INLINE boolx2
-rm_gts_i64x2(const i64x2 v, const i64 s) {
-    return rm_gt_i64x2(v, rm_i64x2s(s));
+rm_lt_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_boolx2(a.x < b.x, a.y < b.y);
 }
 RM_INLINE boolx3
-rm_gts_i64x3(const i64x3 v, const i64 s) {
-    return rm_gt_i64x3(v, rm_i64x3s(s));
+rm_lt_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
 }
 RM_INLINE boolx4
-rm_gts_i64x4(const i64x4 v, const i64 s) {
-    return rm_gt_i64x4(v, rm_i64x4s(s));
+rm_lt_u32x4(const u32x4 a, const u32x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(rmmi_cmplt_epu32(rmmi_load(a.raw), rmmi_load(b.raw)), 4);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u32(vcltq_u32(vld1q_u32(a.raw), vld1q_u32(b.raw)));
+#else
+    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_gts_f32x2(const f32x2 v, const f32 s) {
-    return rm_gt_f32x2(v, rm_f32x2s(s));
+rm_lt_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_boolx2(a.x < b.x, a.y < b.y);
 }
 RM_INLINE boolx3
-rm_gts_f32x3(const f32x3 v, const f32 s) {
-    return rm_gt_f32x3(v, rm_f32x3s(s));
+rm_lt_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
 }
 RM_INLINE boolx4
-rm_gts_f32x4(const f32x4 v, const f32 s) {
-    return rm_gt_f32x4(v, rm_f32x4s(s));
+rm_lt_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
 }
 RM_INLINE boolx2
-rm_gts_f64x2(const f64x2 v, const f64 s) {
-    return rm_gt_f64x2(v, rm_f64x2s(s));
+rm_lt_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_boolx2(a.x < b.x, a.y < b.y);
 }
 RM_INLINE boolx3
-rm_gts_f64x3(const f64x3 v, const f64 s) {
-    return rm_gt_f64x3(v, rm_f64x3s(s));
+rm_lt_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
 }
 RM_INLINE boolx4
-rm_gts_f64x4(const f64x4 v, const f64 s) {
-    return rm_gt_f64x4(v, rm_f64x4s(s));
+rm_lt_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
 }
 RM_INLINE boolx2
-rm_gteq_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_boolx2(a.x >= b.x, a.y >= b.y);
+rm_lt_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_boolx2(a.x < b.x, a.y < b.y);
 }
 RM_INLINE boolx3
-rm_gteq_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
+rm_lt_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
 }
 RM_INLINE boolx4
-rm_gteq_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+rm_lt_i16x4(const i16x4 a, const i16x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(_mm_cmplt_epi16(rmmi_loadl(a.raw), rmmi_loadl(b.raw)),
+                       2);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u16(vclt_s16(vld1_s16(a.raw), vld1_s16(b.raw)));
+#else
+    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_gteq_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_boolx2(a.x >= b.x, a.y >= b.y);
+rm_lt_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_boolx2(a.x < b.x, a.y < b.y);
 }
 RM_INLINE boolx3
-rm_gteq_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
+rm_lt_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
 }
 RM_INLINE boolx4
-rm_gteq_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+rm_lt_i32x4(const i32x4 a, const i32x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(_mm_cmplt_epi32(rmmi_load(a.raw), rmmi_load(b.raw)), 4);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u32(vcltq_s32(vld1q_s32(a.raw), vld1q_s32(b.raw)));
+#else
+    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_gteq_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_boolx2(a.x >= b.x, a.y >= b.y);
+rm_lt_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_boolx2(a.x < b.x, a.y < b.y);
 }
 RM_INLINE boolx3
-rm_gteq_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
+rm_lt_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
 }
 RM_INLINE boolx4
-rm_gteq_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+rm_lt_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
 }
 RM_INLINE boolx2
-rm_gteq_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_boolx2(a.x >= b.x, a.y >= b.y);
+rm_lt_f32x2(const f32x2 a, const f32x2 b) {
+    return rm_boolx2(a.x < b.x, a.y < b.y);
 }
 RM_INLINE boolx3
-rm_gteq_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
+rm_lt_f32x3(const f32x3 a, const f32x3 b) {
+    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
 }
 RM_INLINE boolx4
-rm_gteq_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+rm_lt_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_boolx4(rmm_cmplt(rmm_load(a.raw), rmm_load(b.raw)));
+#else
+    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_gteq_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_boolx2(a.x >= b.x, a.y >= b.y);
+rm_lt_f64x2(const f64x2 a, const f64x2 b) {
+#if defined(RM_SSE2)
+    return rmmd_boolx2(_mm_cmplt_pd(rmmd_load(a.raw), rmmd_load(b.raw)));
+#else
+    return rm_boolx2(a.x < b.x, a.y < b.y);
+#endif
 }
 RM_INLINE boolx3
-rm_gteq_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
+rm_lt_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_boolx3(a.x < b.x, a.y < b.y, a.z < b.z);
 }
 RM_INLINE boolx4
-rm_gteq_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+rm_lt_f64x4(const f64x4 a, const f64x4 b) {
+#if defined(RM_AVX)
+    return rmm256d_boolx4(_mm256_cmp_pd(rmm256d_load(a.raw),
+                                        rmm256d_load(b.raw), _CMP_LT_OQ));
+#else
+    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_gteq_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_boolx2(a.x >= b.x, a.y >= b.y);
+rm_lts_u8x2(const u8x2 v, const u8 s) {
+    return rm_lt_u8x2(v, rm_u8x2s(s));
 }
 RM_INLINE boolx3
-rm_gteq_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
+rm_lts_u8x3(const u8x3 v, const u8 s) {
+    return rm_lt_u8x3(v, rm_u8x3s(s));
 }
 RM_INLINE boolx4
-rm_gteq_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+rm_lts_u8x4(const u8x4 v, const u8 s) {
+    return rm_lt_u8x4(v, rm_u8x4s(s));
 }
 RM_INLINE boolx2
-rm_gteq_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_boolx2(a.x >= b.x, a.y >= b.y);
+rm_lts_u16x2(const u16x2 v, const u16 s) {
+    return rm_lt_u16x2(v, rm_u16x2s(s));
 }
 RM_INLINE boolx3
-rm_gteq_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
+rm_lts_u16x3(const u16x3 v, const u16 s) {
+    return rm_lt_u16x3(v, rm_u16x3s(s));
 }
 RM_INLINE boolx4
-rm_gteq_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+rm_lts_u16x4(const u16x4 v, const u16 s) {
+    return rm_lt_u16x4(v, rm_u16x4s(s));
 }
 RM_INLINE boolx2
-rm_gteq_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_boolx2(a.x >= b.x, a.y >= b.y);
+rm_lts_u32x2(const u32x2 v, const u32 s) {
+    return rm_lt_u32x2(v, rm_u32x2s(s));
 }
 RM_INLINE boolx3
-rm_gteq_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
+rm_lts_u32x3(const u32x3 v, const u32 s) {
+    return rm_lt_u32x3(v, rm_u32x3s(s));
 }
 RM_INLINE boolx4
-rm_gteq_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+rm_lts_u32x4(const u32x4 v, const u32 s) {
+    return rm_lt_u32x4(v, rm_u32x4s(s));
 }
 RM_INLINE boolx2
-rm_gteq_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_boolx2(a.x >= b.x, a.y >= b.y);
+rm_lts_u64x2(const u64x2 v, const u64 s) {
+    return rm_lt_u64x2(v, rm_u64x2s(s));
 }
 RM_INLINE boolx3
-rm_gteq_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
+rm_lts_u64x3(const u64x3 v, const u64 s) {
+    return rm_lt_u64x3(v, rm_u64x3s(s));
 }
 RM_INLINE boolx4
-rm_gteq_f32x4(const f32x4 a, const f32x4 b) {
-    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+rm_lts_u64x4(const u64x4 v, const u64 s) {
+    return rm_lt_u64x4(v, rm_u64x4s(s));
 }
 RM_INLINE boolx2
-rm_gteq_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_boolx2(a.x >= b.x, a.y >= b.y);
+rm_lts_i8x2(const i8x2 v, const i8 s) {
+    return rm_lt_i8x2(v, rm_i8x2s(s));
 }
 RM_INLINE boolx3
-rm_gteq_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
+rm_lts_i8x3(const i8x3 v, const i8 s) {
+    return rm_lt_i8x3(v, rm_i8x3s(s));
 }
 RM_INLINE boolx4
-rm_gteq_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+rm_lts_i8x4(const i8x4 v, const i8 s) {
+    return rm_lt_i8x4(v, rm_i8x4s(s));
 }
 RM_INLINE boolx2
-rm_gteqs_u8x2(const u8x2 v, const u8 s) {
-    return rm_gteq_u8x2(v, rm_u8x2s(s));
+rm_lts_i16x2(const i16x2 v, const i16 s) {
+    return rm_lt_i16x2(v, rm_i16x2s(s));
 }
 RM_INLINE boolx3
-rm_gteqs_u8x3(const u8x3 v, const u8 s) {
-    return rm_gteq_u8x3(v, rm_u8x3s(s));
+rm_lts_i16x3(const i16x3 v, const i16 s) {
+    return rm_lt_i16x3(v, rm_i16x3s(s));
 }
 RM_INLINE boolx4
-rm_gteqs_u8x4(const u8x4 v, const u8 s) {
-    return rm_gteq_u8x4(v, rm_u8x4s(s));
+rm_lts_i16x4(const i16x4 v, const i16 s) {
+    return rm_lt_i16x4(v, rm_i16x4s(s));
 }
 RM_INLINE boolx2
-rm_gteqs_u16x2(const u16x2 v, const u16 s) {
-    return rm_gteq_u16x2(v, rm_u16x2s(s));
+rm_lts_i32x2(const i32x2 v, const i32 s) {
+    return rm_lt_i32x2(v, rm_i32x2s(s));
 }
 RM_INLINE boolx3
-rm_gteqs_u16x3(const u16x3 v, const u16 s) {
-    return rm_gteq_u16x3(v, rm_u16x3s(s));
+rm_lts_i32x3(const i32x3 v, const i32 s) {
+    return rm_lt_i32x3(v, rm_i32x3s(s));
 }
 RM_INLINE boolx4
-rm_gteqs_u16x4(const u16x4 v, const u16 s) {
-    return rm_gteq_u16x4(v, rm_u16x4s(s));
+rm_lts_i32x4(const i32x4 v, const i32 s) {
+    return rm_lt_i32x4(v, rm_i32x4s(s));
 }
 RM_INLINE boolx2
-rm_gteqs_u32x2(const u32x2 v, const u32 s) {
-    return rm_gteq_u32x2(v, rm_u32x2s(s));
+rm_lts_i64x2(const i64x2 v, const i64 s) {
+    return rm_lt_i64x2(v, rm_i64x2s(s));
 }
 RM_INLINE boolx3
-rm_gteqs_u32x3(const u32x3 v, const u32 s) {
-    return rm_gteq_u32x3(v, rm_u32x3s(s));
+rm_lts_i64x3(const i64x3 v, const i64 s) {
+    return rm_lt_i64x3(v, rm_i64x3s(s));
 }
 RM_INLINE boolx4
-rm_gteqs_u32x4(const u32x4 v, const u32 s) {
-    return rm_gteq_u32x4(v, rm_u32x4s(s));
+rm_lts_i64x4(const i64x4 v, const i64 s) {
+    return rm_lt_i64x4(v, rm_i64x4s(s));
 }
 RM_INLINE boolx2
-rm_gteqs_u64x2(const u64x2 v, const u64 s) {
-    return rm_gteq_u64x2(v, rm_u64x2s(s));
+rm_lts_f32x2(const f32x2 v, const f32 s) {
+    return rm_lt_f32x2(v, rm_f32x2s(s));
 }
 RM_INLINE boolx3
-rm_gteqs_u64x3(const u64x3 v, const u64 s) {
-    return rm_gteq_u64x3(v, rm_u64x3s(s));
+rm_lts_f32x3(const f32x3 v, const f32 s) {
+    return rm_lt_f32x3(v, rm_f32x3s(s));
 }
 RM_INLINE boolx4
-rm_gteqs_u64x4(const u64x4 v, const u64 s) {
-    return rm_gteq_u64x4(v, rm_u64x4s(s));
+rm_lts_f32x4(const f32x4 v, const f32 s) {
+    return rm_lt_f32x4(v, rm_f32x4s(s));
 }
 RM_INLINE boolx2
-rm_gteqs_i8x2(const i8x2 v, const i8 s) {
-    return rm_gteq_i8x2(v, rm_i8x2s(s));
+rm_lts_f64x2(const f64x2 v, const f64 s) {
+    return rm_lt_f64x2(v, rm_f64x2s(s));
 }
 RM_INLINE boolx3
-rm_gteqs_i8x3(const i8x3 v, const i8 s) {
-    return rm_gteq_i8x3(v, rm_i8x3s(s));
+rm_lts_f64x3(const f64x3 v, const f64 s) {
+    return rm_lt_f64x3(v, rm_f64x3s(s));
 }
 RM_INLINE boolx4
-rm_gteqs_i8x4(const i8x4 v, const i8 s) {
-    return rm_gteq_i8x4(v, rm_i8x4s(s));
+rm_lts_f64x4(const f64x4 v, const f64 s) {
+    return rm_lt_f64x4(v, rm_f64x4s(s));
 }
 RM_INLINE boolx2
-rm_gteqs_i16x2(const i16x2 v, const i16 s) {
-    return rm_gteq_i16x2(v, rm_i16x2s(s));
+rm_lteq_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_boolx2(a.x <= b.x, a.y <= b.y);
 }
 RM_INLINE boolx3
-rm_gteqs_i16x3(const i16x3 v, const i16 s) {
-    return rm_gteq_i16x3(v, rm_i16x3s(s));
+rm_lteq_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
 }
 RM_INLINE boolx4
-rm_gteqs_i16x4(const i16x4 v, const i16 s) {
-    return rm_gteq_i16x4(v, rm_i16x4s(s));
+rm_lteq_u8x4(const u8x4 a, const u8x4 b) {
+#if defined(RM_SSE2)
+    __m128i xa, xb;
+
+    xa = rmmi_from_u8x4(a);
+    xb = rmmi_from_u8x4(b);
+
+    return rmmi_boolx4(_mm_cmpeq_epi8(_mm_min_epu8(xa, xb), xa), 1);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u8(vcle_u8(rmn_from_u8x4(a), rmn_from_u8x4(b)));
+#else
+    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_gteqs_i32x2(const i32x2 v, const i32 s) {
-    return rm_gteq_i32x2(v, rm_i32x2s(s));
+rm_lteq_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_boolx2(a.x <= b.x, a.y <= b.y);
 }
 RM_INLINE boolx3
-rm_gteqs_i32x3(const i32x3 v, const i32 s) {
-    return rm_gteq_i32x3(v, rm_i32x3s(s));
+rm_lteq_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
 }
 RM_INLINE boolx4
-rm_gteqs_i32x4(const i32x4 v, const i32 s) {
-    return rm_gteq_i32x4(v, rm_i32x4s(s));
+rm_lteq_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
 }
 RM_INLINE boolx2
-rm_gteqs_i64x2(const i64x2 v, const i64 s) {
-    return rm_gteq_i64x2(v, rm_i64x2s(s));
+rm_lteq_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_boolx2(a.x <= b.x, a.y <= b.y);
 }
 RM_INLINE boolx3
-rm_gteqs_i64x3(const i64x3 v, const i64 s) {
-    return rm_gteq_i64x3(v, rm_i64x3s(s));
+rm_lteq_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
 }
 RM_INLINE boolx4
-rm_gteqs_i64x4(const i64x4 v, const i64 s) {
-    return rm_gteq_i64x4(v, rm_i64x4s(s));
+rm_lteq_u32x4(const u32x4 a, const u32x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(rmmi_not(rmmi_cmpgt_epu32(rmmi_load(a.raw),
+                                                 rmmi_load(b.raw))), 4);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u32(vcleq_u32(vld1q_u32(a.raw), vld1q_u32(b.raw)));
+#else
+    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+#endif
 }
 RM_INLINE boolx2
-rm_gteqs_f32x2(const f32x2 v, const f32 s) {
-    return rm_gteq_f32x2(v, rm_f32x2s(s));
+rm_lteq_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_boolx2(a.x <= b.x, a.y <= b.y);
 }
 RM_INLINE boolx3
-rm_gteqs_f32x3(const f32x3 v, const f32 s) {
-    return rm_gteq_f32x3(v, rm_f32x3s(s));
+rm_lteq_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
 }
 RM_INLINE boolx4
-rm_gteqs_f32x4(const f32x4 v, const f32 s) {
-    return rm_gteq_f32x4(v, rm_f32x4s(s));
+rm_lteq_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
 }
 RM_INLINE boolx2
-rm_gteqs_f64x2(const f64x2 v, const f64 s) {
-    return rm_gteq_f64x2(v, rm_f64x2s(s));
+rm_lteq_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_boolx2(a.x <= b.x, a.y <= b.y);
 }
 RM_INLINE boolx3
-rm_gteqs_f64x3(const f64x3 v, const f64 s) {
-    return rm_gteq_f64x3(v, rm_f64x3s(s));
+rm_lteq_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
 }
 RM_INLINE boolx4
-rm_gteqs_f64x4(const f64x4 v, const f64 s) {
-    return rm_gteq_f64x4(v, rm_f64x4s(s));
-}
-RM_INLINE i8x2
-rm_neg_i8x2(const i8x2 v) {
-    return rm_i8x2(-v.x, -v.y);
+rm_lteq_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
 }
-RM_INLINE i8x3
-rm_neg_i8x3(const i8x3 v) {
-    return rm_i8x3(-v.x, -v.y, -v.z);
+RM_INLINE boolx2
+rm_lteq_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_boolx2(a.x <= b.x, a.y <= b.y);
 }
-RM_INLINE i8x4
-rm_neg_i8x4(const i8x4 v) {
-    return rm_i8x4(-v.x, -v.y, -v.z, -v.w);
+RM_INLINE boolx3
+rm_lteq_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
 }
-RM_INLINE i16x2
-rm_neg_i16x2(const i16x2 v) {
-    return rm_i16x2(-v.x, -v.y);
+RM_INLINE boolx4
+rm_lteq_i16x4(const i16x4 a, const i16x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(rmmi_not(_mm_cmpgt_epi16(rmmi_loadl(a.raw),
+                                                rmmi_loadl(b.raw))), 2);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u16(vcle_s16(vld1_s16(a.raw), vld1_s16(b.raw)));
+#else
+    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+#endif
 }
-RM_INLINE i16x3
-rm_neg_i16x3(const i16x3 v) {
-    return rm_i16x3(-v.x, -v.y, -v.z);
-}
-RM_INLINE i16x4
-rm_neg_i16x4(const i16x4 v) {
-    return rm_i16x4(-v.x, -v.y, -v.z, -v.w);
-}
-RM_INLINE i32x2
-rm_neg_i32x2(const i32x2 v) {
-    return rm_i32x2(-v.x, -v.y);
+RM_INLINE boolx2
+rm_lteq_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_boolx2(a.x <= b.x, a.y <= b.y);
 }
-RM_INLINE i32x3
-rm_neg_i32x3(const i32x3 v) {
-    return rm_i32x3(-v.x, -v.y, -v.z);
+RM_INLINE boolx3
+rm_lteq_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
 }
-RM_INLINE i32x4
-rm_neg_i32x4(const i32x4 v) {
-    return rm_i32x4(-v.x, -v.y, -v.z, -v.w);
+RM_INLINE boolx4
+rm_lteq_i32x4(const i32x4 a, const i32x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(rmmi_not(_mm_cmpgt_epi32(rmmi_load(a.raw),
+                                                rmmi_load(b.raw))), 4);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u32(vcleq_s32(vld1q_s32(a.raw), vld1q_s32(b.raw)));
+#else
+    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+#endif
 }
-RM_INLINE i64x2
-rm_neg_i64x2(const i64x2 v) {
-    return rm_i64x2(-v.x, -v.y);
+RM_INLINE boolx2
+rm_lteq_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_boolx2(a.x <= b.x, a.y <= b.y);
 }
-RM_INLINE i64x3
-rm_neg_i64x3(const i64x3 v) {
-    return rm_i64x3(-v.x, -v.y, -v.z);
+RM_INLINE boolx3
+rm_lteq_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
 }
-RM_INLINE i64x4
-rm_neg_i64x4(const i64x4 v) {
-    return rm_i64x4(-v.x, -v.y, -v.z, -v.w);
+RM_INLINE boolx4
+rm_lteq_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
 }
-RM_INLINE f32x2
-rm_neg_f32x2(const f32x2 v) {
-    return rm_f32x2(-v.x, -v.y);
+RM_INLINE boolx2
+rm_lteq_f32x2(const f32x2 a, const f32x2 b) {
+    return rm_boolx2(a.x <= b.x, a.y <= b.y);
 }
-RM_INLINE f32x3
-rm_neg_f32x3(const f32x3 v) {
-    return rm_f32x3(-v.x, -v.y, -v.z);
+RM_INLINE boolx3
+rm_lteq_f32x3(const f32x3 a, const f32x3 b) {
+    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
 }
-RM_INLINE f32x4
-rm_neg_f32x4(const f32x4 v) {
-    f32x4 dest;
-#if defined(RM_SSE)
-    rmm_store(dest.raw,
-                 _mm_xor_ps(rmm_load(v.raw), RMM_SIGNMASK_NEG_F32X4));
+RM_INLINE boolx4
+rm_lteq_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_boolx4(rmm_cmple(rmm_load(a.raw), rmm_load(b.raw)));
 #else
-    dest = rm_f32x4(-v.x, -v.y, -v.z, -v.w);
+    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
 #endif
-    return dest;
 }
-RM_INLINE f64x2
-rm_neg_f64x2(const f64x2 v) {
-    return rm_f64x2(-v.x, -v.y);
+RM_INLINE boolx2
+rm_lteq_f64x2(const f64x2 a, const f64x2 b) {
+#if defined(RM_SSE2)
+    return rmmd_boolx2(_mm_cmple_pd(rmmd_load(a.raw), rmmd_load(b.raw)));
+#else
+    return rm_boolx2(a.x <= b.x, a.y <= b.y);
+#endif
 }
-RM_INLINE f64x3
-rm_neg_f64x3(const f64x3 v) {
-    return rm_f64x3(-v.x, -v.y, -v.z);
+RM_INLINE boolx3
+rm_lteq_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_boolx3(a.x <= b.x, a.y <= b.y, a.z <= b.z);
 }
-RM_INLINE f64x4
-rm_neg_f64x4(const f64x4 v) {
-    return rm_f64x4(-v.x, -v.y, -v.z, -v.w);
+RM_INLINE boolx4
+rm_lteq_f64x4(const f64x4 a, const f64x4 b) {
+#if defined(RM_AVX)
+    return rmm256d_boolx4(_mm256_cmp_pd(rmm256d_load(a.raw),
+                                        rmm256d_load(b.raw), _CMP_LE_OQ));
+#else
+    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+#endif
 }
-RM_INLINE i8x2
-rm_abs_i8x2(const i8x2 v) {
-    return rm_i8x2(rm_abs_i8(v.x), rm_abs_i8(v.y));
+RM_INLINE boolx2
+rm_lteqs_u8x2(const u8x2 v, const u8 s) {
+    return rm_lteq_u8x2(v, rm_u8x2s(s));
 }
-RM_INLINE i8x3
-rm_abs_i8x3(const i8x3 v) {
-    return rm_i8x3(rm_abs_i8(v.x), rm_abs_i8(v.y), rm_abs_i8(v.z));
+RM_INLINE boolx3
+rm_lteqs_u8x3(const u8x3 v, const u8 s) {
+    return rm_lteq_u8x3(v, rm_u8x3s(s));
 }
-RM_INLINE i8x4
-rm_abs_i8x4(const i8x4 v) {
-    return rm_i8x4(rm_abs_i8(v.x), rm_abs_i8(v.y), rm_abs_i8(v.z),
-                   rm_abs_i8(v.w));
+RM_INLINE boolx4
+rm_lteqs_u8x4(const u8x4 v, const u8 s) {
+    return rm_lteq_u8x4(v, rm_u8x4s(s));
 }
-RM_INLINE i16x2
-rm_abs_i16x2(const i16x2 v) {
-    return rm_i16x2(rm_abs_i16(v.x), rm_abs_i16(v.y));
+RM_INLINE boolx2
+rm_lteqs_u16x2(const u16x2 v, const u16 s) {
+    return rm_lteq_u16x2(v, rm_u16x2s(s));
 }
-RM_INLINE i16x3
-rm_abs_i16x3(const i16x3 v) {
-    return rm_i16x3(rm_abs_i16(v.x), rm_abs_i16(v.y), rm_abs_i16(v.z));
+RM_INLINE boolx3
+rm_lteqs_u16x3(const u16x3 v, const u16 s) {
+    return rm_lteq_u16x3(v, rm_u16x3s(s));
 }
-RM_INLINE i16x4
-rm_abs_i16x4(const i16x4 v) {
-    return rm_i16x4(rm_abs_i16(v.x), rm_abs_i16(v.y), rm_abs_i16(v.z),
-                    rm_abs_i16(v.w));
+RM_INLINE boolx4
+rm_lteqs_u16x4(const u16x4 v, const u16 s) {
+    return rm_lteq_u16x4(v, rm_u16x4s(s));
 }
-RM_INLINE i32x2
-rm_abs_i32x2(const i32x2 v) {
-    return rm_i32x2(rm_abs_i32(v.x), rm_abs_i32(v.y));
+RM_INLINE boolx2
+rm_lteqs_u32x2(const u32x2 v, const u32 s) {
+    return rm_lteq_u32x2(v, rm_u32x2s(s));
 }
-RM_INLINE i32x3
-rm_abs_i32x3(const i32x3 v) {
-    return rm_i32x3(rm_abs_i32(v.x), rm_abs_i32(v.y), rm_abs_i32(v.z));
+RM_INLINE boolx3
+rm_lteqs_u32x3(const u32x3 v, const u32 s) {
+    return rm_lteq_u32x3(v, rm_u32x3s(s));
 }
-RM_INLINE i32x4
-rm_abs_i32x4(const i32x4 v) {
-    return rm_i32x4(rm_abs_i32(v.x), rm_abs_i32(v.y), rm_abs_i32(v.z),
-                    rm_abs_i32(v.w));
+RM_INLINE boolx4
+rm_lteqs_u32x4(const u32x4 v, const u32 s) {
+    return rm_lteq_u32x4(v, rm_u32x4s(s));
 }
-RM_INLINE i64x2
-rm_abs_i64x2(const i64x2 v) {
-    return rm_i64x2(rm_abs_i64(v.x), rm_abs_i64(v.y));
+RM_INLINE boolx2
+rm_lteqs_u64x2(const u64x2 v, const u64 s) {
+    return rm_lteq_u64x2(v, rm_u64x2s(s));
 }
-RM_INLINE i64x3
-rm_abs_i64x3(const i64x3 v) {
-    return rm_i64x3(rm_abs_i64(v.x), rm_abs_i64(v.y), rm_abs_i64(v.z));
+RM_INLINE boolx3
+rm_lteqs_u64x3(const u64x3 v, const u64 s) {
+    return rm_lteq_u64x3(v, rm_u64x3s(s));
 }
-RM_INLINE i64x4
-rm_abs_i64x4(const i64x4 v) {
-    return rm_i64x4(rm_abs_i64(v.x), rm_abs_i64(v.y), rm_abs_i64(v.z),
-                    rm_abs_i64(v.w));
+RM_INLINE boolx4
+rm_lteqs_u64x4(const u64x4 v, const u64 s) {
+    return rm_lteq_u64x4(v, rm_u64x4s(s));
 }
-RM_INLINE f32x2
-rm_abs_f32x2(const f32x2 v) {
-    return rm_f32x2(rm_abs_f32(v.x), rm_abs_f32(v.y));
+RM_INLINE boolx2
+rm_lteqs_i8x2(const i8x2 v, const i8 s) {
+    return rm_lteq_i8x2(v, rm_i8x2s(s));
 }
-RM_INLINE f32x3
-rm_abs_f32x3(const f32x3 v) {
-    return rm_f32x3(rm_abs_f32(v.x), rm_abs_f32(v.y), rm_abs_f32(v.z));
+RM_INLINE boolx3
+rm_lteqs_i8x3(const i8x3 v, const i8 s) {
+    return rm_lteq_i8x3(v, rm_i8x3s(s));
 }
-RM_INLINE f32x4
-rm_abs_f32x4(const f32x4 v) {
-    return rm_f32x4(rm_abs_f32(v.x), rm_abs_f32(v.y), rm_abs_f32(v.z),
-                    rm_abs_f32(v.w));
+RM_INLINE boolx4
+rm_lteqs_i8x4(const i8x4 v, const i8 s) {
+    return rm_lteq_i8x4(v, rm_i8x4s(s));
 }
-RM_INLINE f64x2
-rm_abs_f64x2(const f64x2 v) {
-    return rm_f64x2(rm_abs_f64(v.x), rm_abs_f64(v.y));
+RM_INLINE boolx2
+rm_lteqs_i16x2(const i16x2 v, const i16 s) {
+    return rm_lteq_i16x2(v, rm_i16x2s(s));
 }
-RM_INLINE f64x3
-rm_abs_f64x3(const f64x3 v) {
-    return rm_f64x3(rm_abs_f64(v.x), rm_abs_f64(v.y), rm_abs_f64(v.z));
+RM_INLINE boolx3
+rm_lteqs_i16x3(const i16x3 v, const i16 s) {
+    return rm_lteq_i16x3(v, rm_i16x3s(s));
 }
-RM_INLINE f64x4
-rm_abs_f64x4(const f64x4 v) {
-    return rm_f64x4(rm_abs_f64(v.x), rm_abs_f64(v.y), rm_abs_f64(v.z),
-                    rm_abs_f64(v.w));
+RM_INLINE boolx4
+rm_lteqs_i16x4(const i16x4 v, const i16 s) {
+    return rm_lteq_i16x4(v, rm_i16x4s(s));
 }
-RM_INLINE u8x2
-rm_min_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_u8x2(rm_min_u8(a.x, b.x), rm_min_u8(a.y, b.y));
+RM_INLINE boolx2
+rm_lteqs_i32x2(const i32x2 v, const i32 s) {
+    return rm_lteq_i32x2(v, rm_i32x2s(s));
 }
-RM_INLINE u8x3
-rm_min_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_u8x3(rm_min_u8(a.x, b.x), rm_min_u8(a.y, b.y),
-                   rm_min_u8(a.z, b.z));
+RM_INLINE boolx3
+rm_lteqs_i32x3(const i32x3 v, const i32 s) {
+    return rm_lteq_i32x3(v, rm_i32x3s(s));
 }
-RM_INLINE u8x4
-rm_min_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_u8x4(rm_min_u8(a.x, b.x), rm_min_u8(a.y, b.y),
-                   rm_min_u8(a.z, b.z), rm_min_u8(a.w, b.w));
+RM_INLINE boolx4
+rm_lteqs_i32x4(const i32x4 v, const i32 s) {
+    return rm_lteq_i32x4(v, rm_i32x4s(s));
 }
-RM_INLINE u16x2
-rm_min_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_u16x2(rm_min_u16(a.x, b.x), rm_min_u16(a.y, b.y));
+RM_INLINE boolx2
+rm_lteqs_i64x2(const i64x2 v, const i64 s) {
+    return rm_lteq_i64x2(v, rm_i64x2s(s));
 }
-RM_INLINE u16x3
-rm_min_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_u16x3(rm_min_u16(a.x, b.x), rm_min_u16(a.y, b.y),
-                    rm_min_u16(a.z, b.z));
+RM_INLINE boolx3
+rm_lteqs_i64x3(const i64x3 v, const i64 s) {
+    return rm_lteq_i64x3(v, rm_i64x3s(s));
 }
-RM_INLINE u16x4
-rm_min_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_u16x4(rm_min_u16(a.x, b.x), rm_min_u16(a.y, b.y),
-                    rm_min_u16(a.z, b.z), rm_min_u16(a.w, b.w));
+RM_INLINE boolx4
+rm_lteqs_i64x4(const i64x4 v, const i64 s) {
+    return rm_lteq_i64x4(v, rm_i64x4s(s));
 }
-RM_INLINE u32x2
-rm_min_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_u32x2(rm_min_u32(a.x, b.x), rm_min_u32(a.y, b.y));
+RM_INLINE boolx2
+rm_lteqs_f32x2(const f32x2 v, const f32 s) {
+    return rm_lteq_f32x2(v, rm_f32x2s(s));
 }
-RM_INLINE u32x3
-rm_min_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_u32x3(rm_min_u32(a.x, b.x), rm_min_u32(a.y, b.y),
-                    rm_min_u32(a.z, b.z));
+RM_INLINE boolx3
+rm_lteqs_f32x3(const f32x3 v, const f32 s) {
+    return rm_lteq_f32x3(v, rm_f32x3s(s));
 }
-RM_INLINE u32x4
-rm_min_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_u32x4(rm_min_u32(a.x, b.x), rm_min_u32(a.y, b.y),
-                    rm_min_u32(a.z, b.z), rm_min_u32(a.w, b.w));
+RM_INLINE boolx4
+rm_lteqs_f32x4(const f32x4 v, const f32 s) {
+    return rm_lteq_f32x4(v, rm_f32x4s(s));
 }
-RM_INLINE u64x2
-rm_min_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_u64x2(rm_min_u64(a.x, b.x), rm_min_u64(a.y, b.y));
+RM_INLINE boolx2
+rm_lteqs_f64x2(const f64x2 v, const f64 s) {
+    return rm_lteq_f64x2(v, rm_f64x2s(s));
 }
-RM_INLINE u64x3
-rm_min_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_u64x3(rm_min_u64(a.x, b.x), rm_min_u64(a.y, b.y),
-                    rm_min_u64(a.z, b.z));
+RM_INLINE boolx3
+rm_lteqs_f64x3(const f64x3 v, const f64 s) {
+    return rm_lteq_f64x3(v, rm_f64x3s(s));
 }
-RM_INLINE u64x4
-rm_min_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_u64x4(rm_min_u64(a.x, b.x), rm_min_u64(a.y, b.y),
-                    rm_min_u64(a.z, b.z), rm_min_u64(a.w, b.w));
+RM_INLINE boolx4
+rm_lteqs_f64x4(const f64x4 v, const f64 s) {
+    return rm_lteq_f64x4(v, rm_f64x4s(s));
 }
-RM_INLINE i8x2
-rm_min_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_i8x2(rm_min_i8(a.x, b.x), rm_min_i8(a.y, b.y));
+RM_INLINE boolx2
+rm_gt_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_boolx2(a.x > b.x, a.y > b.y);
 }
-RM_INLINE i8x3
-rm_min_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_i8x3(rm_min_i8(a.x, b.x), rm_min_i8(a.y, b.y),
-                   rm_min_i8(a.z, b.z));
+RM_INLINE boolx3
+rm_gt_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
 }
-RM_INLINE i8x4
-rm_min_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_i8x4(rm_min_i8(a.x, b.x), rm_min_i8(a.y, b.y),
-                   rm_min_i8(a.z, b.z), rm_min_i8(a.w, b.w));
+RM_INLINE boolx4
+rm_gt_u8x4(const u8x4 a, const u8x4 b) {
+#if defined(RM_SSE2)
+    __m128i xa, xb;
+
+    xa = rmmi_from_u8x4(a);
+    xb = rmmi_from_u8x4(b);
+
+    return rmmi_boolx4(rmmi_not(_mm_cmpeq_epi8(_mm_min_epu8(xa, xb), xa)), 1);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u8(vcgt_u8(rmn_from_u8x4(a), rmn_from_u8x4(b)));
+#else
+    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+#endif
 }
-RM_INLINE i16x2
-rm_min_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_i16x2(rm_min_i16(a.x, b.x), rm_min_i16(a.y, b.y));
+RM_INLINE boolx2
+rm_gt_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_boolx2(a.x > b.x, a.y > b.y);
 }
-RM_INLINE i16x3
-rm_min_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_i16x3(rm_min_i16(a.x, b.x), rm_min_i16(a.y, b.y),
-                    rm_min_i16(a.z, b.z));
+RM_INLINE boolx3
+rm_gt_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
 }
-RM_INLINE i16x4
-rm_min_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_i16x4(rm_min_i16(a.x, b.x), rm_min_i16(a.y, b.y),
-                    rm_min_i16(a.z, b.z), rm_min_i16(a.w, b.w));
+RM_INLINE boolx4
+rm_gt_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
 }
-RM_INLINE i32x2
-rm_min_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_i32x2(rm_min_i32(a.x, b.x), rm_min_i32(a.y, b.y));
+RM_INLINE boolx2
+rm_gt_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_boolx2(a.x > b.x, a.y > b.y);
 }
-RM_INLINE i32x3
-rm_min_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_i32x3(rm_min_i32(a.x, b.x), rm_min_i32(a.y, b.y),
-                    rm_min_i32(a.z, b.z));
+RM_INLINE boolx3
+rm_gt_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
 }
-RM_INLINE i32x4
-rm_min_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_i32x4(rm_min_i32(a.x, b.x), rm_min_i32(a.y, b.y),
-                    rm_min_i32(a.z, b.z), rm_min_i32(a.w, b.w));
+RM_INLINE boolx4
+rm_gt_u32x4(const u32x4 a, const u32x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(rmmi_cmpgt_epu32(rmmi_load(a.raw), rmmi_load(b.raw)), 4);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u32(vcgtq_u32(vld1q_u32(a.raw), vld1q_u32(b.raw)));
+#else
+    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+#endif
 }
-RM_INLINE i64x2
-rm_min_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_i64x2(rm_min_i64(a.x, b.x), rm_min_i64(a.y, b.y));
+RM_INLINE boolx2
+rm_gt_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_boolx2(a.x > b.x, a.y > b.y);
 }
-RM_INLINE i64x3
-rm_min_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_i64x3(rm_min_i64(a.x, b.x), rm_min_i64(a.y, b.y),
-                    rm_min_i64(a.z, b.z));
+RM_INLINE boolx3
+rm_gt_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
 }
-RM_INLINE i64x4
-rm_min_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_i64x4(rm_min_i64(a.x, b.x), rm_min_i64(a.y, b.y),
-                    rm_min_i64(a.z, b.z), rm_min_i64(a.w, b.w));
+RM_INLINE boolx4
+rm_gt_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
 }
-RM_INLINE f32x2
-rm_min_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_f32x2(rm_min_f32(a.x, b.x), rm_min_f32(a.y, b.y));
+RM_INLINE boolx2
+rm_gt_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_boolx2(a.x > b.x, a.y > b.y);
 }
-RM_INLINE f32x3
-rm_min_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_f32x3(rm_min_f32(a.x, b.x), rm_min_f32(a.y, b.y),
-                    rm_min_f32(a.z, b.z));
+RM_INLINE boolx3
+rm_gt_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
 }
-RM_INLINE f32x4
-rm_min_f32x4(const f32x4 a, const f32x4 b) {
-    f32x4 dest;
-#if defined(RM_SSE)
-    rmm_store(dest.raw, _mm_min_ps(rmm_load(a.raw), rmm_load(b.raw)));
+RM_INLINE boolx4
+rm_gt_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+}
+RM_INLINE boolx2
+rm_gt_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_boolx2(a.x > b.x, a.y > b.y);
+}
+RM_INLINE boolx3
+rm_gt_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
+}
+RM_INLINE boolx4
+rm_gt_i16x4(const i16x4 a, const i16x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(_mm_cmpgt_epi16(rmmi_loadl(a.raw), rmmi_loadl(b.raw)),
+                       2);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u16(vcgt_s16(vld1_s16(a.raw), vld1_s16(b.raw)));
 #else
-    dest = rm_f32x4(rm_min_f32(a.x, b.x), rm_min_f32(a.y, b.y),
-                    rm_min_f32(a.z, b.z), rm_min_f32(a.w, b.w));
+    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
 #endif
-    return dest;
 }
-RM_INLINE f64x2
-rm_min_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_f64x2(rm_min_f64(a.x, b.x), rm_min_f64(a.y, b.y));
+RM_INLINE boolx2
+rm_gt_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_boolx2(a.x > b.x, a.y > b.y);
 }
-RM_INLINE f64x3
-rm_min_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_f64x3(rm_min_f64(a.x, b.x), rm_min_f64(a.y, b.y),
-                    rm_min_f64(a.z, b.z));
+RM_INLINE boolx3
+rm_gt_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
 }
-RM_INLINE f64x4
-rm_min_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_f64x4(rm_min_f64(a.x, b.x), rm_min_f64(a.y, b.y),
-                    rm_min_f64(a.z, b.z), rm_min_f64(a.w, b.w));
+RM_INLINE boolx4
+rm_gt_i32x4(const i32x4 a, const i32x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(_mm_cmpgt_epi32(rmmi_load(a.raw), rmmi_load(b.raw)), 4);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u32(vcgtq_s32(vld1q_s32(a.raw), vld1q_s32(b.raw)));
+#else
+    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+#endif
 }
-RM_INLINE u8x2
-rm_mins_u8x2(const u8x2 v, const u8 s) {
-    return rm_min_u8x2(v, rm_u8x2s(s));
+RM_INLINE boolx2
+rm_gt_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_boolx2(a.x > b.x, a.y > b.y);
 }
-RM_INLINE u8x3
-rm_mins_u8x3(const u8x3 v, const u8 s) {
-    return rm_min_u8x3(v, rm_u8x3s(s));
+RM_INLINE boolx3
+rm_gt_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
 }
-RM_INLINE u8x4
-rm_mins_u8x4(const u8x4 v, const u8 s) {
-    return rm_min_u8x4(v, rm_u8x4s(s));
+RM_INLINE boolx4
+rm_gt_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
 }
-RM_INLINE u16x2
-rm_mins_u16x2(const u16x2 v, const u16 s) {
-    return rm_min_u16x2(v, rm_u16x2s(s));
+RM_INLINE boolx2
+rm_gt_f32x2(const f32x2 a, const f32x2 b) {
+    return rm_boolx2(a.x > b.x, a.y > b.y);
 }
-RM_INLINE u16x3
-rm_mins_u16x3(const u16x3 v, const u16 s) {
-    return rm_min_u16x3(v, rm_u16x3s(s));
+RM_INLINE boolx3
+rm_gt_f32x3(const f32x3 a, const f32x3 b) {
+    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
 }
-RM_INLINE u16x4
-rm_mins_u16x4(const u16x4 v, const u16 s) {
-    return rm_min_u16x4(v, rm_u16x4s(s));
+RM_INLINE boolx4
+rm_gt_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_boolx4(rmm_cmpgt(rmm_load(a.raw), rmm_load(b.raw)));
+#else
+    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+#endif
 }
-RM_INLINE u32x2
-rm_mins_u32x2(const u32x2 v, const u32 s) {
-    return rm_min_u32x2(v, rm_u32x2s(s));
+RM_INLINE boolx2
+rm_gt_f64x2(const f64x2 a, const f64x2 b) {
+#if defined(RM_SSE2)
+    return rmmd_boolx2(_mm_cmpgt_pd(rmmd_load(a.raw), rmmd_load(b.raw)));
+#else
+    return rm_boolx2(a.x > b.x, a.y > b.y);
+#endif
 }
-RM_INLINE u32x3
-rm_mins_u32x3(const u32x3 v, const u32 s) {
-    return rm_min_u32x3(v, rm_u32x3s(s));
+RM_INLINE boolx3
+rm_gt_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_boolx3(a.x > b.x, a.y > b.y, a.z > b.z);
 }
-RM_INLINE u32x4
-rm_mins_u32x4(const u32x4 v, const u32 s) {
-    return rm_min_u32x4(v, rm_u32x4s(s));
+RM_INLINE boolx4
+rm_gt_f64x4(const f64x4 a, const f64x4 b) {
+#if defined(RM_AVX)
+    return rmm256d_boolx4(_mm256_cmp_pd(rmm256d_load(a.raw),
+                                        rmm256d_load(b.raw), _CMP_GT_OQ));
+#else
+    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+#endif
 }
-RM_INLINE u64x2
-rm_mins_u64x2(const u64x2 v, const u64 s) {
-    return rm_min_u64x2(v, rm_u64x2s(s));
+RM_INLINE boolx2
+rm_gts_u8x2(const u8x2 v, const u8 s) {
+    return rm_gt_u8x2(v, rm_u8x2s(s));
 }
-RM_INLINE u64x3
-rm_mins_u64x3(const u64x3 v, const u64 s) {
-    return rm_min_u64x3(v, rm_u64x3s(s));
+RM_INLINE boolx3
+rm_gts_u8x3(const u8x3 v, const u8 s) {
+    return rm_gt_u8x3(v, rm_u8x3s(s));
 }
-RM_INLINE u64x4
-rm_mins_u64x4(const u64x4 v, const u64 s) {
-    return rm_min_u64x4(v, rm_u64x4s(s));
+RM_INLINE boolx4
+rm_gts_u8x4(const u8x4 v, const u8 s) {
+    return rm_gt_u8x4(v, rm_u8x4s(s));
 }
-RM_INLINE i8x2
-rm_mins_i8x2(const i8x2 v, const i8 s) {
-    return rm_min_i8x2(v, rm_i8x2s(s));
+RM_INLINE boolx2
+rm_gts_u16x2(const u16x2 v, const u16 s) {
+    return rm_gt_u16x2(v, rm_u16x2s(s));
 }
-RM_INLINE i8x3
-rm_mins_i8x3(const i8x3 v, const i8 s) {
-    return rm_min_i8x3(v, rm_i8x3s(s));
+RM_INLINE boolx3
+rm_gts_u16x3(const u16x3 v, const u16 s) {
+    return rm_gt_u16x3(v, rm_u16x3s(s));
 }
-RM_INLINE i8x4
-rm_mins_i8x4(const i8x4 v, const i8 s) {
-    return rm_min_i8x4(v, rm_i8x4s(s));
-}
-RM_INLINE i16x2
-rm_mins_i16x2(const i16x2 v, const i16 s) {
-    return rm_min_i16x2(v, rm_i16x2s(s));
+RM_INLINE boolx4
+rm_gts_u16x4(const u16x4 v, const u16 s) {
+    return rm_gt_u16x4(v, rm_u16x4s(s));
 }
-RM_INLINE i16x3
-rm_mins_i16x3(const i16x3 v, const i16 s) {
-    return rm_min_i16x3(v, rm_i16x3s(s));
+RM_INLINE boolx2
+rm_gts_u32x2(const u32x2 v, const u32 s) {
+    return rm_gt_u32x2(v, rm_u32x2s(s));
 }
-RM_INLINE i16x4
-rm_mins_i16x4(const i16x4 v, const i16 s) {
-    return rm_min_i16x4(v, rm_i16x4s(s));
+RM_INLINE boolx3
+rm_gts_u32x3(const u32x3 v, const u32 s) {
+    return rm_gt_u32x3(v, rm_u32x3s(s));
 }
-RM_INLINE i32x2
-rm_mins_i32x2(const i32x2 v, const i32 s) {
-    return rm_min_i32x2(v, rm_i32x2s(s));
+RM_INLINE boolx4
+rm_gts_u32x4(const u32x4 v, const u32 s) {
+    return rm_gt_u32x4(v, rm_u32x4s(s));
 }
-RM_INLINE i32x3
-rm_mins_i32x3(const i32x3 v, const i32 s) {
-    return rm_min_i32x3(v, rm_i32x3s(s));
+RM_INLINE boolx2
+rm_gts_u64x2(const u64x2 v, const u64 s) {
+    return rm_gt_u64x2(v, rm_u64x2s(s));
 }
-RM_INLINE i32x4
-rm_mins_i32x4(const i32x4 v, const i32 s) {
-    return rm_min_i32x4(v, rm_i32x4s(s));
+RM_INLINE boolx3
+rm_gts_u64x3(const u64x3 v, const u64 s) {
+    return rm_gt_u64x3(v, rm_u64x3s(s));
 }
-RM_INLINE i64x2
-rm_mins_i64x2(const i64x2 v, const i64 s) {
-    return rm_min_i64x2(v, rm_i64x2s(s));
+RM_INLINE boolx4
+rm_gts_u64x4(const u64x4 v, const u64 s) {
+    return rm_gt_u64x4(v, rm_u64x4s(s));
 }
-RM_INLINE i64x3
-rm_mins_i64x3(const i64x3 v, const i64 s) {
-    return rm_min_i64x3(v, rm_i64x3s(s));
+RM_INLINE boolx2
+rm_gts_i8x2(const i8x2 v, const i8 s) {
+    return rm_gt_i8x2(v, rm_i8x2s(s));
 }
-RM_INLINE i64x4
-rm_mins_i64x4(const i64x4 v, const i64 s) {
-    return rm_min_i64x4(v, rm_i64x4s(s));
+RM_INLINE boolx3
+rm_gts_i8x3(const i8x3 v, const i8 s) {
+    return rm_gt_i8x3(v, rm_i8x3s(s));
 }
-RM_INLINE f32x2
-rm_mins_f32x2(const f32x2 v, const f32 s) {
-    return rm_min_f32x2(v, rm_f32x2s(s));
+RM_INLINE boolx4
+rm_gts_i8x4(const i8x4 v, const i8 s) {
+    return rm_gt_i8x4(v, rm_i8x4s(s));
 }
-RM_INLINE f32x3
-rm_mins_f32x3(const f32x3 v, const f32 s) {
-    return rm_min_f32x3(v, rm_f32x3s(s));
+RM_INLINE boolx2
+rm_gts_i16x2(const i16x2 v, const i16 s) {
+    return rm_gt_i16x2(v, rm_i16x2s(s));
 }
-RM_INLINE f32x4
-rm_mins_f32x4(const f32x4 v, const f32 s) {
-    return rm_min_f32x4(v, rm_f32x4s(s));
+RM_INLINE boolx3
+rm_gts_i16x3(const i16x3 v, const i16 s) {
+    return rm_gt_i16x3(v, rm_i16x3s(s));
 }
-RM_INLINE f64x2
-rm_mins_f64x2(const f64x2 v, const f64 s) {
-    return rm_min_f64x2(v, rm_f64x2s(s));
+RM_INLINE boolx4
+rm_gts_i16x4(const i16x4 v, const i16 s) {
+    return rm_gt_i16x4(v, rm_i16x4s(s));
 }
-RM_INLINE f64x3
-rm_mins_f64x3(const f64x3 v, const f64 s) {
-    return rm_min_f64x3(v, rm_f64x3s(s));
+RM_INLINE boolx2
+rm_gts_i32x2(const i32x2 v, const i32 s) {
+    return rm_gt_i32x2(v, rm_i32x2s(s));
 }
-RM_INLINE f64x4
-rm_mins_f64x4(const f64x4 v, const f64 s) {
-    return rm_min_f64x4(v, rm_f64x4s(s));
+RM_INLINE boolx3
+rm_gts_i32x3(const i32x3 v, const i32 s) {
+    return rm_gt_i32x3(v, rm_i32x3s(s));
 }
-RM_INLINE u8
-rm_minv_u8x2(const u8x2 v) {
-    return rm_min_u8(v.x, v.y);
+RM_INLINE boolx4
+rm_gts_i32x4(const i32x4 v, const i32 s) {
+    return rm_gt_i32x4(v, rm_i32x4s(s));
 }
-RM_INLINE u8
-rm_minv_u8x3(const u8x3 v) {
-    return rm_min_u8(rm_min_u8(v.x, v.y), v.z);
+RM_INLINE boolx2
+rm_gts_i64x2(const i64x2 v, const i64 s) {
+    return rm_gt_i64x2(v, rm_i64x2s(s));
 }
-RM_INLINE u8
-rm_minv_u8x4(const u8x4 v) {
-    return rm_min_u8(rm_min_u8(v.x, v.y), rm_min_u8(v.z, v.w));
+RM_INLINE boolx3
+rm_gts_i64x3(const i64x3 v, const i64 s) {
+    return rm_gt_i64x3(v, rm_i64x3s(s));
 }
-RM_INLINE u16
-rm_minv_u16x2(const u16x2 v) {
-    return rm_min_u16(v.x, v.y);
+RM_INLINE boolx4
+rm_gts_i64x4(const i64x4 v, const i64 s) {
+    return rm_gt_i64x4(v, rm_i64x4s(s));
 }
-RM_INLINE u16
-rm_minv_u16x3(const u16x3 v) {
-    return rm_min_u16(rm_min_u16(v.x, v.y), v.z);
+RM_INLINE boolx2
+rm_gts_f32x2(const f32x2 v, const f32 s) {
+    return rm_gt_f32x2(v, rm_f32x2s(s));
 }
-RM_INLINE u16
-rm_minv_u16x4(const u16x4 v) {
-    return rm_min_u16(rm_min_u16(v.x, v.y), rm_min_u16(v.z, v.w));
+RM_INLINE boolx3
+rm_gts_f32x3(const f32x3 v, const f32 s) {
+    return rm_gt_f32x3(v, rm_f32x3s(s));
 }
-RM_INLINE u32
-rm_minv_u32x2(const u32x2 v) {
-    return rm_min_u32(v.x, v.y);
+RM_INLINE boolx4
+rm_gts_f32x4(const f32x4 v, const f32 s) {
+    return rm_gt_f32x4(v, rm_f32x4s(s));
 }
-RM_INLINE u32
-rm_minv_u32x3(const u32x3 v) {
-    return rm_min_u32(rm_min_u32(v.x, v.y), v.z);
+RM_INLINE boolx2
+rm_gts_f64x2(const f64x2 v, const f64 s) {
+    return rm_gt_f64x2(v, rm_f64x2s(s));
 }
-RM_INLINE u32
-rm_minv_u32x4(const u32x4 v) {
-    return rm_min_u32(rm_min_u32(v.x, v.y), rm_min_u32(v.z, v.w));
+RM_INLINE boolx3
+rm_gts_f64x3(const f64x3 v, const f64 s) {
+    return rm_gt_f64x3(v, rm_f64x3s(s));
 }
-RM_INLINE u64
-rm_minv_u64x2(const u64x2 v) {
-    return rm_min_u64(v.x, v.y);
+RM_INLINE boolx4
+rm_gts_f64x4(const f64x4 v, const f64 s) {
+    return rm_gt_f64x4(v, rm_f64x4s(s));
 }
-RM_INLINE u64
-rm_minv_u64x3(const u64x3 v) {
-    return rm_min_u64(rm_min_u64(v.x, v.y), v.z);
+RM_INLINE boolx2
+rm_gteq_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_boolx2(a.x >= b.x, a.y >= b.y);
 }
-RM_INLINE u64
-rm_minv_u64x4(const u64x4 v) {
-    return rm_min_u64(rm_min_u64(v.x, v.y), rm_min_u64(v.z, v.w));
+RM_INLINE boolx3
+rm_gteq_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
 }
-RM_INLINE i8
-rm_minv_i8x2(const i8x2 v) {
-    return rm_min_i8(v.x, v.y);
+RM_INLINE boolx4
+rm_gteq_u8x4(const u8x4 a, const u8x4 b) {
+#if defined(RM_SSE2)
+    __m128i xa, xb;
+
+    xa = rmmi_from_u8x4(a);
+    xb = rmmi_from_u8x4(b);
+
+    return rmmi_boolx4(_mm_cmpeq_epi8(_mm_max_epu8(xa, xb), xa), 1);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u8(vcge_u8(rmn_from_u8x4(a), rmn_from_u8x4(b)));
+#else
+    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+#endif
 }
-RM_INLINE i8
-rm_minv_i8x3(const i8x3 v) {
-    return rm_min_i8(rm_min_i8(v.x, v.y), v.z);
+RM_INLINE boolx2
+rm_gteq_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_boolx2(a.x >= b.x, a.y >= b.y);
 }
-RM_INLINE i8
-rm_minv_i8x4(const i8x4 v) {
-    return rm_min_i8(rm_min_i8(v.x, v.y), rm_min_i8(v.z, v.w));
+RM_INLINE boolx3
+rm_gteq_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
 }
-RM_INLINE i16
-rm_minv_i16x2(const i16x2 v) {
-    return rm_min_i16(v.x, v.y);
+RM_INLINE boolx4
+rm_gteq_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
 }
-RM_INLINE i16
-rm_minv_i16x3(const i16x3 v) {
-    return rm_min_i16(rm_min_i16(v.x, v.y), v.z);
+RM_INLINE boolx2
+rm_gteq_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_boolx2(a.x >= b.x, a.y >= b.y);
 }
-RM_INLINE i16
-rm_minv_i16x4(const i16x4 v) {
-    return rm_min_i16(rm_min_i16(v.x, v.y), rm_min_i16(v.z, v.w));
+RM_INLINE boolx3
+rm_gteq_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
 }
-RM_INLINE i32
-rm_minv_i32x2(const i32x2 v) {
-    return rm_min_i32(v.x, v.y);
+RM_INLINE boolx4
+rm_gteq_u32x4(const u32x4 a, const u32x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(rmmi_not(rmmi_cmplt_epu32(rmmi_load(a.raw),
+                                                 rmmi_load(b.raw))), 4);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u32(vcgeq_u32(vld1q_u32(a.raw), vld1q_u32(b.raw)));
+#else
+    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+#endif
 }
-RM_INLINE i32
-rm_minv_i32x3(const i32x3 v) {
-    return rm_min_i32(rm_min_i32(v.x, v.y), v.z);
+RM_INLINE boolx2
+rm_gteq_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_boolx2(a.x >= b.x, a.y >= b.y);
 }
-RM_INLINE i32
-rm_minv_i32x4(const i32x4 v) {
-    return rm_min_i32(rm_min_i32(v.x, v.y), rm_min_i32(v.z, v.w));
+RM_INLINE boolx3
+rm_gteq_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
 }
-RM_INLINE i64
-rm_minv_i64x2(const i64x2 v) {
-    return rm_min_i64(v.x, v.y);
+RM_INLINE boolx4
+rm_gteq_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
 }
-RM_INLINE i64
-rm_minv_i64x3(const i64x3 v) {
-    return rm_min_i64(rm_min_i64(v.x, v.y), v.z);
+RM_INLINE boolx2
+rm_gteq_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_boolx2(a.x >= b.x, a.y >= b.y);
 }
-RM_INLINE i64
-rm_minv_i64x4(const i64x4 v) {
-    return rm_min_i64(rm_min_i64(v.x, v.y), rm_min_i64(v.z, v.w));
+RM_INLINE boolx3
+rm_gteq_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
 }
-RM_INLINE f32
-rm_minv_f32x2(const f32x2 v) {
-    return rm_min_f32(v.x, v.y);
+RM_INLINE boolx4
+rm_gteq_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
 }
-RM_INLINE f32
-rm_minv_f32x3(const f32x3 v) {
-    return rm_min_f32(rm_min_f32(v.x, v.y), v.z);
+RM_INLINE boolx2
+rm_gteq_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_boolx2(a.x >= b.x, a.y >= b.y);
 }
-RM_INLINE f32
-rm_minv_f32x4(const f32x4 v) {
-    return rm_min_f32(rm_min_f32(v.x, v.y), rm_min_f32(v.z, v.w));
+RM_INLINE boolx3
+rm_gteq_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
 }
-RM_INLINE f64
-rm_minv_f64x2(const f64x2 v) {
-    return rm_min_f64(v.x, v.y);
+RM_INLINE boolx4
+rm_gteq_i16x4(const i16x4 a, const i16x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(rmmi_not(_mm_cmplt_epi16(rmmi_loadl(a.raw),
+                                                rmmi_loadl(b.raw))), 2);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u16(vcge_s16(vld1_s16(a.raw), vld1_s16(b.raw)));
+#else
+    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+#endif
 }
-RM_INLINE f64
-rm_minv_f64x3(const f64x3 v) {
-    return rm_min_f64(rm_min_f64(v.x, v.y), v.z);
+RM_INLINE boolx2
+rm_gteq_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_boolx2(a.x >= b.x, a.y >= b.y);
 }
-RM_INLINE f64
-rm_minv_f64x4(const f64x4 v) {
-    return rm_min_f64(rm_min_f64(v.x, v.y), rm_min_f64(v.z, v.w));
+RM_INLINE boolx3
+rm_gteq_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
 }
-RM_INLINE u8x2
-rm_max_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_u8x2(rm_max_u8(a.x, b.x), rm_max_u8(a.y, b.y));
+RM_INLINE boolx4
+rm_gteq_i32x4(const i32x4 a, const i32x4 b) {
+#if defined(RM_SSE2)
+    return rmmi_boolx4(rmmi_not(_mm_cmplt_epi32(rmmi_load(a.raw),
+                                                rmmi_load(b.raw))), 4);
+#elif defined(RM_NEON)
+    return rmn_boolx4_u32(vcgeq_s32(vld1q_s32(a.raw), vld1q_s32(b.raw)));
+#else
+    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+#endif
 }
-RM_INLINE u8x3
-rm_max_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_u8x3(rm_max_u8(a.x, b.x), rm_max_u8(a.y, b.y),
-                   rm_max_u8(a.z, b.z));
+RM_INLINE boolx2
+rm_gteq_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_boolx2(a.x >= b.x, a.y >= b.y);
 }
-RM_INLINE u8x4
-rm_max_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_u8x4(rm_max_u8(a.x, b.x), rm_max_u8(a.y, b.y),
-                   rm_max_u8(a.z, b.z), rm_max_u8(a.w, b.w));
+RM_INLINE boolx3
+rm_gteq_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
 }
-RM_INLINE u16x2
-rm_max_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_u16x2(rm_max_u16(a.x, b.x), rm_max_u16(a.y, b.y));
+RM_INLINE boolx4
+rm_gteq_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
 }
-RM_INLINE u16x3
-rm_max_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_u16x3(rm_max_u16(a.x, b.x), rm_max_u16(a.y, b.y),
-                    rm_max_u16(a.z, b.z));
+RM_INLINE boolx2
+rm_gteq_f32x2(const f32x2 a, const f32x2 b) {
+    return rm_boolx2(a.x >= b.x, a.y >= b.y);
 }
-RM_INLINE u16x4
-rm_max_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_u16x4(rm_max_u16(a.x, b.x), rm_max_u16(a.y, b.y),
-                    rm_max_u16(a.z, b.z), rm_max_u16(a.w, b.w));
+RM_INLINE boolx3
+rm_gteq_f32x3(const f32x3 a, const f32x3 b) {
+    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
 }
-RM_INLINE u32x2
-rm_max_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_u32x2(rm_max_u32(a.x, b.x), rm_max_u32(a.y, b.y));
+RM_INLINE boolx4
+rm_gteq_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_boolx4(rmm_cmpge(rmm_load(a.raw), rmm_load(b.raw)));
+#else
+    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+#endif
 }
-RM_INLINE u32x3
-rm_max_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_u32x3(rm_max_u32(a.x, b.x), rm_max_u32(a.y, b.y),
-                    rm_max_u32(a.z, b.z));
+RM_INLINE boolx2
+rm_gteq_f64x2(const f64x2 a, const f64x2 b) {
+#if defined(RM_SSE2)
+    return rmmd_boolx2(_mm_cmpge_pd(rmmd_load(a.raw), rmmd_load(b.raw)));
+#else
+    return rm_boolx2(a.x >= b.x, a.y >= b.y);
+#endif
 }
-RM_INLINE u32x4
-rm_max_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_u32x4(rm_max_u32(a.x, b.x), rm_max_u32(a.y, b.y),
-                    rm_max_u32(a.z, b.z), rm_max_u32(a.w, b.w));
+RM_INLINE boolx3
+rm_gteq_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_boolx3(a.x >= b.x, a.y >= b.y, a.z >= b.z);
 }
-RM_INLINE u64x2
-rm_max_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_u64x2(rm_max_u64(a.x, b.x), rm_max_u64(a.y, b.y));
+RM_INLINE boolx4
+rm_gteq_f64x4(const f64x4 a, const f64x4 b) {
+#if defined(RM_AVX)
+    return rmm256d_boolx4(_mm256_cmp_pd(rmm256d_load(a.raw),
+                                        rmm256d_load(b.raw), _CMP_GE_OQ));
+#else
+    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+#endif
 }
-RM_INLINE u64x3
-rm_max_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_u64x3(rm_max_u64(a.x, b.x), rm_max_u64(a.y, b.y),
-                    rm_max_u64(a.z, b.z));
+RM_INLINE boolx2
+rm_gteqs_u8x2(const u8x2 v, const u8 s) {
+    return rm_gteq_u8x2(v, rm_u8x2s(s));
 }
-RM_INLINE u64x4
-rm_max_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_u64x4(rm_max_u64(a.x, b.x), rm_max_u64(a.y, b.y),
-                    rm_max_u64(a.z, b.z), rm_max_u64(a.w, b.w));
+RM_INLINE boolx3
+rm_gteqs_u8x3(const u8x3 v, const u8 s) {
+    return rm_gteq_u8x3(v, rm_u8x3s(s));
 }
-RM_INLINE i8x2
-rm_max_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_i8x2(rm_max_i8(a.x, b.x), rm_max_i8(a.y, b.y));
+RM_INLINE boolx4
+rm_gteqs_u8x4(const u8x4 v, const u8 s) {
+    return rm_gteq_u8x4(v, rm_u8x4s(s));
 }
-RM_INLINE i8x3
-rm_max_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_i8x3(rm_max_i8(a.x, b.x), rm_max_i8(a.y, b.y),
-                   rm_max_i8(a.z, b.z));
+RM_INLINE boolx2
+rm_gteqs_u16x2(const u16x2 v, const u16 s) {
+    return rm_gteq_u16x2(v, rm_u16x2s(s));
 }
-RM_INLINE i8x4
-rm_max_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_i8x4(rm_max_i8(a.x, b.x), rm_max_i8(a.y, b.y),
-                   rm_max_i8(a.z, b.z), rm_max_i8(a.w, b.w));
+RM_INLINE boolx3
+rm_gteqs_u16x3(const u16x3 v, const u16 s) {
+    return rm_gteq_u16x3(v, rm_u16x3s(s));
 }
-RM_INLINE i16x2
-rm_max_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_i16x2(rm_max_i16(a.x, b.x), rm_max_i16(a.y, b.y));
+RM_INLINE boolx4
+rm_gteqs_u16x4(const u16x4 v, const u16 s) {
+    return rm_gteq_u16x4(v, rm_u16x4s(s));
 }
-RM_INLINE i16x3
-rm_max_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_i16x3(rm_max_i16(a.x, b.x), rm_max_i16(a.y, b.y),
-                    rm_max_i16(a.z, b.z));
+RM_INLINE boolx2
+rm_gteqs_u32x2(const u32x2 v, const u32 s) {
+    return rm_gteq_u32x2(v, rm_u32x2s(s));
 }
-RM_INLINE i16x4
-rm_max_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_i16x4(rm_max_i16(a.x, b.x), rm_max_i16(a.y, b.y),
-                    rm_max_i16(a.z, b.z), rm_max_i16(a.w, b.w));
+RM_INLINE boolx3
+rm_gteqs_u32x3(const u32x3 v, const u32 s) {
+    return rm_gteq_u32x3(v, rm_u32x3s(s));
 }
-RM_INLINE i32x2
-rm_max_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_i32x2(rm_max_i32(a.x, b.x), rm_max_i32(a.y, b.y));
+RM_INLINE boolx4
+rm_gteqs_u32x4(const u32x4 v, const u32 s) {
+    return rm_gteq_u32x4(v, rm_u32x4s(s));
 }
-RM_INLINE i32x3
-rm_max_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_i32x3(rm_max_i32(a.x, b.x), rm_max_i32(a.y, b.y),
-                    rm_max_i32(a.z, b.z));
+RM_INLINE boolx2
+rm_gteqs_u64x2(const u64x2 v, const u64 s) {
+    return rm_gteq_u64x2(v, rm_u64x2s(s));
 }
-RM_INLINE i32x4
-rm_max_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_i32x4(rm_max_i32(a.x, b.x), rm_max_i32(a.y, b.y),
-                    rm_max_i32(a.z, b.z), rm_max_i32(a.w, b.w));
+RM_INLINE boolx3
+rm_gteqs_u64x3(const u64x3 v, const u64 s) {
+    return rm_gteq_u64x3(v, rm_u64x3s(s));
 }
-RM_INLINE i64x2
-rm_max_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_i64x2(rm_max_i64(a.x, b.x), rm_max_i64(a.y, b.y));
+RM_INLINE boolx4
+rm_gteqs_u64x4(const u64x4 v, const u64 s) {
+    return rm_gteq_u64x4(v, rm_u64x4s(s));
 }
-RM_INLINE i64x3
-rm_max_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_i64x3(rm_max_i64(a.x, b.x), rm_max_i64(a.y, b.y),
-                    rm_max_i64(a.z, b.z));
+RM_INLINE boolx2
+rm_gteqs_i8x2(const i8x2 v, const i8 s) {
+    return rm_gteq_i8x2(v, rm_i8x2s(s));
 }
-RM_INLINE i64x4
-rm_max_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_i64x4(rm_max_i64(a.x, b.x), rm_max_i64(a.y, b.y),
-                    rm_max_i64(a.z, b.z), rm_max_i64(a.w, b.w));
+RM_INLINE boolx3
+rm_gteqs_i8x3(const i8x3 v, const i8 s) {
+    return rm_gteq_i8x3(v, rm_i8x3s(s));
 }
-RM_INLINE f32x2
-rm_max_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_f32x2(rm_max_f32(a.x, b.x), rm_max_f32(a.y, b.y));
+RM_INLINE boolx4
+rm_gteqs_i8x4(const i8x4 v, const i8 s) {
+    return rm_gteq_i8x4(v, rm_i8x4s(s));
 }
-RM_INLINE f32x3
-rm_max_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_f32x3(rm_max_f32(a.x, b.x), rm_max_f32(a.y, b.y),
-                    rm_max_f32(a.z, b.z));
+RM_INLINE boolx2
+rm_gteqs_i16x2(const i16x2 v, const i16 s) {
+    return rm_gteq_i16x2(v, rm_i16x2s(s));
 }
-RM_INLINE f32x4
-rm_max_f32x4(const f32x4 a, const f32x4 b) {
-    f32x4 dest;
-#if defined(RM_SSE)
-    rmm_store(dest.raw, _mm_max_ps(rmm_load(a.raw), rmm_load(b.raw)));
-#else
-    dest = rm_f32x4(rm_max_f32(a.x, b.x), rm_max_f32(a.y, b.y),
-                    rm_max_f32(a.z, b.z), rm_max_f32(a.w, b.w));
-#endif
-    return dest;
+RM_INLINE boolx3
+rm_gteqs_i16x3(const i16x3 v, const i16 s) {
+    return rm_gteq_i16x3(v, rm_i16x3s(s));
 }
-RM_INLINE f64x2
-rm_max_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_f64x2(rm_max_f64(a.x, b.x), rm_max_f64(a.y, b.y));
+RM_INLINE boolx4
+rm_gteqs_i16x4(const i16x4 v, const i16 s) {
+    return rm_gteq_i16x4(v, rm_i16x4s(s));
 }
-RM_INLINE f64x3
-rm_max_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_f64x3(rm_max_f64(a.x, b.x), rm_max_f64(a.y, b.y),
-                    rm_max_f64(a.z, b.z));
+RM_INLINE boolx2
+rm_gteqs_i32x2(const i32x2 v, const i32 s) {
+    return rm_gteq_i32x2(v, rm_i32x2s(s));
 }
-RM_INLINE f64x4
-rm_max_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_f64x4(rm_max_f64(a.x, b.x), rm_max_f64(a.y, b.y),
-                    rm_max_f64(a.z, b.z), rm_max_f64(a.w, b.w));
+RM_INLINE boolx3
+rm_gteqs_i32x3(const i32x3 v, const i32 s) {
+    return rm_gteq_i32x3(v, rm_i32x3s(s));
 }
-RM_INLINE u8x2
-rm_maxs_u8x2(const u8x2 v, const u8 s) {
-    return rm_max_u8x2(v, rm_u8x2s(s));
+RM_INLINE boolx4
+rm_gteqs_i32x4(const i32x4 v, const i32 s) {
+    return rm_gteq_i32x4(v, rm_i32x4s(s));
 }
-RM_INLINE u8x3
-rm_maxs_u8x3(const u8x3 v, const u8 s) {
-    return rm_max_u8x3(v, rm_u8x3s(s));
+RM_INLINE boolx2
+rm_gteqs_i64x2(const i64x2 v, const i64 s) {
+    return rm_gteq_i64x2(v, rm_i64x2s(s));
 }
-RM_INLINE u8x4
-rm_maxs_u8x4(const u8x4 v, const u8 s) {
-    return rm_max_u8x4(v, rm_u8x4s(s));
+RM_INLINE boolx3
+rm_gteqs_i64x3(const i64x3 v, const i64 s) {
+    return rm_gteq_i64x3(v, rm_i64x3s(s));
 }
-RM_INLINE u16x2
-rm_maxs_u16x2(const u16x2 v, const u16 s) {
-    return rm_max_u16x2(v, rm_u16x2s(s));
+RM_INLINE boolx4
+rm_gteqs_i64x4(const i64x4 v, const i64 s) {
+    return rm_gteq_i64x4(v, rm_i64x4s(s));
 }
-RM_INLINE u16x3
-rm_maxs_u16x3(const u16x3 v, const u16 s) {
-    return rm_max_u16x3(v, rm_u16x3s(s));
+RM_INLINE boolx2
+rm_gteqs_f32x2(const f32x2 v, const f32 s) {
+    return rm_gteq_f32x2(v, rm_f32x2s(s));
 }
-RM_INLINE u16x4
-rm_maxs_u16x4(const u16x4 v, const u16 s) {
-    return rm_max_u16x4(v, rm_u16x4s(s));
+RM_INLINE boolx3
+rm_gteqs_f32x3(const f32x3 v, const f32 s) {
+    return rm_gteq_f32x3(v, rm_f32x3s(s));
 }
-RM_INLINE u32x2
-rm_maxs_u32x2(const u32x2 v, const u32 s) {
-    return rm_max_u32x2(v, rm_u32x2s(s));
+RM_INLINE boolx4
+rm_gteqs_f32x4(const f32x4 v, const f32 s) {
+    return rm_gteq_f32x4(v, rm_f32x4s(s));
 }
-RM_INLINE u32x3
-rm_maxs_u32x3(const u32x3 v, const u32 s) {
-    return rm_max_u32x3(v, rm_u32x3s(s));
+RM_INLINE boolx2
+rm_gteqs_f64x2(const f64x2 v, const f64 s) {
+    return rm_gteq_f64x2(v, rm_f64x2s(s));
 }
-RM_INLINE u32x4
-rm_maxs_u32x4(const u32x4 v, const u32 s) {
-    return rm_max_u32x4(v, rm_u32x4s(s));
+RM_INLINE boolx3
+rm_gteqs_f64x3(const f64x3 v, const f64 s) {
+    return rm_gteq_f64x3(v, rm_f64x3s(s));
 }
-RM_INLINE u64x2
-rm_maxs_u64x2(const u64x2 v, const u64 s) {
-    return rm_max_u64x2(v, rm_u64x2s(s));
+RM_INLINE boolx4
+rm_gteqs_f64x4(const f64x4 v, const f64 s) {
+    return rm_gteq_f64x4(v, rm_f64x4s(s));
 }
-RM_INLINE u64x3
-rm_maxs_u64x3(const u64x3 v, const u64 s) {
-    return rm_max_u64x3(v, rm_u64x3s(s));
+RM_INLINE maskf32x4
+rm_eqm_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_cmpeq(rmm_load(a.raw), rmm_load(b.raw));
+#else
+    return rm_boolx4(a.x == b.x, a.y == b.y, a.z == b.z, a.w == b.w);
+#endif
 }
-RM_INLINE u64x4
-rm_maxs_u64x4(const u64x4 v, const u64 s) {
-    return rm_max_u64x4(v, rm_u64x4s(s));
+RM_INLINE maskf32x4
+rm_neqm_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_cmpneq(rmm_load(a.raw), rmm_load(b.raw));
+#else
+    return rm_boolx4(a.x != b.x, a.y != b.y, a.z != b.z, a.w != b.w);
+#endif
+}
+RM_INLINE maskf32x4
+rm_ltm_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_cmplt(rmm_load(a.raw), rmm_load(b.raw));
+#else
+    return rm_boolx4(a.x < b.x, a.y < b.y, a.z < b.z, a.w < b.w);
+#endif
+}
+RM_INLINE maskf32x4
+rm_lteqm_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_cmple(rmm_load(a.raw), rmm_load(b.raw));
+#else
+    return rm_boolx4(a.x <= b.x, a.y <= b.y, a.z <= b.z, a.w <= b.w);
+#endif
+}
+RM_INLINE maskf32x4
+rm_gtm_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_cmpgt(rmm_load(a.raw), rmm_load(b.raw));
+#else
+    return rm_boolx4(a.x > b.x, a.y > b.y, a.z > b.z, a.w > b.w);
+#endif
+}
+RM_INLINE maskf32x4
+rm_gteqm_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_cmpge(rmm_load(a.raw), rmm_load(b.raw));
+#else
+    return rm_boolx4(a.x >= b.x, a.y >= b.y, a.z >= b.z, a.w >= b.w);
+#endif
+}
+RM_INLINE maskf32x4
+rm_and_maskf32x4(const maskf32x4 a, const maskf32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_and(a, b);
+#else
+    return rm_boolx4(a.x && b.x, a.y && b.y, a.z && b.z, a.w && b.w);
+#endif
+}
+RM_INLINE maskf32x4
+rm_or_maskf32x4(const maskf32x4 a, const maskf32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_or(a, b);
+#else
+    return rm_boolx4(a.x || b.x, a.y || b.y, a.z || b.z, a.w || b.w);
+#endif
+}
+RM_INLINE maskf32x4
+rm_not_maskf32x4(const maskf32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_not(v);
+#else
+    return rm_boolx4(!v.x, !v.y, !v.z, !v.w);
+#endif
+}
+RM_INLINE bool
+rm_any_maskf32x4(const maskf32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_any(v);
+#else
+    return (v.x || v.y) || (v.z || v.w);
+#endif
+}
+RM_INLINE bool
+rm_all_maskf32x4(const maskf32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_all(v);
+#else
+    return (v.x && v.y) && (v.z && v.w);
+#endif
+}
+RM_INLINE boolx4
+rm_boolx4_maskf32x4(const maskf32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_boolx4(v);
+#else
+    return v;
+#endif
+}
+/* a where the mask is set, b elsewhere */
+RM_INLINE f32x4
+rm_select_f32x4(const maskf32x4 mask, const f32x4 a, const f32x4 b) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_blendv(rmm_load(b.raw), rmm_load(a.raw), mask));
+#else
+    dest = rm_f32x4(mask.x ? a.x : b.x, mask.y ? a.y : b.y,
+                    mask.z ? a.z : b.z, mask.w ? a.w : b.w);
+#endif
+    return dest;
 }
 RM_INLINE i8x2
-rm_maxs_i8x2(const i8x2 v, const i8 s) {
-    return rm_max_i8x2(v, rm_i8x2s(s));
+rm_neg_i8x2(const i8x2 v) {
+    return rm_i8x2(-v.x, -v.y);
 }
 RM_INLINE i8x3
-rm_maxs_i8x3(const i8x3 v, const i8 s) {
-    return rm_max_i8x3(v, rm_i8x3s(s));
+rm_neg_i8x3(const i8x3 v) {
+    return rm_i8x3(-v.x, -v.y, -v.z);
 }
 RM_INLINE i8x4
-rm_maxs_i8x4(const i8x4 v, const i8 s) {
-    return rm_max_i8x4(v, rm_i8x4s(s));
+rm_neg_i8x4(const i8x4 v) {
+    return rm_i8x4(-v.x, -v.y, -v.z, -v.w);
 }
 RM_INLINE i16x2
-rm_maxs_i16x2(const i16x2 v, const i16 s) {
-    return rm_max_i16x2(v, rm_i16x2s(s));
+rm_neg_i16x2(const i16x2 v) {
+    return rm_i16x2(-v.x, -v.y);
 }
 RM_INLINE i16x3
-rm_maxs_i16x3(const i16x3 v, const i16 s) {
-    return rm_max_i16x3(v, rm_i16x3s(s));
+rm_neg_i16x3(const i16x3 v) {
+    return rm_i16x3(-v.x, -v.y, -v.z);
 }
 RM_INLINE i16x4
-rm_maxs_i16x4(const i16x4 v, const i16 s) {
-    return rm_max_i16x4(v, rm_i16x4s(s));
+rm_neg_i16x4(const i16x4 v) {
+    i16x4 dest;
+#if defined(RM_SSE2)
+    rmmi_storel(dest.raw, _mm_sub_epi16(_mm_setzero_si128(),
+                                        rmmi_loadl(v.raw)));
+#elif defined(RM_NEON)
+    vst1_s16(dest.raw, vneg_s16(vld1_s16(v.raw)));
+#else
+    dest = rm_i16x4(-v.x, -v.y, -v.z, -v.w);
+#endif
+    return dest;
 }
 RM_INLINE i32x2
-rm_maxs_i32x2(const i32x2 v, const i32 s) {
-    return rm_max_i32x2(v, rm_i32x2s(s));
+rm_neg_i32x2(const i32x2 v) {
+    return rm_i32x2(-v.x, -v.y);
 }
 RM_INLINE i32x3
-rm_maxs_i32x3(const i32x3 v, const i32 s) {
-    return rm_max_i32x3(v, rm_i32x3s(s));
+rm_neg_i32x3(const i32x3 v) {
+    return rm_i32x3(-v.x, -v.y, -v.z);
 }
 RM_INLINE i32x4
-rm_maxs_i32x4(const i32x4 v, const i32 s) {
-    return rm_max_i32x4(v, rm_i32x4s(s));
+rm_neg_i32x4(const i32x4 v) {
+    i32x4 dest;
+#if defined(RM_SSE2)
+    rmmi_store(dest.raw, _mm_sub_epi32(_mm_setzero_si128(), rmmi_load(v.raw)));
+#elif defined(RM_NEON)
+    vst1q_s32(dest.raw, vnegq_s32(vld1q_s32(v.raw)));
+#else
+    dest = rm_i32x4(-v.x, -v.y, -v.z, -v.w);
+#endif
+    return dest;
 }
 RM_INLINE i64x2
-rm_maxs_i64x2(const i64x2 v, const i64 s) {
-    return rm_max_i64x2(v, rm_i64x2s(s));
+rm_neg_i64x2(const i64x2 v) {
+    return rm_i64x2(-v.x, -v.y);
 }
 RM_INLINE i64x3
-rm_maxs_i64x3(const i64x3 v, const i64 s) {
-    return rm_max_i64x3(v, rm_i64x3s(s));
+rm_neg_i64x3(const i64x3 v) {
+    return rm_i64x3(-v.x, -v.y, -v.z);
 }
 RM_INLINE i64x4
-rm_maxs_i64x4(const i64x4 v, const i64 s) {
-    return rm_max_i64x4(v, rm_i64x4s(s));
+rm_neg_i64x4(const i64x4 v) {
+    return rm_i64x4(-v.x, -v.y, -v.z, -v.w);
 }
 RM_INLINE f32x2
-rm_maxs_f32x2(const f32x2 v, const f32 s) {
-    return rm_max_f32x2(v, rm_f32x2s(s));
+rm_neg_f32x2(const f32x2 v) {
+    return rm_f32x2(-v.x, -v.y);
 }
 RM_INLINE f32x3
-rm_maxs_f32x3(const f32x3 v, const f32 s) {
-    return rm_max_f32x3(v, rm_f32x3s(s));
+rm_neg_f32x3(const f32x3 v) {
+    return rm_f32x3(-v.x, -v.y, -v.z);
 }
 RM_INLINE f32x4
-rm_maxs_f32x4(const f32x4 v, const f32 s) {
-    return rm_max_f32x4(v, rm_f32x4s(s));
+rm_neg_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_neg(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(-v.x, -v.y, -v.z, -v.w);
+#endif
+    return dest;
 }
 RM_INLINE f64x2
-rm_maxs_f64x2(const f64x2 v, const f64 s) {
-    return rm_max_f64x2(v, rm_f64x2s(s));
+rm_neg_f64x2(const f64x2 v) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, _mm_xor_pd(rmmd_load(v.raw), RMMD_SIGNMASK_NEG_F64X2));
+#else
+    dest = rm_f64x2(-v.x, -v.y);
+#endif
+    return dest;
 }
 RM_INLINE f64x3
-rm_maxs_f64x3(const f64x3 v, const f64 s) {
-    return rm_max_f64x3(v, rm_f64x3s(s));
+rm_neg_f64x3(const f64x3 v) {
+    return rm_f64x3(-v.x, -v.y, -v.z);
 }
 RM_INLINE f64x4
-rm_maxs_f64x4(const f64x4 v, const f64 s) {
-    return rm_max_f64x4(v, rm_f64x4s(s));
-}
-RM_INLINE u8
-rm_maxv_u8x2(const u8x2 v) {
-    return rm_max_u8(v.x, v.y);
+rm_neg_f64x4(const f64x4 v) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, _mm256_xor_pd(rmm256d_load(v.raw),
+                                          RMM256D_SIGNMASK_NEG_F64X4));
+#else
+    dest = rm_f64x4(-v.x, -v.y, -v.z, -v.w);
+#endif
+    return dest;
 }
-RM_INLINE u8
-rm_maxv_u8x3(const u8x3 v) {
-    return rm_max_u8(rm_max_u8(v.x, v.y), v.z);
+RM_INLINE i8x2
+rm_abs_i8x2(const i8x2 v) {
+    return rm_i8x2(rm_abs_i8(v.x), rm_abs_i8(v.y));
 }
-RM_INLINE u8
-rm_maxv_u8x4(const u8x4 v) {
-    return rm_max_u8(rm_max_u8(v.x, v.y), rm_max_u8(v.z, v.w));
+RM_INLINE i8x3
+rm_abs_i8x3(const i8x3 v) {
+    return rm_i8x3(rm_abs_i8(v.x), rm_abs_i8(v.y), rm_abs_i8(v.z));
 }
-RM_INLINE u16
-rm_maxv_u16x2(const u16x2 v) {
-    return rm_max_u16(v.x, v.y);
+RM_INLINE i8x4
+rm_abs_i8x4(const i8x4 v) {
+    return rm_i8x4(rm_abs_i8(v.x), rm_abs_i8(v.y), rm_abs_i8(v.z),
+                   rm_abs_i8(v.w));
 }
-RM_INLINE u16
-rm_maxv_u16x3(const u16x3 v) {
-    return rm_max_u16(rm_max_u16(v.x, v.y), v.z);
+RM_INLINE i16x2
+rm_abs_i16x2(const i16x2 v) {
+    return rm_i16x2(rm_abs_i16(v.x), rm_abs_i16(v.y));
 }
-RM_INLINE u16
-rm_maxv_u16x4(const u16x4 v) {
-    return rm_max_u16(rm_max_u16(v.x, v.y), rm_max_u16(v.z, v.w));
+RM_INLINE i16x3
+rm_abs_i16x3(const i16x3 v) {
+    return rm_i16x3(rm_abs_i16(v.x), rm_abs_i16(v.y), rm_abs_i16(v.z));
 }
-RM_INLINE u32
-rm_maxv_u32x2(const u32x2 v) {
-    return rm_max_u32(v.x, v.y);
+RM_INLINE i16x4
+rm_abs_i16x4(const i16x4 v) {
+    i16x4 dest;
+#if defined(RM_SSE2)
+    rmmi_storel(dest.raw, rmmi_abs_epi16(rmmi_loadl(v.raw)));
+#elif defined(RM_NEON)
+    vst1_s16(dest.raw, vabs_s16(vld1_s16(v.raw)));
+#else
+    dest = rm_i16x4(rm_abs_i16(v.x), rm_abs_i16(v.y), rm_abs_i16(v.z),
+                    rm_abs_i16(v.w));
+#endif
+    return dest;
 }
-RM_INLINE u32
-rm_maxv_u32x3(const u32x3 v) {
-    return rm_max_u32(rm_max_u32(v.x, v.y), v.z);
+RM_INLINE i32x2
+rm_abs_i32x2(const i32x2 v) {
+    return rm_i32x2(rm_abs_i32(v.x), rm_abs_i32(v.y));
 }
-RM_INLINE u32
-rm_maxv_u32x4(const u32x4 v) {
-    return rm_max_u32(rm_max_u32(v.x, v.y), rm_max_u32(v.z, v.w));
+RM_INLINE i32x3
+rm_abs_i32x3(const i32x3 v) {
+    return rm_i32x3(rm_abs_i32(v.x), rm_abs_i32(v.y), rm_abs_i32(v.z));
 }
-RM_INLINE u64
-rm_maxv_u64x2(const u64x2 v) {
-    return rm_max_u64(v.x, v.y);
+RM_INLINE i32x4
+rm_abs_i32x4(const i32x4 v) {
+    i32x4 dest;
+#if defined(RM_SSE2)
+    rmmi_store(dest.raw, rmmi_abs_epi32(rmmi_load(v.raw)));
+#elif defined(RM_NEON)
+    vst1q_s32(dest.raw, vabsq_s32(vld1q_s32(v.raw)));
+#else
+    dest = rm_i32x4(rm_abs_i32(v.x), rm_abs_i32(v.y), rm_abs_i32(v.z),
+                    rm_abs_i32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE u64
-rm_maxv_u64x3(const u64x3 v) {
-    return rm_max_u64(rm_max_u64(v.x, v.y), v.z);
+RM_INLINE i64x2
+rm_abs_i64x2(const i64x2 v) {
+    return rm_i64x2(rm_abs_i64(v.x), rm_abs_i64(v.y));
 }
-RM_INLINE u64
-rm_maxv_u64x4(const u64x4 v) {
-    return rm_max_u64(rm_max_u64(v.x, v.y), rm_max_u64(v.z, v.w));
+RM_INLINE i64x3
+rm_abs_i64x3(const i64x3 v) {
+    return rm_i64x3(rm_abs_i64(v.x), rm_abs_i64(v.y), rm_abs_i64(v.z));
 }
-RM_INLINE i8
-rm_maxv_i8x2(const i8x2 v) {
-    return rm_max_i8(v.x, v.y);
+RM_INLINE i64x4
+rm_abs_i64x4(const i64x4 v) {
+    return rm_i64x4(rm_abs_i64(v.x), rm_abs_i64(v.y), rm_abs_i64(v.z),
+                    rm_abs_i64(v.w));
 }
-RM_INLINE i8
-rm_maxv_i8x3(const i8x3 v) {
-    return rm_max_i8(rm_max_i8(v.x, v.y), v.z);
+RM_INLINE f32x2
+rm_abs_f32x2(const f32x2 v) {
+    return rm_f32x2(rm_abs_f32(v.x), rm_abs_f32(v.y));
 }
-RM_INLINE i8
-rm_maxv_i8x4(const i8x4 v) {
-    return rm_max_i8(rm_max_i8(v.x, v.y), rm_max_i8(v.z, v.w));
+RM_INLINE f32x3
+rm_abs_f32x3(const f32x3 v) {
+    return rm_f32x3(rm_abs_f32(v.x), rm_abs_f32(v.y), rm_abs_f32(v.z));
 }
-RM_INLINE i16
-rm_maxv_i16x2(const i16x2 v) {
-    return rm_max_i16(v.x, v.y);
+RM_INLINE f32x4
+rm_abs_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_abs(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_abs_f32(v.x), rm_abs_f32(v.y), rm_abs_f32(v.z),
+                    rm_abs_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE i16
-rm_maxv_i16x3(const i16x3 v) {
-    return rm_max_i16(rm_max_i16(v.x, v.y), v.z);
+RM_INLINE f64x2
+rm_abs_f64x2(const f64x2 v) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, rmmd_abs(rmmd_load(v.raw)));
+#else
+    dest = rm_f64x2(rm_abs_f64(v.x), rm_abs_f64(v.y));
+#endif
+    return dest;
 }
-RM_INLINE i16
-rm_maxv_i16x4(const i16x4 v) {
-    return rm_max_i16(rm_max_i16(v.x, v.y), rm_max_i16(v.z, v.w));
+RM_INLINE f64x3
+rm_abs_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_abs_f64(v.x), rm_abs_f64(v.y), rm_abs_f64(v.z));
 }
-RM_INLINE i32
-rm_maxv_i32x2(const i32x2 v) {
-    return rm_max_i32(v.x, v.y);
+RM_INLINE f64x4
+rm_abs_f64x4(const f64x4 v) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, rmm256d_abs(rmm256d_load(v.raw)));
+#else
+    dest = rm_f64x4(rm_abs_f64(v.x), rm_abs_f64(v.y), rm_abs_f64(v.z),
+                    rm_abs_f64(v.w));
+#endif
+    return dest;
 }
-RM_INLINE i32
-rm_maxv_i32x3(const i32x3 v) {
-    return rm_max_i32(rm_max_i32(v.x, v.y), v.z);
+RM_INLINE u8x2
+rm_min_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_u8x2(rm_min_u8(a.x, b.x), rm_min_u8(a.y, b.y));
 }
-RM_INLINE i32
-rm_maxv_i32x4(const i32x4 v) {
-    return rm_max_i32(rm_max_i32(v.x, v.y), rm_max_i32(v.z, v.w));
+RM_INLINE u8x3
+rm_min_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_u8x3(rm_min_u8(a.x, b.x), rm_min_u8(a.y, b.y),
+                   rm_min_u8(a.z, b.z));
 }
-RM_INLINE i64
-rm_maxv_i64x2(const i64x2 v) {
-    return rm_max_i64(v.x, v.y);
+RM_INLINE u8x4
+rm_min_u8x4(const u8x4 a, const u8x4 b) {
+    u8x4 dest;
+#if defined(RM_SSE2)
+    dest = rmmi_to_u8x4(_mm_min_epu8(rmmi_from_u8x4(a), rmmi_from_u8x4(b)));
+#elif defined(RM_NEON)
+    dest = rmn_to_u8x4(vmin_u8(rmn_from_u8x4(a), rmn_from_u8x4(b)));
+#else
+    dest = rm_u8x4(rm_min_u8(a.x, b.x), rm_min_u8(a.y, b.y),
+                   rm_min_u8(a.z, b.z), rm_min_u8(a.w, b.w));
+#endif
+    return dest;
 }
-RM_INLINE i64
-rm_maxv_i64x3(const i64x3 v) {
-    return rm_max_i64(rm_max_i64(v.x, v.y), v.z);
+RM_INLINE u16x2
+rm_min_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_u16x2(rm_min_u16(a.x, b.x), rm_min_u16(a.y, b.y));
 }
-RM_INLINE i64
-rm_maxv_i64x4(const i64x4 v) {
-    return rm_max_i64(rm_max_i64(v.x, v.y), rm_max_i64(v.z, v.w));
+RM_INLINE u16x3
+rm_min_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_u16x3(rm_min_u16(a.x, b.x), rm_min_u16(a.y, b.y),
+                    rm_min_u16(a.z, b.z));
 }
-RM_INLINE f32
-rm_maxv_f32x2(const f32x2 v) {
-    return rm_max_f32(v.x, v.y);
+RM_INLINE u16x4
+rm_min_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_u16x4(rm_min_u16(a.x, b.x), rm_min_u16(a.y, b.y),
+                    rm_min_u16(a.z, b.z), rm_min_u16(a.w, b.w));
 }
-RM_INLINE f32
-rm_maxv_f32x3(const f32x3 v) {
-    return rm_max_f32(rm_max_f32(v.x, v.y), v.z);
+RM_INLINE u32x2
+rm_min_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_u32x2(rm_min_u32(a.x, b.x), rm_min_u32(a.y, b.y));
 }
-RM_INLINE f32
-rm_maxv_f32x4(const f32x4 v) {
-    return rm_max_f32(rm_max_f32(v.x, v.y), rm_max_f32(v.z, v.w));
+RM_INLINE u32x3
+rm_min_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_u32x3(rm_min_u32(a.x, b.x), rm_min_u32(a.y, b.y),
+                    rm_min_u32(a.z, b.z));
 }
-RM_INLINE f64
-rm_maxv_f64x2(const f64x2 v) {
-    return rm_max_f64(v.x, v.y);
+RM_INLINE u32x4
+rm_min_u32x4(const u32x4 a, const u32x4 b) {
+    u32x4 dest;
+#if defined(RM_SSE2)
+    rmmi_store(dest.raw, rmmi_min_epu32(rmmi_load(a.raw), rmmi_load(b.raw)));
+#elif defined(RM_NEON)
+    vst1q_u32(dest.raw, vminq_u32(vld1q_u32(a.raw), vld1q_u32(b.raw)));
+#else
+    dest = rm_u32x4(rm_min_u32(a.x, b.x), rm_min_u32(a.y, b.y),
+                    rm_min_u32(a.z, b.z), rm_min_u32(a.w, b.w));
+#endif
+    return dest;
 }
-RM_INLINE f64
-rm_maxv_f64x3(const f64x3 v) {
-    return rm_max_f64(rm_max_f64(v.x, v.y), v.z);
+RM_INLINE u64x2
+rm_min_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_u64x2(rm_min_u64(a.x, b.x), rm_min_u64(a.y, b.y));
 }
-RM_INLINE f64
-rm_maxv_f64x4(const f64x4 v) {
-    return rm_max_f64(rm_max_f64(v.x, v.y), rm_max_f64(v.z, v.w));
+RM_INLINE u64x3
+rm_min_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_u64x3(rm_min_u64(a.x, b.x), rm_min_u64(a.y, b.y),
+                    rm_min_u64(a.z, b.z));
 }
-RM_INLINE u8
-rm_hadd_u8x2(const u8x2 v) {
-    return v.x + v.y;
+RM_INLINE u64x4
+rm_min_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_u64x4(rm_min_u64(a.x, b.x), rm_min_u64(a.y, b.y),
+                    rm_min_u64(a.z, b.z), rm_min_u64(a.w, b.w));
 }
-RM_INLINE u8
-rm_hadd_u8x3(const u8x3 v) {
-    return v.x + v.y + v.z;
+RM_INLINE i8x2
+rm_min_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_i8x2(rm_min_i8(a.x, b.x), rm_min_i8(a.y, b.y));
 }
-RM_INLINE u8
-rm_hadd_u8x4(const u8x4 v) {
-    return v.x + v.y + v.z + v.w;
+RM_INLINE i8x3
+rm_min_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_i8x3(rm_min_i8(a.x, b.x), rm_min_i8(a.y, b.y),
+                   rm_min_i8(a.z, b.z));
 }
-RM_INLINE u16
-rm_hadd_u16x2(const u16x2 v) {
-    return v.x + v.y;
+RM_INLINE i8x4
+rm_min_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_i8x4(rm_min_i8(a.x, b.x), rm_min_i8(a.y, b.y),
+                   rm_min_i8(a.z, b.z), rm_min_i8(a.w, b.w));
 }
-RM_INLINE u16
-rm_hadd_u16x3(const u16x3 v) {
-    return v.x + v.y + v.z;
+RM_INLINE i16x2
+rm_min_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_i16x2(rm_min_i16(a.x, b.x), rm_min_i16(a.y, b.y));
 }
-RM_INLINE u16
-rm_hadd_u16x4(const u16x4 v) {
-    return v.x + v.y + v.z + v.w;
+RM_INLINE i16x3
+rm_min_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_i16x3(rm_min_i16(a.x, b.x), rm_min_i16(a.y, b.y),
+                    rm_min_i16(a.z, b.z));
 }
-RM_INLINE u32
-rm_hadd_u32x2(const u32x2 v) {
-    return v.x + v.y;
+RM_INLINE i16x4
+rm_min_i16x4(const i16x4 a, const i16x4 b) {
+    i16x4 dest;
+#if defined(RM_SSE2)
+    rmmi_storel(dest.raw, _mm_min_epi16(rmmi_loadl(a.raw), rmmi_loadl(b.raw)));
+#elif defined(RM_NEON)
+    vst1_s16(dest.raw, vmin_s16(vld1_s16(a.raw), vld1_s16(b.raw)));
+#else
+    dest = rm_i16x4(rm_min_i16(a.x, b.x), rm_min_i16(a.y, b.y),
+                    rm_min_i16(a.z, b.z), rm_min_i16(a.w, b.w));
+#endif
+    return dest;
 }
-RM_INLINE u32
-rm_hadd_u32x3(const u32x3 v) {
-    return v.x + v.y + v.z;
+RM_INLINE i32x2
+rm_min_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_i32x2(rm_min_i32(a.x, b.x), rm_min_i32(a.y, b.y));
 }
-RM_INLINE u32
-rm_hadd_u32x4(const u32x4 v) {
-    return v.x + v.y + v.z + v.w;
+RM_INLINE i32x3
+rm_min_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_i32x3(rm_min_i32(a.x, b.x), rm_min_i32(a.y, b.y),
+                    rm_min_i32(a.z, b.z));
 }
-RM_INLINE u64
-rm_hadd_u64x2(const u64x2 v) {
-    return v.x + v.y;
+RM_INLINE i32x4
+rm_min_i32x4(const i32x4 a, const i32x4 b) {
+    i32x4 dest;
+#if defined(RM_SSE2)
+    rmmi_store(dest.raw, rmmi_min_epi32(rmmi_load(a.raw), rmmi_load(b.raw)));
+#elif defined(RM_NEON)
+    vst1q_s32(dest.raw, vminq_s32(vld1q_s32(a.raw), vld1q_s32(b.raw)));
+#else
+    dest = rm_i32x4(rm_min_i32(a.x, b.x), rm_min_i32(a.y, b.y),
+                    rm_min_i32(a.z, b.z), rm_min_i32(a.w, b.w));
+#endif
+    return dest;
 }
-RM_INLINE u64
-rm_hadd_u64x3(const u64x3 v) {
-    return v.x + v.y + v.z;
+RM_INLINE i64x2
+rm_min_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_i64x2(rm_min_i64(a.x, b.x), rm_min_i64(a.y, b.y));
 }
-RM_INLINE u64
-rm_hadd_u64x4(const u64x4 v) {
-    return v.x + v.y + v.z + v.w;
+RM_INLINE i64x3
+rm_min_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_i64x3(rm_min_i64(a.x, b.x), rm_min_i64(a.y, b.y),
+                    rm_min_i64(a.z, b.z));
 }
-RM_INLINE i8
-rm_hadd_i8x2(const i8x2 v) {
-    return v.x + v.y;
+RM_INLINE i64x4
+rm_min_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_i64x4(rm_min_i64(a.x, b.x), rm_min_i64(a.y, b.y),
+                    rm_min_i64(a.z, b.z), rm_min_i64(a.w, b.w));
 }
-RM_INLINE i8
-rm_hadd_i8x3(const i8x3 v) {
-    return v.x + v.y + v.z;
+RM_INLINE f32x2
+rm_min_f32x2(const f32x2 a, const f32x2 b) {
+    return rm_f32x2(rm_min_f32(a.x, b.x), rm_min_f32(a.y, b.y));
 }
-RM_INLINE i8
-rm_hadd_i8x4(const i8x4 v) {
-    return v.x + v.y + v.z + v.w;
+RM_INLINE f32x3
+rm_min_f32x3(const f32x3 a, const f32x3 b) {
+    return rm_f32x3(rm_min_f32(a.x, b.x), rm_min_f32(a.y, b.y),
+                    rm_min_f32(a.z, b.z));
 }
-RM_INLINE i16
-rm_hadd_i16x2(const i16x2 v) {
-    return v.x + v.y;
-}
-RM_INLINE i16
-rm_hadd_i16x3(const i16x3 v) {
-    return v.x + v.y + v.z;
-}
-RM_INLINE i16
-rm_hadd_i16x4(const i16x4 v) {
-    return v.x + v.y + v.z + v.w;
-}
-RM_INLINE i32
-rm_hadd_i32x2(const i32x2 v) {
-    return v.x + v.y;
-}
-RM_INLINE i32
-rm_hadd_i32x3(const i32x3 v) {
-    return v.x + v.y + v.z;
-}
-RM_INLINE i32
-rm_hadd_i32x4(const i32x4 v) {
-    return v.x + v.y + v.z + v.w;
-}
-RM_INLINE i64
-rm_hadd_i64x2(const i64x2 v) {
-    return v.x + v.y;
-}
-RM_INLINE i64
-rm_hadd_i64x3(const i64x3 v) {
-    return v.x + v.y + v.z;
-}
-RM_INLINE i64
-rm_hadd_i64x4(const i64x4 v) {
-    return v.x + v.y + v.z + v.w;
-}
-RM_INLINE f32
-rm_hadd_f32x2(const f32x2 v) {
-    return v.x + v.y;
-}
-RM_INLINE f32
-rm_hadd_f32x3(const f32x3 v) {
-    return v.x + v.y + v.z;
-}
-RM_INLINE f32
-rm_hadd_f32x4(const f32x4 v) {
-#if defined(RM_SSE)
-    return rmm_hadd(rmm_load(v.raw));
+RM_INLINE f32x4
+rm_min_f32x4(const f32x4 a, const f32x4 b) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_min(rmm_load(a.raw), rmm_load(b.raw)));
 #else
-    return v.x + v.y + v.z + v.w;
+    dest = rm_f32x4(rm_min_f32(a.x, b.x), rm_min_f32(a.y, b.y),
+                    rm_min_f32(a.z, b.z), rm_min_f32(a.w, b.w));
 #endif
+    return dest;
 }
-RM_INLINE f64
-rm_hadd_f64x2(const f64x2 v) {
-    return v.x + v.y;
+RM_INLINE f64x2
+rm_min_f64x2(const f64x2 a, const f64x2 b) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, _mm_min_pd(rmmd_load(a.raw), rmmd_load(b.raw)));
+#else
+    dest = rm_f64x2(rm_min_f64(a.x, b.x), rm_min_f64(a.y, b.y));
+#endif
+    return dest;
 }
-RM_INLINE f64
-rm_hadd_f64x3(const f64x3 v) {
-    return v.x + v.y + v.z;
+RM_INLINE f64x3
+rm_min_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_f64x3(rm_min_f64(a.x, b.x), rm_min_f64(a.y, b.y),
+                    rm_min_f64(a.z, b.z));
 }
-RM_INLINE f64
-rm_hadd_f64x4(const f64x4 v) {
-    return v.x + v.y + v.z + v.w;
+RM_INLINE f64x4
+rm_min_f64x4(const f64x4 a, const f64x4 b) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, _mm256_min_pd(rmm256d_load(a.raw),
+                                          rmm256d_load(b.raw)));
+#else
+    dest = rm_f64x4(rm_min_f64(a.x, b.x), rm_min_f64(a.y, b.y),
+                    rm_min_f64(a.z, b.z), rm_min_f64(a.w, b.w));
+#endif
+    return dest;
 }
 RM_INLINE u8x2
-rm_add_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_u8x2(a.x + b.x, a.y + b.y);
+rm_mins_u8x2(const u8x2 v, const u8 s) {
+    return rm_min_u8x2(v, rm_u8x2s(s));
 }
 RM_INLINE u8x3
-rm_add_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_u8x3(a.x + b.x, a.y + b.y, a.z + b.z);
+rm_mins_u8x3(const u8x3 v, const u8 s) {
+    return rm_min_u8x3(v, rm_u8x3s(s));
 }
 RM_INLINE u8x4
-rm_add_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_u8x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+rm_mins_u8x4(const u8x4 v, const u8 s) {
+    return rm_min_u8x4(v, rm_u8x4s(s));
 }
 RM_INLINE u16x2
-rm_add_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_u16x2(a.x + b.x, a.y + b.y);
+rm_mins_u16x2(const u16x2 v, const u16 s) {
+    return rm_min_u16x2(v, rm_u16x2s(s));
 }
 RM_INLINE u16x3
-rm_add_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_u16x3(a.x + b.x, a.y + b.y, a.z + b.z);
+rm_mins_u16x3(const u16x3 v, const u16 s) {
+    return rm_min_u16x3(v, rm_u16x3s(s));
 }
 RM_INLINE u16x4
-rm_add_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_u16x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+rm_mins_u16x4(const u16x4 v, const u16 s) {
+    return rm_min_u16x4(v, rm_u16x4s(s));
 }
 RM_INLINE u32x2
-rm_add_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_u32x2(a.x + b.x, a.y + b.y);
+rm_mins_u32x2(const u32x2 v, const u32 s) {
+    return rm_min_u32x2(v, rm_u32x2s(s));
 }
 RM_INLINE u32x3
-rm_add_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_u32x3(a.x + b.x, a.y + b.y, a.z + b.z);
+rm_mins_u32x3(const u32x3 v, const u32 s) {
+    return rm_min_u32x3(v, rm_u32x3s(s));
 }
 RM_INLINE u32x4
-rm_add_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_u32x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+rm_mins_u32x4(const u32x4 v, const u32 s) {
+    return rm_min_u32x4(v, rm_u32x4s(s));
 }
 RM_INLINE u64x2
-rm_add_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_u64x2(a.x + b.x, a.y + b.y);
+rm_mins_u64x2(const u64x2 v, const u64 s) {
+    return rm_min_u64x2(v, rm_u64x2s(s));
 }
 RM_INLINE u64x3
-rm_add_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_u64x3(a.x + b.x, a.y + b.y, a.z + b.z);
+rm_mins_u64x3(const u64x3 v, const u64 s) {
+    return rm_min_u64x3(v, rm_u64x3s(s));
 }
 RM_INLINE u64x4
-rm_add_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_u64x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+rm_mins_u64x4(const u64x4 v, const u64 s) {
+    return rm_min_u64x4(v, rm_u64x4s(s));
 }
 RM_INLINE i8x2
-rm_add_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_i8x2(a.x + b.x, a.y + b.y);
+rm_mins_i8x2(const i8x2 v, const i8 s) {
+    return rm_min_i8x2(v, rm_i8x2s(s));
 }
 RM_INLINE i8x3
-rm_add_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_i8x3(a.x + b.x, a.y + b.y, a.z + b.z);
+rm_mins_i8x3(const i8x3 v, const i8 s) {
+    return rm_min_i8x3(v, rm_i8x3s(s));
 }
 RM_INLINE i8x4
-rm_add_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_i8x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+rm_mins_i8x4(const i8x4 v, const i8 s) {
+    return rm_min_i8x4(v, rm_i8x4s(s));
 }
 RM_INLINE i16x2
-rm_add_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_i16x2(a.x + b.x, a.y + b.y);
+rm_mins_i16x2(const i16x2 v, const i16 s) {
+    return rm_min_i16x2(v, rm_i16x2s(s));
 }
 RM_INLINE i16x3
-rm_add_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_i16x3(a.x + b.x, a.y + b.y, a.z + b.z);
+rm_mins_i16x3(const i16x3 v, const i16 s) {
+    return rm_min_i16x3(v, rm_i16x3s(s));
 }
 RM_INLINE i16x4
-rm_add_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_i16x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+rm_mins_i16x4(const i16x4 v, const i16 s) {
+    return rm_min_i16x4(v, rm_i16x4s(s));
 }
 RM_INLINE i32x2
-rm_add_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_i32x2(a.x + b.x, a.y + b.y);
+rm_mins_i32x2(const i32x2 v, const i32 s) {
+    return rm_min_i32x2(v, rm_i32x2s(s));
 }
 RM_INLINE i32x3
-rm_add_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_i32x3(a.x + b.x, a.y + b.y, a.z + b.z);
+rm_mins_i32x3(const i32x3 v, const i32 s) {
+    return rm_min_i32x3(v, rm_i32x3s(s));
 }
 RM_INLINE i32x4
-rm_add_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_i32x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+rm_mins_i32x4(const i32x4 v, const i32 s) {
+    return rm_min_i32x4(v, rm_i32x4s(s));
 }
 RM_INLINE i64x2
-rm_add_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_i64x2(a.x + b.x, a.y + b.y);
+rm_mins_i64x2(const i64x2 v, const i64 s) {
+    return rm_min_i64x2(v, rm_i64x2s(s));
 }
 RM_INLINE i64x3
-rm_add_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_i64x3(a.x + b.x, a.y + b.y, a.z + b.z);
+rm_mins_i64x3(const i64x3 v, const i64 s) {
+    return rm_min_i64x3(v, rm_i64x3s(s));
 }
 RM_INLINE i64x4
-rm_add_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_i64x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+rm_mins_i64x4(const i64x4 v, const i64 s) {
+    return rm_min_i64x4(v, rm_i64x4s(s));
 }
 RM_INLINE f32x2
-rm_add_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_f32x2(a.x + b.x, a.y + b.y);
+rm_mins_f32x2(const f32x2 v, const f32 s) {
+    return rm_min_f32x2(v, rm_f32x2s(s));
 }
 RM_INLINE f32x3
-rm_add_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_f32x3(a.x + b.x, a.y + b.y, a.z + b.z);
+rm_mins_f32x3(const f32x3 v, const f32 s) {
+    return rm_min_f32x3(v, rm_f32x3s(s));
 }
 RM_INLINE f32x4
-rm_add_f32x4(const f32x4 a, const f32x4 b) {
-    f32x4 dest;
-#if defined(RM_SSE)
-    rmm_store(dest.raw, _mm_add_ps(rmm_load(a.raw), rmm_load(b.raw)));
-#else
-    dest = rm_f32x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
-#endif
-    return dest;
+rm_mins_f32x4(const f32x4 v, const f32 s) {
+    return rm_min_f32x4(v, rm_f32x4s(s));
 }
 RM_INLINE f64x2
-rm_add_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_f64x2(a.x + b.x, a.y + b.y);
+rm_mins_f64x2(const f64x2 v, const f64 s) {
+    return rm_min_f64x2(v, rm_f64x2s(s));
 }
 RM_INLINE f64x3
-rm_add_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_f64x3(a.x + b.x, a.y + b.y, a.z + b.z);
+rm_mins_f64x3(const f64x3 v, const f64 s) {
+    return rm_min_f64x3(v, rm_f64x3s(s));
 }
 RM_INLINE f64x4
-rm_add_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_f64x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+rm_mins_f64x4(const f64x4 v, const f64 s) {
+    return rm_min_f64x4(v, rm_f64x4s(s));
 }
-RM_INLINE u8x2
-rm_adds_u8x2(const u8x2 v, const u8 s) {
-    return rm_add_u8x2(v, rm_u8x2s(s));
+RM_INLINE u8
+rm_minv_u8x2(const u8x2 v) {
+    return rm_min_u8(v.x, v.y);
 }
-RM_INLINE u8x3
-rm_adds_u8x3(const u8x3 v, const u8 s) {
-    return rm_add_u8x3(v, rm_u8x3s(s));
+RM_INLINE u8
+rm_minv_u8x3(const u8x3 v) {
+    return rm_min_u8(rm_min_u8(v.x, v.y), v.z);
 }
-RM_INLINE u8x4
-rm_adds_u8x4(const u8x4 v, const u8 s) {
-    return rm_add_u8x4(v, rm_u8x4s(s));
+RM_INLINE u8
+rm_minv_u8x4(const u8x4 v) {
+    return rm_min_u8(rm_min_u8(v.x, v.y), rm_min_u8(v.z, v.w));
 }
-RM_INLINE u16x2
-rm_adds_u16x2(const u16x2 v, const u16 s) {
-    return rm_add_u16x2(v, rm_u16x2s(s));
+RM_INLINE u16
+rm_minv_u16x2(const u16x2 v) {
+    return rm_min_u16(v.x, v.y);
 }
-RM_INLINE u16x3
-rm_adds_u16x3(const u16x3 v, const u16 s) {
-    return rm_add_u16x3(v, rm_u16x3s(s));
+RM_INLINE u16
+rm_minv_u16x3(const u16x3 v) {
+    return rm_min_u16(rm_min_u16(v.x, v.y), v.z);
 }
-RM_INLINE u16x4
-rm_adds_u16x4(const u16x4 v, const u16 s) {
-    return rm_add_u16x4(v, rm_u16x4s(s));
+RM_INLINE u16
+rm_minv_u16x4(const u16x4 v) {
+    return rm_min_u16(rm_min_u16(v.x, v.y), rm_min_u16(v.z, v.w));
 }
-RM_INLINE u32x2
-rm_adds_u32x2(const u32x2 v, const u32 s) {
-    return rm_add_u32x2(v, rm_u32x2s(s));
+RM_INLINE u32
+rm_minv_u32x2(const u32x2 v) {
+    return rm_min_u32(v.x, v.y);
 }
-RM_INLINE u32x3
-rm_adds_u32x3(const u32x3 v, const u32 s) {
-    return rm_add_u32x3(v, rm_u32x3s(s));
+RM_INLINE u32
+rm_minv_u32x3(const u32x3 v) {
+    return rm_min_u32(rm_min_u32(v.x, v.y), v.z);
 }
-RM_INLINE u32x4
-rm_adds_u32x4(const u32x4 v, const u32 s) {
-    return rm_add_u32x4(v, rm_u32x4s(s));
+RM_INLINE u32
+rm_minv_u32x4(const u32x4 v) {
+    return rm_min_u32(rm_min_u32(v.x, v.y), rm_min_u32(v.z, v.w));
 }
-RM_INLINE u64x2
-rm_adds_u64x2(const u64x2 v, const u64 s) {
-    return rm_add_u64x2(v, rm_u64x2s(s));
+RM_INLINE u64
+rm_minv_u64x2(const u64x2 v) {
+    return rm_min_u64(v.x, v.y);
 }
-RM_INLINE u64x3
-rm_adds_u64x3(const u64x3 v, const u64 s) {
-    return rm_add_u64x3(v, rm_u64x3s(s));
+RM_INLINE u64
+rm_minv_u64x3(const u64x3 v) {
+    return rm_min_u64(rm_min_u64(v.x, v.y), v.z);
 }
-RM_INLINE u64x4
-rm_adds_u64x4(const u64x4 v, const u64 s) {
-    return rm_add_u64x4(v, rm_u64x4s(s));
+RM_INLINE u64
+rm_minv_u64x4(const u64x4 v) {
+    return rm_min_u64(rm_min_u64(v.x, v.y), rm_min_u64(v.z, v.w));
 }
-RM_INLINE i8x2
-rm_adds_i8x2(const i8x2 v, const i8 s) {
-    return rm_add_i8x2(v, rm_i8x2s(s));
+RM_INLINE i8
+rm_minv_i8x2(const i8x2 v) {
+    return rm_min_i8(v.x, v.y);
 }
-RM_INLINE i8x3
-rm_adds_i8x3(const i8x3 v, const i8 s) {
-    return rm_add_i8x3(v, rm_i8x3s(s));
+RM_INLINE i8
+rm_minv_i8x3(const i8x3 v) {
+    return rm_min_i8(rm_min_i8(v.x, v.y), v.z);
 }
-RM_INLINE i8x4
-rm_adds_i8x4(const i8x4 v, const i8 s) {
-    return rm_add_i8x4(v, rm_i8x4s(s));
+RM_INLINE i8
+rm_minv_i8x4(const i8x4 v) {
+    return rm_min_i8(rm_min_i8(v.x, v.y), rm_min_i8(v.z, v.w));
 }
-RM_INLINE i16x2
-rm_adds_i16x2(const i16x2 v, const i16 s) {
-    return rm_add_i16x2(v, rm_i16x2s(s));
+RM_INLINE i16
+rm_minv_i16x2(const i16x2 v) {
+    return rm_min_i16(v.x, v.y);
 }
-RM_INLINE i16x3
-rm_adds_i16x3(const i16x3 v, const i16 s) {
-    return rm_add_i16x3(v, rm_i16x3s(s));
+RM_INLINE i16
+rm_minv_i16x3(const i16x3 v) {
+    return rm_min_i16(rm_min_i16(v.x, v.y), v.z);
 }
-RM_INLINE i16x4
-rm_adds_i16x4(const i16x4 v, const i16 s) {
-    return rm_add_i16x4(v, rm_i16x4s(s));
+RM_INLINE i16
+rm_minv_i16x4(const i16x4 v) {
+    return rm_min_i16(rm_min_i16(v.x, v.y), rm_min_i16(v.z, v.w));
 }
-RM_INLINE i32x2
-rm_adds_i32x2(const i32x2 v, const i32 s) {
-    return rm_add_i32x2(v, rm_i32x2s(s));
+RM_INLINE i32
+rm_minv_i32x2(const i32x2 v) {
+    return rm_min_i32(v.x, v.y);
 }
-RM_INLINE i32x3
-rm_adds_i32x3(const i32x3 v, const i32 s) {
-    return rm_add_i32x3(v, rm_i32x3s(s));
+RM_INLINE i32
+rm_minv_i32x3(const i32x3 v) {
+    return rm_min_i32(rm_min_i32(v.x, v.y), v.z);
 }
-RM_INLINE i32x4
-rm_adds_i32x4(const i32x4 v, const i32 s) {
-    return rm_add_i32x4(v, rm_i32x4s(s));
+RM_INLINE i32
+rm_minv_i32x4(const i32x4 v) {
+    return rm_min_i32(rm_min_i32(v.x, v.y), rm_min_i32(v.z, v.w));
 }
-RM_INLINE i64x2
-rm_adds_i64x2(const i64x2 v, const i64 s) {
-    return rm_add_i64x2(v, rm_i64x2s(s));
+RM_INLINE i64
+rm_minv_i64x2(const i64x2 v) {
+    return rm_min_i64(v.x, v.y);
 }
-RM_INLINE i64x3
-rm_adds_i64x3(const i64x3 v, const i64 s) {
-    return rm_add_i64x3(v, rm_i64x3s(s));
+RM_INLINE i64
+rm_minv_i64x3(const i64x3 v) {
+    return rm_min_i64(rm_min_i64(v.x, v.y), v.z);
 }
-RM_INLINE i64x4
-rm_adds_i64x4(const i64x4 v, const i64 s) {
-    return rm_add_i64x4(v, rm_i64x4s(s));
+RM_INLINE i64
+rm_minv_i64x4(const i64x4 v) {
+    return rm_min_i64(rm_min_i64(v.x, v.y), rm_min_i64(v.z, v.w));
 }
-RM_INLINE f32x2
-rm_adds_f32x2(const f32x2 v, const f32 s) {
-    return rm_add_f32x2(v, rm_f32x2s(s));
+RM_INLINE f32
+rm_minv_f32x2(const f32x2 v) {
+    return rm_min_f32(v.x, v.y);
 }
-RM_INLINE f32x3
-rm_adds_f32x3(const f32x3 v, const f32 s) {
-    return rm_add_f32x3(v, rm_f32x3s(s));
+RM_INLINE f32
+rm_minv_f32x3(const f32x3 v) {
+    return rm_min_f32(rm_min_f32(v.x, v.y), v.z);
 }
-RM_INLINE f32x4
-rm_adds_f32x4(const f32x4 v, const f32 s) {
-    return rm_add_f32x4(v, rm_f32x4s(s));
+RM_INLINE f32
+rm_minv_f32x4(const f32x4 v) {
+    return rm_min_f32(rm_min_f32(v.x, v.y), rm_min_f32(v.z, v.w));
 }
-RM_INLINE f64x2
-rm_adds_f64x2(const f64x2 v, const f64 s) {
-    return rm_add_f64x2(v, rm_f64x2s(s));
+RM_INLINE f64
+rm_minv_f64x2(const f64x2 v) {
+#if defined(RM_SSE2)
+    return _mm_cvtsd_f64(rmmd_vhmin(rmmd_load(v.raw)));
+#else
+    return rm_min_f64(v.x, v.y);
+#endif
 }
-RM_INLINE f64x3
-rm_adds_f64x3(const f64x3 v, const f64 s) {
-    return rm_add_f64x3(v, rm_f64x3s(s));
+RM_INLINE f64
+rm_minv_f64x3(const f64x3 v) {
+    return rm_min_f64(rm_min_f64(v.x, v.y), v.z);
 }
-RM_INLINE f64x4
-rm_adds_f64x4(const f64x4 v, const f64 s) {
-    return rm_add_f64x4(v, rm_f64x4s(s));
+RM_INLINE f64
+rm_minv_f64x4(const f64x4 v) {
+#if defined(RM_AVX)
+    return _mm_cvtsd_f64(rmm256d_vhmin(rmm256d_load(v.raw)));
+#else
+    return rm_min_f64(rm_min_f64(v.x, v.y), rm_min_f64(v.z, v.w));
+#endif
 }
 RM_INLINE u8x2
-rm_sub_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_u8x2(a.x - b.x, a.y - b.y);
+rm_max_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_u8x2(rm_max_u8(a.x, b.x), rm_max_u8(a.y, b.y));
 }
 RM_INLINE u8x3
-rm_sub_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_u8x3(a.x - b.x, a.y - b.y, a.z - b.z);
+rm_max_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_u8x3(rm_max_u8(a.x, b.x), rm_max_u8(a.y, b.y),
+                   rm_max_u8(a.z, b.z));
 }
 RM_INLINE u8x4
-rm_sub_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_u8x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+rm_max_u8x4(const u8x4 a, const u8x4 b) {
+    u8x4 dest;
+#if defined(RM_SSE2)
+    dest = rmmi_to_u8x4(_mm_max_epu8(rmmi_from_u8x4(a), rmmi_from_u8x4(b)));
+#elif defined(RM_NEON)
+    dest = rmn_to_u8x4(vmax_u8(rmn_from_u8x4(a), rmn_from_u8x4(b)));
+#else
+    dest = rm_u8x4(rm_max_u8(a.x, b.x), rm_max_u8(a.y, b.y),
+                   rm_max_u8(a.z, b.z), rm_max_u8(a.w, b.w));
+#endif
+    return dest;
 }
 RM_INLINE u16x2
-rm_sub_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_u16x2(a.x - b.x, a.y - b.y);
+rm_max_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_u16x2(rm_max_u16(a.x, b.x), rm_max_u16(a.y, b.y));
 }
 RM_INLINE u16x3
-rm_sub_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_u16x3(a.x - b.x, a.y - b.y, a.z - b.z);
+rm_max_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_u16x3(rm_max_u16(a.x, b.x), rm_max_u16(a.y, b.y),
+                    rm_max_u16(a.z, b.z));
 }
 RM_INLINE u16x4
-rm_sub_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_u16x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+rm_max_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_u16x4(rm_max_u16(a.x, b.x), rm_max_u16(a.y, b.y),
+                    rm_max_u16(a.z, b.z), rm_max_u16(a.w, b.w));
 }
 RM_INLINE u32x2
-rm_sub_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_u32x2(a.x - b.x, a.y - b.y);
+rm_max_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_u32x2(rm_max_u32(a.x, b.x), rm_max_u32(a.y, b.y));
 }
 RM_INLINE u32x3
-rm_sub_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_u32x3(a.x - b.x, a.y - b.y, a.z - b.z);
+rm_max_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_u32x3(rm_max_u32(a.x, b.x), rm_max_u32(a.y, b.y),
+                    rm_max_u32(a.z, b.z));
 }
 RM_INLINE u32x4
-rm_sub_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_u32x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+rm_max_u32x4(const u32x4 a, const u32x4 b) {
+    u32x4 dest;
+#if defined(RM_SSE2)
+    rmmi_store(dest.raw, rmmi_max_epu32(rmmi_load(a.raw), rmmi_load(b.raw)));
+#elif defined(RM_NEON)
+    vst1q_u32(dest.raw, vmaxq_u32(vld1q_u32(a.raw), vld1q_u32(b.raw)));
+#else
+    dest = rm_u32x4(rm_max_u32(a.x, b.x), rm_max_u32(a.y, b.y),
+                    rm_max_u32(a.z, b.z), rm_max_u32(a.w, b.w));
+#endif
+    return dest;
 }
 RM_INLINE u64x2
-rm_sub_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_u64x2(a.x - b.x, a.y - b.y);
+rm_max_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_u64x2(rm_max_u64(a.x, b.x), rm_max_u64(a.y, b.y));
 }
 RM_INLINE u64x3
-rm_sub_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_u64x3(a.x - b.x, a.y - b.y, a.z - b.z);
+rm_max_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_u64x3(rm_max_u64(a.x, b.x), rm_max_u64(a.y, b.y),
+                    rm_max_u64(a.z, b.z));
 }
 RM_INLINE u64x4
-rm_sub_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_u64x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+rm_max_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_u64x4(rm_max_u64(a.x, b.x), rm_max_u64(a.y, b.y),
+                    rm_max_u64(a.z, b.z), rm_max_u64(a.w, b.w));
 }
 RM_INLINE i8x2
-rm_sub_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_i8x2(a.x - b.x, a.y - b.y);
+rm_max_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_i8x2(rm_max_i8(a.x, b.x), rm_max_i8(a.y, b.y));
 }
 RM_INLINE i8x3
-rm_sub_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_i8x3(a.x - b.x, a.y - b.y, a.z - b.z);
+rm_max_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_i8x3(rm_max_i8(a.x, b.x), rm_max_i8(a.y, b.y),
+                   rm_max_i8(a.z, b.z));
 }
 RM_INLINE i8x4
-rm_sub_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_i8x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+rm_max_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_i8x4(rm_max_i8(a.x, b.x), rm_max_i8(a.y, b.y),
+                   rm_max_i8(a.z, b.z), rm_max_i8(a.w, b.w));
 }
 RM_INLINE i16x2
-rm_sub_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_i16x2(a.x - b.x, a.y - b.y);
+rm_max_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_i16x2(rm_max_i16(a.x, b.x), rm_max_i16(a.y, b.y));
 }
 RM_INLINE i16x3
-rm_sub_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_i16x3(a.x - b.x, a.y - b.y, a.z - b.z);
+rm_max_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_i16x3(rm_max_i16(a.x, b.x), rm_max_i16(a.y, b.y),
+                    rm_max_i16(a.z, b.z));
 }
 RM_INLINE i16x4
-rm_sub_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_i16x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+rm_max_i16x4(const i16x4 a, const i16x4 b) {
+    i16x4 dest;
+#if defined(RM_SSE2)
+    rmmi_storel(dest.raw, _mm_max_epi16(rmmi_loadl(a.raw), rmmi_loadl(b.raw)));
+#elif defined(RM_NEON)
+    vst1_s16(dest.raw, vmax_s16(vld1_s16(a.raw), vld1_s16(b.raw)));
+#else
+    dest = rm_i16x4(rm_max_i16(a.x, b.x), rm_max_i16(a.y, b.y),
+                    rm_max_i16(a.z, b.z), rm_max_i16(a.w, b.w));
+#endif
+    return dest;
 }
 RM_INLINE i32x2
-rm_sub_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_i32x2(a.x - b.x, a.y - b.y);
+rm_max_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_i32x2(rm_max_i32(a.x, b.x), rm_max_i32(a.y, b.y));
 }
 RM_INLINE i32x3
-rm_sub_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_i32x3(a.x - b.x, a.y - b.y, a.z - b.z);
+rm_max_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_i32x3(rm_max_i32(a.x, b.x), rm_max_i32(a.y, b.y),
+                    rm_max_i32(a.z, b.z));
 }
 RM_INLINE i32x4
-rm_sub_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_i32x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+rm_max_i32x4(const i32x4 a, const i32x4 b) {
+    i32x4 dest;
+#if defined(RM_SSE2)
+    rmmi_store(dest.raw, rmmi_max_epi32(rmmi_load(a.raw), rmmi_load(b.raw)));
+#elif defined(RM_NEON)
+    vst1q_s32(dest.raw, vmaxq_s32(vld1q_s32(a.raw), vld1q_s32(b.raw)));
+#else
+    dest = rm_i32x4(rm_max_i32(a.x, b.x), rm_max_i32(a.y, b.y),
+                    rm_max_i32(a.z, b.z), rm_max_i32(a.w, b.w));
+#endif
+    return dest;
 }
 RM_INLINE i64x2
-rm_sub_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_i64x2(a.x - b.x, a.y - b.y);
+rm_max_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_i64x2(rm_max_i64(a.x, b.x), rm_max_i64(a.y, b.y));
 }
 RM_INLINE i64x3
-rm_sub_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_i64x3(a.x - b.x, a.y - b.y, a.z - b.z);
+rm_max_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_i64x3(rm_max_i64(a.x, b.x), rm_max_i64(a.y, b.y),
+                    rm_max_i64(a.z, b.z));
 }
 RM_INLINE i64x4
-rm_sub_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_i64x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+rm_max_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_i64x4(rm_max_i64(a.x, b.x), rm_max_i64(a.y, b.y),
+                    rm_max_i64(a.z, b.z), rm_max_i64(a.w, b.w));
 }
 RM_INLINE f32x2
-rm_sub_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_f32x2(a.x - b.x, a.y - b.y);
+rm_max_f32x2(const f32x2 a, const f32x2 b) {
+    return rm_f32x2(rm_max_f32(a.x, b.x), rm_max_f32(a.y, b.y));
 }
 RM_INLINE f32x3
-rm_sub_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_f32x3(a.x - b.x, a.y - b.y, a.z - b.z);
-}
+rm_max_f32x3(const f32x3 a, const f32x3 b) {
+    return rm_f32x3(rm_max_f32(a.x, b.x), rm_max_f32(a.y, b.y),
+                    rm_max_f32(a.z, b.z));
+}
 RM_INLINE f32x4
-rm_sub_f32x4(const f32x4 a, const f32x4 b) {
+rm_max_f32x4(const f32x4 a, const f32x4 b) {
     f32x4 dest;
-#if defined(RM_SSE)
-    rmm_store(dest.raw, _mm_sub_ps(rmm_load(a.raw), rmm_load(b.raw)));
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_max(rmm_load(a.raw), rmm_load(b.raw)));
 #else
-    dest = rm_f32x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+    dest = rm_f32x4(rm_max_f32(a.x, b.x), rm_max_f32(a.y, b.y),
+                    rm_max_f32(a.z, b.z), rm_max_f32(a.w, b.w));
 #endif
     return dest;
 }
 RM_INLINE f64x2
-rm_sub_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_f64x2(a.x - b.x, a.y - b.y);
+rm_max_f64x2(const f64x2 a, const f64x2 b) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, _mm_max_pd(rmmd_load(a.raw), rmmd_load(b.raw)));
+#else
+    dest = rm_f64x2(rm_max_f64(a.x, b.x), rm_max_f64(a.y, b.y));
+#endif
+    return dest;
 }
 RM_INLINE f64x3
-rm_sub_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_f64x3(a.x - b.x, a.y - b.y, a.z - b.z);
+rm_max_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_f64x3(rm_max_f64(a.x, b.x), rm_max_f64(a.y, b.y),
+                    rm_max_f64(a.z, b.z));
 }
 RM_INLINE f64x4
-rm_sub_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_f64x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+rm_max_f64x4(const f64x4 a, const f64x4 b) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, _mm256_max_pd(rmm256d_load(a.raw),
+                                          rmm256d_load(b.raw)));
+#else
+    dest = rm_f64x4(rm_max_f64(a.x, b.x), rm_max_f64(a.y, b.y),
+                    rm_max_f64(a.z, b.z), rm_max_f64(a.w, b.w));
+#endif
+    return dest;
 }
 RM_INLINE u8x2
-rm_subs_u8x2(const u8x2 v, const u8 s) {
-    return rm_sub_u8x2(v, rm_u8x2s(s));
+rm_maxs_u8x2(const u8x2 v, const u8 s) {
+    return rm_max_u8x2(v, rm_u8x2s(s));
 }
 RM_INLINE u8x3
-rm_subs_u8x3(const u8x3 v, const u8 s) {
-    return rm_sub_u8x3(v, rm_u8x3s(s));
+rm_maxs_u8x3(const u8x3 v, const u8 s) {
+    return rm_max_u8x3(v, rm_u8x3s(s));
 }
 RM_INLINE u8x4
-rm_subs_u8x4(const u8x4 v, const u8 s) {
-    return rm_sub_u8x4(v, rm_u8x4s(s));
+rm_maxs_u8x4(const u8x4 v, const u8 s) {
+    return rm_max_u8x4(v, rm_u8x4s(s));
 }
 RM_INLINE u16x2
-rm_subs_u16x2(const u16x2 v, const u16 s) {
-    return rm_sub_u16x2(v, rm_u16x2s(s));
+rm_maxs_u16x2(const u16x2 v, const u16 s) {
+    return rm_max_u16x2(v, rm_u16x2s(s));
 }
 RM_INLINE u16x3
-rm_subs_u16x3(const u16x3 v, const u16 s) {
-    return rm_sub_u16x3(v, rm_u16x3s(s));
+rm_maxs_u16x3(const u16x3 v, const u16 s) {
+    return rm_max_u16x3(v, rm_u16x3s(s));
 }
 RM_INLINE u16x4
-rm_subs_u16x4(const u16x4 v, const u16 s) {
-    return rm_sub_u16x4(v, rm_u16x4s(s));
+rm_maxs_u16x4(const u16x4 v, const u16 s) {
+    return rm_max_u16x4(v, rm_u16x4s(s));
 }
 RM_INLINE u32x2
-rm_subs_u32x2(const u32x2 v, const u32 s) {
-    return rm_sub_u32x2(v, rm_u32x2s(s));
+rm_maxs_u32x2(const u32x2 v, const u32 s) {
+    return rm_max_u32x2(v, rm_u32x2s(s));
 }
 RM_INLINE u32x3
-rm_subs_u32x3(const u32x3 v, const u32 s) {
-    return rm_sub_u32x3(v, rm_u32x3s(s));
+rm_maxs_u32x3(const u32x3 v, const u32 s) {
+    return rm_max_u32x3(v, rm_u32x3s(s));
 }
 RM_INLINE u32x4
-rm_subs_u32x4(const u32x4 v, const u32 s) {
-    return rm_sub_u32x4(v, rm_u32x4s(s));
+rm_maxs_u32x4(const u32x4 v, const u32 s) {
+    return rm_max_u32x4(v, rm_u32x4s(s));
 }
 RM_INLINE u64x2
-rm_subs_u64x2(const u64x2 v, const u64 s) {
-    return rm_sub_u64x2(v, rm_u64x2s(s));
+rm_maxs_u64x2(const u64x2 v, const u64 s) {
+    return rm_max_u64x2(v, rm_u64x2s(s));
 }
 RM_INLINE u64x3
-rm_subs_u64x3(const u64x3 v, const u64 s) {
-    return rm_sub_u64x3(v, rm_u64x3s(s));
+rm_maxs_u64x3(const u64x3 v, const u64 s) {
+    return rm_max_u64x3(v, rm_u64x3s(s));
 }
 RM_INLINE u64x4
-rm_subs_u64x4(const u64x4 v, const u64 s) {
-    return rm_sub_u64x4(v, rm_u64x4s(s));
+rm_maxs_u64x4(const u64x4 v, const u64 s) {
+    return rm_max_u64x4(v, rm_u64x4s(s));
 }
 RM_INLINE i8x2
-rm_subs_i8x2(const i8x2 v, const i8 s) {
-    return rm_sub_i8x2(v, rm_i8x2s(s));
+rm_maxs_i8x2(const i8x2 v, const i8 s) {
+    return rm_max_i8x2(v, rm_i8x2s(s));
 }
 RM_INLINE i8x3
-rm_subs_i8x3(const i8x3 v, const i8 s) {
-    return rm_sub_i8x3(v, rm_i8x3s(s));
+rm_maxs_i8x3(const i8x3 v, const i8 s) {
+    return rm_max_i8x3(v, rm_i8x3s(s));
 }
 RM_INLINE i8x4
-rm_subs_i8x4(const i8x4 v, const i8 s) {
-    return rm_sub_i8x4(v, rm_i8x4s(s));
+rm_maxs_i8x4(const i8x4 v, const i8 s) {
+    return rm_max_i8x4(v, rm_i8x4s(s));
 }
 RM_INLINE i16x2
-rm_subs_i16x2(const i16x2 v, const i16 s) {
-    return rm_sub_i16x2(v, rm_i16x2s(s));
+rm_maxs_i16x2(const i16x2 v, const i16 s) {
+    return rm_max_i16x2(v, rm_i16x2s(s));
 }
 RM_INLINE i16x3
-rm_subs_i16x3(const i16x3 v, const i16 s) {
-    return rm_sub_i16x3(v, rm_i16x3s(s));
+rm_maxs_i16x3(const i16x3 v, const i16 s) {
+    return rm_max_i16x3(v, rm_i16x3s(s));
 }
 RM_INLINE i16x4
-rm_subs_i16x4(const i16x4 v, const i16 s) {
-    return rm_sub_i16x4(v, rm_i16x4s(s));
+rm_maxs_i16x4(const i16x4 v, const i16 s) {
+    return rm_max_i16x4(v, rm_i16x4s(s));
 }
 RM_INLINE i32x2
-rm_subs_i32x2(const i32x2 v, const i32 s) {
-    return rm_sub_i32x2(v, rm_i32x2s(s));
+rm_maxs_i32x2(const i32x2 v, const i32 s) {
+    return rm_max_i32x2(v, rm_i32x2s(s));
 }
 RM_INLINE i32x3
-rm_subs_i32x3(const i32x3 v, const i32 s) {
-    return rm_sub_i32x3(v, rm_i32x3s(s));
+rm_maxs_i32x3(const i32x3 v, const i32 s) {
+    return rm_max_i32x3(v, rm_i32x3s(s));
 }
 RM_INLINE i32x4
-rm_subs_i32x4(const i32x4 v, const i32 s) {
-    return rm_sub_i32x4(v, rm_i32x4s(s));
+rm_maxs_i32x4(const i32x4 v, const i32 s) {
+    return rm_max_i32x4(v, rm_i32x4s(s));
 }
 RM_INLINE i64x2
-rm_subs_i64x2(const i64x2 v, const i64 s) {
-    return rm_sub_i64x2(v, rm_i64x2s(s));
+rm_maxs_i64x2(const i64x2 v, const i64 s) {
+    return rm_max_i64x2(v, rm_i64x2s(s));
 }
 RM_INLINE i64x3
-rm_subs_i64x3(const i64x3 v, const i64 s) {
-    return rm_sub_i64x3(v, rm_i64x3s(s));
+rm_maxs_i64x3(const i64x3 v, const i64 s) {
+    return rm_max_i64x3(v, rm_i64x3s(s));
 }
 RM_INLINE i64x4
-rm_subs_i64x4(const i64x4 v, const i64 s) {
-    return rm_sub_i64x4(v, rm_i64x4s(s));
+rm_maxs_i64x4(const i64x4 v, const i64 s) {
+    return rm_max_i64x4(v, rm_i64x4s(s));
 }
 RM_INLINE f32x2
-rm_subs_f32x2(const f32x2 v, const f32 s) {
-    return rm_sub_f32x2(v, rm_f32x2s(s));
+rm_maxs_f32x2(const f32x2 v, const f32 s) {
+    return rm_max_f32x2(v, rm_f32x2s(s));
 }
 RM_INLINE f32x3
-rm_subs_f32x3(const f32x3 v, const f32 s) {
-    return rm_sub_f32x3(v, rm_f32x3s(s));
+rm_maxs_f32x3(const f32x3 v, const f32 s) {
+    return rm_max_f32x3(v, rm_f32x3s(s));
 }
 RM_INLINE f32x4
-rm_subs_f32x4(const f32x4 v, const f32 s) {
-    return rm_sub_f32x4(v, rm_f32x4s(s));
+rm_maxs_f32x4(const f32x4 v, const f32 s) {
+    return rm_max_f32x4(v, rm_f32x4s(s));
 }
 RM_INLINE f64x2
-rm_subs_f64x2(const f64x2 v, const f64 s) {
-    return rm_sub_f64x2(v, rm_f64x2s(s));
+rm_maxs_f64x2(const f64x2 v, const f64 s) {
+    return rm_max_f64x2(v, rm_f64x2s(s));
 }
 RM_INLINE f64x3
-rm_subs_f64x3(const f64x3 v, const f64 s) {
-    return rm_sub_f64x3(v, rm_f64x3s(s));
+rm_maxs_f64x3(const f64x3 v, const f64 s) {
+    return rm_max_f64x3(v, rm_f64x3s(s));
 }
 RM_INLINE f64x4
-rm_subs_f64x4(const f64x4 v, const f64 s) {
-    return rm_sub_f64x4(v, rm_f64x4s(s));
-}
-RM_INLINE u8x2
-rm_ssub_u8x2(const u8 s, const u8x2 v) {
-    return rm_sub_u8x2(rm_u8x2s(s), v);
+rm_maxs_f64x4(const f64x4 v, const f64 s) {
+    return rm_max_f64x4(v, rm_f64x4s(s));
 }
-RM_INLINE u8x3
-rm_ssub_u8x3(const u8 s, const u8x3 v) {
-    return rm_sub_u8x3(rm_u8x3s(s), v);
+RM_INLINE u8
+rm_maxv_u8x2(const u8x2 v) {
+    return rm_max_u8(v.x, v.y);
 }
-RM_INLINE u8x4
-rm_ssub_u8x4(const u8 s, const u8x4 v) {
-    return rm_sub_u8x4(rm_u8x4s(s), v);
+RM_INLINE u8
+rm_maxv_u8x3(const u8x3 v) {
+    return rm_max_u8(rm_max_u8(v.x, v.y), v.z);
 }
-RM_INLINE u16x2
-rm_ssub_u16x2(const u16 s, const u16x2 v) {
-    return rm_sub_u16x2(rm_u16x2s(s), v);
+RM_INLINE u8
+rm_maxv_u8x4(const u8x4 v) {
+    return rm_max_u8(rm_max_u8(v.x, v.y), rm_max_u8(v.z, v.w));
 }
-RM_INLINE u16x3
-rm_ssub_u16x3(const u16 s, const u16x3 v) {
-    return rm_sub_u16x3(rm_u16x3s(s), v);
+RM_INLINE u16
+rm_maxv_u16x2(const u16x2 v) {
+    return rm_max_u16(v.x, v.y);
 }
-RM_INLINE u16x4
-rm_ssub_u16x4(const u16 s, const u16x4 v) {
-    return rm_sub_u16x4(rm_u16x4s(s), v);
+RM_INLINE u16
+rm_maxv_u16x3(const u16x3 v) {
+    return rm_max_u16(rm_max_u16(v.x, v.y), v.z);
 }
-RM_INLINE u32x2
-rm_ssub_u32x2(const u32 s, const u32x2 v) {
-    return rm_sub_u32x2(rm_u32x2s(s), v);
+RM_INLINE u16
+rm_maxv_u16x4(const u16x4 v) {
+    return rm_max_u16(rm_max_u16(v.x, v.y), rm_max_u16(v.z, v.w));
 }
-RM_INLINE u32x3
-rm_ssub_u32x3(const u32 s, const u32x3 v) {
-    return rm_sub_u32x3(rm_u32x3s(s), v);
+RM_INLINE u32
+rm_maxv_u32x2(const u32x2 v) {
+    return rm_max_u32(v.x, v.y);
 }
-RM_INLINE u32x4
-rm_ssub_u32x4(const u32 s, const u32x4 v) {
-    return rm_sub_u32x4(rm_u32x4s(s), v);
+RM_INLINE u32
+rm_maxv_u32x3(const u32x3 v) {
+    return rm_max_u32(rm_max_u32(v.x, v.y), v.z);
 }
-RM_INLINE u64x2
-rm_ssub_u64x2(const u64 s, const u64x2 v) {
-    return rm_sub_u64x2(rm_u64x2s(s), v);
+RM_INLINE u32
+rm_maxv_u32x4(const u32x4 v) {
+    return rm_max_u32(rm_max_u32(v.x, v.y), rm_max_u32(v.z, v.w));
 }
-RM_INLINE u64x3
-rm_ssub_u64x3(const u64 s, const u64x3 v) {
-    return rm_sub_u64x3(rm_u64x3s(s), v);
+RM_INLINE u64
+rm_maxv_u64x2(const u64x2 v) {
+    return rm_max_u64(v.x, v.y);
 }
-RM_INLINE u64x4
-rm_ssub_u64x4(const u64 s, const u64x4 v) {
-    return rm_sub_u64x4(rm_u64x4s(s), v);
+RM_INLINE u64
+rm_maxv_u64x3(const u64x3 v) {
+    return rm_max_u64(rm_max_u64(v.x, v.y), v.z);
 }
-RM_INLINE i8x2
-rm_ssub_i8x2(const i8 s, const i8x2 v) {
-    return rm_sub_i8x2(rm_i8x2s(s), v);
+RM_INLINE u64
+rm_maxv_u64x4(const u64x4 v) {
+    return rm_max_u64(rm_max_u64(v.x, v.y), rm_max_u64(v.z, v.w));
 }
-RM_INLINE i8x3
-rm_ssub_i8x3(const i8 s, const i8x3 v) {
-    return rm_sub_i8x3(rm_i8x3s(s), v);
+RM_INLINE i8
+rm_maxv_i8x2(const i8x2 v) {
+    return rm_max_i8(v.x, v.y);
 }
-RM_INLINE i8x4
-rm_ssub_i8x4(const i8 s, const i8x4 v) {
-    return rm_sub_i8x4(rm_i8x4s(s), v);
+RM_INLINE i8
+rm_maxv_i8x3(const i8x3 v) {
+    return rm_max_i8(rm_max_i8(v.x, v.y), v.z);
 }
-RM_INLINE i16x2
-rm_ssub_i16x2(const i16 s, const i16x2 v) {
-    return rm_sub_i16x2(rm_i16x2s(s), v);
+RM_INLINE i8
+rm_maxv_i8x4(const i8x4 v) {
+    return rm_max_i8(rm_max_i8(v.x, v.y), rm_max_i8(v.z, v.w));
 }
-RM_INLINE i16x3
-rm_ssub_i16x3(const i16 s, const i16x3 v) {
-    return rm_sub_i16x3(rm_i16x3s(s), v);
+RM_INLINE i16
+rm_maxv_i16x2(const i16x2 v) {
+    return rm_max_i16(v.x, v.y);
 }
-RM_INLINE i16x4
-rm_ssub_i16x4(const i16 s, const i16x4 v) {
-    return rm_sub_i16x4(rm_i16x4s(s), v);
+RM_INLINE i16
+rm_maxv_i16x3(const i16x3 v) {
+    return rm_max_i16(rm_max_i16(v.x, v.y), v.z);
 }
-RM_INLINE i32x2
-rm_ssub_i32x2(const i32 s, const i32x2 v) {
-    return rm_sub_i32x2(rm_i32x2s(s), v);
+RM_INLINE i16
+rm_maxv_i16x4(const i16x4 v) {
+    return rm_max_i16(rm_max_i16(v.x, v.y), rm_max_i16(v.z, v.w));
 }
-RM_INLINE i32x3
-rm_ssub_i32x3(const i32 s, const i32x3 v) {
-    return rm_sub_i32x3(rm_i32x3s(s), v);
+RM_INLINE i32
+rm_maxv_i32x2(const i32x2 v) {
+    return rm_max_i32(v.x, v.y);
 }
-RM_INLINE i32x4
-rm_ssub_i32x4(const i32 s, const i32x4 v) {
-    return rm_sub_i32x4(rm_i32x4s(s), v);
+RM_INLINE i32
+rm_maxv_i32x3(const i32x3 v) {
+    return rm_max_i32(rm_max_i32(v.x, v.y), v.z);
 }
-RM_INLINE i64x2
-rm_ssub_i64x2(const i64 s, const i64x2 v) {
-    return rm_sub_i64x2(rm_i64x2s(s), v);
+RM_INLINE i32
+rm_maxv_i32x4(const i32x4 v) {
+    return rm_max_i32(rm_max_i32(v.x, v.y), rm_max_i32(v.z, v.w));
 }
-RM_INLINE i64x3
-rm_ssub_i64x3(const i64 s, const i64x3 v) {
-    return rm_sub_i64x3(rm_i64x3s(s), v);
+RM_INLINE i64
+rm_maxv_i64x2(const i64x2 v) {
+    return rm_max_i64(v.x, v.y);
 }
-RM_INLINE i64x4
-rm_ssub_i64x4(const i64 s, const i64x4 v) {
-    return rm_sub_i64x4(rm_i64x4s(s), v);
+RM_INLINE i64
+rm_maxv_i64x3(const i64x3 v) {
+    return rm_max_i64(rm_max_i64(v.x, v.y), v.z);
 }
-RM_INLINE f32x2
-rm_ssub_f32x2(const f32 s, const f32x2 v) {
-    return rm_sub_f32x2(rm_f32x2s(s), v);
+RM_INLINE i64
+rm_maxv_i64x4(const i64x4 v) {
+    return rm_max_i64(rm_max_i64(v.x, v.y), rm_max_i64(v.z, v.w));
 }
-RM_INLINE f32x3
-rm_ssub_f32x3(const f32 s, const f32x3 v) {
-    return rm_sub_f32x3(rm_f32x3s(s), v);
+RM_INLINE f32
+rm_maxv_f32x2(const f32x2 v) {
+    return rm_max_f32(v.x, v.y);
 }
-RM_INLINE f32x4
-rm_ssub_f32x4(const f32 s, const f32x4 v) {
-    return rm_sub_f32x4(rm_f32x4s(s), v);
+RM_INLINE f32
+rm_maxv_f32x3(const f32x3 v) {
+    return rm_max_f32(rm_max_f32(v.x, v.y), v.z);
 }
-RM_INLINE f64x2
-rm_ssub_f64x2(const f64 s, const f64x2 v) {
-    return rm_sub_f64x2(rm_f64x2s(s), v);
+RM_INLINE f32
+rm_maxv_f32x4(const f32x4 v) {
+    return rm_max_f32(rm_max_f32(v.x, v.y), rm_max_f32(v.z, v.w));
 }
-RM_INLINE f64x3
-rm_ssub_f64x3(const f64 s, const f64x3 v) {
-    return rm_sub_f64x3(rm_f64x3s(s), v);
+RM_INLINE f64
+rm_maxv_f64x2(const f64x2 v) {
+#if defined(RM_SSE2)
+    return _mm_cvtsd_f64(rmmd_vhmax(rmmd_load(v.raw)));
+#else
+    return rm_max_f64(v.x, v.y);
+#endif
 }
-RM_INLINE f64x4
-rm_ssub_f64x4(const f64 s, const f64x4 v) {
-    return rm_sub_f64x4(rm_f64x4s(s), v);
+RM_INLINE f64
+rm_maxv_f64x3(const f64x3 v) {
+    return rm_max_f64(rm_max_f64(v.x, v.y), v.z);
 }
-RM_INLINE u8x2
-rm_mul_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_u8x2(a.x * b.x, a.y * b.y);
+RM_INLINE f64
+rm_maxv_f64x4(const f64x4 v) {
+#if defined(RM_AVX)
+    return _mm_cvtsd_f64(rmm256d_vhmax(rmm256d_load(v.raw)));
+#else
+    return rm_max_f64(rm_max_f64(v.x, v.y), rm_max_f64(v.z, v.w));
+#endif
 }
-RM_INLINE u8x3
-rm_mul_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_u8x3(a.x * b.x, a.y * b.y, a.z * b.z);
+RM_INLINE u8
+rm_hadd_u8x2(const u8x2 v) {
+    return v.x + v.y;
 }
-RM_INLINE u8x4
-rm_mul_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_u8x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+RM_INLINE u8
+rm_hadd_u8x3(const u8x3 v) {
+    return v.x + v.y + v.z;
 }
-RM_INLINE u16x2
-rm_mul_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_u16x2(a.x * b.x, a.y * b.y);
+RM_INLINE u8
+rm_hadd_u8x4(const u8x4 v) {
+    return v.x + v.y + v.z + v.w;
 }
-RM_INLINE u16x3
-rm_mul_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_u16x3(a.x * b.x, a.y * b.y, a.z * b.z);
+RM_INLINE u16
+rm_hadd_u16x2(const u16x2 v) {
+    return v.x + v.y;
 }
-RM_INLINE u16x4
-rm_mul_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_u16x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+RM_INLINE u16
+rm_hadd_u16x3(const u16x3 v) {
+    return v.x + v.y + v.z;
 }
-RM_INLINE u32x2
-rm_mul_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_u32x2(a.x * b.x, a.y * b.y);
+RM_INLINE u16
+rm_hadd_u16x4(const u16x4 v) {
+    return v.x + v.y + v.z + v.w;
 }
-RM_INLINE u32x3
-rm_mul_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_u32x3(a.x * b.x, a.y * b.y, a.z * b.z);
+RM_INLINE u32
+rm_hadd_u32x2(const u32x2 v) {
+    return v.x + v.y;
 }
-RM_INLINE u32x4
-rm_mul_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_u32x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+RM_INLINE u32
+rm_hadd_u32x3(const u32x3 v) {
+    return v.x + v.y + v.z;
 }
-RM_INLINE u64x2
-rm_mul_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_u64x2(a.x * b.x, a.y * b.y);
+RM_INLINE u32
+rm_hadd_u32x4(const u32x4 v) {
+    return v.x + v.y + v.z + v.w;
 }
-RM_INLINE u64x3
-rm_mul_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_u64x3(a.x * b.x, a.y * b.y, a.z * b.z);
+RM_INLINE u64
+rm_hadd_u64x2(const u64x2 v) {
+    return v.x + v.y;
 }
-RM_INLINE u64x4
-rm_mul_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_u64x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+RM_INLINE u64
+rm_hadd_u64x3(const u64x3 v) {
+    return v.x + v.y + v.z;
 }
-RM_INLINE i8x2
-rm_mul_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_i8x2(a.x * b.x, a.y * b.y);
+RM_INLINE u64
+rm_hadd_u64x4(const u64x4 v) {
+    return v.x + v.y + v.z + v.w;
 }
-RM_INLINE i8x3
-rm_mul_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_i8x3(a.x * b.x, a.y * b.y, a.z * b.z);
+RM_INLINE i8
+rm_hadd_i8x2(const i8x2 v) {
+    return v.x + v.y;
 }
-RM_INLINE i8x4
-rm_mul_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_i8x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+RM_INLINE i8
+rm_hadd_i8x3(const i8x3 v) {
+    return v.x + v.y + v.z;
 }
-RM_INLINE i16x2
-rm_mul_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_i16x2(a.x * b.x, a.y * b.y);
+RM_INLINE i8
+rm_hadd_i8x4(const i8x4 v) {
+    return v.x + v.y + v.z + v.w;
 }
-RM_INLINE i16x3
-rm_mul_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_i16x3(a.x * b.x, a.y * b.y, a.z * b.z);
+RM_INLINE i16
+rm_hadd_i16x2(const i16x2 v) {
+    return v.x + v.y;
 }
-RM_INLINE i16x4
-rm_mul_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_i16x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+RM_INLINE i16
+rm_hadd_i16x3(const i16x3 v) {
+    return v.x + v.y + v.z;
 }
-RM_INLINE i32x2
-rm_mul_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_i32x2(a.x * b.x, a.y * b.y);
+RM_INLINE i16
+rm_hadd_i16x4(const i16x4 v) {
+    return v.x + v.y + v.z + v.w;
 }
-RM_INLINE i32x3
-rm_mul_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_i32x3(a.x * b.x, a.y * b.y, a.z * b.z);
+RM_INLINE i32
+rm_hadd_i32x2(const i32x2 v) {
+    return v.x + v.y;
 }
-RM_INLINE i32x4
-rm_mul_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_i32x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+RM_INLINE i32
+rm_hadd_i32x3(const i32x3 v) {
+    return v.x + v.y + v.z;
 }
-RM_INLINE i64x2
-rm_mul_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_i64x2(a.x * b.x, a.y * b.y);
+RM_INLINE i32
+rm_hadd_i32x4(const i32x4 v) {
+    return v.x + v.y + v.z + v.w;
 }
-RM_INLINE i64x3
-rm_mul_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_i64x3(a.x * b.x, a.y * b.y, a.z * b.z);
+RM_INLINE i64
+rm_hadd_i64x2(const i64x2 v) {
+    return v.x + v.y;
 }
-RM_INLINE i64x4
-rm_mul_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_i64x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+RM_INLINE i64
+rm_hadd_i64x3(const i64x3 v) {
+    return v.x + v.y + v.z;
 }
-RM_INLINE f32x2
-rm_mul_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_f32x2(a.x * b.x, a.y * b.y);
+RM_INLINE i64
+rm_hadd_i64x4(const i64x4 v) {
+    return v.x + v.y + v.z + v.w;
 }
-RM_INLINE f32x3
-rm_mul_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_f32x3(a.x * b.x, a.y * b.y, a.z * b.z);
+RM_INLINE f32
+rm_hadd_f32x2(const f32x2 v) {
+    return v.x + v.y;
 }
-RM_INLINE f32x4
-rm_mul_f32x4(const f32x4 a, const f32x4 b) {
-    f32x4 dest;
-#if defined(RM_SSE)
-    rmm_store(dest.raw, _mm_mul_ps(rmm_load(a.raw), rmm_load(b.raw)));
+RM_INLINE f32
+rm_hadd_f32x3(const f32x3 v) {
+    return v.x + v.y + v.z;
+}
+RM_INLINE f32
+rm_hadd_f32x4(const f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_hadd(rmm_load(v.raw));
 #else
-    dest = rm_f32x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+    return v.x + v.y + v.z + v.w;
 #endif
-    return dest;
 }
-RM_INLINE f64x2
-rm_mul_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_f64x2(a.x * b.x, a.y * b.y);
-}
-RM_INLINE f64x3
-rm_mul_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_f64x3(a.x * b.x, a.y * b.y, a.z * b.z);
+RM_INLINE f64
+rm_hadd_f64x2(const f64x2 v) {
+#if defined(RM_SSE2)
+    return rmmd_hadd(rmmd_load(v.raw));
+#else
+    return v.x + v.y;
+#endif
 }
-RM_INLINE f64x4
-rm_mul_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_f64x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+RM_INLINE f64
+rm_hadd_f64x3(const f64x3 v) {
+    return v.x + v.y + v.z;
+}
+RM_INLINE f64
+rm_hadd_f64x4(const f64x4 v) {
+#if defined(RM_AVX)
+    return rmm256d_hadd(rmm256d_load(v.raw));
+#else
+    return v.x + v.y + v.z + v.w;
+#endif
 }
 RM_INLINE u8x2
-rm_muls_u8x2(const u8x2 v, const u8 s) {
-    return rm_mul_u8x2(v, rm_u8x2s(s));
+rm_add_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_u8x2(a.x + b.x, a.y + b.y);
 }
 RM_INLINE u8x3
-rm_muls_u8x3(const u8x3 v, const u8 s) {
-    return rm_mul_u8x3(v, rm_u8x3s(s));
+rm_add_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_u8x3(a.x + b.x, a.y + b.y, a.z + b.z);
 }
 RM_INLINE u8x4
-rm_muls_u8x4(const u8x4 v, const u8 s) {
-    return rm_mul_u8x4(v, rm_u8x4s(s));
+rm_add_u8x4(const u8x4 a, const u8x4 b) {
+    u8x4 dest;
+#if defined(RM_SSE2)
+    dest = rmmi_to_u8x4(_mm_add_epi8(rmmi_from_u8x4(a), rmmi_from_u8x4(b)));
+#elif defined(RM_NEON)
+    dest = rmn_to_u8x4(vadd_u8(rmn_from_u8x4(a), rmn_from_u8x4(b)));
+#else
+    dest = rm_u8x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+#endif
+    return dest;
 }
 RM_INLINE u16x2
-rm_muls_u16x2(const u16x2 v, const u16 s) {
-    return rm_mul_u16x2(v, rm_u16x2s(s));
+rm_add_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_u16x2(a.x + b.x, a.y + b.y);
 }
 RM_INLINE u16x3
-rm_muls_u16x3(const u16x3 v, const u16 s) {
-    return rm_mul_u16x3(v, rm_u16x3s(s));
+rm_add_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_u16x3(a.x + b.x, a.y + b.y, a.z + b.z);
 }
 RM_INLINE u16x4
-rm_muls_u16x4(const u16x4 v, const u16 s) {
-    return rm_mul_u16x4(v, rm_u16x4s(s));
+rm_add_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_u16x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
 }
 RM_INLINE u32x2
-rm_muls_u32x2(const u32x2 v, const u32 s) {
-    return rm_mul_u32x2(v, rm_u32x2s(s));
+rm_add_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_u32x2(a.x + b.x, a.y + b.y);
 }
 RM_INLINE u32x3
-rm_muls_u32x3(const u32x3 v, const u32 s) {
-    return rm_mul_u32x3(v, rm_u32x3s(s));
+rm_add_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_u32x3(a.x + b.x, a.y + b.y, a.z + b.z);
 }
 RM_INLINE u32x4
-rm_muls_u32x4(const u32x4 v, const u32 s) {
-    return rm_mul_u32x4(v, rm_u32x4s(s));
+rm_add_u32x4(const u32x4 a, const u32x4 b) {
+    u32x4 dest;
+#if defined(RM_SSE2)
+    rmmi_store(dest.raw, _mm_add_epi32(rmmi_load(a.raw), rmmi_load(b.raw)));
+#elif defined(RM_NEON)
+    vst1q_u32(dest.raw, vaddq_u32(vld1q_u32(a.raw), vld1q_u32(b.raw)));
+#else
+    dest = rm_u32x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+#endif
+    return dest;
 }
 RM_INLINE u64x2
-rm_muls_u64x2(const u64x2 v, const u64 s) {
-    return rm_mul_u64x2(v, rm_u64x2s(s));
+rm_add_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_u64x2(a.x + b.x, a.y + b.y);
 }
 RM_INLINE u64x3
-rm_muls_u64x3(const u64x3 v, const u64 s) {
-    return rm_mul_u64x3(v, rm_u64x3s(s));
+rm_add_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_u64x3(a.x + b.x, a.y + b.y, a.z + b.z);
 }
 RM_INLINE u64x4
-rm_muls_u64x4(const u64x4 v, const u64 s) {
-    return rm_mul_u64x4(v, rm_u64x4s(s));
+rm_add_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_u64x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
 }
 RM_INLINE i8x2
-rm_muls_i8x2(const i8x2 v, const i8 s) {
-    return rm_mul_i8x2(v, rm_i8x2s(s));
+rm_add_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_i8x2(a.x + b.x, a.y + b.y);
 }
 RM_INLINE i8x3
-rm_muls_i8x3(const i8x3 v, const i8 s) {
-    return rm_mul_i8x3(v, rm_i8x3s(s));
+rm_add_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_i8x3(a.x + b.x, a.y + b.y, a.z + b.z);
 }
 RM_INLINE i8x4
-rm_muls_i8x4(const i8x4 v, const i8 s) {
-    return rm_mul_i8x4(v, rm_i8x4s(s));
+rm_add_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_i8x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
 }
 RM_INLINE i16x2
-rm_muls_i16x2(const i16x2 v, const i16 s) {
-    return rm_mul_i16x2(v, rm_i16x2s(s));
+rm_add_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_i16x2(a.x + b.x, a.y + b.y);
 }
 RM_INLINE i16x3
-rm_muls_i16x3(const i16x3 v, const i16 s) {
-    return rm_mul_i16x3(v, rm_i16x3s(s));
+rm_add_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_i16x3(a.x + b.x, a.y + b.y, a.z + b.z);
 }
 RM_INLINE i16x4
-rm_muls_i16x4(const i16x4 v, const i16 s) {
-    return rm_mul_i16x4(v, rm_i16x4s(s));
+rm_add_i16x4(const i16x4 a, const i16x4 b) {
+    i16x4 dest;
+#if defined(RM_SSE2)
+    rmmi_storel(dest.raw, _mm_add_epi16(rmmi_loadl(a.raw), rmmi_loadl(b.raw)));
+#elif defined(RM_NEON)
+    vst1_s16(dest.raw, vadd_s16(vld1_s16(a.raw), vld1_s16(b.raw)));
+#else
+    dest = rm_i16x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+#endif
+    return dest;
 }
 RM_INLINE i32x2
-rm_muls_i32x2(const i32x2 v, const i32 s) {
-    return rm_mul_i32x2(v, rm_i32x2s(s));
+rm_add_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_i32x2(a.x + b.x, a.y + b.y);
 }
 RM_INLINE i32x3
-rm_muls_i32x3(const i32x3 v, const i32 s) {
-    return rm_mul_i32x3(v, rm_i32x3s(s));
+rm_add_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_i32x3(a.x + b.x, a.y + b.y, a.z + b.z);
 }
 RM_INLINE i32x4
-rm_muls_i32x4(const i32x4 v, const i32 s) {
-    return rm_mul_i32x4(v, rm_i32x4s(s));
+rm_add_i32x4(const i32x4 a, const i32x4 b) {
+    i32x4 dest;
+#if defined(RM_SSE2)
+    rmmi_store(dest.raw, _mm_add_epi32(rmmi_load(a.raw), rmmi_load(b.raw)));
+#elif defined(RM_NEON)
+    vst1q_s32(dest.raw, vaddq_s32(vld1q_s32(a.raw), vld1q_s32(b.raw)));
+#else
+    dest = rm_i32x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+#endif
+    return dest;
 }
 RM_INLINE i64x2
-rm_muls_i64x2(const i64x2 v, const i64 s) {
-    return rm_mul_i64x2(v, rm_i64x2s(s));
+rm_add_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_i64x2(a.x + b.x, a.y + b.y);
 }
 RM_INLINE i64x3
-rm_muls_i64x3(const i64x3 v, const i64 s) {
-    return rm_mul_i64x3(v, rm_i64x3s(s));
+rm_add_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_i64x3(a.x + b.x, a.y + b.y, a.z + b.z);
 }
 RM_INLINE i64x4
-rm_muls_i64x4(const i64x4 v, const i64 s) {
-    return rm_mul_i64x4(v, rm_i64x4s(s));
+rm_add_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_i64x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
 }
 RM_INLINE f32x2
-rm_muls_f32x2(const f32x2 v, const f32 s) {
-    return rm_mul_f32x2(v, rm_f32x2s(s));
+rm_add_f32x2(const f32x2 a, const f32x2 b) {
+    return rm_f32x2(a.x + b.x, a.y + b.y);
 }
 RM_INLINE f32x3
-rm_muls_f32x3(const f32x3 v, const f32 s) {
-    return rm_mul_f32x3(v, rm_f32x3s(s));
+rm_add_f32x3(const f32x3 a, const f32x3 b) {
+    return rm_f32x3(a.x + b.x, a.y + b.y, a.z + b.z);
 }
 RM_INLINE f32x4
-rm_muls_f32x4(const f32x4 v, const f32 s) {
-    return rm_mul_f32x4(v, rm_f32x4s(s));
+rm_add_f32x4(const f32x4 a, const f32x4 b) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_add(rmm_load(a.raw), rmm_load(b.raw)));
+#else
+    dest = rm_f32x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+#endif
+    return dest;
 }
 RM_INLINE f64x2
-rm_muls_f64x2(const f64x2 v, const f64 s) {
-    return rm_mul_f64x2(v, rm_f64x2s(s));
+rm_add_f64x2(const f64x2 a, const f64x2 b) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, _mm_add_pd(rmmd_load(a.raw), rmmd_load(b.raw)));
+#else
+    dest = rm_f64x2(a.x + b.x, a.y + b.y);
+#endif
+    return dest;
 }
 RM_INLINE f64x3
-rm_muls_f64x3(const f64x3 v, const f64 s) {
-    return rm_mul_f64x3(v, rm_f64x3s(s));
+rm_add_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_f64x3(a.x + b.x, a.y + b.y, a.z + b.z);
 }
 RM_INLINE f64x4
-rm_muls_f64x4(const f64x4 v, const f64 s) {
-    return rm_mul_f64x4(v, rm_f64x4s(s));
+rm_add_f64x4(const f64x4 a, const f64x4 b) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, _mm256_add_pd(rmm256d_load(a.raw),
+                                          rmm256d_load(b.raw)));
+#else
+    dest = rm_f64x4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+#endif
+    return dest;
 }
 RM_INLINE u8x2
-rm_div_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_u8x2(a.x / b.x, a.y / b.y);
+rm_adds_u8x2(const u8x2 v, const u8 s) {
+    return rm_add_u8x2(v, rm_u8x2s(s));
 }
 RM_INLINE u8x3
-rm_div_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_u8x3(a.x / b.x, a.y / b.y, a.z / b.z);
+rm_adds_u8x3(const u8x3 v, const u8 s) {
+    return rm_add_u8x3(v, rm_u8x3s(s));
 }
 RM_INLINE u8x4
-rm_div_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_u8x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+rm_adds_u8x4(const u8x4 v, const u8 s) {
+    return rm_add_u8x4(v, rm_u8x4s(s));
 }
 RM_INLINE u16x2
-rm_div_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_u16x2(a.x / b.x, a.y / b.y);
+rm_adds_u16x2(const u16x2 v, const u16 s) {
+    return rm_add_u16x2(v, rm_u16x2s(s));
 }
 RM_INLINE u16x3
-rm_div_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_u16x3(a.x / b.x, a.y / b.y, a.z / b.z);
+rm_adds_u16x3(const u16x3 v, const u16 s) {
+    return rm_add_u16x3(v, rm_u16x3s(s));
 }
 RM_INLINE u16x4
-rm_div_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_u16x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+rm_adds_u16x4(const u16x4 v, const u16 s) {
+    return rm_add_u16x4(v, rm_u16x4s(s));
 }
 RM_INLINE u32x2
-rm_div_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_u32x2(a.x / b.x, a.y / b.y);
+rm_adds_u32x2(const u32x2 v, const u32 s) {
+    return rm_add_u32x2(v, rm_u32x2s(s));
 }
 RM_INLINE u32x3
-rm_div_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_u32x3(a.x / b.x, a.y / b.y, a.z / b.z);
+rm_adds_u32x3(const u32x3 v, const u32 s) {
+    return rm_add_u32x3(v, rm_u32x3s(s));
 }
 RM_INLINE u32x4
-rm_div_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_u32x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+rm_adds_u32x4(const u32x4 v, const u32 s) {
+    return rm_add_u32x4(v, rm_u32x4s(s));
 }
 RM_INLINE u64x2
-rm_div_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_u64x2(a.x / b.x, a.y / b.y);
+rm_adds_u64x2(const u64x2 v, const u64 s) {
+    return rm_add_u64x2(v, rm_u64x2s(s));
 }
 RM_INLINE u64x3
-rm_div_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_u64x3(a.x / b.x, a.y / b.y, a.z / b.z);
+rm_adds_u64x3(const u64x3 v, const u64 s) {
+    return rm_add_u64x3(v, rm_u64x3s(s));
 }
 RM_INLINE u64x4
-rm_div_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_u64x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+rm_adds_u64x4(const u64x4 v, const u64 s) {
+    return rm_add_u64x4(v, rm_u64x4s(s));
 }
 RM_INLINE i8x2
-rm_div_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_i8x2(a.x / b.x, a.y / b.y);
+rm_adds_i8x2(const i8x2 v, const i8 s) {
+    return rm_add_i8x2(v, rm_i8x2s(s));
 }
 RM_INLINE i8x3
-rm_div_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_i8x3(a.x / b.x, a.y / b.y, a.z / b.z);
+rm_adds_i8x3(const i8x3 v, const i8 s) {
+    return rm_add_i8x3(v, rm_i8x3s(s));
 }
 RM_INLINE i8x4
-rm_div_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_i8x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+rm_adds_i8x4(const i8x4 v, const i8 s) {
+    return rm_add_i8x4(v, rm_i8x4s(s));
 }
 RM_INLINE i16x2
-rm_div_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_i16x2(a.x / b.x, a.y / b.y);
+rm_adds_i16x2(const i16x2 v, const i16 s) {
+    return rm_add_i16x2(v, rm_i16x2s(s));
 }
 RM_INLINE i16x3
-rm_div_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_i16x3(a.x / b.x, a.y / b.y, a.z / b.z);
+rm_adds_i16x3(const i16x3 v, const i16 s) {
+    return rm_add_i16x3(v, rm_i16x3s(s));
 }
 RM_INLINE i16x4
-rm_div_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_i16x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+rm_adds_i16x4(const i16x4 v, const i16 s) {
+    return rm_add_i16x4(v, rm_i16x4s(s));
 }
 RM_INLINE i32x2
-rm_div_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_i32x2(a.x / b.x, a.y / b.y);
+rm_adds_i32x2(const i32x2 v, const i32 s) {
+    return rm_add_i32x2(v, rm_i32x2s(s));
 }
 RM_INLINE i32x3
-rm_div_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_i32x3(a.x / b.x, a.y / b.y, a.z / b.z);
+rm_adds_i32x3(const i32x3 v, const i32 s) {
+    return rm_add_i32x3(v, rm_i32x3s(s));
 }
 RM_INLINE i32x4
-rm_div_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_i32x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+rm_adds_i32x4(const i32x4 v, const i32 s) {
+    return rm_add_i32x4(v, rm_i32x4s(s));
 }
 RM_INLINE i64x2
-rm_div_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_i64x2(a.x / b.x, a.y / b.y);
+rm_adds_i64x2(const i64x2 v, const i64 s) {
+    return rm_add_i64x2(v, rm_i64x2s(s));
 }
 RM_INLINE i64x3
-rm_div_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_i64x3(a.x / b.x, a.y / b.y, a.z / b.z);
+rm_adds_i64x3(const i64x3 v, const i64 s) {
+    return rm_add_i64x3(v, rm_i64x3s(s));
 }
 RM_INLINE i64x4
-rm_div_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_i64x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+rm_adds_i64x4(const i64x4 v, const i64 s) {
+    return rm_add_i64x4(v, rm_i64x4s(s));
 }
 RM_INLINE f32x2
-rm_div_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_f32x2(a.x / b.x, a.y / b.y);
+rm_adds_f32x2(const f32x2 v, const f32 s) {
+    return rm_add_f32x2(v, rm_f32x2s(s));
 }
 RM_INLINE f32x3
-rm_div_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_f32x3(a.x / b.x, a.y / b.y, a.z / b.z);
+rm_adds_f32x3(const f32x3 v, const f32 s) {
+    return rm_add_f32x3(v, rm_f32x3s(s));
 }
 RM_INLINE f32x4
-rm_div_f32x4(const f32x4 a, const f32x4 b) {
-    f32x4 dest;
-#if defined(RM_SSE)
-    rmm_store(dest.raw, _mm_div_ps(rmm_load(a.raw), rmm_load(b.raw)));
-#else
-    dest = rm_f32x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
-#endif
-    return dest;
+rm_adds_f32x4(const f32x4 v, const f32 s) {
+    return rm_add_f32x4(v, rm_f32x4s(s));
 }
 RM_INLINE f64x2
-rm_div_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_f64x2(a.x / b.x, a.y / b.y);
+rm_adds_f64x2(const f64x2 v, const f64 s) {
+    return rm_add_f64x2(v, rm_f64x2s(s));
 }
 RM_INLINE f64x3
-rm_div_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_f64x3(a.x / b.x, a.y / b.y, a.z / b.z);
+rm_adds_f64x3(const f64x3 v, const f64 s) {
+    return rm_add_f64x3(v, rm_f64x3s(s));
 }
 RM_INLINE f64x4
-rm_div_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_f64x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+rm_adds_f64x4(const f64x4 v, const f64 s) {
+    return rm_add_f64x4(v, rm_f64x4s(s));
 }
 RM_INLINE u8x2
-rm_divs_u8x2(const u8x2 v, const u8 s) {
-    return rm_muls_u8x2(v, 1.0f / s);
+rm_sub_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_u8x2(a.x - b.x, a.y - b.y);
 }
 RM_INLINE u8x3
-rm_divs_u8x3(const u8x3 v, const u8 s) {
-    return rm_muls_u8x3(v, 1.0f / s);
+rm_sub_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_u8x3(a.x - b.x, a.y - b.y, a.z - b.z);
 }
 RM_INLINE u8x4
-rm_divs_u8x4(const u8x4 v, const u8 s) {
-    return rm_muls_u8x4(v, 1.0f / s);
+rm_sub_u8x4(const u8x4 a, const u8x4 b) {
+    u8x4 dest;
+#if defined(RM_SSE2)
+    dest = rmmi_to_u8x4(_mm_sub_epi8(rmmi_from_u8x4(a), rmmi_from_u8x4(b)));
+#elif defined(RM_NEON)
+    dest = rmn_to_u8x4(vsub_u8(rmn_from_u8x4(a), rmn_from_u8x4(b)));
+#else
+    dest = rm_u8x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+#endif
+    return dest;
 }
 RM_INLINE u16x2
-rm_divs_u16x2(const u16x2 v, const u16 s) {
-    return rm_muls_u16x2(v, 1.0f / s);
+rm_sub_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_u16x2(a.x - b.x, a.y - b.y);
 }
 RM_INLINE u16x3
-rm_divs_u16x3(const u16x3 v, const u16 s) {
-    return rm_muls_u16x3(v, 1.0f / s);
+rm_sub_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_u16x3(a.x - b.x, a.y - b.y, a.z - b.z);
 }
 RM_INLINE u16x4
-rm_divs_u16x4(const u16x4 v, const u16 s) {
-    return rm_muls_u16x4(v, 1.0f / s);
+rm_sub_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_u16x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
 }
 RM_INLINE u32x2
-rm_divs_u32x2(const u32x2 v, const u32 s) {
-    return rm_muls_u32x2(v, 1.0f / s);
+rm_sub_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_u32x2(a.x - b.x, a.y - b.y);
 }
 RM_INLINE u32x3
-rm_divs_u32x3(const u32x3 v, const u32 s) {
-    return rm_muls_u32x3(v, 1.0f / s);
+rm_sub_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_u32x3(a.x - b.x, a.y - b.y, a.z - b.z);
 }
 RM_INLINE u32x4
-rm_divs_u32x4(const u32x4 v, const u32 s) {
-    return rm_muls_u32x4(v, 1.0f / s);
+rm_sub_u32x4(const u32x4 a, const u32x4 b) {
+    u32x4 dest;
+#if defined(RM_SSE2)
+    rmmi_store(dest.raw, _mm_sub_epi32(rmmi_load(a.raw), rmmi_load(b.raw)));
+#elif defined(RM_NEON)
+    vst1q_u32(dest.raw, vsubq_u32(vld1q_u32(a.raw), vld1q_u32(b.raw)));
+#else
+    dest = rm_u32x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+#endif
+    return dest;
 }
 RM_INLINE u64x2
-rm_divs_u64x2(const u64x2 v, const u64 s) {
-    return rm_muls_u64x2(v, 1.0f / s);
+rm_sub_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_u64x2(a.x - b.x, a.y - b.y);
 }
 RM_INLINE u64x3
-rm_divs_u64x3(const u64x3 v, const u64 s) {
-    return rm_muls_u64x3(v, 1.0f / s);
+rm_sub_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_u64x3(a.x - b.x, a.y - b.y, a.z - b.z);
 }
 RM_INLINE u64x4
-rm_divs_u64x4(const u64x4 v, const u64 s) {
-    return rm_muls_u64x4(v, 1.0f / s);
+rm_sub_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_u64x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
 }
 RM_INLINE i8x2
-rm_divs_i8x2(const i8x2 v, const i8 s) {
-    return rm_muls_i8x2(v, 1.0f / s);
+rm_sub_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_i8x2(a.x - b.x, a.y - b.y);
 }
 RM_INLINE i8x3
-rm_divs_i8x3(const i8x3 v, const i8 s) {
-    return rm_muls_i8x3(v, 1.0f / s);
+rm_sub_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_i8x3(a.x - b.x, a.y - b.y, a.z - b.z);
 }
 RM_INLINE i8x4
-rm_divs_i8x4(const i8x4 v, const i8 s) {
-    return rm_muls_i8x4(v, 1.0f / s);
+rm_sub_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_i8x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
 }
 RM_INLINE i16x2
-rm_divs_i16x2(const i16x2 v, const i16 s) {
-    return rm_muls_i16x2(v, 1.0f / s);
+rm_sub_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_i16x2(a.x - b.x, a.y - b.y);
 }
 RM_INLINE i16x3
-rm_divs_i16x3(const i16x3 v, const i16 s) {
-    return rm_muls_i16x3(v, 1.0f / s);
+rm_sub_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_i16x3(a.x - b.x, a.y - b.y, a.z - b.z);
 }
 RM_INLINE i16x4
-rm_divs_i16x4(const i16x4 v, const i16 s) {
-    return rm_muls_i16x4(v, 1.0f / s);
+rm_sub_i16x4(const i16x4 a, const i16x4 b) {
+    i16x4 dest;
+#if defined(RM_SSE2)
+    rmmi_storel(dest.raw, _mm_sub_epi16(rmmi_loadl(a.raw), rmmi_loadl(b.raw)));
+#elif defined(RM_NEON)
+    vst1_s16(dest.raw, vsub_s16(vld1_s16(a.raw), vld1_s16(b.raw)));
+#else
+    dest = rm_i16x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+#endif
+    return dest;
 }
 RM_INLINE i32x2
-rm_divs_i32x2(const i32x2 v, const i32 s) {
-    return rm_muls_i32x2(v, 1.0f / s);
+rm_sub_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_i32x2(a.x - b.x, a.y - b.y);
 }
 RM_INLINE i32x3
-rm_divs_i32x3(const i32x3 v, const i32 s) {
-    return rm_muls_i32x3(v, 1.0f / s);
+rm_sub_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_i32x3(a.x - b.x, a.y - b.y, a.z - b.z);
 }
 RM_INLINE i32x4
-rm_divs_i32x4(const i32x4 v, const i32 s) {
-    return rm_muls_i32x4(v, 1.0f / s);
+rm_sub_i32x4(const i32x4 a, const i32x4 b) {
+    i32x4 dest;
+#if defined(RM_SSE2)
+    rmmi_store(dest.raw, _mm_sub_epi32(rmmi_load(a.raw), rmmi_load(b.raw)));
+#elif defined(RM_NEON)
+    vst1q_s32(dest.raw, vsubq_s32(vld1q_s32(a.raw), vld1q_s32(b.raw)));
+#else
+    dest = rm_i32x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+#endif
+    return dest;
 }
 RM_INLINE i64x2
-rm_divs_i64x2(const i64x2 v, const i64 s) {
-    return rm_muls_i64x2(v, 1.0f / s);
+rm_sub_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_i64x2(a.x - b.x, a.y - b.y);
 }
 RM_INLINE i64x3
-rm_divs_i64x3(const i64x3 v, const i64 s) {
-    return rm_muls_i64x3(v, 1.0f / s);
+rm_sub_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_i64x3(a.x - b.x, a.y - b.y, a.z - b.z);
 }
 RM_INLINE i64x4
-rm_divs_i64x4(const i64x4 v, const i64 s) {
-    return rm_muls_i64x4(v, 1.0f / s);
+rm_sub_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_i64x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
 }
 RM_INLINE f32x2
-rm_divs_f32x2(const f32x2 v, const f32 s) {
-    return rm_muls_f32x2(v, 1.0f / s);
+rm_sub_f32x2(const f32x2 a, const f32x2 b) {
+    return rm_f32x2(a.x - b.x, a.y - b.y);
 }
 RM_INLINE f32x3
-rm_divs_f32x3(const f32x3 v, const f32 s) {
-    return rm_muls_f32x3(v, 1.0f / s);
+rm_sub_f32x3(const f32x3 a, const f32x3 b) {
+    return rm_f32x3(a.x - b.x, a.y - b.y, a.z - b.z);
 }
 RM_INLINE f32x4
-rm_divs_f32x4(const f32x4 v, const f32 s) {
-    return rm_muls_f32x4(v, 1.0f / s);
+rm_sub_f32x4(const f32x4 a, const f32x4 b) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_sub(rmm_load(a.raw), rmm_load(b.raw)));
+#else
+    dest = rm_f32x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+#endif
+    return dest;
 }
 RM_INLINE f64x2
-rm_divs_f64x2(const f64x2 v, const f64 s) {
-    return rm_muls_f64x2(v, 1.0f / s);
+rm_sub_f64x2(const f64x2 a, const f64x2 b) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, _mm_sub_pd(rmmd_load(a.raw), rmmd_load(b.raw)));
+#else
+    dest = rm_f64x2(a.x - b.x, a.y - b.y);
+#endif
+    return dest;
 }
 RM_INLINE f64x3
-rm_divs_f64x3(const f64x3 v, const f64 s) {
-    return rm_muls_f64x3(v, 1.0f / s);
+rm_sub_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_f64x3(a.x - b.x, a.y - b.y, a.z - b.z);
 }
 RM_INLINE f64x4
-rm_divs_f64x4(const f64x4 v, const f64 s) {
-    return rm_muls_f64x4(v, 1.0f / s);
+rm_sub_f64x4(const f64x4 a, const f64x4 b) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, _mm256_sub_pd(rmm256d_load(a.raw),
+                                          rmm256d_load(b.raw)));
+#else
+    dest = rm_f64x4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+#endif
+    return dest;
 }
 RM_INLINE u8x2
-rm_sdiv_u8x2(const u8 s, const u8x2 v) {
-    return rm_div_u8x2(rm_u8x2s(s), v);
+rm_subs_u8x2(const u8x2 v, const u8 s) {
+    return rm_sub_u8x2(v, rm_u8x2s(s));
 }
 RM_INLINE u8x3
-rm_sdiv_u8x3(const u8 s, const u8x3 v) {
-    return rm_div_u8x3(rm_u8x3s(s), v);
+rm_subs_u8x3(const u8x3 v, const u8 s) {
+    return rm_sub_u8x3(v, rm_u8x3s(s));
 }
 RM_INLINE u8x4
-rm_sdiv_u8x4(const u8 s, const u8x4 v) {
-    return rm_div_u8x4(rm_u8x4s(s), v);
+rm_subs_u8x4(const u8x4 v, const u8 s) {
+    return rm_sub_u8x4(v, rm_u8x4s(s));
 }
 RM_INLINE u16x2
-rm_sdiv_u16x2(const u16 s, const u16x2 v) {
-    return rm_div_u16x2(rm_u16x2s(s), v);
+rm_subs_u16x2(const u16x2 v, const u16 s) {
+    return rm_sub_u16x2(v, rm_u16x2s(s));
 }
 RM_INLINE u16x3
-rm_sdiv_u16x3(const u16 s, const u16x3 v) {
-    return rm_div_u16x3(rm_u16x3s(s), v);
+rm_subs_u16x3(const u16x3 v, const u16 s) {
+    return rm_sub_u16x3(v, rm_u16x3s(s));
 }
 RM_INLINE u16x4
-rm_sdiv_u16x4(const u16 s, const u16x4 v) {
-    return rm_div_u16x4(rm_u16x4s(s), v);
+rm_subs_u16x4(const u16x4 v, const u16 s) {
+    return rm_sub_u16x4(v, rm_u16x4s(s));
 }
 RM_INLINE u32x2
-rm_sdiv_u32x2(const u32 s, const u32x2 v) {
-    return rm_div_u32x2(rm_u32x2s(s), v);
+rm_subs_u32x2(const u32x2 v, const u32 s) {
+    return rm_sub_u32x2(v, rm_u32x2s(s));
 }
 RM_INLINE u32x3
-rm_sdiv_u32x3(const u32 s, const u32x3 v) {
-    return rm_div_u32x3(rm_u32x3s(s), v);
+rm_subs_u32x3(const u32x3 v, const u32 s) {
+    return rm_sub_u32x3(v, rm_u32x3s(s));
 }
 RM_INLINE u32x4
-rm_sdiv_u32x4(const u32 s, const u32x4 v) {
-    return rm_div_u32x4(rm_u32x4s(s), v);
+rm_subs_u32x4(const u32x4 v, const u32 s) {
+    return rm_sub_u32x4(v, rm_u32x4s(s));
 }
 RM_INLINE u64x2
-rm_sdiv_u64x2(const u64 s, const u64x2 v) {
-    return rm_div_u64x2(rm_u64x2s(s), v);
+rm_subs_u64x2(const u64x2 v, const u64 s) {
+    return rm_sub_u64x2(v, rm_u64x2s(s));
 }
 RM_INLINE u64x3
-rm_sdiv_u64x3(const u64 s, const u64x3 v) {
-    return rm_div_u64x3(rm_u64x3s(s), v);
+rm_subs_u64x3(const u64x3 v, const u64 s) {
+    return rm_sub_u64x3(v, rm_u64x3s(s));
 }
 RM_INLINE u64x4
-rm_sdiv_u64x4(const u64 s, const u64x4 v) {
-    return rm_div_u64x4(rm_u64x4s(s), v);
+rm_subs_u64x4(const u64x4 v, const u64 s) {
+    return rm_sub_u64x4(v, rm_u64x4s(s));
 }
 RM_INLINE i8x2
-rm_sdiv_i8x2(const i8 s, const i8x2 v) {
-    return rm_div_i8x2(rm_i8x2s(s), v);
+rm_subs_i8x2(const i8x2 v, const i8 s) {
+    return rm_sub_i8x2(v, rm_i8x2s(s));
 }
 RM_INLINE i8x3
-rm_sdiv_i8x3(const i8 s, const i8x3 v) {
-    return rm_div_i8x3(rm_i8x3s(s), v);
+rm_subs_i8x3(const i8x3 v, const i8 s) {
+    return rm_sub_i8x3(v, rm_i8x3s(s));
 }
 RM_INLINE i8x4
-rm_sdiv_i8x4(const i8 s, const i8x4 v) {
-    return rm_div_i8x4(rm_i8x4s(s), v);
+rm_subs_i8x4(const i8x4 v, const i8 s) {
+    return rm_sub_i8x4(v, rm_i8x4s(s));
 }
 RM_INLINE i16x2
-rm_sdiv_i16x2(const i16 s, const i16x2 v) {
-    return rm_div_i16x2(rm_i16x2s(s), v);
+rm_subs_i16x2(const i16x2 v, const i16 s) {
+    return rm_sub_i16x2(v, rm_i16x2s(s));
 }
 RM_INLINE i16x3
-rm_sdiv_i16x3(const i16 s, const i16x3 v) {
-    return rm_div_i16x3(rm_i16x3s(s), v);
+rm_subs_i16x3(const i16x3 v, const i16 s) {
+    return rm_sub_i16x3(v, rm_i16x3s(s));
 }
 RM_INLINE i16x4
-rm_sdiv_i16x4(const i16 s, const i16x4 v) {
-    return rm_div_i16x4(rm_i16x4s(s), v);
+rm_subs_i16x4(const i16x4 v, const i16 s) {
+    return rm_sub_i16x4(v, rm_i16x4s(s));
 }
 RM_INLINE i32x2
-rm_sdiv_i32x2(const i32 s, const i32x2 v) {
-    return rm_div_i32x2(rm_i32x2s(s), v);
+rm_subs_i32x2(const i32x2 v, const i32 s) {
+    return rm_sub_i32x2(v, rm_i32x2s(s));
 }
 RM_INLINE i32x3
-rm_sdiv_i32x3(const i32 s, const i32x3 v) {
-    return rm_div_i32x3(rm_i32x3s(s), v);
+rm_subs_i32x3(const i32x3 v, const i32 s) {
+    return rm_sub_i32x3(v, rm_i32x3s(s));
 }
 RM_INLINE i32x4
-rm_sdiv_i32x4(const i32 s, const i32x4 v) {
-    return rm_div_i32x4(rm_i32x4s(s), v);
+rm_subs_i32x4(const i32x4 v, const i32 s) {
+    return rm_sub_i32x4(v, rm_i32x4s(s));
 }
 RM_INLINE i64x2
-rm_sdiv_i64x2(const i64 s, const i64x2 v) {
-    return rm_div_i64x2(rm_i64x2s(s), v);
+rm_subs_i64x2(const i64x2 v, const i64 s) {
+    return rm_sub_i64x2(v, rm_i64x2s(s));
 }
 RM_INLINE i64x3
-rm_sdiv_i64x3(const i64 s, const i64x3 v) {
-    return rm_div_i64x3(rm_i64x3s(s), v);
+rm_subs_i64x3(const i64x3 v, const i64 s) {
+    return rm_sub_i64x3(v, rm_i64x3s(s));
 }
 RM_INLINE i64x4
-rm_sdiv_i64x4(const i64 s, const i64x4 v) {
-    return rm_div_i64x4(rm_i64x4s(s), v);
+rm_subs_i64x4(const i64x4 v, const i64 s) {
+    return rm_sub_i64x4(v, rm_i64x4s(s));
 }
 RM_INLINE f32x2
-rm_sdiv_f32x2(const f32 s, const f32x2 v) {
-    return rm_div_f32x2(rm_f32x2s(s), v);
+rm_subs_f32x2(const f32x2 v, const f32 s) {
+    return rm_sub_f32x2(v, rm_f32x2s(s));
 }
 RM_INLINE f32x3
-rm_sdiv_f32x3(const f32 s, const f32x3 v) {
-    return rm_div_f32x3(rm_f32x3s(s), v);
+rm_subs_f32x3(const f32x3 v, const f32 s) {
+    return rm_sub_f32x3(v, rm_f32x3s(s));
 }
 RM_INLINE f32x4
-rm_sdiv_f32x4(const f32 s, const f32x4 v) {
-    return rm_div_f32x4(rm_f32x4s(s), v);
+rm_subs_f32x4(const f32x4 v, const f32 s) {
+    return rm_sub_f32x4(v, rm_f32x4s(s));
 }
 RM_INLINE f64x2
-rm_sdiv_f64x2(const f64 s, const f64x2 v) {
-    return rm_div_f64x2(rm_f64x2s(s), v);
+rm_subs_f64x2(const f64x2 v, const f64 s) {
+    return rm_sub_f64x2(v, rm_f64x2s(s));
 }
 RM_INLINE f64x3
-rm_sdiv_f64x3(const f64 s, const f64x3 v) {
-    return rm_div_f64x3(rm_f64x3s(s), v);
+rm_subs_f64x3(const f64x3 v, const f64 s) {
+    return rm_sub_f64x3(v, rm_f64x3s(s));
 }
 RM_INLINE f64x4
-rm_sdiv_f64x4(const f64 s, const f64x4 v) {
-    return rm_div_f64x4(rm_f64x4s(s), v);
+rm_subs_f64x4(const f64x4 v, const f64 s) {
+    return rm_sub_f64x4(v, rm_f64x4s(s));
 }
 RM_INLINE u8x2
-rm_mod_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_u8x2(rm_mod_u8(a.x, b.x), rm_mod_u8(a.y, b.y));
+rm_ssub_u8x2(const u8 s, const u8x2 v) {
+    return rm_sub_u8x2(rm_u8x2s(s), v);
 }
 RM_INLINE u8x3
-rm_mod_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_u8x3(rm_mod_u8(a.x, b.x), rm_mod_u8(a.y, b.y),
-                   rm_mod_u8(a.z, b.z));
+rm_ssub_u8x3(const u8 s, const u8x3 v) {
+    return rm_sub_u8x3(rm_u8x3s(s), v);
 }
 RM_INLINE u8x4
-rm_mod_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_u8x4(rm_mod_u8(a.x, b.x), rm_mod_u8(a.y, b.y),
-                   rm_mod_u8(a.z, b.z), rm_mod_u8(a.w, b.w));
+rm_ssub_u8x4(const u8 s, const u8x4 v) {
+    return rm_sub_u8x4(rm_u8x4s(s), v);
 }
 RM_INLINE u16x2
-rm_mod_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_u16x2(rm_mod_u16(a.x, b.x), rm_mod_u16(a.y, b.y));
+rm_ssub_u16x2(const u16 s, const u16x2 v) {
+    return rm_sub_u16x2(rm_u16x2s(s), v);
 }
 RM_INLINE u16x3
-rm_mod_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_u16x3(rm_mod_u16(a.x, b.x), rm_mod_u16(a.y, b.y),
-                    rm_mod_u16(a.z, b.z));
+rm_ssub_u16x3(const u16 s, const u16x3 v) {
+    return rm_sub_u16x3(rm_u16x3s(s), v);
 }
 RM_INLINE u16x4
-rm_mod_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_u16x4(rm_mod_u16(a.x, b.x), rm_mod_u16(a.y, b.y),
-                    rm_mod_u16(a.z, b.z), rm_mod_u16(a.w, b.w));
+rm_ssub_u16x4(const u16 s, const u16x4 v) {
+    return rm_sub_u16x4(rm_u16x4s(s), v);
 }
 RM_INLINE u32x2
-rm_mod_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_u32x2(rm_mod_u32(a.x, b.x), rm_mod_u32(a.y, b.y));
+rm_ssub_u32x2(const u32 s, const u32x2 v) {
+    return rm_sub_u32x2(rm_u32x2s(s), v);
 }
 RM_INLINE u32x3
-rm_mod_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_u32x3(rm_mod_u32(a.x, b.x), rm_mod_u32(a.y, b.y),
-                    rm_mod_u32(a.z, b.z));
+rm_ssub_u32x3(const u32 s, const u32x3 v) {
+    return rm_sub_u32x3(rm_u32x3s(s), v);
 }
 RM_INLINE u32x4
-rm_mod_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_u32x4(rm_mod_u32(a.x, b.x), rm_mod_u32(a.y, b.y),
-                    rm_mod_u32(a.z, b.z), rm_mod_u32(a.w, b.w));
+rm_ssub_u32x4(const u32 s, const u32x4 v) {
+    return rm_sub_u32x4(rm_u32x4s(s), v);
 }
 RM_INLINE u64x2
-rm_mod_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_u64x2(rm_mod_u64(a.x, b.x), rm_mod_u64(a.y, b.y));
+rm_ssub_u64x2(const u64 s, const u64x2 v) {
+    return rm_sub_u64x2(rm_u64x2s(s), v);
 }
 RM_INLINE u64x3
-rm_mod_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_u64x3(rm_mod_u64(a.x, b.x), rm_mod_u64(a.y, b.y),
-                    rm_mod_u64(a.z, b.z));
+rm_ssub_u64x3(const u64 s, const u64x3 v) {
+    return rm_sub_u64x3(rm_u64x3s(s), v);
 }
 RM_INLINE u64x4
-rm_mod_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_u64x4(rm_mod_u64(a.x, b.x), rm_mod_u64(a.y, b.y),
-                    rm_mod_u64(a.z, b.z), rm_mod_u64(a.w, b.w));
+rm_ssub_u64x4(const u64 s, const u64x4 v) {
+    return rm_sub_u64x4(rm_u64x4s(s), v);
 }
 RM_INLINE i8x2
-rm_mod_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_i8x2(rm_mod_i8(a.x, b.x), rm_mod_i8(a.y, b.y));
+rm_ssub_i8x2(const i8 s, const i8x2 v) {
+    return rm_sub_i8x2(rm_i8x2s(s), v);
 }
 RM_INLINE i8x3
-rm_mod_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_i8x3(rm_mod_i8(a.x, b.x), rm_mod_i8(a.y, b.y),
-                   rm_mod_i8(a.z, b.z));
+rm_ssub_i8x3(const i8 s, const i8x3 v) {
+    return rm_sub_i8x3(rm_i8x3s(s), v);
 }
 RM_INLINE i8x4
-rm_mod_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_i8x4(rm_mod_i8(a.x, b.x), rm_mod_i8(a.y, b.y),
-                   rm_mod_i8(a.z, b.z), rm_mod_i8(a.w, b.w));
+rm_ssub_i8x4(const i8 s, const i8x4 v) {
+    return rm_sub_i8x4(rm_i8x4s(s), v);
 }
 RM_INLINE i16x2
-rm_mod_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_i16x2(rm_mod_i16(a.x, b.x), rm_mod_i16(a.y, b.y));
+rm_ssub_i16x2(const i16 s, const i16x2 v) {
+    return rm_sub_i16x2(rm_i16x2s(s), v);
 }
 RM_INLINE i16x3
-rm_mod_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_i16x3(rm_mod_i16(a.x, b.x), rm_mod_i16(a.y, b.y),
-                    rm_mod_i16(a.z, b.z));
+rm_ssub_i16x3(const i16 s, const i16x3 v) {
+    return rm_sub_i16x3(rm_i16x3s(s), v);
 }
 RM_INLINE i16x4
-rm_mod_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_i16x4(rm_mod_i16(a.x, b.x), rm_mod_i16(a.y, b.y),
-                    rm_mod_i16(a.z, b.z), rm_mod_i16(a.w, b.w));
+rm_ssub_i16x4(const i16 s, const i16x4 v) {
+    return rm_sub_i16x4(rm_i16x4s(s), v);
 }
 RM_INLINE i32x2
-rm_mod_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_i32x2(rm_mod_i32(a.x, b.x), rm_mod_i32(a.y, b.y));
+rm_ssub_i32x2(const i32 s, const i32x2 v) {
+    return rm_sub_i32x2(rm_i32x2s(s), v);
 }
 RM_INLINE i32x3
-rm_mod_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_i32x3(rm_mod_i32(a.x, b.x), rm_mod_i32(a.y, b.y),
-                    rm_mod_i32(a.z, b.z));
+rm_ssub_i32x3(const i32 s, const i32x3 v) {
+    return rm_sub_i32x3(rm_i32x3s(s), v);
 }
 RM_INLINE i32x4
-rm_mod_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_i32x4(rm_mod_i32(a.x, b.x), rm_mod_i32(a.y, b.y),
-                    rm_mod_i32(a.z, b.z), rm_mod_i32(a.w, b.w));
+rm_ssub_i32x4(const i32 s, const i32x4 v) {
+    return rm_sub_i32x4(rm_i32x4s(s), v);
 }
 RM_INLINE i64x2
-rm_mod_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_i64x2(rm_mod_i64(a.x, b.x), rm_mod_i64(a.y, b.y));
+rm_ssub_i64x2(const i64 s, const i64x2 v) {
+    return rm_sub_i64x2(rm_i64x2s(s), v);
 }
 RM_INLINE i64x3
-rm_mod_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_i64x3(rm_mod_i64(a.x, b.x), rm_mod_i64(a.y, b.y),
-                    rm_mod_i64(a.z, b.z));
+rm_ssub_i64x3(const i64 s, const i64x3 v) {
+    return rm_sub_i64x3(rm_i64x3s(s), v);
 }
 RM_INLINE i64x4
-rm_mod_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_i64x4(rm_mod_i64(a.x, b.x), rm_mod_i64(a.y, b.y),
-                    rm_mod_i64(a.z, b.z), rm_mod_i64(a.w, b.w));
+rm_ssub_i64x4(const i64 s, const i64x4 v) {
+    return rm_sub_i64x4(rm_i64x4s(s), v);
 }
 RM_INLINE f32x2
-rm_mod_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_f32x2(rm_mod_f32(a.x, b.x), rm_mod_f32(a.y, b.y));
+rm_ssub_f32x2(const f32 s, const f32x2 v) {
+    return rm_sub_f32x2(rm_f32x2s(s), v);
 }
 RM_INLINE f32x3
-rm_mod_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_f32x3(rm_mod_f32(a.x, b.x), rm_mod_f32(a.y, b.y),
-                    rm_mod_f32(a.z, b.z));
+rm_ssub_f32x3(const f32 s, const f32x3 v) {
+    return rm_sub_f32x3(rm_f32x3s(s), v);
 }
 RM_INLINE f32x4
-rm_mod_f32x4(const f32x4 a, const f32x4 b) {
-    f32x4 dest;
-#if defined(RM_SSE2)
-    __m128 xa, xb;
-    __m128i xdiv;
-
-    xa   = rmm_load(a.raw);
-    xb   = rmm_load(b.raw);
-    xdiv = _mm_cvttps_epi32(_mm_div_ps(xa, xb));
-
-    rmm_store(dest.raw,
-                 _mm_sub_ps(xa, _mm_mul_ps(_mm_castsi128_ps(xdiv), xb)));
-#else
-    dest = rm_f32x4(rm_mod_f32(a.x, b.x), rm_mod_f32(a.y, b.y),
-                    rm_mod_f32(a.z, b.z), rm_mod_f32(a.w, b.w));
-#endif
-    return dest;
+rm_ssub_f32x4(const f32 s, const f32x4 v) {
+    return rm_sub_f32x4(rm_f32x4s(s), v);
 }
 RM_INLINE f64x2
-rm_mod_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_f64x2(rm_mod_f64(a.x, b.x), rm_mod_f64(a.y, b.y));
+rm_ssub_f64x2(const f64 s, const f64x2 v) {
+    return rm_sub_f64x2(rm_f64x2s(s), v);
 }
 RM_INLINE f64x3
-rm_mod_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_f64x3(rm_mod_f64(a.x, b.x), rm_mod_f64(a.y, b.y),
-                    rm_mod_f64(a.z, b.z));
+rm_ssub_f64x3(const f64 s, const f64x3 v) {
+    return rm_sub_f64x3(rm_f64x3s(s), v);
 }
 RM_INLINE f64x4
-rm_mod_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_f64x4(rm_mod_f64(a.x, b.x), rm_mod_f64(a.y, b.y),
-                    rm_mod_f64(a.z, b.z), rm_mod_f64(a.w, b.w));
+rm_ssub_f64x4(const f64 s, const f64x4 v) {
+    return rm_sub_f64x4(rm_f64x4s(s), v);
 }
 RM_INLINE u8x2
-rm_mods_u8x2(const u8x2 v, const u8 s) {
-    return rm_mod_u8x2(v, rm_u8x2s(s));
+rm_mul_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_u8x2(a.x * b.x, a.y * b.y);
 }
 RM_INLINE u8x3
-rm_mods_u8x3(const u8x3 v, const u8 s) {
-    return rm_mod_u8x3(v, rm_u8x3s(s));
+rm_mul_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_u8x3(a.x * b.x, a.y * b.y, a.z * b.z);
 }
 RM_INLINE u8x4
-rm_mods_u8x4(const u8x4 v, const u8 s) {
-    return rm_mod_u8x4(v, rm_u8x4s(s));
+rm_mul_u8x4(const u8x4 a, const u8x4 b) {
+    u8x4 dest;
+#if defined(RM_SSE2)
+    dest = rmmi_to_u8x4(rmmi_mullo_epi8(rmmi_from_u8x4(a), rmmi_from_u8x4(b)));
+#elif defined(RM_NEON)
+    dest = rmn_to_u8x4(vmul_u8(rmn_from_u8x4(a), rmn_from_u8x4(b)));
+#else
+    dest = rm_u8x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+#endif
+    return dest;
 }
 RM_INLINE u16x2
-rm_mods_u16x2(const u16x2 v, const u16 s) {
-    return rm_mod_u16x2(v, rm_u16x2s(s));
+rm_mul_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_u16x2(a.x * b.x, a.y * b.y);
 }
 RM_INLINE u16x3
-rm_mods_u16x3(const u16x3 v, const u16 s) {
-    return rm_mod_u16x3(v, rm_u16x3s(s));
+rm_mul_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_u16x3(a.x * b.x, a.y * b.y, a.z * b.z);
 }
 RM_INLINE u16x4
-rm_mods_u16x4(const u16x4 v, const u16 s) {
-    return rm_mod_u16x4(v, rm_u16x4s(s));
+rm_mul_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_u16x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
 }
 RM_INLINE u32x2
-rm_mods_u32x2(const u32x2 v, const u32 s) {
-    return rm_mod_u32x2(v, rm_u32x2s(s));
+rm_mul_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_u32x2(a.x * b.x, a.y * b.y);
 }
 RM_INLINE u32x3
-rm_mods_u32x3(const u32x3 v, const u32 s) {
-    return rm_mod_u32x3(v, rm_u32x3s(s));
+rm_mul_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_u32x3(a.x * b.x, a.y * b.y, a.z * b.z);
 }
 RM_INLINE u32x4
-rm_mods_u32x4(const u32x4 v, const u32 s) {
-    return rm_mod_u32x4(v, rm_u32x4s(s));
+rm_mul_u32x4(const u32x4 a, const u32x4 b) {
+    u32x4 dest;
+#if defined(RM_SSE2)
+    rmmi_store(dest.raw, rmmi_mullo_epi32(rmmi_load(a.raw), rmmi_load(b.raw)));
+#elif defined(RM_NEON)
+    vst1q_u32(dest.raw, vmulq_u32(vld1q_u32(a.raw), vld1q_u32(b.raw)));
+#else
+    dest = rm_u32x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+#endif
+    return dest;
 }
 RM_INLINE u64x2
-rm_mods_u64x2(const u64x2 v, const u64 s) {
-    return rm_mod_u64x2(v, rm_u64x2s(s));
+rm_mul_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_u64x2(a.x * b.x, a.y * b.y);
 }
 RM_INLINE u64x3
-rm_mods_u64x3(const u64x3 v, const u64 s) {
-    return rm_mod_u64x3(v, rm_u64x3s(s));
+rm_mul_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_u64x3(a.x * b.x, a.y * b.y, a.z * b.z);
 }
 RM_INLINE u64x4
-rm_mods_u64x4(const u64x4 v, const u64 s) {
-    return rm_mod_u64x4(v, rm_u64x4s(s));
+rm_mul_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_u64x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
 }
 RM_INLINE i8x2
-rm_mods_i8x2(const i8x2 v, const i8 s) {
-    return rm_mod_i8x2(v, rm_i8x2s(s));
+rm_mul_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_i8x2(a.x * b.x, a.y * b.y);
 }
 RM_INLINE i8x3
-rm_mods_i8x3(const i8x3 v, const i8 s) {
-    return rm_mod_i8x3(v, rm_i8x3s(s));
+rm_mul_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_i8x3(a.x * b.x, a.y * b.y, a.z * b.z);
 }
 RM_INLINE i8x4
-rm_mods_i8x4(const i8x4 v, const i8 s) {
-    return rm_mod_i8x4(v, rm_i8x4s(s));
+rm_mul_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_i8x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
 }
 RM_INLINE i16x2
-rm_mods_i16x2(const i16x2 v, const i16 s) {
-    return rm_mod_i16x2(v, rm_i16x2s(s));
+rm_mul_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_i16x2(a.x * b.x, a.y * b.y);
 }
 RM_INLINE i16x3
-rm_mods_i16x3(const i16x3 v, const i16 s) {
-    return rm_mod_i16x3(v, rm_i16x3s(s));
+rm_mul_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_i16x3(a.x * b.x, a.y * b.y, a.z * b.z);
 }
 RM_INLINE i16x4
-rm_mods_i16x4(const i16x4 v, const i16 s) {
-    return rm_mod_i16x4(v, rm_i16x4s(s));
-}
-RM_INLINE i32x2
-rm_mods_i32x2(const i32x2 v, const i32 s) {
-    return rm_mod_i32x2(v, rm_i32x2s(s));
+rm_mul_i16x4(const i16x4 a, const i16x4 b) {
+    i16x4 dest;
+#if defined(RM_SSE2)
+    rmmi_storel(dest.raw, _mm_mullo_epi16(rmmi_loadl(a.raw),
+                                          rmmi_loadl(b.raw)));
+#elif defined(RM_NEON)
+    vst1_s16(dest.raw, vmul_s16(vld1_s16(a.raw), vld1_s16(b.raw)));
+#else
+    dest = rm_i16x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+#endif
+    return dest;
+}
+RM_INLINE i32x2
+rm_mul_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_i32x2(a.x * b.x, a.y * b.y);
 }
 RM_INLINE i32x3
-rm_mods_i32x3(const i32x3 v, const i32 s) {
-    return rm_mod_i32x3(v, rm_i32x3s(s));
+rm_mul_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_i32x3(a.x * b.x, a.y * b.y, a.z * b.z);
 }
 RM_INLINE i32x4
-rm_mods_i32x4(const i32x4 v, const i32 s) {
-    return rm_mod_i32x4(v, rm_i32x4s(s));
+rm_mul_i32x4(const i32x4 a, const i32x4 b) {
+    i32x4 dest;
+#if defined(RM_SSE2)
+    rmmi_store(dest.raw, rmmi_mullo_epi32(rmmi_load(a.raw), rmmi_load(b.raw)));
+#elif defined(RM_NEON)
+    vst1q_s32(dest.raw, vmulq_s32(vld1q_s32(a.raw), vld1q_s32(b.raw)));
+#else
+    dest = rm_i32x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+#endif
+    return dest;
 }
 RM_INLINE i64x2
-rm_mods_i64x2(const i64x2 v, const i64 s) {
-    return rm_mod_i64x2(v, rm_i64x2s(s));
+rm_mul_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_i64x2(a.x * b.x, a.y * b.y);
 }
 RM_INLINE i64x3
-rm_mods_i64x3(const i64x3 v, const i64 s) {
-    return rm_mod_i64x3(v, rm_i64x3s(s));
+rm_mul_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_i64x3(a.x * b.x, a.y * b.y, a.z * b.z);
 }
 RM_INLINE i64x4
-rm_mods_i64x4(const i64x4 v, const i64 s) {
-    return rm_mod_i64x4(v, rm_i64x4s(s));
+rm_mul_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_i64x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
 }
 RM_INLINE f32x2
-rm_mods_f32x2(const f32x2 v, const f32 s) {
-    return rm_mod_f32x2(v, rm_f32x2s(s));
+rm_mul_f32x2(const f32x2 a, const f32x2 b) {
+    return rm_f32x2(a.x * b.x, a.y * b.y);
 }
 RM_INLINE f32x3
-rm_mods_f32x3(const f32x3 v, const f32 s) {
-    return rm_mod_f32x3(v, rm_f32x3s(s));
+rm_mul_f32x3(const f32x3 a, const f32x3 b) {
+    return rm_f32x3(a.x * b.x, a.y * b.y, a.z * b.z);
 }
 RM_INLINE f32x4
-rm_mods_f32x4(const f32x4 v, const f32 s) {
-    return rm_mod_f32x4(v, rm_f32x4s(s));
+rm_mul_f32x4(const f32x4 a, const f32x4 b) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_mul(rmm_load(a.raw), rmm_load(b.raw)));
+#else
+    dest = rm_f32x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+#endif
+    return dest;
 }
 RM_INLINE f64x2
-rm_mods_f64x2(const f64x2 v, const f64 s) {
-    return rm_mod_f64x2(v, rm_f64x2s(s));
+rm_mul_f64x2(const f64x2 a, const f64x2 b) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, _mm_mul_pd(rmmd_load(a.raw), rmmd_load(b.raw)));
+#else
+    dest = rm_f64x2(a.x * b.x, a.y * b.y);
+#endif
+    return dest;
 }
 RM_INLINE f64x3
-rm_mods_f64x3(const f64x3 v, const f64 s) {
-    return rm_mod_f64x3(v, rm_f64x3s(s));
+rm_mul_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_f64x3(a.x * b.x, a.y * b.y, a.z * b.z);
 }
 RM_INLINE f64x4
-rm_mods_f64x4(const f64x4 v, const f64 s) {
-    return rm_mod_f64x4(v, rm_f64x4s(s));
+rm_mul_f64x4(const f64x4 a, const f64x4 b) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, _mm256_mul_pd(rmm256d_load(a.raw),
+                                          rmm256d_load(b.raw)));
+#else
+    dest = rm_f64x4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+#endif
+    return dest;
 }
 RM_INLINE u8x2
-rm_smod_u8x2(const u8 s, const u8x2 v) {
-    return rm_mod_u8x2(rm_u8x2s(s), v);
+rm_muls_u8x2(const u8x2 v, const u8 s) {
+    return rm_mul_u8x2(v, rm_u8x2s(s));
 }
 RM_INLINE u8x3
-rm_smod_u8x3(const u8 s, const u8x3 v) {
-    return rm_mod_u8x3(rm_u8x3s(s), v);
+rm_muls_u8x3(const u8x3 v, const u8 s) {
+    return rm_mul_u8x3(v, rm_u8x3s(s));
 }
 RM_INLINE u8x4
-rm_smod_u8x4(const u8 s, const u8x4 v) {
-    return rm_mod_u8x4(rm_u8x4s(s), v);
+rm_muls_u8x4(const u8x4 v, const u8 s) {
+    return rm_mul_u8x4(v, rm_u8x4s(s));
 }
 RM_INLINE u16x2
-rm_smod_u16x2(const u16 s, const u16x2 v) {
-    return rm_mod_u16x2(rm_u16x2s(s), v);
+rm_muls_u16x2(const u16x2 v, const u16 s) {
+    return rm_mul_u16x2(v, rm_u16x2s(s));
 }
 RM_INLINE u16x3
-rm_smod_u16x3(const u16 s, const u16x3 v) {
-    return rm_mod_u16x3(rm_u16x3s(s), v);
+rm_muls_u16x3(const u16x3 v, const u16 s) {
+    return rm_mul_u16x3(v, rm_u16x3s(s));
 }
 RM_INLINE u16x4
-rm_smod_u16x4(const u16 s, const u16x4 v) {
-    return rm_mod_u16x4(rm_u16x4s(s), v);
+rm_muls_u16x4(const u16x4 v, const u16 s) {
+    return rm_mul_u16x4(v, rm_u16x4s(s));
 }
 RM_INLINE u32x2
-rm_smod_u32x2(const u32 s, const u32x2 v) {
-    return rm_mod_u32x2(rm_u32x2s(s), v);
+rm_muls_u32x2(const u32x2 v, const u32 s) {
+    return rm_mul_u32x2(v, rm_u32x2s(s));
 }
 RM_INLINE u32x3
-rm_smod_u32x3(const u32 s, const u32x3 v) {
-    return rm_mod_u32x3(rm_u32x3s(s), v);
+rm_muls_u32x3(const u32x3 v, const u32 s) {
+    return rm_mul_u32x3(v, rm_u32x3s(s));
 }
 RM_INLINE u32x4
-rm_smod_u32x4(const u32 s, const u32x4 v) {
-    return rm_mod_u32x4(rm_u32x4s(s), v);
+rm_muls_u32x4(const u32x4 v, const u32 s) {
+    return rm_mul_u32x4(v, rm_u32x4s(s));
 }
 RM_INLINE u64x2
-rm_smod_u64x2(const u64 s, const u64x2 v) {
-    return rm_mod_u64x2(rm_u64x2s(s), v);
+rm_muls_u64x2(const u64x2 v, const u64 s) {
+    return rm_mul_u64x2(v, rm_u64x2s(s));
 }
 RM_INLINE u64x3
-rm_smod_u64x3(const u64 s, const u64x3 v) {
-    return rm_mod_u64x3(rm_u64x3s(s), v);
+rm_muls_u64x3(const u64x3 v, const u64 s) {
+    return rm_mul_u64x3(v, rm_u64x3s(s));
 }
 RM_INLINE u64x4
-rm_smod_u64x4(const u64 s, const u64x4 v) {
-    return rm_mod_u64x4(rm_u64x4s(s), v);
+rm_muls_u64x4(const u64x4 v, const u64 s) {
+    return rm_mul_u64x4(v, rm_u64x4s(s));
 }
 RM_INLINE i8x2
-rm_smod_i8x2(const i8 s, const i8x2 v) {
-    return rm_mod_i8x2(rm_i8x2s(s), v);
+rm_muls_i8x2(const i8x2 v, const i8 s) {
+    return rm_mul_i8x2(v, rm_i8x2s(s));
 }
 RM_INLINE i8x3
-rm_smod_i8x3(const i8 s, const i8x3 v) {
-    return rm_mod_i8x3(rm_i8x3s(s), v);
+rm_muls_i8x3(const i8x3 v, const i8 s) {
+    return rm_mul_i8x3(v, rm_i8x3s(s));
 }
 RM_INLINE i8x4
-rm_smod_i8x4(const i8 s, const i8x4 v) {
-    return rm_mod_i8x4(rm_i8x4s(s), v);
+rm_muls_i8x4(const i8x4 v, const i8 s) {
+    return rm_mul_i8x4(v, rm_i8x4s(s));
 }
 RM_INLINE i16x2
-rm_smod_i16x2(const i16 s, const i16x2 v) {
-    return rm_mod_i16x2(rm_i16x2s(s), v);
+rm_muls_i16x2(const i16x2 v, const i16 s) {
+    return rm_mul_i16x2(v, rm_i16x2s(s));
 }
 RM_INLINE i16x3
-rm_smod_i16x3(const i16 s, const i16x3 v) {
-    return rm_mod_i16x3(rm_i16x3s(s), v);
+rm_muls_i16x3(const i16x3 v, const i16 s) {
+    return rm_mul_i16x3(v, rm_i16x3s(s));
 }
 RM_INLINE i16x4
-rm_smod_i16x4(const i16 s, const i16x4 v) {
-    return rm_mod_i16x4(rm_i16x4s(s), v);
+rm_muls_i16x4(const i16x4 v, const i16 s) {
+    return rm_mul_i16x4(v, rm_i16x4s(s));
 }
 RM_INLINE i32x2
-rm_smod_i32x2(const i32 s, const i32x2 v) {
-    return rm_mod_i32x2(rm_i32x2s(s), v);
+rm_muls_i32x2(const i32x2 v, const i32 s) {
+    return rm_mul_i32x2(v, rm_i32x2s(s));
 }
 RM_INLINE i32x3
-rm_smod_i32x3(const i32 s, const i32x3 v) {
-    return rm_mod_i32x3(rm_i32x3s(s), v);
+rm_muls_i32x3(const i32x3 v, const i32 s) {
+    return rm_mul_i32x3(v, rm_i32x3s(s));
 }
 RM_INLINE i32x4
-rm_smod_i32x4(const i32 s, const i32x4 v) {
-    return rm_mod_i32x4(rm_i32x4s(s), v);
+rm_muls_i32x4(const i32x4 v, const i32 s) {
+    return rm_mul_i32x4(v, rm_i32x4s(s));
 }
 RM_INLINE i64x2
-rm_smod_i64x2(const i64 s, const i64x2 v) {
-    return rm_mod_i64x2(rm_i64x2s(s), v);
+rm_muls_i64x2(const i64x2 v, const i64 s) {
+    return rm_mul_i64x2(v, rm_i64x2s(s));
 }
 RM_INLINE i64x3
-rm_smod_i64x3(const i64 s, const i64x3 v) {
-    return rm_mod_i64x3(rm_i64x3s(s), v);
+rm_muls_i64x3(const i64x3 v, const i64 s) {
+    return rm_mul_i64x3(v, rm_i64x3s(s));
 }
 RM_INLINE i64x4
-rm_smod_i64x4(const i64 s, const i64x4 v) {
-    return rm_mod_i64x4(rm_i64x4s(s), v);
+rm_muls_i64x4(const i64x4 v, const i64 s) {
+    return rm_mul_i64x4(v, rm_i64x4s(s));
 }
 RM_INLINE f32x2
-rm_smod_f32x2(const f32 s, const f32x2 v) {
-    return rm_mod_f32x2(rm_f32x2s(s), v);
+rm_muls_f32x2(const f32x2 v, const f32 s) {
+    return rm_mul_f32x2(v, rm_f32x2s(s));
 }
 RM_INLINE f32x3
-rm_smod_f32x3(const f32 s, const f32x3 v) {
-    return rm_mod_f32x3(rm_f32x3s(s), v);
+rm_muls_f32x3(const f32x3 v, const f32 s) {
+    return rm_mul_f32x3(v, rm_f32x3s(s));
 }
 RM_INLINE f32x4
-rm_smod_f32x4(const f32 s, const f32x4 v) {
-    return rm_mod_f32x4(rm_f32x4s(s), v);
+rm_muls_f32x4(const f32x4 v, const f32 s) {
+    return rm_mul_f32x4(v, rm_f32x4s(s));
 }
 RM_INLINE f64x2
-rm_smod_f64x2(const f64 s, const f64x2 v) {
-    return rm_mod_f64x2(rm_f64x2s(s), v);
+rm_muls_f64x2(const f64x2 v, const f64 s) {
+    return rm_mul_f64x2(v, rm_f64x2s(s));
 }
 RM_INLINE f64x3
-rm_smod_f64x3(const f64 s, const f64x3 v) {
-    return rm_mod_f64x3(rm_f64x3s(s), v);
+rm_muls_f64x3(const f64x3 v, const f64 s) {
+    return rm_mul_f64x3(v, rm_f64x3s(s));
 }
 RM_INLINE f64x4
-rm_smod_f64x4(const f64 s, const f64x4 v) {
-    return rm_mod_f64x4(rm_f64x4s(s), v);
+rm_muls_f64x4(const f64x4 v, const f64 s) {
+    return rm_mul_f64x4(v, rm_f64x4s(s));
 }
 RM_INLINE u8x2
-rm_clamp_u8x2(const u8x2 v, const u8x2 min, const u8x2 max) {
-    return rm_u8x2(rm_clamp_u8(v.x, min.x, max.x),
-                   rm_clamp_u8(v.y, min.y, max.y));
+rm_div_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_u8x2(a.x / b.x, a.y / b.y);
 }
 RM_INLINE u8x3
-rm_clamp_u8x3(const u8x3 v, const u8x3 min, const u8x3 max) {
-    return rm_u8x3(rm_clamp_u8(v.x, min.x, max.x),
-                   rm_clamp_u8(v.y, min.y, max.y),
-                   rm_clamp_u8(v.z, min.z, max.z));
+rm_div_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_u8x3(a.x / b.x, a.y / b.y, a.z / b.z);
 }
 RM_INLINE u8x4
-rm_clamp_u8x4(const u8x4 v, const u8x4 min, const u8x4 max) {
-    return rm_u8x4(
-        rm_clamp_u8(v.x, min.x, max.x), rm_clamp_u8(v.y, min.y, max.y),
-        rm_clamp_u8(v.z, min.z, max.z), rm_clamp_u8(v.w, min.w, max.w));
+rm_div_u8x4(const u8x4 a, const u8x4 b) {
+    return rm_u8x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
 }
 RM_INLINE u16x2
-rm_clamp_u16x2(const u16x2 v, const u16x2 min, const u16x2 max) {
-    return rm_u16x2(rm_clamp_u16(v.x, min.x, max.x),
-                    rm_clamp_u16(v.y, min.y, max.y));
+rm_div_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_u16x2(a.x / b.x, a.y / b.y);
 }
 RM_INLINE u16x3
-rm_clamp_u16x3(const u16x3 v, const u16x3 min, const u16x3 max) {
-    return rm_u16x3(rm_clamp_u16(v.x, min.x, max.x),
-                    rm_clamp_u16(v.y, min.y, max.y),
-                    rm_clamp_u16(v.z, min.z, max.z));
+rm_div_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_u16x3(a.x / b.x, a.y / b.y, a.z / b.z);
 }
 RM_INLINE u16x4
-rm_clamp_u16x4(const u16x4 v, const u16x4 min, const u16x4 max) {
-    return rm_u16x4(
-        rm_clamp_u16(v.x, min.x, max.x), rm_clamp_u16(v.y, min.y, max.y),
-        rm_clamp_u16(v.z, min.z, max.z), rm_clamp_u16(v.w, min.w, max.w));
+rm_div_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_u16x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
 }
 RM_INLINE u32x2
-rm_clamp_u32x2(const u32x2 v, const u32x2 min, const u32x2 max) {
-    return rm_u32x2(rm_clamp_u32(v.x, min.x, max.x),
-                    rm_clamp_u32(v.y, min.y, max.y));
+rm_div_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_u32x2(a.x / b.x, a.y / b.y);
 }
 RM_INLINE u32x3
-rm_clamp_u32x3(const u32x3 v, const u32x3 min, const u32x3 max) {
-    return rm_u32x3(rm_clamp_u32(v.x, min.x, max.x),
-                    rm_clamp_u32(v.y, min.y, max.y),
-                    rm_clamp_u32(v.z, min.z, max.z));
+rm_div_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_u32x3(a.x / b.x, a.y / b.y, a.z / b.z);
 }
 RM_INLINE u32x4
-rm_clamp_u32x4(const u32x4 v, const u32x4 min, const u32x4 max) {
-    return rm_u32x4(
-        rm_clamp_u32(v.x, min.x, max.x), rm_clamp_u32(v.y, min.y, max.y),
-        rm_clamp_u32(v.z, min.z, max.z), rm_clamp_u32(v.w, min.w, max.w));
+rm_div_u32x4(const u32x4 a, const u32x4 b) {
+    return rm_u32x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
 }
 RM_INLINE u64x2
-rm_clamp_u64x2(const u64x2 v, const u64x2 min, const u64x2 max) {
-    return rm_u64x2(rm_clamp_u64(v.x, min.x, max.x),
-                    rm_clamp_u64(v.y, min.y, max.y));
+rm_div_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_u64x2(a.x / b.x, a.y / b.y);
 }
 RM_INLINE u64x3
-rm_clamp_u64x3(const u64x3 v, const u64x3 min, const u64x3 max) {
-    return rm_u64x3(rm_clamp_u64(v.x, min.x, max.x),
-                    rm_clamp_u64(v.y, min.y, max.y),
-                    rm_clamp_u64(v.z, min.z, max.z));
+rm_div_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_u64x3(a.x / b.x, a.y / b.y, a.z / b.z);
 }
 RM_INLINE u64x4
-rm_clamp_u64x4(const u64x4 v, const u64x4 min, const u64x4 max) {
-    return rm_u64x4(
-        rm_clamp_u64(v.x, min.x, max.x), rm_clamp_u64(v.y, min.y, max.y),
-        rm_clamp_u64(v.z, min.z, max.z), rm_clamp_u64(v.w, min.w, max.w));
+rm_div_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_u64x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
 }
 RM_INLINE i8x2
-rm_clamp_i8x2(const i8x2 v, const i8x2 min, const i8x2 max) {
-    return rm_i8x2(rm_clamp_i8(v.x, min.x, max.x),
-                   rm_clamp_i8(v.y, min.y, max.y));
+rm_div_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_i8x2(a.x / b.x, a.y / b.y);
 }
 RM_INLINE i8x3
-rm_clamp_i8x3(const i8x3 v, const i8x3 min, const i8x3 max) {
-    return rm_i8x3(rm_clamp_i8(v.x, min.x, max.x),
-                   rm_clamp_i8(v.y, min.y, max.y),
-                   rm_clamp_i8(v.z, min.z, max.z));
+rm_div_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_i8x3(a.x / b.x, a.y / b.y, a.z / b.z);
 }
 RM_INLINE i8x4
-rm_clamp_i8x4(const i8x4 v, const i8x4 min, const i8x4 max) {
-    return rm_i8x4(
-        rm_clamp_i8(v.x, min.x, max.x), rm_clamp_i8(v.y, min.y, max.y),
-        rm_clamp_i8(v.z, min.z, max.z), rm_clamp_i8(v.w, min.w, max.w));
+rm_div_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_i8x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
 }
 RM_INLINE i16x2
-rm_clamp_i16x2(const i16x2 v, const i16x2 min, const i16x2 max) {
-    return rm_i16x2(rm_clamp_i16(v.x, min.x, max.x),
-                    rm_clamp_i16(v.y, min.y, max.y));
+rm_div_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_i16x2(a.x / b.x, a.y / b.y);
 }
 RM_INLINE i16x3
-rm_clamp_i16x3(const i16x3 v, const i16x3 min, const i16x3 max) {
-    return rm_i16x3(rm_clamp_i16(v.x, min.x, max.x),
-                    rm_clamp_i16(v.y, min.y, max.y),
-                    rm_clamp_i16(v.z, min.z, max.z));
+rm_div_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_i16x3(a.x / b.x, a.y / b.y, a.z / b.z);
 }
 RM_INLINE i16x4
-rm_clamp_i16x4(const i16x4 v, const i16x4 min, const i16x4 max) {
-    return rm_i16x4(
-        rm_clamp_i16(v.x, min.x, max.x), rm_clamp_i16(v.y, min.y, max.y),
-        rm_clamp_i16(v.z, min.z, max.z), rm_clamp_i16(v.w, min.w, max.w));
+rm_div_i16x4(const i16x4 a, const i16x4 b) {
+    return rm_i16x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
 }
 RM_INLINE i32x2
-rm_clamp_i32x2(const i32x2 v, const i32x2 min, const i32x2 max) {
-    return rm_i32x2(rm_clamp_i32(v.x, min.x, max.x),
-                    rm_clamp_i32(v.y, min.y, max.y));
+rm_div_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_i32x2(a.x / b.x, a.y / b.y);
 }
 RM_INLINE i32x3
-rm_clamp_i32x3(const i32x3 v, const i32x3 min, const i32x3 max) {
-    return rm_i32x3(rm_clamp_i32(v.x, min.x, max.x),
-                    rm_clamp_i32(v.y, min.y, max.y),
-                    rm_clamp_i32(v.z, min.z, max.z));
+rm_div_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_i32x3(a.x / b.x, a.y / b.y, a.z / b.z);
 }
 RM_INLINE i32x4
-rm_clamp_i32x4(const i32x4 v, const i32x4 min, const i32x4 max) {
-    return rm_i32x4(
-        rm_clamp_i32(v.x, min.x, max.x), rm_clamp_i32(v.y, min.y, max.y),
-        rm_clamp_i32(v.z, min.z, max.z), rm_clamp_i32(v.w, min.w, max.w));
+rm_div_i32x4(const i32x4 a, const i32x4 b) {
+    return rm_i32x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
 }
 RM_INLINE i64x2
-rm_clamp_i64x2(const i64x2 v, const i64x2 min, const i64x2 max) {
-    return rm_i64x2(rm_clamp_i64(v.x, min.x, max.x),
-                    rm_clamp_i64(v.y, min.y, max.y));
+rm_div_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_i64x2(a.x / b.x, a.y / b.y);
 }
 RM_INLINE i64x3
-rm_clamp_i64x3(const i64x3 v, const i64x3 min, const i64x3 max) {
-    return rm_i64x3(rm_clamp_i64(v.x, min.x, max.x),
-                    rm_clamp_i64(v.y, min.y, max.y),
-                    rm_clamp_i64(v.z, min.z, max.z));
+rm_div_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_i64x3(a.x / b.x, a.y / b.y, a.z / b.z);
 }
 RM_INLINE i64x4
-rm_clamp_i64x4(const i64x4 v, const i64x4 min, const i64x4 max) {
-    return rm_i64x4(
-        rm_clamp_i64(v.x, min.x, max.x), rm_clamp_i64(v.y, min.y, max.y),
-        rm_clamp_i64(v.z, min.z, max.z), rm_clamp_i64(v.w, min.w, max.w));
+rm_div_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_i64x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
 }
 RM_INLINE f32x2
-rm_clamp_f32x2(const f32x2 v, const f32x2 min, const f32x2 max) {
-    return rm_f32x2(rm_clamp_f32(v.x, min.x, max.x),
-                    rm_clamp_f32(v.y, min.y, max.y));
+rm_div_f32x2(const f32x2 a, const f32x2 b) {
+    return rm_f32x2(a.x / b.x, a.y / b.y);
 }
 RM_INLINE f32x3
-rm_clamp_f32x3(const f32x3 v, const f32x3 min, const f32x3 max) {
-    return rm_f32x3(rm_clamp_f32(v.x, min.x, max.x),
-                    rm_clamp_f32(v.y, min.y, max.y),
-                    rm_clamp_f32(v.z, min.z, max.z));
+rm_div_f32x3(const f32x3 a, const f32x3 b) {
+    return rm_f32x3(a.x / b.x, a.y / b.y, a.z / b.z);
 }
 RM_INLINE f32x4
-rm_clamp_f32x4(const f32x4 v, const f32x4 min, const f32x4 max) {
+rm_div_f32x4(const f32x4 a, const f32x4 b) {
     f32x4 dest;
-#if defined(RM_SSE)
-    rmm_store(dest.raw, _mm_min_ps(_mm_max_ps(rmm_load(v.raw),
-                                                 rmm_load(min.raw)),
-                                      rmm_load(max.raw)));
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_div(rmm_load(a.raw), rmm_load(b.raw)));
 #else
-    dest = rm_f32x4(
-        rm_clamp_f32(v.x, min.x, max.x), rm_clamp_f32(v.y, min.y, max.y),
-        rm_clamp_f32(v.z, min.z, max.z), rm_clamp_f32(v.w, min.w, max.w));
+    dest = rm_f32x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
 #endif
     return dest;
 }
 RM_INLINE f64x2
-rm_clamp_f64x2(const f64x2 v, const f64x2 min, const f64x2 max) {
-    return rm_f64x2(rm_clamp_f64(v.x, min.x, max.x),
-                    rm_clamp_f64(v.y, min.y, max.y));
+rm_div_f64x2(const f64x2 a, const f64x2 b) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, _mm_div_pd(rmmd_load(a.raw), rmmd_load(b.raw)));
+#else
+    dest = rm_f64x2(a.x / b.x, a.y / b.y);
+#endif
+    return dest;
 }
 RM_INLINE f64x3
-rm_clamp_f64x3(const f64x3 v, const f64x3 min, const f64x3 max) {
-    return rm_f64x3(rm_clamp_f64(v.x, min.x, max.x),
-                    rm_clamp_f64(v.y, min.y, max.y),
-                    rm_clamp_f64(v.z, min.z, max.z));
+rm_div_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_f64x3(a.x / b.x, a.y / b.y, a.z / b.z);
 }
 RM_INLINE f64x4
-rm_clamp_f64x4(const f64x4 v, const f64x4 min, const f64x4 max) {
-    return rm_f64x4(
-        rm_clamp_f64(v.x, min.x, max.x), rm_clamp_f64(v.y, min.y, max.y),
-        rm_clamp_f64(v.z, min.z, max.z), rm_clamp_f64(v.w, min.w, max.w));
+rm_div_f64x4(const f64x4 a, const f64x4 b) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, _mm256_div_pd(rmm256d_load(a.raw),
+                                          rmm256d_load(b.raw)));
+#else
+    dest = rm_f64x4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+#endif
+    return dest;
 }
 RM_INLINE u8x2
-rm_clamps_u8x2(const u8x2 v, u8 min, u8 max) {
-    return rm_clamp_u8x2(v, rm_u8x2s(min), rm_u8x2s(max));
+rm_divs_u8x2(const u8x2 v, const u8 s) {
+    return rm_muls_u8x2(v, 1.0f / s);
 }
 RM_INLINE u8x3
-rm_clamps_u8x3(const u8x3 v, u8 min, u8 max) {
-    return rm_clamp_u8x3(v, rm_u8x3s(min), rm_u8x3s(max));
+rm_divs_u8x3(const u8x3 v, const u8 s) {
+    return rm_muls_u8x3(v, 1.0f / s);
 }
 RM_INLINE u8x4
-rm_clamps_u8x4(const u8x4 v, u8 min, u8 max) {
-    return rm_clamp_u8x4(v, rm_u8x4s(min), rm_u8x4s(max));
+rm_divs_u8x4(const u8x4 v, const u8 s) {
+    return rm_muls_u8x4(v, 1.0f / s);
 }
 RM_INLINE u16x2
-rm_clamps_u16x2(const u16x2 v, u16 min, u16 max) {
-    return rm_clamp_u16x2(v, rm_u16x2s(min), rm_u16x2s(max));
+rm_divs_u16x2(const u16x2 v, const u16 s) {
+    return rm_muls_u16x2(v, 1.0f / s);
 }
 RM_INLINE u16x3
-rm_clamps_u16x3(const u16x3 v, u16 min, u16 max) {
-    return rm_clamp_u16x3(v, rm_u16x3s(min), rm_u16x3s(max));
+rm_divs_u16x3(const u16x3 v, const u16 s) {
+    return rm_muls_u16x3(v, 1.0f / s);
 }
 RM_INLINE u16x4
-rm_clamps_u16x4(const u16x4 v, u16 min, u16 max) {
-    return rm_clamp_u16x4(v, rm_u16x4s(min), rm_u16x4s(max));
+rm_divs_u16x4(const u16x4 v, const u16 s) {
+    return rm_muls_u16x4(v, 1.0f / s);
 }
 RM_INLINE u32x2
-rm_clamps_u32x2(const u32x2 v, u32 min, u32 max) {
-    return rm_clamp_u32x2(v, rm_u32x2s(min), rm_u32x2s(max));
+rm_divs_u32x2(const u32x2 v, const u32 s) {
+    return rm_muls_u32x2(v, 1.0f / s);
 }
 RM_INLINE u32x3
-rm_clamps_u32x3(const u32x3 v, u32 min, u32 max) {
-    return rm_clamp_u32x3(v, rm_u32x3s(min), rm_u32x3s(max));
+rm_divs_u32x3(const u32x3 v, const u32 s) {
+    return rm_muls_u32x3(v, 1.0f / s);
 }
 RM_INLINE u32x4
-rm_clamps_u32x4(const u32x4 v, u32 min, u32 max) {
-    return rm_clamp_u32x4(v, rm_u32x4s(min), rm_u32x4s(max));
+rm_divs_u32x4(const u32x4 v, const u32 s) {
+    return rm_muls_u32x4(v, 1.0f / s);
 }
 RM_INLINE u64x2
-rm_clamps_u64x2(const u64x2 v, u64 min, u64 max) {
-    return rm_clamp_u64x2(v, rm_u64x2s(min), rm_u64x2s(max));
+rm_divs_u64x2(const u64x2 v, const u64 s) {
+    return rm_muls_u64x2(v, 1.0f / s);
 }
 RM_INLINE u64x3
-rm_clamps_u64x3(const u64x3 v, u64 min, u64 max) {
-    return rm_clamp_u64x3(v, rm_u64x3s(min), rm_u64x3s(max));
+rm_divs_u64x3(const u64x3 v, const u64 s) {
+    return rm_muls_u64x3(v, 1.0f / s);
 }
 RM_INLINE u64x4
-rm_clamps_u64x4(const u64x4 v, u64 min, u64 max) {
-    return rm_clamp_u64x4(v, rm_u64x4s(min), rm_u64x4s(max));
+rm_divs_u64x4(const u64x4 v, const u64 s) {
+    return rm_muls_u64x4(v, 1.0f / s);
 }
 RM_INLINE i8x2
-rm_clamps_i8x2(const i8x2 v, i8 min, i8 max) {
-    return rm_clamp_i8x2(v, rm_i8x2s(min), rm_i8x2s(max));
+rm_divs_i8x2(const i8x2 v, const i8 s) {
+    return rm_muls_i8x2(v, 1.0f / s);
 }
 RM_INLINE i8x3
-rm_clamps_i8x3(const i8x3 v, i8 min, i8 max) {
-    return rm_clamp_i8x3(v, rm_i8x3s(min), rm_i8x3s(max));
+rm_divs_i8x3(const i8x3 v, const i8 s) {
+    return rm_muls_i8x3(v, 1.0f / s);
 }
 RM_INLINE i8x4
-rm_clamps_i8x4(const i8x4 v, i8 min, i8 max) {
-    return rm_clamp_i8x4(v, rm_i8x4s(min), rm_i8x4s(max));
+rm_divs_i8x4(const i8x4 v, const i8 s) {
+    return rm_muls_i8x4(v, 1.0f / s);
 }
 RM_INLINE i16x2
-rm_clamps_i16x2(const i16x2 v, i16 min, i16 max) {
-    return rm_clamp_i16x2(v, rm_i16x2s(min), rm_i16x2s(max));
+rm_divs_i16x2(const i16x2 v, const i16 s) {
+    return rm_muls_i16x2(v, 1.0f / s);
 }
 RM_INLINE i16x3
-rm_clamps_i16x3(const i16x3 v, i16 min, i16 max) {
-    return rm_clamp_i16x3(v, rm_i16x3s(min), rm_i16x3s(max));
+rm_divs_i16x3(const i16x3 v, const i16 s) {
+    return rm_muls_i16x3(v, 1.0f / s);
 }
 RM_INLINE i16x4
-rm_clamps_i16x4(const i16x4 v, i16 min, i16 max) {
-    return rm_clamp_i16x4(v, rm_i16x4s(min), rm_i16x4s(max));
+rm_divs_i16x4(const i16x4 v, const i16 s) {
+    return rm_muls_i16x4(v, 1.0f / s);
 }
 RM_INLINE i32x2
-rm_clamps_i32x2(const i32x2 v, i32 min, i32 max) {
-    return rm_clamp_i32x2(v, rm_i32x2s(min), rm_i32x2s(max));
+rm_divs_i32x2(const i32x2 v, const i32 s) {
+    return rm_muls_i32x2(v, 1.0f / s);
 }
 RM_INLINE i32x3
-rm_clamps_i32x3(const i32x3 v, i32 min, i32 max) {
-    return rm_clamp_i32x3(v, rm_i32x3s(min), rm_i32x3s(max));
+rm_divs_i32x3(const i32x3 v, const i32 s) {
+    return rm_muls_i32x3(v, 1.0f / s);
 }
 RM_INLINE i32x4
-rm_clamps_i32x4(const i32x4 v, i32 min, i32 max) {
-    return rm_clamp_i32x4(v, rm_i32x4s(min), rm_i32x4s(max));
+rm_divs_i32x4(const i32x4 v, const i32 s) {
+    return rm_muls_i32x4(v, 1.0f / s);
 }
 RM_INLINE i64x2
-rm_clamps_i64x2(const i64x2 v, i64 min, i64 max) {
-    return rm_clamp_i64x2(v, rm_i64x2s(min), rm_i64x2s(max));
+rm_divs_i64x2(const i64x2 v, const i64 s) {
+    return rm_muls_i64x2(v, 1.0f / s);
 }
 RM_INLINE i64x3
-rm_clamps_i64x3(const i64x3 v, i64 min, i64 max) {
-    return rm_clamp_i64x3(v, rm_i64x3s(min), rm_i64x3s(max));
+rm_divs_i64x3(const i64x3 v, const i64 s) {
+    return rm_muls_i64x3(v, 1.0f / s);
 }
 RM_INLINE i64x4
-rm_clamps_i64x4(const i64x4 v, i64 min, i64 max) {
-    return rm_clamp_i64x4(v, rm_i64x4s(min), rm_i64x4s(max));
+rm_divs_i64x4(const i64x4 v, const i64 s) {
+    return rm_muls_i64x4(v, 1.0f / s);
 }
 RM_INLINE f32x2
-rm_clamps_f32x2(const f32x2 v, f32 min, f32 max) {
-    return rm_clamp_f32x2(v, rm_f32x2s(min), rm_f32x2s(max));
+rm_divs_f32x2(const f32x2 v, const f32 s) {
+    return rm_muls_f32x2(v, 1.0f / s);
 }
 RM_INLINE f32x3
-rm_clamps_f32x3(const f32x3 v, f32 min, f32 max) {
-    return rm_clamp_f32x3(v, rm_f32x3s(min), rm_f32x3s(max));
+rm_divs_f32x3(const f32x3 v, const f32 s) {
+    return rm_muls_f32x3(v, 1.0f / s);
 }
 RM_INLINE f32x4
-rm_clamps_f32x4(const f32x4 v, f32 min, f32 max) {
-    return rm_clamp_f32x4(v, rm_f32x4s(min), rm_f32x4s(max));
+rm_divs_f32x4(const f32x4 v, const f32 s) {
+    return rm_muls_f32x4(v, 1.0f / s);
 }
 RM_INLINE f64x2
-rm_clamps_f64x2(const f64x2 v, f64 min, f64 max) {
-    return rm_clamp_f64x2(v, rm_f64x2s(min), rm_f64x2s(max));
+rm_divs_f64x2(const f64x2 v, const f64 s) {
+    return rm_muls_f64x2(v, 1.0f / s);
 }
 RM_INLINE f64x3
-rm_clamps_f64x3(const f64x3 v, f64 min, f64 max) {
-    return rm_clamp_f64x3(v, rm_f64x3s(min), rm_f64x3s(max));
+rm_divs_f64x3(const f64x3 v, const f64 s) {
+    return rm_muls_f64x3(v, 1.0f / s);
 }
 RM_INLINE f64x4
-rm_clamps_f64x4(const f64x4 v, f64 min, f64 max) {
-    return rm_clamp_f64x4(v, rm_f64x4s(min), rm_f64x4s(max));
-}
-RM_INLINE i8x2
-rm_sign_i8x2(const i8x2 v) {
-    return rm_i8x2(rm_sign_i8(v.x), rm_sign_i8(v.y));
+rm_divs_f64x4(const f64x4 v, const f64 s) {
+    return rm_muls_f64x4(v, 1.0f / s);
 }
-RM_INLINE i8x3
-rm_sign_i8x3(const i8x3 v) {
-    return rm_i8x3(rm_sign_i8(v.x), rm_sign_i8(v.y), rm_sign_i8(v.z));
+RM_INLINE u8x2
+rm_sdiv_u8x2(const u8 s, const u8x2 v) {
+    return rm_div_u8x2(rm_u8x2s(s), v);
 }
-RM_INLINE i8x4
-rm_sign_i8x4(const i8x4 v) {
-    return rm_i8x4(rm_sign_i8(v.x), rm_sign_i8(v.y), rm_sign_i8(v.z),
-                   rm_sign_i8(v.w));
+RM_INLINE u8x3
+rm_sdiv_u8x3(const u8 s, const u8x3 v) {
+    return rm_div_u8x3(rm_u8x3s(s), v);
 }
-RM_INLINE i16x2
-rm_sign_i16x2(const i16x2 v) {
-    return rm_i16x2(rm_sign_i16(v.x), rm_sign_i16(v.y));
+RM_INLINE u8x4
+rm_sdiv_u8x4(const u8 s, const u8x4 v) {
+    return rm_div_u8x4(rm_u8x4s(s), v);
 }
-RM_INLINE i16x3
-rm_sign_i16x3(const i16x3 v) {
-    return rm_i16x3(rm_sign_i16(v.x), rm_sign_i16(v.y), rm_sign_i16(v.z));
+RM_INLINE u16x2
+rm_sdiv_u16x2(const u16 s, const u16x2 v) {
+    return rm_div_u16x2(rm_u16x2s(s), v);
 }
-RM_INLINE i16x4
-rm_sign_i16x4(const i16x4 v) {
-    return rm_i16x4(rm_sign_i16(v.x), rm_sign_i16(v.y), rm_sign_i16(v.z),
-                    rm_sign_i16(v.w));
-}
-RM_INLINE i32x2
-rm_sign_i32x2(const i32x2 v) {
-    return rm_i32x2(rm_sign_i32(v.x), rm_sign_i32(v.y));
-}
-RM_INLINE i32x3
-rm_sign_i32x3(const i32x3 v) {
-    return rm_i32x3(rm_sign_i32(v.x), rm_sign_i32(v.y), rm_sign_i32(v.z));
-}
-RM_INLINE i32x4
-rm_sign_i32x4(const i32x4 v) {
-    return rm_i32x4(rm_sign_i32(v.x), rm_sign_i32(v.y), rm_sign_i32(v.z),
-                    rm_sign_i32(v.w));
-}
-RM_INLINE i64x2
-rm_sign_i64x2(const i64x2 v) {
-    return rm_i64x2(rm_sign_i64(v.x), rm_sign_i64(v.y));
-}
-RM_INLINE i64x3
-rm_sign_i64x3(const i64x3 v) {
-    return rm_i64x3(rm_sign_i64(v.x), rm_sign_i64(v.y), rm_sign_i64(v.z));
+RM_INLINE u16x3
+rm_sdiv_u16x3(const u16 s, const u16x3 v) {
+    return rm_div_u16x3(rm_u16x3s(s), v);
 }
-RM_INLINE i64x4
-rm_sign_i64x4(const i64x4 v) {
-    return rm_i64x4(rm_sign_i64(v.x), rm_sign_i64(v.y), rm_sign_i64(v.z),
-                    rm_sign_i64(v.w));
+RM_INLINE u16x4
+rm_sdiv_u16x4(const u16 s, const u16x4 v) {
+    return rm_div_u16x4(rm_u16x4s(s), v);
 }
-RM_INLINE f32x2
-rm_sign_f32x2(const f32x2 v) {
-    return rm_f32x2(rm_sign_f32(v.x), rm_sign_f32(v.y));
+RM_INLINE u32x2
+rm_sdiv_u32x2(const u32 s, const u32x2 v) {
+    return rm_div_u32x2(rm_u32x2s(s), v);
 }
-RM_INLINE f32x3
-rm_sign_f32x3(const f32x3 v) {
-    return rm_f32x3(rm_sign_f32(v.x), rm_sign_f32(v.y), rm_sign_f32(v.z));
+RM_INLINE u32x3
+rm_sdiv_u32x3(const u32 s, const u32x3 v) {
+    return rm_div_u32x3(rm_u32x3s(s), v);
 }
-RM_INLINE f32x4
-rm_sign_f32x4(const f32x4 v) {
-    return rm_f32x4(rm_sign_f32(v.x), rm_sign_f32(v.y), rm_sign_f32(v.z),
-                    rm_sign_f32(v.w));
+RM_INLINE u32x4
+rm_sdiv_u32x4(const u32 s, const u32x4 v) {
+    return rm_div_u32x4(rm_u32x4s(s), v);
 }
-RM_INLINE f64x2
-rm_sign_f64x2(const f64x2 v) {
-    return rm_f64x2(rm_sign_f64(v.x), rm_sign_f64(v.y));
+RM_INLINE u64x2
+rm_sdiv_u64x2(const u64 s, const u64x2 v) {
+    return rm_div_u64x2(rm_u64x2s(s), v);
 }
-RM_INLINE f64x3
-rm_sign_f64x3(const f64x3 v) {
-    return rm_f64x3(rm_sign_f64(v.x), rm_sign_f64(v.y), rm_sign_f64(v.z));
+RM_INLINE u64x3
+rm_sdiv_u64x3(const u64 s, const u64x3 v) {
+    return rm_div_u64x3(rm_u64x3s(s), v);
 }
-RM_INLINE f64x4
-rm_sign_f64x4(const f64x4 v) {
-    return rm_f64x4(rm_sign_f64(v.x), rm_sign_f64(v.y), rm_sign_f64(v.z),
-                    rm_sign_f64(v.w));
+RM_INLINE u64x4
+rm_sdiv_u64x4(const u64 s, const u64x4 v) {
+    return rm_div_u64x4(rm_u64x4s(s), v);
 }
 RM_INLINE i8x2
-rm_copysign_i8x2(const i8x2 v, const i8x2 s) {
-    return rm_i8x2(rm_copysign_i8(v.x, s.x), rm_copysign_i8(v.y, s.y));
+rm_sdiv_i8x2(const i8 s, const i8x2 v) {
+    return rm_div_i8x2(rm_i8x2s(s), v);
 }
 RM_INLINE i8x3
-rm_copysign_i8x3(const i8x3 v, const i8x3 s) {
-    return rm_i8x3(rm_copysign_i8(v.x, s.x), rm_copysign_i8(v.y, s.y),
-                   rm_copysign_i8(v.z, s.z));
+rm_sdiv_i8x3(const i8 s, const i8x3 v) {
+    return rm_div_i8x3(rm_i8x3s(s), v);
 }
 RM_INLINE i8x4
-rm_copysign_i8x4(const i8x4 v, const i8x4 s) {
-    return rm_i8x4(rm_copysign_i8(v.x, s.x), rm_copysign_i8(v.y, s.y),
-                   rm_copysign_i8(v.z, s.z), rm_copysign_i8(v.w, s.w));
+rm_sdiv_i8x4(const i8 s, const i8x4 v) {
+    return rm_div_i8x4(rm_i8x4s(s), v);
 }
 RM_INLINE i16x2
-rm_copysign_i16x2(const i16x2 v, const i16x2 s) {
-    return rm_i16x2(rm_copysign_i16(v.x, s.x), rm_copysign_i16(v.y, s.y));
+rm_sdiv_i16x2(const i16 s, const i16x2 v) {
+    return rm_div_i16x2(rm_i16x2s(s), v);
 }
 RM_INLINE i16x3
-rm_copysign_i16x3(const i16x3 v, const i16x3 s) {
-    return rm_i16x3(rm_copysign_i16(v.x, s.x), rm_copysign_i16(v.y, s.y),
-                    rm_copysign_i16(v.z, s.z));
+rm_sdiv_i16x3(const i16 s, const i16x3 v) {
+    return rm_div_i16x3(rm_i16x3s(s), v);
 }
 RM_INLINE i16x4
-rm_copysign_i16x4(const i16x4 v, const i16x4 s) {
-    return rm_i16x4(rm_copysign_i16(v.x, s.x), rm_copysign_i16(v.y, s.y),
-                    rm_copysign_i16(v.z, s.z), rm_copysign_i16(v.w, s.w));
+rm_sdiv_i16x4(const i16 s, const i16x4 v) {
+    return rm_div_i16x4(rm_i16x4s(s), v);
 }
 RM_INLINE i32x2
-rm_copysign_i32x2(const i32x2 v, const i32x2 s) {
-    return rm_i32x2(rm_copysign_i32(v.x, s.x), rm_copysign_i32(v.y, s.y));
+rm_sdiv_i32x2(const i32 s, const i32x2 v) {
+    return rm_div_i32x2(rm_i32x2s(s), v);
 }
 RM_INLINE i32x3
-rm_copysign_i32x3(const i32x3 v, const i32x3 s) {
-    return rm_i32x3(rm_copysign_i32(v.x, s.x), rm_copysign_i32(v.y, s.y),
-                    rm_copysign_i32(v.z, s.z));
+rm_sdiv_i32x3(const i32 s, const i32x3 v) {
+    return rm_div_i32x3(rm_i32x3s(s), v);
 }
 RM_INLINE i32x4
-rm_copysign_i32x4(const i32x4 v, const i32x4 s) {
-    return rm_i32x4(rm_copysign_i32(v.x, s.x), rm_copysign_i32(v.y, s.y),
-                    rm_copysign_i32(v.z, s.z), rm_copysign_i32(v.w, s.w));
+rm_sdiv_i32x4(const i32 s, const i32x4 v) {
+    return rm_div_i32x4(rm_i32x4s(s), v);
 }
 RM_INLINE i64x2
-rm_copysign_i64x2(const i64x2 v, const i64x2 s) {
-    return rm_i64x2(rm_copysign_i64(v.x, s.x), rm_copysign_i64(v.y, s.y));
+rm_sdiv_i64x2(const i64 s, const i64x2 v) {
+    return rm_div_i64x2(rm_i64x2s(s), v);
 }
 RM_INLINE i64x3
-rm_copysign_i64x3(const i64x3 v, const i64x3 s) {
-    return rm_i64x3(rm_copysign_i64(v.x, s.x), rm_copysign_i64(v.y, s.y),
-                    rm_copysign_i64(v.z, s.z));
+rm_sdiv_i64x3(const i64 s, const i64x3 v) {
+    return rm_div_i64x3(rm_i64x3s(s), v);
 }
 RM_INLINE i64x4
-rm_copysign_i64x4(const i64x4 v, const i64x4 s) {
-    return rm_i64x4(rm_copysign_i64(v.x, s.x), rm_copysign_i64(v.y, s.y),
-                    rm_copysign_i64(v.z, s.z), rm_copysign_i64(v.w, s.w));
+rm_sdiv_i64x4(const i64 s, const i64x4 v) {
+    return rm_div_i64x4(rm_i64x4s(s), v);
 }
 RM_INLINE f32x2
-rm_copysign_f32x2(const f32x2 v, const f32x2 s) {
-    return rm_f32x2(rm_copysign_f32(v.x, s.x), rm_copysign_f32(v.y, s.y));
+rm_sdiv_f32x2(const f32 s, const f32x2 v) {
+    return rm_div_f32x2(rm_f32x2s(s), v);
 }
 RM_INLINE f32x3
-rm_copysign_f32x3(const f32x3 v, const f32x3 s) {
-    return rm_f32x3(rm_copysign_f32(v.x, s.x), rm_copysign_f32(v.y, s.y),
-                    rm_copysign_f32(v.z, s.z));
+rm_sdiv_f32x3(const f32 s, const f32x3 v) {
+    return rm_div_f32x3(rm_f32x3s(s), v);
 }
 RM_INLINE f32x4
-rm_copysign_f32x4(const f32x4 v, const f32x4 s) {
-    return rm_f32x4(rm_copysign_f32(v.x, s.x), rm_copysign_f32(v.y, s.y),
-                    rm_copysign_f32(v.z, s.z), rm_copysign_f32(v.w, s.w));
+rm_sdiv_f32x4(const f32 s, const f32x4 v) {
+    return rm_div_f32x4(rm_f32x4s(s), v);
 }
 RM_INLINE f64x2
-rm_copysign_f64x2(const f64x2 v, const f64x2 s) {
-    return rm_f64x2(rm_copysign_f64(v.x, s.x), rm_copysign_f64(v.y, s.y));
+rm_sdiv_f64x2(const f64 s, const f64x2 v) {
+    return rm_div_f64x2(rm_f64x2s(s), v);
 }
 RM_INLINE f64x3
-rm_copysign_f64x3(const f64x3 v, const f64x3 s) {
-    return rm_f64x3(rm_copysign_f64(v.x, s.x), rm_copysign_f64(v.y, s.y),
-                    rm_copysign_f64(v.z, s.z));
+rm_sdiv_f64x3(const f64 s, const f64x3 v) {
+    return rm_div_f64x3(rm_f64x3s(s), v);
 }
 RM_INLINE f64x4
-rm_copysign_f64x4(const f64x4 v, const f64x4 s) {
-    return rm_f64x4(rm_copysign_f64(v.x, s.x), rm_copysign_f64(v.y, s.y),
-                    rm_copysign_f64(v.z, s.z), rm_copysign_f64(v.w, s.w));
+rm_sdiv_f64x4(const f64 s, const f64x4 v) {
+    return rm_div_f64x4(rm_f64x4s(s), v);
+}
+RM_INLINE u8x2
+rm_mod_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_u8x2(rm_mod_u8(a.x, b.x), rm_mod_u8(a.y, b.y));
+}
+RM_INLINE u8x3
+rm_mod_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_u8x3(rm_mod_u8(a.x, b.x), rm_mod_u8(a.y, b.y),
+                   rm_mod_u8(a.z, b.z));
+}
+RM_INLINE u8x4
+rm_mod_u8x4(const u8x4 a, const u8x4 b) {
+    return rm_u8x4(rm_mod_u8(a.x, b.x), rm_mod_u8(a.y, b.y),
+                   rm_mod_u8(a.z, b.z), rm_mod_u8(a.w, b.w));
+}
+RM_INLINE u16x2
+rm_mod_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_u16x2(rm_mod_u16(a.x, b.x), rm_mod_u16(a.y, b.y));
+}
+RM_INLINE u16x3
+rm_mod_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_u16x3(rm_mod_u16(a.x, b.x), rm_mod_u16(a.y, b.y),
+                    rm_mod_u16(a.z, b.z));
+}
+RM_INLINE u16x4
+rm_mod_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_u16x4(rm_mod_u16(a.x, b.x), rm_mod_u16(a.y, b.y),
+                    rm_mod_u16(a.z, b.z), rm_mod_u16(a.w, b.w));
+}
+RM_INLINE u32x2
+rm_mod_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_u32x2(rm_mod_u32(a.x, b.x), rm_mod_u32(a.y, b.y));
+}
+RM_INLINE u32x3
+rm_mod_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_u32x3(rm_mod_u32(a.x, b.x), rm_mod_u32(a.y, b.y),
+                    rm_mod_u32(a.z, b.z));
+}
+RM_INLINE u32x4
+rm_mod_u32x4(const u32x4 a, const u32x4 b) {
+    return rm_u32x4(rm_mod_u32(a.x, b.x), rm_mod_u32(a.y, b.y),
+                    rm_mod_u32(a.z, b.z), rm_mod_u32(a.w, b.w));
+}
+RM_INLINE u64x2
+rm_mod_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_u64x2(rm_mod_u64(a.x, b.x), rm_mod_u64(a.y, b.y));
+}
+RM_INLINE u64x3
+rm_mod_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_u64x3(rm_mod_u64(a.x, b.x), rm_mod_u64(a.y, b.y),
+                    rm_mod_u64(a.z, b.z));
+}
+RM_INLINE u64x4
+rm_mod_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_u64x4(rm_mod_u64(a.x, b.x), rm_mod_u64(a.y, b.y),
+                    rm_mod_u64(a.z, b.z), rm_mod_u64(a.w, b.w));
 }
 RM_INLINE i8x2
-rm_copysigns_i8x2(const i8x2 v, const i8 s) {
-    return rm_copysign_i8x2(v, rm_i8x2s(s));
+rm_mod_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_i8x2(rm_mod_i8(a.x, b.x), rm_mod_i8(a.y, b.y));
 }
 RM_INLINE i8x3
-rm_copysigns_i8x3(const i8x3 v, const i8 s) {
-    return rm_copysign_i8x3(v, rm_i8x3s(s));
+rm_mod_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_i8x3(rm_mod_i8(a.x, b.x), rm_mod_i8(a.y, b.y),
+                   rm_mod_i8(a.z, b.z));
 }
 RM_INLINE i8x4
-rm_copysigns_i8x4(const i8x4 v, const i8 s) {
-    return rm_copysign_i8x4(v, rm_i8x4s(s));
+rm_mod_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_i8x4(rm_mod_i8(a.x, b.x), rm_mod_i8(a.y, b.y),
+                   rm_mod_i8(a.z, b.z), rm_mod_i8(a.w, b.w));
 }
 RM_INLINE i16x2
-rm_copysigns_i16x2(const i16x2 v, const i16 s) {
-    return rm_copysign_i16x2(v, rm_i16x2s(s));
+rm_mod_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_i16x2(rm_mod_i16(a.x, b.x), rm_mod_i16(a.y, b.y));
 }
 RM_INLINE i16x3
-rm_copysigns_i16x3(const i16x3 v, const i16 s) {
-    return rm_copysign_i16x3(v, rm_i16x3s(s));
+rm_mod_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_i16x3(rm_mod_i16(a.x, b.x), rm_mod_i16(a.y, b.y),
+                    rm_mod_i16(a.z, b.z));
 }
 RM_INLINE i16x4
-rm_copysigns_i16x4(const i16x4 v, const i16 s) {
-    return rm_copysign_i16x4(v, rm_i16x4s(s));
+rm_mod_i16x4(const i16x4 a, const i16x4 b) {
+    return rm_i16x4(rm_mod_i16(a.x, b.x), rm_mod_i16(a.y, b.y),
+                    rm_mod_i16(a.z, b.z), rm_mod_i16(a.w, b.w));
 }
 RM_INLINE i32x2
-rm_copysigns_i32x2(const i32x2 v, const i32 s) {
-    return rm_copysign_i32x2(v, rm_i32x2s(s));
+rm_mod_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_i32x2(rm_mod_i32(a.x, b.x), rm_mod_i32(a.y, b.y));
 }
 RM_INLINE i32x3
-rm_copysigns_i32x3(const i32x3 v, const i32 s) {
-    return rm_copysign_i32x3(v, rm_i32x3s(s));
+rm_mod_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_i32x3(rm_mod_i32(a.x, b.x), rm_mod_i32(a.y, b.y),
+                    rm_mod_i32(a.z, b.z));
 }
 RM_INLINE i32x4
-rm_copysigns_i32x4(const i32x4 v, const i32 s) {
-    return rm_copysign_i32x4(v, rm_i32x4s(s));
+rm_mod_i32x4(const i32x4 a, const i32x4 b) {
+    return rm_i32x4(rm_mod_i32(a.x, b.x), rm_mod_i32(a.y, b.y),
+                    rm_mod_i32(a.z, b.z), rm_mod_i32(a.w, b.w));
 }
 RM_INLINE i64x2
-rm_copysigns_i64x2(const i64x2 v, const i64 s) {
-    return rm_copysign_i64x2(v, rm_i64x2s(s));
+rm_mod_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_i64x2(rm_mod_i64(a.x, b.x), rm_mod_i64(a.y, b.y));
 }
 RM_INLINE i64x3
-rm_copysigns_i64x3(const i64x3 v, const i64 s) {
-    return rm_copysign_i64x3(v, rm_i64x3s(s));
+rm_mod_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_i64x3(rm_mod_i64(a.x, b.x), rm_mod_i64(a.y, b.y),
+                    rm_mod_i64(a.z, b.z));
 }
 RM_INLINE i64x4
-rm_copysigns_i64x4(const i64x4 v, const i64 s) {
-    return rm_copysign_i64x4(v, rm_i64x4s(s));
+rm_mod_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_i64x4(rm_mod_i64(a.x, b.x), rm_mod_i64(a.y, b.y),
+                    rm_mod_i64(a.z, b.z), rm_mod_i64(a.w, b.w));
 }
 RM_INLINE f32x2
-rm_copysigns_f32x2(const f32x2 v, const f32 s) {
-    return rm_copysign_f32x2(v, rm_f32x2s(s));
+rm_mod_f32x2(const f32x2 a, const f32x2 b) {
+    return rm_f32x2(rm_mod_f32(a.x, b.x), rm_mod_f32(a.y, b.y));
 }
 RM_INLINE f32x3
-rm_copysigns_f32x3(const f32x3 v, const f32 s) {
-    return rm_copysign_f32x3(v, rm_f32x3s(s));
+rm_mod_f32x3(const f32x3 a, const f32x3 b) {
+    return rm_f32x3(rm_mod_f32(a.x, b.x), rm_mod_f32(a.y, b.y),
+                    rm_mod_f32(a.z, b.z));
 }
 RM_INLINE f32x4
-rm_copysigns_f32x4(const f32x4 v, const f32 s) {
-    return rm_copysign_f32x4(v, rm_f32x4s(s));
+rm_mod_f32x4(const f32x4 a, const f32x4 b) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmv_f32x4 xa, xb;
+
+    xa = rmm_load(a.raw);
+    xb = rmm_load(b.raw);
+
+    rmm_store(dest.raw,
+              rmm_sub(xa, rmm_mul(rmm_trunc(rmm_div(xa, xb)), xb)));
+#else
+    dest = rm_f32x4(rm_mod_f32(a.x, b.x), rm_mod_f32(a.y, b.y),
+                    rm_mod_f32(a.z, b.z), rm_mod_f32(a.w, b.w));
+#endif
+    return dest;
 }
 RM_INLINE f64x2
-rm_copysigns_f64x2(const f64x2 v, const f64 s) {
-    return rm_copysign_f64x2(v, rm_f64x2s(s));
+rm_mod_f64x2(const f64x2 a, const f64x2 b) {
+    f64x2 dest;
+#if defined(RM_SSE4_1)
+    __m128d xa, xb, xdiv;
+
+    xa   = rmmd_load(a.raw);
+    xb   = rmmd_load(b.raw);
+    xdiv = _mm_round_pd(_mm_div_pd(xa, xb),
+                        _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+
+    rmmd_store(dest.raw, _mm_sub_pd(xa, _mm_mul_pd(xdiv, xb)));
+#else
+    dest = rm_f64x2(rm_mod_f64(a.x, b.x), rm_mod_f64(a.y, b.y));
+#endif
+    return dest;
 }
 RM_INLINE f64x3
-rm_copysigns_f64x3(const f64x3 v, const f64 s) {
-    return rm_copysign_f64x3(v, rm_f64x3s(s));
+rm_mod_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_f64x3(rm_mod_f64(a.x, b.x), rm_mod_f64(a.y, b.y),
+                    rm_mod_f64(a.z, b.z));
 }
 RM_INLINE f64x4
-rm_copysigns_f64x4(const f64x4 v, const f64 s) {
-    return rm_copysign_f64x4(v, rm_f64x4s(s));
+rm_mod_f64x4(const f64x4 a, const f64x4 b) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    __m256d xa, xb, xdiv;
+
+    xa   = rmm256d_load(a.raw);
+    xb   = rmm256d_load(b.raw);
+    xdiv = _mm256_round_pd(_mm256_div_pd(xa, xb),
+                           _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+
+    rmm256d_store(dest.raw, _mm256_sub_pd(xa, _mm256_mul_pd(xdiv, xb)));
+#else
+    dest = rm_f64x4(rm_mod_f64(a.x, b.x), rm_mod_f64(a.y, b.y),
+                    rm_mod_f64(a.z, b.z), rm_mod_f64(a.w, b.w));
+#endif
+    return dest;
 }
 RM_INLINE u8x2
-rm_fma_u8x2(const u8x2 a, const u8x2 b, const u8x2 c) {
-    return rm_add_u8x2(rm_mul_u8x2(a, b), c);
+rm_mods_u8x2(const u8x2 v, const u8 s) {
+    return rm_mod_u8x2(v, rm_u8x2s(s));
 }
 RM_INLINE u8x3
-rm_fma_u8x3(const u8x3 a, const u8x3 b, const u8x3 c) {
-    return rm_add_u8x3(rm_mul_u8x3(a, b), c);
+rm_mods_u8x3(const u8x3 v, const u8 s) {
+    return rm_mod_u8x3(v, rm_u8x3s(s));
 }
 RM_INLINE u8x4
-rm_fma_u8x4(const u8x4 a, const u8x4 b, const u8x4 c) {
-    return rm_add_u8x4(rm_mul_u8x4(a, b), c);
+rm_mods_u8x4(const u8x4 v, const u8 s) {
+    return rm_mod_u8x4(v, rm_u8x4s(s));
 }
 RM_INLINE u16x2
-rm_fma_u16x2(const u16x2 a, const u16x2 b, const u16x2 c) {
-    return rm_add_u16x2(rm_mul_u16x2(a, b), c);
+rm_mods_u16x2(const u16x2 v, const u16 s) {
+    return rm_mod_u16x2(v, rm_u16x2s(s));
 }
 RM_INLINE u16x3
-rm_fma_u16x3(const u16x3 a, const u16x3 b, const u16x3 c) {
-    return rm_add_u16x3(rm_mul_u16x3(a, b), c);
+rm_mods_u16x3(const u16x3 v, const u16 s) {
+    return rm_mod_u16x3(v, rm_u16x3s(s));
 }
 RM_INLINE u16x4
-rm_fma_u16x4(const u16x4 a, const u16x4 b, const u16x4 c) {
-    return rm_add_u16x4(rm_mul_u16x4(a, b), c);
+rm_mods_u16x4(const u16x4 v, const u16 s) {
+    return rm_mod_u16x4(v, rm_u16x4s(s));
 }
 RM_INLINE u32x2
-rm_fma_u32x2(const u32x2 a, const u32x2 b, const u32x2 c) {
-    return rm_add_u32x2(rm_mul_u32x2(a, b), c);
+rm_mods_u32x2(const u32x2 v, const u32 s) {
+    return rm_mod_u32x2(v, rm_u32x2s(s));
 }
 RM_INLINE u32x3
-rm_fma_u32x3(const u32x3 a, const u32x3 b, const u32x3 c) {
-    return rm_add_u32x3(rm_mul_u32x3(a, b), c);
+rm_mods_u32x3(const u32x3 v, const u32 s) {
+    return rm_mod_u32x3(v, rm_u32x3s(s));
 }
 RM_INLINE u32x4
-rm_fma_u32x4(const u32x4 a, const u32x4 b, const u32x4 c) {
-    return rm_add_u32x4(rm_mul_u32x4(a, b), c);
+rm_mods_u32x4(const u32x4 v, const u32 s) {
+    return rm_mod_u32x4(v, rm_u32x4s(s));
 }
 RM_INLINE u64x2
-rm_fma_u64x2(const u64x2 a, const u64x2 b, const u64x2 c) {
-    return rm_add_u64x2(rm_mul_u64x2(a, b), c);
+rm_mods_u64x2(const u64x2 v, const u64 s) {
+    return rm_mod_u64x2(v, rm_u64x2s(s));
 }
 RM_INLINE u64x3
-rm_fma_u64x3(const u64x3 a, const u64x3 b, const u64x3 c) {
-    return rm_add_u64x3(rm_mul_u64x3(a, b), c);
+rm_mods_u64x3(const u64x3 v, const u64 s) {
+    return rm_mod_u64x3(v, rm_u64x3s(s));
 }
 RM_INLINE u64x4
-rm_fma_u64x4(const u64x4 a, const u64x4 b, const u64x4 c) {
-    return rm_add_u64x4(rm_mul_u64x4(a, b), c);
+rm_mods_u64x4(const u64x4 v, const u64 s) {
+    return rm_mod_u64x4(v, rm_u64x4s(s));
 }
 RM_INLINE i8x2
-rm_fma_i8x2(const i8x2 a, const i8x2 b, const i8x2 c) {
-    return rm_add_i8x2(rm_mul_i8x2(a, b), c);
+rm_mods_i8x2(const i8x2 v, const i8 s) {
+    return rm_mod_i8x2(v, rm_i8x2s(s));
 }
 RM_INLINE i8x3
-rm_fma_i8x3(const i8x3 a, const i8x3 b, const i8x3 c) {
-    return rm_add_i8x3(rm_mul_i8x3(a, b), c);
+rm_mods_i8x3(const i8x3 v, const i8 s) {
+    return rm_mod_i8x3(v, rm_i8x3s(s));
 }
 RM_INLINE i8x4
-rm_fma_i8x4(const i8x4 a, const i8x4 b, const i8x4 c) {
-    return rm_add_i8x4(rm_mul_i8x4(a, b), c);
+rm_mods_i8x4(const i8x4 v, const i8 s) {
+    return rm_mod_i8x4(v, rm_i8x4s(s));
 }
 RM_INLINE i16x2
-rm_fma_i16x2(const i16x2 a, const i16x2 b, const i16x2 c) {
-    return rm_add_i16x2(rm_mul_i16x2(a, b), c);
+rm_mods_i16x2(const i16x2 v, const i16 s) {
+    return rm_mod_i16x2(v, rm_i16x2s(s));
 }
 RM_INLINE i16x3
-rm_fma_i16x3(const i16x3 a, const i16x3 b, const i16x3 c) {
-    return rm_add_i16x3(rm_mul_i16x3(a, b), c);
+rm_mods_i16x3(const i16x3 v, const i16 s) {
+    return rm_mod_i16x3(v, rm_i16x3s(s));
 }
 RM_INLINE i16x4
-rm_fma_i16x4(const i16x4 a, const i16x4 b, const i16x4 c) {
-    return rm_add_i16x4(rm_mul_i16x4(a, b), c);
+rm_mods_i16x4(const i16x4 v, const i16 s) {
+    return rm_mod_i16x4(v, rm_i16x4s(s));
 }
 RM_INLINE i32x2
-rm_fma_i32x2(const i32x2 a, const i32x2 b, const i32x2 c) {
-    return rm_add_i32x2(rm_mul_i32x2(a, b), c);
+rm_mods_i32x2(const i32x2 v, const i32 s) {
+    return rm_mod_i32x2(v, rm_i32x2s(s));
 }
 RM_INLINE i32x3
-rm_fma_i32x3(const i32x3 a, const i32x3 b, const i32x3 c) {
-    return rm_add_i32x3(rm_mul_i32x3(a, b), c);
+rm_mods_i32x3(const i32x3 v, const i32 s) {
+    return rm_mod_i32x3(v, rm_i32x3s(s));
 }
 RM_INLINE i32x4
-rm_fma_i32x4(const i32x4 a, const i32x4 b, const i32x4 c) {
-    return rm_add_i32x4(rm_mul_i32x4(a, b), c);
+rm_mods_i32x4(const i32x4 v, const i32 s) {
+    return rm_mod_i32x4(v, rm_i32x4s(s));
 }
 RM_INLINE i64x2
-rm_fma_i64x2(const i64x2 a, const i64x2 b, const i64x2 c) {
-    return rm_add_i64x2(rm_mul_i64x2(a, b), c);
+rm_mods_i64x2(const i64x2 v, const i64 s) {
+    return rm_mod_i64x2(v, rm_i64x2s(s));
 }
 RM_INLINE i64x3
-rm_fma_i64x3(const i64x3 a, const i64x3 b, const i64x3 c) {
-    return rm_add_i64x3(rm_mul_i64x3(a, b), c);
+rm_mods_i64x3(const i64x3 v, const i64 s) {
+    return rm_mod_i64x3(v, rm_i64x3s(s));
 }
 RM_INLINE i64x4
-rm_fma_i64x4(const i64x4 a, const i64x4 b, const i64x4 c) {
-    return rm_add_i64x4(rm_mul_i64x4(a, b), c);
+rm_mods_i64x4(const i64x4 v, const i64 s) {
+    return rm_mod_i64x4(v, rm_i64x4s(s));
 }
 RM_INLINE f32x2
-rm_fma_f32x2(const f32x2 a, const f32x2 b, const f32x2 c) {
-    return rm_add_f32x2(rm_mul_f32x2(a, b), c);
+rm_mods_f32x2(const f32x2 v, const f32 s) {
+    return rm_mod_f32x2(v, rm_f32x2s(s));
 }
 RM_INLINE f32x3
-rm_fma_f32x3(const f32x3 a, const f32x3 b, const f32x3 c) {
-    return rm_add_f32x3(rm_mul_f32x3(a, b), c);
+rm_mods_f32x3(const f32x3 v, const f32 s) {
+    return rm_mod_f32x3(v, rm_f32x3s(s));
 }
 RM_INLINE f32x4
-rm_fma_f32x4(const f32x4 a, const f32x4 b, const f32x4 c) {
-    f32x4 dest;
-#if defined(RM_SSE)
-    rmm_store(dest.raw, rmm_fmadd(rmm_load(a.raw), rmm_load(b.raw),
-                                     rmm_load(c.raw)));
-#else
-    dest = rm_add_f32x4(rm_mul_f32x4(a, b), c);
-#endif
-    return dest;
+rm_mods_f32x4(const f32x4 v, const f32 s) {
+    return rm_mod_f32x4(v, rm_f32x4s(s));
 }
 RM_INLINE f64x2
-rm_fma_f64x2(const f64x2 a, const f64x2 b, const f64x2 c) {
-    return rm_add_f64x2(rm_mul_f64x2(a, b), c);
+rm_mods_f64x2(const f64x2 v, const f64 s) {
+    return rm_mod_f64x2(v, rm_f64x2s(s));
 }
 RM_INLINE f64x3
-rm_fma_f64x3(const f64x3 a, const f64x3 b, const f64x3 c) {
-    return rm_add_f64x3(rm_mul_f64x3(a, b), c);
+rm_mods_f64x3(const f64x3 v, const f64 s) {
+    return rm_mod_f64x3(v, rm_f64x3s(s));
 }
 RM_INLINE f64x4
-rm_fma_f64x4(const f64x4 a, const f64x4 b, const f64x4 c) {
-    return rm_add_f64x4(rm_mul_f64x4(a, b), c);
+rm_mods_f64x4(const f64x4 v, const f64 s) {
+    return rm_mod_f64x4(v, rm_f64x4s(s));
 }
 RM_INLINE u8x2
-rm_fmas_u8x2(const u8x2 a, const u8x2 b, const u8 c) {
-    return rm_adds_u8x2(rm_mul_u8x2(a, b), c);
+rm_smod_u8x2(const u8 s, const u8x2 v) {
+    return rm_mod_u8x2(rm_u8x2s(s), v);
 }
 RM_INLINE u8x3
-rm_fmas_u8x3(const u8x3 a, const u8x3 b, const u8 c) {
-    return rm_adds_u8x3(rm_mul_u8x3(a, b), c);
+rm_smod_u8x3(const u8 s, const u8x3 v) {
+    return rm_mod_u8x3(rm_u8x3s(s), v);
 }
 RM_INLINE u8x4
-rm_fmas_u8x4(const u8x4 a, const u8x4 b, const u8 c) {
-    return rm_adds_u8x4(rm_mul_u8x4(a, b), c);
+rm_smod_u8x4(const u8 s, const u8x4 v) {
+    return rm_mod_u8x4(rm_u8x4s(s), v);
 }
 RM_INLINE u16x2
-rm_fmas_u16x2(const u16x2 a, const u16x2 b, const u16 c) {
-    return rm_adds_u16x2(rm_mul_u16x2(a, b), c);
+rm_smod_u16x2(const u16 s, const u16x2 v) {
+    return rm_mod_u16x2(rm_u16x2s(s), v);
 }
 RM_INLINE u16x3
-rm_fmas_u16x3(const u16x3 a, const u16x3 b, const u16 c) {
-    return rm_adds_u16x3(rm_mul_u16x3(a, b), c);
+rm_smod_u16x3(const u16 s, const u16x3 v) {
+    return rm_mod_u16x3(rm_u16x3s(s), v);
 }
 RM_INLINE u16x4
-rm_fmas_u16x4(const u16x4 a, const u16x4 b, const u16 c) {
-    return rm_adds_u16x4(rm_mul_u16x4(a, b), c);
+rm_smod_u16x4(const u16 s, const u16x4 v) {
+    return rm_mod_u16x4(rm_u16x4s(s), v);
 }
 RM_INLINE u32x2
-rm_fmas_u32x2(const u32x2 a, const u32x2 b, const u32 c) {
-    return rm_adds_u32x2(rm_mul_u32x2(a, b), c);
+rm_smod_u32x2(const u32 s, const u32x2 v) {
+    return rm_mod_u32x2(rm_u32x2s(s), v);
 }
 RM_INLINE u32x3
-rm_fmas_u32x3(const u32x3 a, const u32x3 b, const u32 c) {
-    return rm_adds_u32x3(rm_mul_u32x3(a, b), c);
+rm_smod_u32x3(const u32 s, const u32x3 v) {
+    return rm_mod_u32x3(rm_u32x3s(s), v);
 }
 RM_INLINE u32x4
-rm_fmas_u32x4(const u32x4 a, const u32x4 b, const u32 c) {
-    return rm_adds_u32x4(rm_mul_u32x4(a, b), c);
+rm_smod_u32x4(const u32 s, const u32x4 v) {
+    return rm_mod_u32x4(rm_u32x4s(s), v);
 }
 RM_INLINE u64x2
-rm_fmas_u64x2(const u64x2 a, const u64x2 b, const u64 c) {
-    return rm_adds_u64x2(rm_mul_u64x2(a, b), c);
+rm_smod_u64x2(const u64 s, const u64x2 v) {
+    return rm_mod_u64x2(rm_u64x2s(s), v);
 }
 RM_INLINE u64x3
-rm_fmas_u64x3(const u64x3 a, const u64x3 b, const u64 c) {
-    return rm_adds_u64x3(rm_mul_u64x3(a, b), c);
+rm_smod_u64x3(const u64 s, const u64x3 v) {
+    return rm_mod_u64x3(rm_u64x3s(s), v);
 }
 RM_INLINE u64x4
-rm_fmas_u64x4(const u64x4 a, const u64x4 b, const u64 c) {
-    return rm_adds_u64x4(rm_mul_u64x4(a, b), c);
+rm_smod_u64x4(const u64 s, const u64x4 v) {
+    return rm_mod_u64x4(rm_u64x4s(s), v);
 }
 RM_INLINE i8x2
-rm_fmas_i8x2(const i8x2 a, const i8x2 b, const i8 c) {
-    return rm_adds_i8x2(rm_mul_i8x2(a, b), c);
+rm_smod_i8x2(const i8 s, const i8x2 v) {
+    return rm_mod_i8x2(rm_i8x2s(s), v);
 }
 RM_INLINE i8x3
-rm_fmas_i8x3(const i8x3 a, const i8x3 b, const i8 c) {
-    return rm_adds_i8x3(rm_mul_i8x3(a, b), c);
+rm_smod_i8x3(const i8 s, const i8x3 v) {
+    return rm_mod_i8x3(rm_i8x3s(s), v);
 }
 RM_INLINE i8x4
-rm_fmas_i8x4(const i8x4 a, const i8x4 b, const i8 c) {
-    return rm_adds_i8x4(rm_mul_i8x4(a, b), c);
+rm_smod_i8x4(const i8 s, const i8x4 v) {
+    return rm_mod_i8x4(rm_i8x4s(s), v);
 }
 RM_INLINE i16x2
-rm_fmas_i16x2(const i16x2 a, const i16x2 b, const i16 c) {
-    return rm_adds_i16x2(rm_mul_i16x2(a, b), c);
+rm_smod_i16x2(const i16 s, const i16x2 v) {
+    return rm_mod_i16x2(rm_i16x2s(s), v);
 }
 RM_INLINE i16x3
-rm_fmas_i16x3(const i16x3 a, const i16x3 b, const i16 c) {
-    return rm_adds_i16x3(rm_mul_i16x3(a, b), c);
+rm_smod_i16x3(const i16 s, const i16x3 v) {
+    return rm_mod_i16x3(rm_i16x3s(s), v);
 }
 RM_INLINE i16x4
-rm_fmas_i16x4(const i16x4 a, const i16x4 b, const i16 c) {
-    return rm_adds_i16x4(rm_mul_i16x4(a, b), c);
+rm_smod_i16x4(const i16 s, const i16x4 v) {
+    return rm_mod_i16x4(rm_i16x4s(s), v);
 }
 RM_INLINE i32x2
-rm_fmas_i32x2(const i32x2 a, const i32x2 b, const i32 c) {
-    return rm_adds_i32x2(rm_mul_i32x2(a, b), c);
-}
+rm_smod_i32x2(const i32 s, const i32x2 v) {
+    return rm_mod_i32x2(rm_i32x2s(s), v);
+}
 RM_INLINE i32x3
-rm_fmas_i32x3(const i32x3 a, const i32x3 b, const i32 c) {
-    return rm_adds_i32x3(rm_mul_i32x3(a, b), c);
+rm_smod_i32x3(const i32 s, const i32x3 v) {
+    return rm_mod_i32x3(rm_i32x3s(s), v);
 }
 RM_INLINE i32x4
-rm_fmas_i32x4(const i32x4 a, const i32x4 b, const i32 c) {
-    return rm_adds_i32x4(rm_mul_i32x4(a, b), c);
+rm_smod_i32x4(const i32 s, const i32x4 v) {
+    return rm_mod_i32x4(rm_i32x4s(s), v);
 }
 RM_INLINE i64x2
-rm_fmas_i64x2(const i64x2 a, const i64x2 b, const i64 c) {
-    return rm_adds_i64x2(rm_mul_i64x2(a, b), c);
+rm_smod_i64x2(const i64 s, const i64x2 v) {
+    return rm_mod_i64x2(rm_i64x2s(s), v);
 }
 RM_INLINE i64x3
-rm_fmas_i64x3(const i64x3 a, const i64x3 b, const i64 c) {
-    return rm_adds_i64x3(rm_mul_i64x3(a, b), c);
+rm_smod_i64x3(const i64 s, const i64x3 v) {
+    return rm_mod_i64x3(rm_i64x3s(s), v);
 }
 RM_INLINE i64x4
-rm_fmas_i64x4(const i64x4 a, const i64x4 b, const i64 c) {
-    return rm_adds_i64x4(rm_mul_i64x4(a, b), c);
+rm_smod_i64x4(const i64 s, const i64x4 v) {
+    return rm_mod_i64x4(rm_i64x4s(s), v);
 }
 RM_INLINE f32x2
-rm_fmas_f32x2(const f32x2 a, const f32x2 b, const f32 c) {
-    return rm_adds_f32x2(rm_mul_f32x2(a, b), c);
+rm_smod_f32x2(const f32 s, const f32x2 v) {
+    return rm_mod_f32x2(rm_f32x2s(s), v);
 }
 RM_INLINE f32x3
-rm_fmas_f32x3(const f32x3 a, const f32x3 b, const f32 c) {
-    return rm_adds_f32x3(rm_mul_f32x3(a, b), c);
+rm_smod_f32x3(const f32 s, const f32x3 v) {
+    return rm_mod_f32x3(rm_f32x3s(s), v);
 }
 RM_INLINE f32x4
-rm_fmas_f32x4(const f32x4 a, const f32x4 b, const f32 c) {
-    return rm_adds_f32x4(rm_mul_f32x4(a, b), c);
+rm_smod_f32x4(const f32 s, const f32x4 v) {
+    return rm_mod_f32x4(rm_f32x4s(s), v);
 }
 RM_INLINE f64x2
-rm_fmas_f64x2(const f64x2 a, const f64x2 b, const f64 c) {
-    return rm_adds_f64x2(rm_mul_f64x2(a, b), c);
+rm_smod_f64x2(const f64 s, const f64x2 v) {
+    return rm_mod_f64x2(rm_f64x2s(s), v);
 }
 RM_INLINE f64x3
-rm_fmas_f64x3(const f64x3 a, const f64x3 b, const f64 c) {
-    return rm_adds_f64x3(rm_mul_f64x3(a, b), c);
+rm_smod_f64x3(const f64 s, const f64x3 v) {
+    return rm_mod_f64x3(rm_f64x3s(s), v);
 }
 RM_INLINE f64x4
-rm_fmas_f64x4(const f64x4 a, const f64x4 b, const f64 c) {
-    return rm_adds_f64x4(rm_mul_f64x4(a, b), c);
+rm_smod_f64x4(const f64 s, const f64x4 v) {
+    return rm_mod_f64x4(rm_f64x4s(s), v);
 }
 RM_INLINE u8x2
-rm_fmass_u8x2(const u8x2 a, const u8 b, const u8 c) {
-    return rm_adds_u8x2(rm_muls_u8x2(a, b), c);
+rm_clamp_u8x2(const u8x2 v, const u8x2 min, const u8x2 max) {
+    return rm_u8x2(rm_clamp_u8(v.x, min.x, max.x),
+                   rm_clamp_u8(v.y, min.y, max.y));
 }
 RM_INLINE u8x3
-rm_fmass_u8x3(const u8x3 a, const u8 b, const u8 c) {
-    return rm_adds_u8x3(rm_muls_u8x3(a, b), c);
+rm_clamp_u8x3(const u8x3 v, const u8x3 min, const u8x3 max) {
+    return rm_u8x3(rm_clamp_u8(v.x, min.x, max.x),
+                   rm_clamp_u8(v.y, min.y, max.y),
+                   rm_clamp_u8(v.z, min.z, max.z));
 }
 RM_INLINE u8x4
-rm_fmass_u8x4(const u8x4 a, const u8 b, const u8 c) {
-    return rm_adds_u8x4(rm_muls_u8x4(a, b), c);
+rm_clamp_u8x4(const u8x4 v, const u8x4 min, const u8x4 max) {
+    u8x4 dest;
+#if defined(RM_SSE2)
+    dest = rmmi_to_u8x4(_mm_min_epu8(_mm_max_epu8(rmmi_from_u8x4(v),
+                                                  rmmi_from_u8x4(min)),
+                                     rmmi_from_u8x4(max)));
+#elif defined(RM_NEON)
+    dest = rmn_to_u8x4(vmin_u8(vmax_u8(rmn_from_u8x4(v), rmn_from_u8x4(min)),
+                               rmn_from_u8x4(max)));
+#else
+    dest = rm_u8x4(
+        rm_clamp_u8(v.x, min.x, max.x), rm_clamp_u8(v.y, min.y, max.y),
+        rm_clamp_u8(v.z, min.z, max.z), rm_clamp_u8(v.w, min.w, max.w));
+#endif
+    return dest;
 }
 RM_INLINE u16x2
-rm_fmass_u16x2(const u16x2 a, const u16 b, const u16 c) {
-    return rm_adds_u16x2(rm_muls_u16x2(a, b), c);
+rm_clamp_u16x2(const u16x2 v, const u16x2 min, const u16x2 max) {
+    return rm_u16x2(rm_clamp_u16(v.x, min.x, max.x),
+                    rm_clamp_u16(v.y, min.y, max.y));
 }
 RM_INLINE u16x3
-rm_fmass_u16x3(const u16x3 a, const u16 b, const u16 c) {
-    return rm_adds_u16x3(rm_muls_u16x3(a, b), c);
+rm_clamp_u16x3(const u16x3 v, const u16x3 min, const u16x3 max) {
+    return rm_u16x3(rm_clamp_u16(v.x, min.x, max.x),
+                    rm_clamp_u16(v.y, min.y, max.y),
+                    rm_clamp_u16(v.z, min.z, max.z));
 }
 RM_INLINE u16x4
-rm_fmass_u16x4(const u16x4 a, const u16 b, const u16 c) {
-    return rm_adds_u16x4(rm_muls_u16x4(a, b), c);
+rm_clamp_u16x4(const u16x4 v, const u16x4 min, const u16x4 max) {
+    return rm_u16x4(
+        rm_clamp_u16(v.x, min.x, max.x), rm_clamp_u16(v.y, min.y, max.y),
+        rm_clamp_u16(v.z, min.z, max.z), rm_clamp_u16(v.w, min.w, max.w));
 }
 RM_INLINE u32x2
-rm_fmass_u32x2(const u32x2 a, const u32 b, const u32 c) {
-    return rm_adds_u32x2(rm_muls_u32x2(a, b), c);
+rm_clamp_u32x2(const u32x2 v, const u32x2 min, const u32x2 max) {
+    return rm_u32x2(rm_clamp_u32(v.x, min.x, max.x),
+                    rm_clamp_u32(v.y, min.y, max.y));
 }
 RM_INLINE u32x3
-rm_fmass_u32x3(const u32x3 a, const u32 b, const u32 c) {
-    return rm_adds_u32x3(rm_muls_u32x3(a, b), c);
+rm_clamp_u32x3(const u32x3 v, const u32x3 min, const u32x3 max) {
+    return rm_u32x3(rm_clamp_u32(v.x, min.x, max.x),
+                    rm_clamp_u32(v.y, min.y, max.y),
+                    rm_clamp_u32(v.z, min.z, max.z));
 }
 RM_INLINE u32x4
-rm_fmass_u32x4(const u32x4 a, const u32 b, const u32 c) {
-    return rm_adds_u32x4(rm_muls_u32x4(a, b), c);
+rm_clamp_u32x4(const u32x4 v, const u32x4 min, const u32x4 max) {
+    u32x4 dest;
+#if defined(RM_SSE2)
+    rmmi_store(dest.raw, rmmi_min_epu32(rmmi_max_epu32(rmmi_load(v.raw),
+                                                       rmmi_load(min.raw)),
+                                        rmmi_load(max.raw)));
+#elif defined(RM_NEON)
+    vst1q_u32(dest.raw, vminq_u32(vmaxq_u32(vld1q_u32(v.raw),
+                                            vld1q_u32(min.raw)),
+                                  vld1q_u32(max.raw)));
+#else
+    dest = rm_u32x4(
+        rm_clamp_u32(v.x, min.x, max.x), rm_clamp_u32(v.y, min.y, max.y),
+        rm_clamp_u32(v.z, min.z, max.z), rm_clamp_u32(v.w, min.w, max.w));
+#endif
+    return dest;
 }
 RM_INLINE u64x2
-rm_fmass_u64x2(const u64x2 a, const u64 b, const u64 c) {
-    return rm_adds_u64x2(rm_muls_u64x2(a, b), c);
+rm_clamp_u64x2(const u64x2 v, const u64x2 min, const u64x2 max) {
+    return rm_u64x2(rm_clamp_u64(v.x, min.x, max.x),
+                    rm_clamp_u64(v.y, min.y, max.y));
 }
 RM_INLINE u64x3
-rm_fmass_u64x3(const u64x3 a, const u64 b, const u64 c) {
-    return rm_adds_u64x3(rm_muls_u64x3(a, b), c);
+rm_clamp_u64x3(const u64x3 v, const u64x3 min, const u64x3 max) {
+    return rm_u64x3(rm_clamp_u64(v.x, min.x, max.x),
+                    rm_clamp_u64(v.y, min.y, max.y),
+                    rm_clamp_u64(v.z, min.z, max.z));
 }
 RM_INLINE u64x4
-rm_fmass_u64x4(const u64x4 a, const u64 b, const u64 c) {
-    return rm_adds_u64x4(rm_muls_u64x4(a, b), c);
+rm_clamp_u64x4(const u64x4 v, const u64x4 min, const u64x4 max) {
+    return rm_u64x4(
+        rm_clamp_u64(v.x, min.x, max.x), rm_clamp_u64(v.y, min.y, max.y),
+        rm_clamp_u64(v.z, min.z, max.z), rm_clamp_u64(v.w, min.w, max.w));
 }
 RM_INLINE i8x2
-rm_fmass_i8x2(const i8x2 a, const i8 b, const i8 c) {
-    return rm_adds_i8x2(rm_muls_i8x2(a, b), c);
+rm_clamp_i8x2(const i8x2 v, const i8x2 min, const i8x2 max) {
+    return rm_i8x2(rm_clamp_i8(v.x, min.x, max.x),
+                   rm_clamp_i8(v.y, min.y, max.y));
 }
 RM_INLINE i8x3
-rm_fmass_i8x3(const i8x3 a, const i8 b, const i8 c) {
-    return rm_adds_i8x3(rm_muls_i8x3(a, b), c);
+rm_clamp_i8x3(const i8x3 v, const i8x3 min, const i8x3 max) {
+    return rm_i8x3(rm_clamp_i8(v.x, min.x, max.x),
+                   rm_clamp_i8(v.y, min.y, max.y),
+                   rm_clamp_i8(v.z, min.z, max.z));
 }
 RM_INLINE i8x4
-rm_fmass_i8x4(const i8x4 a, const i8 b, const i8 c) {
-    return rm_adds_i8x4(rm_muls_i8x4(a, b), c);
+rm_clamp_i8x4(const i8x4 v, const i8x4 min, const i8x4 max) {
+    return rm_i8x4(
+        rm_clamp_i8(v.x, min.x, max.x), rm_clamp_i8(v.y, min.y, max.y),
+        rm_clamp_i8(v.z, min.z, max.z), rm_clamp_i8(v.w, min.w, max.w));
 }
 RM_INLINE i16x2
-rm_fmass_i16x2(const i16x2 a, const i16 b, const i16 c) {
-    return rm_adds_i16x2(rm_muls_i16x2(a, b), c);
+rm_clamp_i16x2(const i16x2 v, const i16x2 min, const i16x2 max) {
+    return rm_i16x2(rm_clamp_i16(v.x, min.x, max.x),
+                    rm_clamp_i16(v.y, min.y, max.y));
 }
 RM_INLINE i16x3
-rm_fmass_i16x3(const i16x3 a, const i16 b, const i16 c) {
-    return rm_adds_i16x3(rm_muls_i16x3(a, b), c);
+rm_clamp_i16x3(const i16x3 v, const i16x3 min, const i16x3 max) {
+    return rm_i16x3(rm_clamp_i16(v.x, min.x, max.x),
+                    rm_clamp_i16(v.y, min.y, max.y),
+                    rm_clamp_i16(v.z, min.z, max.z));
 }
 RM_INLINE i16x4
-rm_fmass_i16x4(const i16x4 a, const i16 b, const i16 c) {
-    return rm_adds_i16x4(rm_muls_i16x4(a, b), c);
+rm_clamp_i16x4(const i16x4 v, const i16x4 min, const i16x4 max) {
+    i16x4 dest;
+#if defined(RM_SSE2)
+    rmmi_storel(dest.raw, _mm_min_epi16(_mm_max_epi16(rmmi_loadl(v.raw),
+                                                      rmmi_loadl(min.raw)),
+                                        rmmi_loadl(max.raw)));
+#elif defined(RM_NEON)
+    vst1_s16(dest.raw, vmin_s16(vmax_s16(vld1_s16(v.raw), vld1_s16(min.raw)),
+                                vld1_s16(max.raw)));
+#else
+    dest = rm_i16x4(
+        rm_clamp_i16(v.x, min.x, max.x), rm_clamp_i16(v.y, min.y, max.y),
+        rm_clamp_i16(v.z, min.z, max.z), rm_clamp_i16(v.w, min.w, max.w));
+#endif
+    return dest;
 }
 RM_INLINE i32x2
-rm_fmass_i32x2(const i32x2 a, const i32 b, const i32 c) {
-    return rm_adds_i32x2(rm_muls_i32x2(a, b), c);
+rm_clamp_i32x2(const i32x2 v, const i32x2 min, const i32x2 max) {
+    return rm_i32x2(rm_clamp_i32(v.x, min.x, max.x),
+                    rm_clamp_i32(v.y, min.y, max.y));
 }
 RM_INLINE i32x3
-rm_fmass_i32x3(const i32x3 a, const i32 b, const i32 c) {
-    return rm_adds_i32x3(rm_muls_i32x3(a, b), c);
+rm_clamp_i32x3(const i32x3 v, const i32x3 min, const i32x3 max) {
+    return rm_i32x3(rm_clamp_i32(v.x, min.x, max.x),
+                    rm_clamp_i32(v.y, min.y, max.y),
+                    rm_clamp_i32(v.z, min.z, max.z));
 }
 RM_INLINE i32x4
-rm_fmass_i32x4(const i32x4 a, const i32 b, const i32 c) {
-    return rm_adds_i32x4(rm_muls_i32x4(a, b), c);
+rm_clamp_i32x4(const i32x4 v, const i32x4 min, const i32x4 max) {
+    i32x4 dest;
+#if defined(RM_SSE2)
+    rmmi_store(dest.raw, rmmi_min_epi32(rmmi_max_epi32(rmmi_load(v.raw),
+                                                       rmmi_load(min.raw)),
+                                        rmmi_load(max.raw)));
+#elif defined(RM_NEON)
+    vst1q_s32(dest.raw, vminq_s32(vmaxq_s32(vld1q_s32(v.raw),
+                                            vld1q_s32(min.raw)),
+                                  vld1q_s32(max.raw)));
+#else
+    dest = rm_i32x4(
+        rm_clamp_i32(v.x, min.x, max.x), rm_clamp_i32(v.y, min.y, max.y),
+        rm_clamp_i32(v.z, min.z, max.z), rm_clamp_i32(v.w, min.w, max.w));
+#endif
+    return dest;
 }
 RM_INLINE i64x2
-rm_fmass_i64x2(const i64x2 a, const i64 b, const i64 c) {
-    return rm_adds_i64x2(rm_muls_i64x2(a, b), c);
+rm_clamp_i64x2(const i64x2 v, const i64x2 min, const i64x2 max) {
+    return rm_i64x2(rm_clamp_i64(v.x, min.x, max.x),
+                    rm_clamp_i64(v.y, min.y, max.y));
 }
 RM_INLINE i64x3
-rm_fmass_i64x3(const i64x3 a, const i64 b, const i64 c) {
-    return rm_adds_i64x3(rm_muls_i64x3(a, b), c);
+rm_clamp_i64x3(const i64x3 v, const i64x3 min, const i64x3 max) {
+    return rm_i64x3(rm_clamp_i64(v.x, min.x, max.x),
+                    rm_clamp_i64(v.y, min.y, max.y),
+                    rm_clamp_i64(v.z, min.z, max.z));
 }
 RM_INLINE i64x4
-rm_fmass_i64x4(const i64x4 a, const i64 b, const i64 c) {
-    return rm_adds_i64x4(rm_muls_i64x4(a, b), c);
+rm_clamp_i64x4(const i64x4 v, const i64x4 min, const i64x4 max) {
+    return rm_i64x4(
+        rm_clamp_i64(v.x, min.x, max.x), rm_clamp_i64(v.y, min.y, max.y),
+        rm_clamp_i64(v.z, min.z, max.z), rm_clamp_i64(v.w, min.w, max.w));
 }
 RM_INLINE f32x2
-rm_fmass_f32x2(const f32x2 a, const f32 b, const f32 c) {
-    return rm_adds_f32x2(rm_muls_f32x2(a, b), c);
+rm_clamp_f32x2(const f32x2 v, const f32x2 min, const f32x2 max) {
+    return rm_f32x2(rm_clamp_f32(v.x, min.x, max.x),
+                    rm_clamp_f32(v.y, min.y, max.y));
 }
 RM_INLINE f32x3
-rm_fmass_f32x3(const f32x3 a, const f32 b, const f32 c) {
-    return rm_adds_f32x3(rm_muls_f32x3(a, b), c);
+rm_clamp_f32x3(const f32x3 v, const f32x3 min, const f32x3 max) {
+    return rm_f32x3(rm_clamp_f32(v.x, min.x, max.x),
+                    rm_clamp_f32(v.y, min.y, max.y),
+                    rm_clamp_f32(v.z, min.z, max.z));
 }
 RM_INLINE f32x4
-rm_fmass_f32x4(const f32x4 a, const f32 b, const f32 c) {
-    return rm_adds_f32x4(rm_muls_f32x4(a, b), c);
+rm_clamp_f32x4(const f32x4 v, const f32x4 min, const f32x4 max) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_min(rmm_max(rmm_load(v.raw), rmm_load(min.raw)),
+                                rmm_load(max.raw)));
+#else
+    dest = rm_f32x4(
+        rm_clamp_f32(v.x, min.x, max.x), rm_clamp_f32(v.y, min.y, max.y),
+        rm_clamp_f32(v.z, min.z, max.z), rm_clamp_f32(v.w, min.w, max.w));
+#endif
+    return dest;
 }
 RM_INLINE f64x2
-rm_fmass_f64x2(const f64x2 a, const f64 b, const f64 c) {
-    return rm_adds_f64x2(rm_muls_f64x2(a, b), c);
+rm_clamp_f64x2(const f64x2 v, const f64x2 min, const f64x2 max) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, _mm_min_pd(_mm_max_pd(rmmd_load(v.raw),
+                                               rmmd_load(min.raw)),
+                                    rmmd_load(max.raw)));
+#else
+    dest = rm_f64x2(rm_clamp_f64(v.x, min.x, max.x),
+                    rm_clamp_f64(v.y, min.y, max.y));
+#endif
+    return dest;
 }
 RM_INLINE f64x3
-rm_fmass_f64x3(const f64x3 a, const f64 b, const f64 c) {
-    return rm_adds_f64x3(rm_muls_f64x3(a, b), c);
+rm_clamp_f64x3(const f64x3 v, const f64x3 min, const f64x3 max) {
+    return rm_f64x3(rm_clamp_f64(v.x, min.x, max.x),
+                    rm_clamp_f64(v.y, min.y, max.y),
+                    rm_clamp_f64(v.z, min.z, max.z));
 }
 RM_INLINE f64x4
-rm_fmass_f64x4(const f64x4 a, const f64 b, const f64 c) {
-    return rm_adds_f64x4(rm_muls_f64x4(a, b), c);
+rm_clamp_f64x4(const f64x4 v, const f64x4 min, const f64x4 max) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw,
+                  _mm256_min_pd(_mm256_max_pd(rmm256d_load(v.raw),
+                                              rmm256d_load(min.raw)),
+                                rmm256d_load(max.raw)));
+#else
+    dest = rm_f64x4(
+        rm_clamp_f64(v.x, min.x, max.x), rm_clamp_f64(v.y, min.y, max.y),
+        rm_clamp_f64(v.z, min.z, max.z), rm_clamp_f64(v.w, min.w, max.w));
+#endif
+    return dest;
 }
-RM_INLINE f32x2
-rm_floor_f32x2(const f32x2 v) {
-    return rm_f32x2(rm_floor_f32(v.x), rm_floor_f32(v.y));
+RM_INLINE u8x2
+rm_clamps_u8x2(const u8x2 v, u8 min, u8 max) {
+    return rm_clamp_u8x2(v, rm_u8x2s(min), rm_u8x2s(max));
 }
-RM_INLINE f32x3
-rm_floor_f32x3(const f32x3 v) {
-    return rm_f32x3(rm_floor_f32(v.x), rm_floor_f32(v.y), rm_floor_f32(v.z));
+RM_INLINE u8x3
+rm_clamps_u8x3(const u8x3 v, u8 min, u8 max) {
+    return rm_clamp_u8x3(v, rm_u8x3s(min), rm_u8x3s(max));
 }
-RM_INLINE f32x4
-rm_floor_f32x4(const f32x4 v) {
-    return rm_f32x4(rm_floor_f32(v.x), rm_floor_f32(v.y), rm_floor_f32(v.z),
-                    rm_floor_f32(v.w));
+RM_INLINE u8x4
+rm_clamps_u8x4(const u8x4 v, u8 min, u8 max) {
+    return rm_clamp_u8x4(v, rm_u8x4s(min), rm_u8x4s(max));
 }
-RM_INLINE f64x2
-rm_floor_f64x2(const f64x2 v) {
-    return rm_f64x2(rm_floor_f64(v.x), rm_floor_f64(v.y));
+RM_INLINE u16x2
+rm_clamps_u16x2(const u16x2 v, u16 min, u16 max) {
+    return rm_clamp_u16x2(v, rm_u16x2s(min), rm_u16x2s(max));
 }
-RM_INLINE f64x3
-rm_floor_f64x3(const f64x3 v) {
-    return rm_f64x3(rm_floor_f64(v.x), rm_floor_f64(v.y), rm_floor_f64(v.z));
+RM_INLINE u16x3
+rm_clamps_u16x3(const u16x3 v, u16 min, u16 max) {
+    return rm_clamp_u16x3(v, rm_u16x3s(min), rm_u16x3s(max));
 }
-RM_INLINE f64x4
-rm_floor_f64x4(const f64x4 v) {
-    return rm_f64x4(rm_floor_f64(v.x), rm_floor_f64(v.y), rm_floor_f64(v.z),
-                    rm_floor_f64(v.w));
+RM_INLINE u16x4
+rm_clamps_u16x4(const u16x4 v, u16 min, u16 max) {
+    return rm_clamp_u16x4(v, rm_u16x4s(min), rm_u16x4s(max));
 }
-RM_INLINE f32x2
-rm_ceil_f32x2(const f32x2 v) {
-    return rm_f32x2(rm_ceil_f32(v.x), rm_ceil_f32(v.y));
+RM_INLINE u32x2
+rm_clamps_u32x2(const u32x2 v, u32 min, u32 max) {
+    return rm_clamp_u32x2(v, rm_u32x2s(min), rm_u32x2s(max));
 }
-RM_INLINE f32x3
-rm_ceil_f32x3(const f32x3 v) {
-    return rm_f32x3(rm_ceil_f32(v.x), rm_ceil_f32(v.y), rm_ceil_f32(v.z));
+RM_INLINE u32x3
+rm_clamps_u32x3(const u32x3 v, u32 min, u32 max) {
+    return rm_clamp_u32x3(v, rm_u32x3s(min), rm_u32x3s(max));
 }
-RM_INLINE f32x4
-rm_ceil_f32x4(const f32x4 v) {
-    return rm_f32x4(rm_ceil_f32(v.x), rm_ceil_f32(v.y), rm_ceil_f32(v.z),
-                    rm_ceil_f32(v.w));
+RM_INLINE u32x4
+rm_clamps_u32x4(const u32x4 v, u32 min, u32 max) {
+    return rm_clamp_u32x4(v, rm_u32x4s(min), rm_u32x4s(max));
 }
-RM_INLINE f64x2
-rm_ceil_f64x2(const f64x2 v) {
-    return rm_f64x2(rm_ceil_f64(v.x), rm_ceil_f64(v.y));
+RM_INLINE u64x2
+rm_clamps_u64x2(const u64x2 v, u64 min, u64 max) {
+    return rm_clamp_u64x2(v, rm_u64x2s(min), rm_u64x2s(max));
 }
-RM_INLINE f64x3
-rm_ceil_f64x3(const f64x3 v) {
-    return rm_f64x3(rm_ceil_f64(v.x), rm_ceil_f64(v.y), rm_ceil_f64(v.z));
+RM_INLINE u64x3
+rm_clamps_u64x3(const u64x3 v, u64 min, u64 max) {
+    return rm_clamp_u64x3(v, rm_u64x3s(min), rm_u64x3s(max));
 }
-RM_INLINE f64x4
-rm_ceil_f64x4(const f64x4 v) {
-    return rm_f64x4(rm_ceil_f64(v.x), rm_ceil_f64(v.y), rm_ceil_f64(v.z),
-                    rm_ceil_f64(v.w));
+RM_INLINE u64x4
+rm_clamps_u64x4(const u64x4 v, u64 min, u64 max) {
+    return rm_clamp_u64x4(v, rm_u64x4s(min), rm_u64x4s(max));
 }
-RM_INLINE f32x2
-rm_round_f32x2(const f32x2 v) {
-    return rm_f32x2(rm_round_f32(v.x), rm_round_f32(v.y));
+RM_INLINE i8x2
+rm_clamps_i8x2(const i8x2 v, i8 min, i8 max) {
+    return rm_clamp_i8x2(v, rm_i8x2s(min), rm_i8x2s(max));
 }
-RM_INLINE f32x3
-rm_round_f32x3(const f32x3 v) {
-    return rm_f32x3(rm_round_f32(v.x), rm_round_f32(v.y), rm_round_f32(v.z));
+RM_INLINE i8x3
+rm_clamps_i8x3(const i8x3 v, i8 min, i8 max) {
+    return rm_clamp_i8x3(v, rm_i8x3s(min), rm_i8x3s(max));
 }
-RM_INLINE f32x4
-rm_round_f32x4(const f32x4 v) {
-    return rm_f32x4(rm_round_f32(v.x), rm_round_f32(v.y), rm_round_f32(v.z),
-                    rm_round_f32(v.w));
+RM_INLINE i8x4
+rm_clamps_i8x4(const i8x4 v, i8 min, i8 max) {
+    return rm_clamp_i8x4(v, rm_i8x4s(min), rm_i8x4s(max));
 }
-RM_INLINE f64x2
-rm_round_f64x2(const f64x2 v) {
-    return rm_f64x2(rm_round_f64(v.x), rm_round_f64(v.y));
+RM_INLINE i16x2
+rm_clamps_i16x2(const i16x2 v, i16 min, i16 max) {
+    return rm_clamp_i16x2(v, rm_i16x2s(min), rm_i16x2s(max));
 }
-RM_INLINE f64x3
-rm_round_f64x3(const f64x3 v) {
-    return rm_f64x3(rm_round_f64(v.x), rm_round_f64(v.y), rm_round_f64(v.z));
+RM_INLINE i16x3
+rm_clamps_i16x3(const i16x3 v, i16 min, i16 max) {
+    return rm_clamp_i16x3(v, rm_i16x3s(min), rm_i16x3s(max));
 }
-RM_INLINE f64x4
-rm_round_f64x4(const f64x4 v) {
-    return rm_f64x4(rm_round_f64(v.x), rm_round_f64(v.y), rm_round_f64(v.z),
-                    rm_round_f64(v.w));
+RM_INLINE i16x4
+rm_clamps_i16x4(const i16x4 v, i16 min, i16 max) {
+    return rm_clamp_i16x4(v, rm_i16x4s(min), rm_i16x4s(max));
 }
-RM_INLINE f32x2
-rm_trunc_f32x2(const f32x2 v) {
-    return rm_f32x2(rm_trunc_f32(v.x), rm_trunc_f32(v.y));
+RM_INLINE i32x2
+rm_clamps_i32x2(const i32x2 v, i32 min, i32 max) {
+    return rm_clamp_i32x2(v, rm_i32x2s(min), rm_i32x2s(max));
 }
-RM_INLINE f32x3
-rm_trunc_f32x3(const f32x3 v) {
-    return rm_f32x3(rm_trunc_f32(v.x), rm_trunc_f32(v.y), rm_trunc_f32(v.z));
+RM_INLINE i32x3
+rm_clamps_i32x3(const i32x3 v, i32 min, i32 max) {
+    return rm_clamp_i32x3(v, rm_i32x3s(min), rm_i32x3s(max));
 }
-RM_INLINE f32x4
-rm_trunc_f32x4(const f32x4 v) {
-    return rm_f32x4(rm_trunc_f32(v.x), rm_trunc_f32(v.y), rm_trunc_f32(v.z),
-                    rm_trunc_f32(v.w));
+RM_INLINE i32x4
+rm_clamps_i32x4(const i32x4 v, i32 min, i32 max) {
+    return rm_clamp_i32x4(v, rm_i32x4s(min), rm_i32x4s(max));
 }
-RM_INLINE f64x2
-rm_trunc_f64x2(const f64x2 v) {
-    return rm_f64x2(rm_trunc_f64(v.x), rm_trunc_f64(v.y));
+RM_INLINE i64x2
+rm_clamps_i64x2(const i64x2 v, i64 min, i64 max) {
+    return rm_clamp_i64x2(v, rm_i64x2s(min), rm_i64x2s(max));
 }
-RM_INLINE f64x3
-rm_trunc_f64x3(const f64x3 v) {
-    return rm_f64x3(rm_trunc_f64(v.x), rm_trunc_f64(v.y), rm_trunc_f64(v.z));
+RM_INLINE i64x3
+rm_clamps_i64x3(const i64x3 v, i64 min, i64 max) {
+    return rm_clamp_i64x3(v, rm_i64x3s(min), rm_i64x3s(max));
 }
-RM_INLINE f64x4
-rm_trunc_f64x4(const f64x4 v) {
-    return rm_f64x4(rm_trunc_f64(v.x), rm_trunc_f64(v.y), rm_trunc_f64(v.z),
-                    rm_trunc_f64(v.w));
+RM_INLINE i64x4
+rm_clamps_i64x4(const i64x4 v, i64 min, i64 max) {
+    return rm_clamp_i64x4(v, rm_i64x4s(min), rm_i64x4s(max));
 }
 RM_INLINE f32x2
-rm_fract_f32x2(const f32x2 v) {
-    return rm_f32x2(rm_fract_f32(v.x), rm_fract_f32(v.y));
+rm_clamps_f32x2(const f32x2 v, f32 min, f32 max) {
+    return rm_clamp_f32x2(v, rm_f32x2s(min), rm_f32x2s(max));
 }
 RM_INLINE f32x3
-rm_fract_f32x3(const f32x3 v) {
-    return rm_f32x3(rm_fract_f32(v.x), rm_fract_f32(v.y), rm_fract_f32(v.z));
+rm_clamps_f32x3(const f32x3 v, f32 min, f32 max) {
+    return rm_clamp_f32x3(v, rm_f32x3s(min), rm_f32x3s(max));
 }
 RM_INLINE f32x4
-rm_fract_f32x4(const f32x4 v) {
-    return rm_f32x4(rm_fract_f32(v.x), rm_fract_f32(v.y), rm_fract_f32(v.z),
-                    rm_fract_f32(v.w));
+rm_clamps_f32x4(const f32x4 v, f32 min, f32 max) {
+    return rm_clamp_f32x4(v, rm_f32x4s(min), rm_f32x4s(max));
 }
 RM_INLINE f64x2
-rm_fract_f64x2(const f64x2 v) {
-    return rm_f64x2(rm_fract_f64(v.x), rm_fract_f64(v.y));
+rm_clamps_f64x2(const f64x2 v, f64 min, f64 max) {
+    return rm_clamp_f64x2(v, rm_f64x2s(min), rm_f64x2s(max));
 }
 RM_INLINE f64x3
-rm_fract_f64x3(const f64x3 v) {
-    return rm_f64x3(rm_fract_f64(v.x), rm_fract_f64(v.y), rm_fract_f64(v.z));
+rm_clamps_f64x3(const f64x3 v, f64 min, f64 max) {
+    return rm_clamp_f64x3(v, rm_f64x3s(min), rm_f64x3s(max));
 }
 RM_INLINE f64x4
-rm_fract_f64x4(const f64x4 v) {
-    return rm_f64x4(rm_fract_f64(v.x), rm_fract_f64(v.y), rm_fract_f64(v.z),
-                    rm_fract_f64(v.w));
-}
-RM_INLINE boolx2
-rm_copy_boolx2(const boolx2 v) {
-    return rm_boolx2(v.x, v.y);
-}
-RM_INLINE boolx3
-rm_copy_boolx3(const boolx3 v) {
-    return rm_boolx3(v.x, v.y, v.z);
-}
-RM_INLINE boolx4
-rm_copy_boolx4(const boolx4 v) {
-    return rm_boolx4(v.x, v.y, v.z, v.w);
-}
-RM_INLINE u8x2
-rm_copy_u8x2(const u8x2 v) {
-    return rm_u8x2(v.x, v.y);
-}
-RM_INLINE u8x3
-rm_copy_u8x3(const u8x3 v) {
-    return rm_u8x3(v.x, v.y, v.z);
-}
-RM_INLINE u8x4
-rm_copy_u8x4(const u8x4 v) {
-    return rm_u8x4(v.x, v.y, v.z, v.w);
-}
-RM_INLINE u16x2
-rm_copy_u16x2(const u16x2 v) {
-    return rm_u16x2(v.x, v.y);
-}
-RM_INLINE u16x3
-rm_copy_u16x3(const u16x3 v) {
-    return rm_u16x3(v.x, v.y, v.z);
-}
-RM_INLINE u16x4
-rm_copy_u16x4(const u16x4 v) {
-    return rm_u16x4(v.x, v.y, v.z, v.w);
-}
-RM_INLINE u32x2
-rm_copy_u32x2(const u32x2 v) {
-    return rm_u32x2(v.x, v.y);
-}
-RM_INLINE u32x3
-rm_copy_u32x3(const u32x3 v) {
-    return rm_u32x3(v.x, v.y, v.z);
-}
-RM_INLINE u32x4
-rm_copy_u32x4(const u32x4 v) {
-    return rm_u32x4(v.x, v.y, v.z, v.w);
-}
-RM_INLINE u64x2
-rm_copy_u64x2(const u64x2 v) {
-    return rm_u64x2(v.x, v.y);
-}
-RM_INLINE u64x3
-rm_copy_u64x3(const u64x3 v) {
-    return rm_u64x3(v.x, v.y, v.z);
-}
-RM_INLINE u64x4
-rm_copy_u64x4(const u64x4 v) {
-    return rm_u64x4(v.x, v.y, v.z, v.w);
+rm_clamps_f64x4(const f64x4 v, f64 min, f64 max) {
+    return rm_clamp_f64x4(v, rm_f64x4s(min), rm_f64x4s(max));
 }
 RM_INLINE i8x2
-rm_copy_i8x2(const i8x2 v) {
-    return rm_i8x2(v.x, v.y);
+rm_sign_i8x2(const i8x2 v) {
+    return rm_i8x2(rm_sign_i8(v.x), rm_sign_i8(v.y));
 }
 RM_INLINE i8x3
-rm_copy_i8x3(const i8x3 v) {
-    return rm_i8x3(v.x, v.y, v.z);
+rm_sign_i8x3(const i8x3 v) {
+    return rm_i8x3(rm_sign_i8(v.x), rm_sign_i8(v.y), rm_sign_i8(v.z));
 }
 RM_INLINE i8x4
-rm_copy_i8x4(const i8x4 v) {
-    return rm_i8x4(v.x, v.y, v.z, v.w);
+rm_sign_i8x4(const i8x4 v) {
+    return rm_i8x4(rm_sign_i8(v.x), rm_sign_i8(v.y), rm_sign_i8(v.z),
+                   rm_sign_i8(v.w));
 }
 RM_INLINE i16x2
-rm_copy_i16x2(const i16x2 v) {
-    return rm_i16x2(v.x, v.y);
+rm_sign_i16x2(const i16x2 v) {
+    return rm_i16x2(rm_sign_i16(v.x), rm_sign_i16(v.y));
 }
 RM_INLINE i16x3
-rm_copy_i16x3(const i16x3 v) {
-    return rm_i16x3(v.x, v.y, v.z);
+rm_sign_i16x3(const i16x3 v) {
+    return rm_i16x3(rm_sign_i16(v.x), rm_sign_i16(v.y), rm_sign_i16(v.z));
 }
 RM_INLINE i16x4
-rm_copy_i16x4(const i16x4 v) {
-    return rm_i16x4(v.x, v.y, v.z, v.w);
+rm_sign_i16x4(const i16x4 v) {
+    return rm_i16x4(rm_sign_i16(v.x), rm_sign_i16(v.y), rm_sign_i16(v.z),
+                    rm_sign_i16(v.w));
 }
 RM_INLINE i32x2
-rm_copy_i32x2(const i32x2 v) {
-    return rm_i32x2(v.x, v.y);
+rm_sign_i32x2(const i32x2 v) {
+    return rm_i32x2(rm_sign_i32(v.x), rm_sign_i32(v.y));
 }
 RM_INLINE i32x3
-rm_copy_i32x3(const i32x3 v) {
-    return rm_i32x3(v.x, v.y, v.z);
+rm_sign_i32x3(const i32x3 v) {
+    return rm_i32x3(rm_sign_i32(v.x), rm_sign_i32(v.y), rm_sign_i32(v.z));
 }
 RM_INLINE i32x4
-rm_copy_i32x4(const i32x4 v) {
-    return rm_i32x4(v.x, v.y, v.z, v.w);
+rm_sign_i32x4(const i32x4 v) {
+    return rm_i32x4(rm_sign_i32(v.x), rm_sign_i32(v.y), rm_sign_i32(v.z),
+                    rm_sign_i32(v.w));
 }
 RM_INLINE i64x2
-rm_copy_i64x2(const i64x2 v) {
-    return rm_i64x2(v.x, v.y);
+rm_sign_i64x2(const i64x2 v) {
+    return rm_i64x2(rm_sign_i64(v.x), rm_sign_i64(v.y));
 }
 RM_INLINE i64x3
-rm_copy_i64x3(const i64x3 v) {
-    return rm_i64x3(v.x, v.y, v.z);
+rm_sign_i64x3(const i64x3 v) {
+    return rm_i64x3(rm_sign_i64(v.x), rm_sign_i64(v.y), rm_sign_i64(v.z));
 }
 RM_INLINE i64x4
-rm_copy_i64x4(const i64x4 v) {
-    return rm_i64x4(v.x, v.y, v.z, v.w);
+rm_sign_i64x4(const i64x4 v) {
+    return rm_i64x4(rm_sign_i64(v.x), rm_sign_i64(v.y), rm_sign_i64(v.z),
+                    rm_sign_i64(v.w));
 }
 RM_INLINE f32x2
-rm_copy_f32x2(const f32x2 v) {
-    return rm_f32x2(v.x, v.y);
+rm_sign_f32x2(const f32x2 v) {
+    return rm_f32x2(rm_sign_f32(v.x), rm_sign_f32(v.y));
 }
 RM_INLINE f32x3
-rm_copy_f32x3(const f32x3 v) {
-    return rm_f32x3(v.x, v.y, v.z);
+rm_sign_f32x3(const f32x3 v) {
+    return rm_f32x3(rm_sign_f32(v.x), rm_sign_f32(v.y), rm_sign_f32(v.z));
 }
 RM_INLINE f32x4
-rm_copy_f32x4(const f32x4 v) {
-    f32x4 dest;
-#if defined(RM_SSE)
-    rmm_store(dest.raw, rmm_load(v.raw));
-#else
-    dest = rm_f32x4(v.x, v.y, v.z, v.w);
-#endif
-    return dest;
+rm_sign_f32x4(const f32x4 v) {
+    return rm_f32x4(rm_sign_f32(v.x), rm_sign_f32(v.y), rm_sign_f32(v.z),
+                    rm_sign_f32(v.w));
 }
 RM_INLINE f64x2
-rm_copy_f64x2(const f64x2 v) {
+rm_sign_f64x2(const f64x2 v) {
     f64x2 dest;
 #if defined(RM_SSE2)
-    _mm_store_pd(dest.raw, _mm_load_pd(v.raw));
+    __m128d x, zero, one;
+
+    x    = rmmd_load(v.raw);
+    zero = _mm_setzero_pd();
+    one  = _mm_set1_pd(1.0);
+
+    rmmd_store(dest.raw, _mm_sub_pd(_mm_and_pd(_mm_cmpgt_pd(x, zero), one),
+                                    _mm_and_pd(_mm_cmplt_pd(x, zero), one)));
 #else
-    dest = rm_f64x2(v.x, v.y);
+    dest = rm_f64x2(rm_sign_f64(v.x), rm_sign_f64(v.y));
 #endif
     return dest;
 }
 RM_INLINE f64x3
-rm_copy_f64x3(const f64x3 v) {
-    return rm_f64x3(v.x, v.y, v.z);
+rm_sign_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_sign_f64(v.x), rm_sign_f64(v.y), rm_sign_f64(v.z));
 }
 RM_INLINE f64x4
-rm_copy_f64x4(const f64x4 v) {
+rm_sign_f64x4(const f64x4 v) {
     f64x4 dest;
 #if defined(RM_AVX)
-    _mm256_store_pd(dest.raw, _mm256_load_pd(v.raw));
+    __m256d x, zero, one;
+
+    x    = rmm256d_load(v.raw);
+    zero = _mm256_setzero_pd();
+    one  = _mm256_set1_pd(1.0);
+
+    rmm256d_store(dest.raw,
+                  _mm256_sub_pd(
+                      _mm256_and_pd(_mm256_cmp_pd(x, zero, _CMP_GT_OQ), one),
+                      _mm256_and_pd(_mm256_cmp_pd(x, zero, _CMP_LT_OQ), one)));
 #else
-    dest = rm_f64x4(v.x, v.y, v.z, v.w);
+    dest = rm_f64x4(rm_sign_f64(v.x), rm_sign_f64(v.y), rm_sign_f64(v.z),
+                    rm_sign_f64(v.w));
 #endif
     return dest;
 }
-RM_INLINE boolx2
-rm_zero_boolx2(void) {
-    return rm_boolx2s(0);
-}
-RM_INLINE boolx3
-rm_zero_boolx3(void) {
-    return rm_boolx3s(0);
-}
-RM_INLINE boolx4
-rm_zero_boolx4(void) {
-    return rm_boolx4s(0);
-}
-RM_INLINE u8x2
-rm_zero_u8x2(void) {
-    return rm_u8x2s(0);
-}
-RM_INLINE u8x3
-rm_zero_u8x3(void) {
-    return rm_u8x3s(0);
-}
-RM_INLINE u8x4
-rm_zero_u8x4(void) {
-    return rm_u8x4s(0);
-}
-RM_INLINE u16x2
-rm_zero_u16x2(void) {
-    return rm_u16x2s(0);
-}
-RM_INLINE u16x3
-rm_zero_u16x3(void) {
-    return rm_u16x3s(0);
-}
-RM_INLINE u16x4
-rm_zero_u16x4(void) {
-    return rm_u16x4s(0);
-}
-RM_INLINE u32x2
-rm_zero_u32x2(void) {
-    return rm_u32x2s(0);
-}
-RM_INLINE u32x3
-rm_zero_u32x3(void) {
-    return rm_u32x3s(0);
-}
-RM_INLINE u32x4
-rm_zero_u32x4(void) {
-    return rm_u32x4s(0);
-}
-RM_INLINE u64x2
-rm_zero_u64x2(void) {
-    return rm_u64x2s(0);
-}
-RM_INLINE u64x3
-rm_zero_u64x3(void) {
-    return rm_u64x3s(0);
-}
-RM_INLINE u64x4
-rm_zero_u64x4(void) {
-    return rm_u64x4s(0);
-}
 RM_INLINE i8x2
-rm_zero_i8x2(void) {
-    return rm_i8x2s(0);
+rm_copysign_i8x2(const i8x2 v, const i8x2 s) {
+    return rm_i8x2(rm_copysign_i8(v.x, s.x), rm_copysign_i8(v.y, s.y));
 }
 RM_INLINE i8x3
-rm_zero_i8x3(void) {
-    return rm_i8x3s(0);
+rm_copysign_i8x3(const i8x3 v, const i8x3 s) {
+    return rm_i8x3(rm_copysign_i8(v.x, s.x), rm_copysign_i8(v.y, s.y),
+                   rm_copysign_i8(v.z, s.z));
 }
 RM_INLINE i8x4
-rm_zero_i8x4(void) {
-    return rm_i8x4s(0);
+rm_copysign_i8x4(const i8x4 v, const i8x4 s) {
+    return rm_i8x4(rm_copysign_i8(v.x, s.x), rm_copysign_i8(v.y, s.y),
+                   rm_copysign_i8(v.z, s.z), rm_copysign_i8(v.w, s.w));
 }
 RM_INLINE i16x2
-rm_zero_i16x2(void) {
-    return rm_i16x2s(0);
+rm_copysign_i16x2(const i16x2 v, const i16x2 s) {
+    return rm_i16x2(rm_copysign_i16(v.x, s.x), rm_copysign_i16(v.y, s.y));
 }
 RM_INLINE i16x3
-rm_zero_i16x3(void) {
-    return rm_i16x3s(0);
+rm_copysign_i16x3(const i16x3 v, const i16x3 s) {
+    return rm_i16x3(rm_copysign_i16(v.x, s.x), rm_copysign_i16(v.y, s.y),
+                    rm_copysign_i16(v.z, s.z));
 }
 RM_INLINE i16x4
-rm_zero_i16x4(void) {
-    return rm_i16x4s(0);
+rm_copysign_i16x4(const i16x4 v, const i16x4 s) {
+    return rm_i16x4(rm_copysign_i16(v.x, s.x), rm_copysign_i16(v.y, s.y),
+                    rm_copysign_i16(v.z, s.z), rm_copysign_i16(v.w, s.w));
 }
 RM_INLINE i32x2
-rm_zero_i32x2(void) {
-    return rm_i32x2s(0);
+rm_copysign_i32x2(const i32x2 v, const i32x2 s) {
+    return rm_i32x2(rm_copysign_i32(v.x, s.x), rm_copysign_i32(v.y, s.y));
 }
 RM_INLINE i32x3
-rm_zero_i32x3(void) {
-    return rm_i32x3s(0);
+rm_copysign_i32x3(const i32x3 v, const i32x3 s) {
+    return rm_i32x3(rm_copysign_i32(v.x, s.x), rm_copysign_i32(v.y, s.y),
+                    rm_copysign_i32(v.z, s.z));
 }
 RM_INLINE i32x4
-rm_zero_i32x4(void) {
-    return rm_i32x4s(0);
+rm_copysign_i32x4(const i32x4 v, const i32x4 s) {
+    return rm_i32x4(rm_copysign_i32(v.x, s.x), rm_copysign_i32(v.y, s.y),
+                    rm_copysign_i32(v.z, s.z), rm_copysign_i32(v.w, s.w));
 }
 RM_INLINE i64x2
-rm_zero_i64x2(void) {
-    return rm_i64x2s(0);
+rm_copysign_i64x2(const i64x2 v, const i64x2 s) {
+    return rm_i64x2(rm_copysign_i64(v.x, s.x), rm_copysign_i64(v.y, s.y));
 }
 RM_INLINE i64x3
-rm_zero_i64x3(void) {
-    return rm_i64x3s(0);
+rm_copysign_i64x3(const i64x3 v, const i64x3 s) {
+    return rm_i64x3(rm_copysign_i64(v.x, s.x), rm_copysign_i64(v.y, s.y),
+                    rm_copysign_i64(v.z, s.z));
 }
 RM_INLINE i64x4
-rm_zero_i64x4(void) {
-    return rm_i64x4s(0);
+rm_copysign_i64x4(const i64x4 v, const i64x4 s) {
+    return rm_i64x4(rm_copysign_i64(v.x, s.x), rm_copysign_i64(v.y, s.y),
+                    rm_copysign_i64(v.z, s.z), rm_copysign_i64(v.w, s.w));
 }
 RM_INLINE f32x2
-rm_zero_f32x2(void) {
-    return rm_f32x2s(0);
+rm_copysign_f32x2(const f32x2 v, const f32x2 s) {
+    return rm_f32x2(rm_copysign_f32(v.x, s.x), rm_copysign_f32(v.y, s.y));
 }
 RM_INLINE f32x3
-rm_zero_f32x3(void) {
-    return rm_f32x3s(0);
+rm_copysign_f32x3(const f32x3 v, const f32x3 s) {
+    return rm_f32x3(rm_copysign_f32(v.x, s.x), rm_copysign_f32(v.y, s.y),
+                    rm_copysign_f32(v.z, s.z));
 }
 RM_INLINE f32x4
-rm_zero_f32x4(void) {
-    f32x4 dest;
-#if defined(RM_SSE)
-    rmm_store(dest.raw, _mm_setzero_ps());
-#else
-    dest = rm_f32x4s(0);
-#endif
-    return dest;
+rm_copysign_f32x4(const f32x4 v, const f32x4 s) {
+    return rm_f32x4(rm_copysign_f32(v.x, s.x), rm_copysign_f32(v.y, s.y),
+                    rm_copysign_f32(v.z, s.z), rm_copysign_f32(v.w, s.w));
 }
 RM_INLINE f64x2
-rm_zero_f64x2(void) {
-    f64x2 dest;
+rm_copysign_f64x2(const f64x2 v, const f64x2 s) {
 #if defined(RM_SSE2)
-    _mm_store_pd(dest.raw, _mm_setzero_pd());
+    return rm_mul_f64x2(rm_abs_f64x2(v), rm_sign_f64x2(s));
 #else
-    dest = rm_f64x2s(0);
+    return rm_f64x2(rm_copysign_f64(v.x, s.x), rm_copysign_f64(v.y, s.y));
 #endif
-    return dest;
 }
 RM_INLINE f64x3
-rm_zero_f64x3(void) {
-    return rm_f64x3s(0);
+rm_copysign_f64x3(const f64x3 v, const f64x3 s) {
+    return rm_f64x3(rm_copysign_f64(v.x, s.x), rm_copysign_f64(v.y, s.y),
+                    rm_copysign_f64(v.z, s.z));
 }
 RM_INLINE f64x4
-rm_zero_f64x4(void) {
-    f64x4 dest;
+rm_copysign_f64x4(const f64x4 v, const f64x4 s) {
 #if defined(RM_AVX)
-    _mm256_store_pd(dest.raw, _mm256_setzero_pd());
+    return rm_mul_f64x4(rm_abs_f64x4(v), rm_sign_f64x4(s));
 #else
-    dest = rm_f64x4s(0);
+    return rm_f64x4(rm_copysign_f64(v.x, s.x), rm_copysign_f64(v.y, s.y),
+                    rm_copysign_f64(v.z, s.z), rm_copysign_f64(v.w, s.w));
 #endif
-    return dest;
-}
-RM_INLINE boolx2
-rm_one_boolx2(void) {
-    return rm_boolx2s(1);
 }
-RM_INLINE boolx3
-rm_one_boolx3(void) {
-    return rm_boolx3s(1);
+RM_INLINE i8x2
+rm_copysigns_i8x2(const i8x2 v, const i8 s) {
+    return rm_copysign_i8x2(v, rm_i8x2s(s));
 }
-RM_INLINE boolx4
-rm_one_boolx4(void) {
-    return rm_boolx4s(1);
+RM_INLINE i8x3
+rm_copysigns_i8x3(const i8x3 v, const i8 s) {
+    return rm_copysign_i8x3(v, rm_i8x3s(s));
 }
-RM_INLINE u8x2
-rm_one_u8x2(void) {
-    return rm_u8x2s(1);
+RM_INLINE i8x4
+rm_copysigns_i8x4(const i8x4 v, const i8 s) {
+    return rm_copysign_i8x4(v, rm_i8x4s(s));
 }
-RM_INLINE u8x3
-rm_one_u8x3(void) {
-    return rm_u8x3s(1);
+RM_INLINE i16x2
+rm_copysigns_i16x2(const i16x2 v, const i16 s) {
+    return rm_copysign_i16x2(v, rm_i16x2s(s));
 }
-RM_INLINE u8x4
-rm_one_u8x4(void) {
-    return rm_u8x4s(1);
+RM_INLINE i16x3
+rm_copysigns_i16x3(const i16x3 v, const i16 s) {
+    return rm_copysign_i16x3(v, rm_i16x3s(s));
 }
-RM_INLINE u16x2
-rm_one_u16x2(void) {
-    return rm_u16x2s(1);
+RM_INLINE i16x4
+rm_copysigns_i16x4(const i16x4 v, const i16 s) {
+    return rm_copysign_i16x4(v, rm_i16x4s(s));
 }
-RM_INLINE u16x3
-rm_one_u16x3(void) {
-    return rm_u16x3s(1);
+RM_INLINE i32x2
+rm_copysigns_i32x2(const i32x2 v, const i32 s) {
+    return rm_copysign_i32x2(v, rm_i32x2s(s));
 }
-RM_INLINE u16x4
-rm_one_u16x4(void) {
-    return rm_u16x4s(1);
+RM_INLINE i32x3
+rm_copysigns_i32x3(const i32x3 v, const i32 s) {
+    return rm_copysign_i32x3(v, rm_i32x3s(s));
 }
-RM_INLINE u32x2
-rm_one_u32x2(void) {
-    return rm_u32x2s(1);
+RM_INLINE i32x4
+rm_copysigns_i32x4(const i32x4 v, const i32 s) {
+    return rm_copysign_i32x4(v, rm_i32x4s(s));
 }
-RM_INLINE u32x3
-rm_one_u32x3(void) {
-    return rm_u32x3s(1);
+RM_INLINE i64x2
+rm_copysigns_i64x2(const i64x2 v, const i64 s) {
+    return rm_copysign_i64x2(v, rm_i64x2s(s));
 }
-RM_INLINE u32x4
-rm_one_u32x4(void) {
-    return rm_u32x4s(1);
+RM_INLINE i64x3
+rm_copysigns_i64x3(const i64x3 v, const i64 s) {
+    return rm_copysign_i64x3(v, rm_i64x3s(s));
+}
+RM_INLINE i64x4
+rm_copysigns_i64x4(const i64x4 v, const i64 s) {
+    return rm_copysign_i64x4(v, rm_i64x4s(s));
+}
+RM_INLINE f32x2
+rm_copysigns_f32x2(const f32x2 v, const f32 s) {
+    return rm_copysign_f32x2(v, rm_f32x2s(s));
+}
+RM_INLINE f32x3
+rm_copysigns_f32x3(const f32x3 v, const f32 s) {
+    return rm_copysign_f32x3(v, rm_f32x3s(s));
+}
+RM_INLINE f32x4
+rm_copysigns_f32x4(const f32x4 v, const f32 s) {
+    return rm_copysign_f32x4(v, rm_f32x4s(s));
+}
+RM_INLINE f64x2
+rm_copysigns_f64x2(const f64x2 v, const f64 s) {
+    return rm_copysign_f64x2(v, rm_f64x2s(s));
+}
+RM_INLINE f64x3
+rm_copysigns_f64x3(const f64x3 v, const f64 s) {
+    return rm_copysign_f64x3(v, rm_f64x3s(s));
+}
+RM_INLINE f64x4
+rm_copysigns_f64x4(const f64x4 v, const f64 s) {
+    return rm_copysign_f64x4(v, rm_f64x4s(s));
+}
+RM_INLINE u8x2
+rm_fma_u8x2(const u8x2 a, const u8x2 b, const u8x2 c) {
+    return rm_add_u8x2(rm_mul_u8x2(a, b), c);
+}
+RM_INLINE u8x3
+rm_fma_u8x3(const u8x3 a, const u8x3 b, const u8x3 c) {
+    return rm_add_u8x3(rm_mul_u8x3(a, b), c);
+}
+RM_INLINE u8x4
+rm_fma_u8x4(const u8x4 a, const u8x4 b, const u8x4 c) {
+    return rm_add_u8x4(rm_mul_u8x4(a, b), c);
+}
+RM_INLINE u16x2
+rm_fma_u16x2(const u16x2 a, const u16x2 b, const u16x2 c) {
+    return rm_add_u16x2(rm_mul_u16x2(a, b), c);
+}
+RM_INLINE u16x3
+rm_fma_u16x3(const u16x3 a, const u16x3 b, const u16x3 c) {
+    return rm_add_u16x3(rm_mul_u16x3(a, b), c);
+}
+RM_INLINE u16x4
+rm_fma_u16x4(const u16x4 a, const u16x4 b, const u16x4 c) {
+    return rm_add_u16x4(rm_mul_u16x4(a, b), c);
+}
+RM_INLINE u32x2
+rm_fma_u32x2(const u32x2 a, const u32x2 b, const u32x2 c) {
+    return rm_add_u32x2(rm_mul_u32x2(a, b), c);
+}
+RM_INLINE u32x3
+rm_fma_u32x3(const u32x3 a, const u32x3 b, const u32x3 c) {
+    return rm_add_u32x3(rm_mul_u32x3(a, b), c);
+}
+RM_INLINE u32x4
+rm_fma_u32x4(const u32x4 a, const u32x4 b, const u32x4 c) {
+    return rm_add_u32x4(rm_mul_u32x4(a, b), c);
 }
 RM_INLINE u64x2
-rm_one_u64x2(void) {
-    return rm_u64x2s(1);
+rm_fma_u64x2(const u64x2 a, const u64x2 b, const u64x2 c) {
+    return rm_add_u64x2(rm_mul_u64x2(a, b), c);
 }
 RM_INLINE u64x3
-rm_one_u64x3(void) {
-    return rm_u64x3s(1);
+rm_fma_u64x3(const u64x3 a, const u64x3 b, const u64x3 c) {
+    return rm_add_u64x3(rm_mul_u64x3(a, b), c);
 }
 RM_INLINE u64x4
-rm_one_u64x4(void) {
-    return rm_u64x4s(1);
+rm_fma_u64x4(const u64x4 a, const u64x4 b, const u64x4 c) {
+    return rm_add_u64x4(rm_mul_u64x4(a, b), c);
 }
 RM_INLINE i8x2
-rm_one_i8x2(void) {
-    return rm_i8x2s(1);
+rm_fma_i8x2(const i8x2 a, const i8x2 b, const i8x2 c) {
+    return rm_add_i8x2(rm_mul_i8x2(a, b), c);
 }
 RM_INLINE i8x3
-rm_one_i8x3(void) {
-    return rm_i8x3s(1);
+rm_fma_i8x3(const i8x3 a, const i8x3 b, const i8x3 c) {
+    return rm_add_i8x3(rm_mul_i8x3(a, b), c);
 }
 RM_INLINE i8x4
-rm_one_i8x4(void) {
-    return rm_i8x4s(1);
+rm_fma_i8x4(const i8x4 a, const i8x4 b, const i8x4 c) {
+    return rm_add_i8x4(rm_mul_i8x4(a, b), c);
 }
 RM_INLINE i16x2
-rm_one_i16x2(void) {
-    return rm_i16x2s(1);
+rm_fma_i16x2(const i16x2 a, const i16x2 b, const i16x2 c) {
+    return rm_add_i16x2(rm_mul_i16x2(a, b), c);
 }
 RM_INLINE i16x3
-rm_one_i16x3(void) {
-    return rm_i16x3s(1);
+rm_fma_i16x3(const i16x3 a, const i16x3 b, const i16x3 c) {
+    return rm_add_i16x3(rm_mul_i16x3(a, b), c);
 }
 RM_INLINE i16x4
-rm_one_i16x4(void) {
-    return rm_i16x4s(1);
+rm_fma_i16x4(const i16x4 a, const i16x4 b, const i16x4 c) {
+    return rm_add_i16x4(rm_mul_i16x4(a, b), c);
 }
 RM_INLINE i32x2
-rm_one_i32x2(void) {
-    return rm_i32x2s(1);
+rm_fma_i32x2(const i32x2 a, const i32x2 b, const i32x2 c) {
+    return rm_add_i32x2(rm_mul_i32x2(a, b), c);
 }
 RM_INLINE i32x3
-rm_one_i32x3(void) {
-    return rm_i32x3s(1);
+rm_fma_i32x3(const i32x3 a, const i32x3 b, const i32x3 c) {
+    return rm_add_i32x3(rm_mul_i32x3(a, b), c);
 }
 RM_INLINE i32x4
-rm_one_i32x4(void) {
-    return rm_i32x4s(1);
+rm_fma_i32x4(const i32x4 a, const i32x4 b, const i32x4 c) {
+    return rm_add_i32x4(rm_mul_i32x4(a, b), c);
 }
 RM_INLINE i64x2
-rm_one_i64x2(void) {
-    return rm_i64x2s(1);
+rm_fma_i64x2(const i64x2 a, const i64x2 b, const i64x2 c) {
+    return rm_add_i64x2(rm_mul_i64x2(a, b), c);
 }
 RM_INLINE i64x3
-rm_one_i64x3(void) {
-    return rm_i64x3s(1);
+rm_fma_i64x3(const i64x3 a, const i64x3 b, const i64x3 c) {
+    return rm_add_i64x3(rm_mul_i64x3(a, b), c);
 }
 RM_INLINE i64x4
-rm_one_i64x4(void) {
-    return rm_i64x4s(1);
+rm_fma_i64x4(const i64x4 a, const i64x4 b, const i64x4 c) {
+    return rm_add_i64x4(rm_mul_i64x4(a, b), c);
 }
 RM_INLINE f32x2
-rm_one_f32x2(void) {
-    return rm_f32x2s(1);
+rm_fma_f32x2(const f32x2 a, const f32x2 b, const f32x2 c) {
+    return rm_add_f32x2(rm_mul_f32x2(a, b), c);
 }
 RM_INLINE f32x3
-rm_one_f32x3(void) {
-    return rm_f32x3s(1);
+rm_fma_f32x3(const f32x3 a, const f32x3 b, const f32x3 c) {
+    return rm_add_f32x3(rm_mul_f32x3(a, b), c);
 }
 RM_INLINE f32x4
-rm_one_f32x4(void) {
+rm_fma_f32x4(const f32x4 a, const f32x4 b, const f32x4 c) {
     f32x4 dest;
-#if defined(RM_SSE)
-    rmm_store(dest.raw, _mm_set_ps(1, 1, 1, 1));
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_fmadd(rmm_load(a.raw), rmm_load(b.raw),
+                                  rmm_load(c.raw)));
 #else
-    dest = rm_f32x4s(1);
+    dest = rm_add_f32x4(rm_mul_f32x4(a, b), c);
 #endif
     return dest;
 }
 RM_INLINE f64x2
-rm_one_f64x2(void) {
+rm_fma_f64x2(const f64x2 a, const f64x2 b, const f64x2 c) {
     f64x2 dest;
 #if defined(RM_SSE2)
-    _mm_store_pd(dest.raw, _mm_set_pd(1, 1));
+    rmmd_store(dest.raw, rmmd_fmadd(rmmd_load(a.raw), rmmd_load(b.raw),
+                                    rmmd_load(c.raw)));
 #else
-    dest = rm_f64x2s(1);
+    dest = rm_add_f64x2(rm_mul_f64x2(a, b), c);
 #endif
     return dest;
 }
 RM_INLINE f64x3
-rm_one_f64x3(void) {
-    return rm_f64x3s(1);
+rm_fma_f64x3(const f64x3 a, const f64x3 b, const f64x3 c) {
+    return rm_add_f64x3(rm_mul_f64x3(a, b), c);
 }
 RM_INLINE f64x4
-rm_one_f64x4(void) {
+rm_fma_f64x4(const f64x4 a, const f64x4 b, const f64x4 c) {
     f64x4 dest;
 #if defined(RM_AVX)
-    _mm256_store_pd(dest.raw, _mm256_set_pd(1, 1, 1, 1));
+    rmm256d_store(dest.raw, rmm256d_fmadd(rmm256d_load(a.raw),
+                                          rmm256d_load(b.raw),
+                                          rmm256d_load(c.raw)));
 #else
-    dest = rm_f64x4s(1);
+    dest = rm_add_f64x4(rm_mul_f64x4(a, b), c);
 #endif
     return dest;
 }
-RM_INLINE u8
-rm_dot_u8x2(const u8x2 a, const u8x2 b) {
-    return a.x * b.x + a.y * b.y;
+RM_INLINE u8x2
+rm_fmas_u8x2(const u8x2 a, const u8x2 b, const u8 c) {
+    return rm_adds_u8x2(rm_mul_u8x2(a, b), c);
 }
-RM_INLINE u8
-rm_dot_u8x3(const u8x3 a, const u8x3 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z;
+RM_INLINE u8x3
+rm_fmas_u8x3(const u8x3 a, const u8x3 b, const u8 c) {
+    return rm_adds_u8x3(rm_mul_u8x3(a, b), c);
 }
-RM_INLINE u8
-rm_dot_u8x4(const u8x4 a, const u8x4 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+RM_INLINE u8x4
+rm_fmas_u8x4(const u8x4 a, const u8x4 b, const u8 c) {
+    return rm_adds_u8x4(rm_mul_u8x4(a, b), c);
 }
-RM_INLINE u16
-rm_dot_u16x2(const u16x2 a, const u16x2 b) {
-    return a.x * b.x + a.y * b.y;
+RM_INLINE u16x2
+rm_fmas_u16x2(const u16x2 a, const u16x2 b, const u16 c) {
+    return rm_adds_u16x2(rm_mul_u16x2(a, b), c);
 }
-RM_INLINE u16
-rm_dot_u16x3(const u16x3 a, const u16x3 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z;
+RM_INLINE u16x3
+rm_fmas_u16x3(const u16x3 a, const u16x3 b, const u16 c) {
+    return rm_adds_u16x3(rm_mul_u16x3(a, b), c);
 }
-RM_INLINE u16
-rm_dot_u16x4(const u16x4 a, const u16x4 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+RM_INLINE u16x4
+rm_fmas_u16x4(const u16x4 a, const u16x4 b, const u16 c) {
+    return rm_adds_u16x4(rm_mul_u16x4(a, b), c);
 }
-RM_INLINE u32
-rm_dot_u32x2(const u32x2 a, const u32x2 b) {
-    return a.x * b.x + a.y * b.y;
+RM_INLINE u32x2
+rm_fmas_u32x2(const u32x2 a, const u32x2 b, const u32 c) {
+    return rm_adds_u32x2(rm_mul_u32x2(a, b), c);
 }
-RM_INLINE u32
-rm_dot_u32x3(const u32x3 a, const u32x3 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z;
+RM_INLINE u32x3
+rm_fmas_u32x3(const u32x3 a, const u32x3 b, const u32 c) {
+    return rm_adds_u32x3(rm_mul_u32x3(a, b), c);
 }
-RM_INLINE u32
-rm_dot_u32x4(const u32x4 a, const u32x4 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+RM_INLINE u32x4
+rm_fmas_u32x4(const u32x4 a, const u32x4 b, const u32 c) {
+    return rm_adds_u32x4(rm_mul_u32x4(a, b), c);
 }
-RM_INLINE u64
-rm_dot_u64x2(const u64x2 a, const u64x2 b) {
-    return a.x * b.x + a.y * b.y;
+RM_INLINE u64x2
+rm_fmas_u64x2(const u64x2 a, const u64x2 b, const u64 c) {
+    return rm_adds_u64x2(rm_mul_u64x2(a, b), c);
 }
-RM_INLINE u64
-rm_dot_u64x3(const u64x3 a, const u64x3 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z;
+RM_INLINE u64x3
+rm_fmas_u64x3(const u64x3 a, const u64x3 b, const u64 c) {
+    return rm_adds_u64x3(rm_mul_u64x3(a, b), c);
 }
-RM_INLINE u64
-rm_dot_u64x4(const u64x4 a, const u64x4 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+RM_INLINE u64x4
+rm_fmas_u64x4(const u64x4 a, const u64x4 b, const u64 c) {
+    return rm_adds_u64x4(rm_mul_u64x4(a, b), c);
 }
-RM_INLINE i8
-rm_dot_i8x2(const i8x2 a, const i8x2 b) {
-    return a.x * b.x + a.y * b.y;
+RM_INLINE i8x2
+rm_fmas_i8x2(const i8x2 a, const i8x2 b, const i8 c) {
+    return rm_adds_i8x2(rm_mul_i8x2(a, b), c);
 }
-RM_INLINE i8
-rm_dot_i8x3(const i8x3 a, const i8x3 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z;
+RM_INLINE i8x3
+rm_fmas_i8x3(const i8x3 a, const i8x3 b, const i8 c) {
+    return rm_adds_i8x3(rm_mul_i8x3(a, b), c);
 }
-RM_INLINE i8
-rm_dot_i8x4(const i8x4 a, const i8x4 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+RM_INLINE i8x4
+rm_fmas_i8x4(const i8x4 a, const i8x4 b, const i8 c) {
+    return rm_adds_i8x4(rm_mul_i8x4(a, b), c);
 }
-RM_INLINE i16
-rm_dot_i16x2(const i16x2 a, const i16x2 b) {
-    return a.x * b.x + a.y * b.y;
+RM_INLINE i16x2
+rm_fmas_i16x2(const i16x2 a, const i16x2 b, const i16 c) {
+    return rm_adds_i16x2(rm_mul_i16x2(a, b), c);
 }
-RM_INLINE i16
-rm_dot_i16x3(const i16x3 a, const i16x3 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z;
+RM_INLINE i16x3
+rm_fmas_i16x3(const i16x3 a, const i16x3 b, const i16 c) {
+    return rm_adds_i16x3(rm_mul_i16x3(a, b), c);
 }
-RM_INLINE i16
-rm_dot_i16x4(const i16x4 a, const i16x4 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+RM_INLINE i16x4
+rm_fmas_i16x4(const i16x4 a, const i16x4 b, const i16 c) {
+    return rm_adds_i16x4(rm_mul_i16x4(a, b), c);
 }
-RM_INLINE i32
-rm_dot_i32x2(const i32x2 a, const i32x2 b) {
-    return a.x * b.x + a.y * b.y;
+RM_INLINE i32x2
+rm_fmas_i32x2(const i32x2 a, const i32x2 b, const i32 c) {
+    return rm_adds_i32x2(rm_mul_i32x2(a, b), c);
 }
-RM_INLINE i32
-rm_dot_i32x3(const i32x3 a, const i32x3 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z;
+RM_INLINE i32x3
+rm_fmas_i32x3(const i32x3 a, const i32x3 b, const i32 c) {
+    return rm_adds_i32x3(rm_mul_i32x3(a, b), c);
 }
-RM_INLINE i32
-rm_dot_i32x4(const i32x4 a, const i32x4 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+RM_INLINE i32x4
+rm_fmas_i32x4(const i32x4 a, const i32x4 b, const i32 c) {
+    return rm_adds_i32x4(rm_mul_i32x4(a, b), c);
 }
-RM_INLINE i64
-rm_dot_i64x2(const i64x2 a, const i64x2 b) {
-    return a.x * b.x + a.y * b.y;
+RM_INLINE i64x2
+rm_fmas_i64x2(const i64x2 a, const i64x2 b, const i64 c) {
+    return rm_adds_i64x2(rm_mul_i64x2(a, b), c);
 }
-RM_INLINE i64
-rm_dot_i64x3(const i64x3 a, const i64x3 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z;
+RM_INLINE i64x3
+rm_fmas_i64x3(const i64x3 a, const i64x3 b, const i64 c) {
+    return rm_adds_i64x3(rm_mul_i64x3(a, b), c);
 }
-RM_INLINE i64
-rm_dot_i64x4(const i64x4 a, const i64x4 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+RM_INLINE i64x4
+rm_fmas_i64x4(const i64x4 a, const i64x4 b, const i64 c) {
+    return rm_adds_i64x4(rm_mul_i64x4(a, b), c);
 }
-RM_INLINE f32
-rm_dot_f32x2(const f32x2 a, const f32x2 b) {
-    return a.x * b.x + a.y * b.y;
+RM_INLINE f32x2
+rm_fmas_f32x2(const f32x2 a, const f32x2 b, const f32 c) {
+    return rm_adds_f32x2(rm_mul_f32x2(a, b), c);
 }
-RM_INLINE f32
-rm_dot_f32x3(const f32x3 a, const f32x3 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z;
+RM_INLINE f32x3
+rm_fmas_f32x3(const f32x3 a, const f32x3 b, const f32 c) {
+    return rm_adds_f32x3(rm_mul_f32x3(a, b), c);
 }
-RM_INLINE f32
-rm_dot_f32x4(const f32x4 a, const f32x4 b) {
-#if defined(RM_SSE)
-    return rmm_dot(rmm_load(a.raw), rmm_load(b.raw));
-#else
-    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
-#endif
+RM_INLINE f32x4
+rm_fmas_f32x4(const f32x4 a, const f32x4 b, const f32 c) {
+    return rm_adds_f32x4(rm_mul_f32x4(a, b), c);
 }
-RM_INLINE f64
-rm_dot_f64x2(const f64x2 a, const f64x2 b) {
-    return a.x * b.x + a.y * b.y;
+RM_INLINE f64x2
+rm_fmas_f64x2(const f64x2 a, const f64x2 b, const f64 c) {
+    return rm_adds_f64x2(rm_mul_f64x2(a, b), c);
 }
-RM_INLINE f64
-rm_dot_f64x3(const f64x3 a, const f64x3 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z;
+RM_INLINE f64x3
+rm_fmas_f64x3(const f64x3 a, const f64x3 b, const f64 c) {
+    return rm_adds_f64x3(rm_mul_f64x3(a, b), c);
 }
-RM_INLINE f64
-rm_dot_f64x4(const f64x4 a, const f64x4 b) {
-    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+RM_INLINE f64x4
+rm_fmas_f64x4(const f64x4 a, const f64x4 b, const f64 c) {
+    return rm_adds_f64x4(rm_mul_f64x4(a, b), c);
 }
-RM_INLINE u8
-rm_norm2_u8x2(const u8x2 v) {
-    return rm_dot_u8x2(v, v);
+RM_INLINE u8x2
+rm_fmass_u8x2(const u8x2 a, const u8 b, const u8 c) {
+    return rm_adds_u8x2(rm_muls_u8x2(a, b), c);
 }
-RM_INLINE u8
-rm_norm2_u8x3(const u8x3 v) {
-    return rm_dot_u8x3(v, v);
+RM_INLINE u8x3
+rm_fmass_u8x3(const u8x3 a, const u8 b, const u8 c) {
+    return rm_adds_u8x3(rm_muls_u8x3(a, b), c);
 }
-RM_INLINE u8
-rm_norm2_u8x4(const u8x4 v) {
-    return rm_dot_u8x4(v, v);
+RM_INLINE u8x4
+rm_fmass_u8x4(const u8x4 a, const u8 b, const u8 c) {
+    return rm_adds_u8x4(rm_muls_u8x4(a, b), c);
 }
-RM_INLINE u16
-rm_norm2_u16x2(const u16x2 v) {
-    return rm_dot_u16x2(v, v);
+RM_INLINE u16x2
+rm_fmass_u16x2(const u16x2 a, const u16 b, const u16 c) {
+    return rm_adds_u16x2(rm_muls_u16x2(a, b), c);
 }
-RM_INLINE u16
-rm_norm2_u16x3(const u16x3 v) {
-    return rm_dot_u16x3(v, v);
+RM_INLINE u16x3
+rm_fmass_u16x3(const u16x3 a, const u16 b, const u16 c) {
+    return rm_adds_u16x3(rm_muls_u16x3(a, b), c);
 }
-RM_INLINE u16
-rm_norm2_u16x4(const u16x4 v) {
-    return rm_dot_u16x4(v, v);
+RM_INLINE u16x4
+rm_fmass_u16x4(const u16x4 a, const u16 b, const u16 c) {
+    return rm_adds_u16x4(rm_muls_u16x4(a, b), c);
 }
-RM_INLINE u32
-rm_norm2_u32x2(const u32x2 v) {
-    return rm_dot_u32x2(v, v);
+RM_INLINE u32x2
+rm_fmass_u32x2(const u32x2 a, const u32 b, const u32 c) {
+    return rm_adds_u32x2(rm_muls_u32x2(a, b), c);
 }
-RM_INLINE u32
-rm_norm2_u32x3(const u32x3 v) {
-    return rm_dot_u32x3(v, v);
+RM_INLINE u32x3
+rm_fmass_u32x3(const u32x3 a, const u32 b, const u32 c) {
+    return rm_adds_u32x3(rm_muls_u32x3(a, b), c);
 }
-RM_INLINE u32
-rm_norm2_u32x4(const u32x4 v) {
-    return rm_dot_u32x4(v, v);
+RM_INLINE u32x4
+rm_fmass_u32x4(const u32x4 a, const u32 b, const u32 c) {
+    return rm_adds_u32x4(rm_muls_u32x4(a, b), c);
 }
-RM_INLINE u64
-rm_norm2_u64x2(const u64x2 v) {
-    return rm_dot_u64x2(v, v);
+RM_INLINE u64x2
+rm_fmass_u64x2(const u64x2 a, const u64 b, const u64 c) {
+    return rm_adds_u64x2(rm_muls_u64x2(a, b), c);
 }
-RM_INLINE u64
-rm_norm2_u64x3(const u64x3 v) {
-    return rm_dot_u64x3(v, v);
+RM_INLINE u64x3
+rm_fmass_u64x3(const u64x3 a, const u64 b, const u64 c) {
+    return rm_adds_u64x3(rm_muls_u64x3(a, b), c);
 }
-RM_INLINE u64
-rm_norm2_u64x4(const u64x4 v) {
-    return rm_dot_u64x4(v, v);
+RM_INLINE u64x4
+rm_fmass_u64x4(const u64x4 a, const u64 b, const u64 c) {
+    return rm_adds_u64x4(rm_muls_u64x4(a, b), c);
 }
-RM_INLINE i8
-rm_norm2_i8x2(const i8x2 v) {
-    return rm_dot_i8x2(v, v);
+RM_INLINE i8x2
+rm_fmass_i8x2(const i8x2 a, const i8 b, const i8 c) {
+    return rm_adds_i8x2(rm_muls_i8x2(a, b), c);
 }
-RM_INLINE i8
-rm_norm2_i8x3(const i8x3 v) {
-    return rm_dot_i8x3(v, v);
+RM_INLINE i8x3
+rm_fmass_i8x3(const i8x3 a, const i8 b, const i8 c) {
+    return rm_adds_i8x3(rm_muls_i8x3(a, b), c);
 }
-RM_INLINE i8
-rm_norm2_i8x4(const i8x4 v) {
-    return rm_dot_i8x4(v, v);
+RM_INLINE i8x4
+rm_fmass_i8x4(const i8x4 a, const i8 b, const i8 c) {
+    return rm_adds_i8x4(rm_muls_i8x4(a, b), c);
 }
-RM_INLINE i16
-rm_norm2_i16x2(const i16x2 v) {
-    return rm_dot_i16x2(v, v);
+RM_INLINE i16x2
+rm_fmass_i16x2(const i16x2 a, const i16 b, const i16 c) {
+    return rm_adds_i16x2(rm_muls_i16x2(a, b), c);
 }
-RM_INLINE i16
-rm_norm2_i16x3(const i16x3 v) {
-    return rm_dot_i16x3(v, v);
+RM_INLINE i16x3
+rm_fmass_i16x3(const i16x3 a, const i16 b, const i16 c) {
+    return rm_adds_i16x3(rm_muls_i16x3(a, b), c);
 }
-RM_INLINE i16
-rm_norm2_i16x4(const i16x4 v) {
-    return rm_dot_i16x4(v, v);
+RM_INLINE i16x4
+rm_fmass_i16x4(const i16x4 a, const i16 b, const i16 c) {
+    return rm_adds_i16x4(rm_muls_i16x4(a, b), c);
 }
-RM_INLINE i32
-rm_norm2_i32x2(const i32x2 v) {
-    return rm_dot_i32x2(v, v);
+RM_INLINE i32x2
+rm_fmass_i32x2(const i32x2 a, const i32 b, const i32 c) {
+    return rm_adds_i32x2(rm_muls_i32x2(a, b), c);
 }
-RM_INLINE i32
-rm_norm2_i32x3(const i32x3 v) {
-    return rm_dot_i32x3(v, v);
+RM_INLINE i32x3
+rm_fmass_i32x3(const i32x3 a, const i32 b, const i32 c) {
+    return rm_adds_i32x3(rm_muls_i32x3(a, b), c);
 }
-RM_INLINE i32
-rm_norm2_i32x4(const i32x4 v) {
-    return rm_dot_i32x4(v, v);
+RM_INLINE i32x4
+rm_fmass_i32x4(const i32x4 a, const i32 b, const i32 c) {
+    return rm_adds_i32x4(rm_muls_i32x4(a, b), c);
 }
-RM_INLINE i64
-rm_norm2_i64x2(const i64x2 v) {
-    return rm_dot_i64x2(v, v);
+RM_INLINE i64x2
+rm_fmass_i64x2(const i64x2 a, const i64 b, const i64 c) {
+    return rm_adds_i64x2(rm_muls_i64x2(a, b), c);
 }
-RM_INLINE i64
-rm_norm2_i64x3(const i64x3 v) {
-    return rm_dot_i64x3(v, v);
+RM_INLINE i64x3
+rm_fmass_i64x3(const i64x3 a, const i64 b, const i64 c) {
+    return rm_adds_i64x3(rm_muls_i64x3(a, b), c);
 }
-RM_INLINE i64
-rm_norm2_i64x4(const i64x4 v) {
-    return rm_dot_i64x4(v, v);
+RM_INLINE i64x4
+rm_fmass_i64x4(const i64x4 a, const i64 b, const i64 c) {
+    return rm_adds_i64x4(rm_muls_i64x4(a, b), c);
 }
-RM_INLINE f32
-rm_norm2_f32x2(const f32x2 v) {
-    return rm_dot_f32x2(v, v);
+RM_INLINE f32x2
+rm_fmass_f32x2(const f32x2 a, const f32 b, const f32 c) {
+    return rm_adds_f32x2(rm_muls_f32x2(a, b), c);
 }
-RM_INLINE f32
-rm_norm2_f32x3(const f32x3 v) {
-    return rm_dot_f32x3(v, v);
+RM_INLINE f32x3
+rm_fmass_f32x3(const f32x3 a, const f32 b, const f32 c) {
+    return rm_adds_f32x3(rm_muls_f32x3(a, b), c);
 }
-RM_INLINE f32
-rm_norm2_f32x4(const f32x4 v) {
-    return rm_dot_f32x4(v, v);
+RM_INLINE f32x4
+rm_fmass_f32x4(const f32x4 a, const f32 b, const f32 c) {
+    return rm_adds_f32x4(rm_muls_f32x4(a, b), c);
 }
-RM_INLINE f64
-rm_norm2_f64x2(const f64x2 v) {
-    return rm_dot_f64x2(v, v);
+RM_INLINE f64x2
+rm_fmass_f64x2(const f64x2 a, const f64 b, const f64 c) {
+    return rm_adds_f64x2(rm_muls_f64x2(a, b), c);
 }
-RM_INLINE f64
-rm_norm2_f64x3(const f64x3 v) {
-    return rm_dot_f64x3(v, v);
+RM_INLINE f64x3
+rm_fmass_f64x3(const f64x3 a, const f64 b, const f64 c) {
+    return rm_adds_f64x3(rm_muls_f64x3(a, b), c);
 }
-RM_INLINE f64
-rm_norm2_f64x4(const f64x4 v) {
-    return rm_dot_f64x4(v, v);
+RM_INLINE f64x4
+rm_fmass_f64x4(const f64x4 a, const f64 b, const f64 c) {
+    return rm_adds_f64x4(rm_muls_f64x4(a, b), c);
 }
-RM_INLINE f32
-rm_norm_u8x2(const u8x2 v) {
-    return rm_sqrt_f32(rm_norm2_u8x2(v));
+RM_INLINE f32x2
+rm_floor_f32x2(const f32x2 v) {
+    return rm_f32x2(rm_floor_f32(v.x), rm_floor_f32(v.y));
 }
-RM_INLINE f32
-rm_norm_u8x3(const u8x3 v) {
-    return rm_sqrt_f32(rm_norm2_u8x3(v));
+RM_INLINE f32x3
+rm_floor_f32x3(const f32x3 v) {
+    return rm_f32x3(rm_floor_f32(v.x), rm_floor_f32(v.y), rm_floor_f32(v.z));
 }
-RM_INLINE f32
-rm_norm_u8x4(const u8x4 v) {
-    return rm_sqrt_f32(rm_norm2_u8x4(v));
+RM_INLINE f32x4
+rm_floor_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_floor(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_floor_f32(v.x), rm_floor_f32(v.y), rm_floor_f32(v.z),
+                    rm_floor_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE f32
-rm_norm_u16x2(const u16x2 v) {
-    return rm_sqrt_f32(rm_norm2_u16x2(v));
+RM_INLINE f64x2
+rm_floor_f64x2(const f64x2 v) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, rmmd_floor(rmmd_load(v.raw)));
+#else
+    dest = rm_f64x2(rm_floor_f64(v.x), rm_floor_f64(v.y));
+#endif
+    return dest;
 }
-RM_INLINE f32
-rm_norm_u16x3(const u16x3 v) {
-    return rm_sqrt_f32(rm_norm2_u16x3(v));
+RM_INLINE f64x3
+rm_floor_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_floor_f64(v.x), rm_floor_f64(v.y), rm_floor_f64(v.z));
 }
-RM_INLINE f32
-rm_norm_u16x4(const u16x4 v) {
-    return rm_sqrt_f32(rm_norm2_u16x4(v));
+RM_INLINE f64x4
+rm_floor_f64x4(const f64x4 v) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, rmm256d_floor(rmm256d_load(v.raw)));
+#else
+    dest = rm_f64x4(rm_floor_f64(v.x), rm_floor_f64(v.y), rm_floor_f64(v.z),
+                    rm_floor_f64(v.w));
+#endif
+    return dest;
 }
-RM_INLINE f32
-rm_norm_u32x2(const u32x2 v) {
-    return rm_sqrt_f32(rm_norm2_u32x2(v));
+RM_INLINE f32x2
+rm_ceil_f32x2(const f32x2 v) {
+    return rm_f32x2(rm_ceil_f32(v.x), rm_ceil_f32(v.y));
 }
-RM_INLINE f32
-rm_norm_u32x3(const u32x3 v) {
-    return rm_sqrt_f32(rm_norm2_u32x3(v));
+RM_INLINE f32x3
+rm_ceil_f32x3(const f32x3 v) {
+    return rm_f32x3(rm_ceil_f32(v.x), rm_ceil_f32(v.y), rm_ceil_f32(v.z));
 }
-RM_INLINE f32
-rm_norm_u32x4(const u32x4 v) {
-    return rm_sqrt_f32(rm_norm2_u32x4(v));
+RM_INLINE f32x4
+rm_ceil_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_ceil(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_ceil_f32(v.x), rm_ceil_f32(v.y), rm_ceil_f32(v.z),
+                    rm_ceil_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE f64
-rm_norm_u64x2(const u64x2 v) {
-    return rm_sqrt_f64(rm_norm2_u64x2(v));
+RM_INLINE f64x2
+rm_ceil_f64x2(const f64x2 v) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, rmmd_ceil(rmmd_load(v.raw)));
+#else
+    dest = rm_f64x2(rm_ceil_f64(v.x), rm_ceil_f64(v.y));
+#endif
+    return dest;
 }
-RM_INLINE f64
-rm_norm_u64x3(const u64x3 v) {
-    return rm_sqrt_f64(rm_norm2_u64x3(v));
+RM_INLINE f64x3
+rm_ceil_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_ceil_f64(v.x), rm_ceil_f64(v.y), rm_ceil_f64(v.z));
 }
-RM_INLINE f64
-rm_norm_u64x4(const u64x4 v) {
-    return rm_sqrt_f64(rm_norm2_u64x4(v));
+RM_INLINE f64x4
+rm_ceil_f64x4(const f64x4 v) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, rmm256d_ceil(rmm256d_load(v.raw)));
+#else
+    dest = rm_f64x4(rm_ceil_f64(v.x), rm_ceil_f64(v.y), rm_ceil_f64(v.z),
+                    rm_ceil_f64(v.w));
+#endif
+    return dest;
 }
-RM_INLINE f32
-rm_norm_i8x2(const i8x2 v) {
-    return rm_sqrt_f32(rm_norm2_i8x2(v));
+RM_INLINE f32x2
+rm_round_f32x2(const f32x2 v) {
+    return rm_f32x2(rm_round_f32(v.x), rm_round_f32(v.y));
 }
-RM_INLINE f32
-rm_norm_i8x3(const i8x3 v) {
-    return rm_sqrt_f32(rm_norm2_i8x3(v));
+RM_INLINE f32x3
+rm_round_f32x3(const f32x3 v) {
+    return rm_f32x3(rm_round_f32(v.x), rm_round_f32(v.y), rm_round_f32(v.z));
 }
-RM_INLINE f32
-rm_norm_i8x4(const i8x4 v) {
-    return rm_sqrt_f32(rm_norm2_i8x4(v));
+RM_INLINE f32x4
+rm_round_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_round(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_round_f32(v.x), rm_round_f32(v.y), rm_round_f32(v.z),
+                    rm_round_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE f32
-rm_norm_i16x2(const i16x2 v) {
-    return rm_sqrt_f32(rm_norm2_i16x2(v));
+RM_INLINE f64x2
+rm_round_f64x2(const f64x2 v) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, rmmd_round(rmmd_load(v.raw)));
+#else
+    dest = rm_f64x2(rm_round_f64(v.x), rm_round_f64(v.y));
+#endif
+    return dest;
 }
-RM_INLINE f32
-rm_norm_i16x3(const i16x3 v) {
-    return rm_sqrt_f32(rm_norm2_i16x3(v));
+RM_INLINE f64x3
+rm_round_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_round_f64(v.x), rm_round_f64(v.y), rm_round_f64(v.z));
 }
-RM_INLINE f32
-rm_norm_i16x4(const i16x4 v) {
-    return rm_sqrt_f32(rm_norm2_i16x4(v));
+RM_INLINE f64x4
+rm_round_f64x4(const f64x4 v) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, rmm256d_round(rmm256d_load(v.raw)));
+#else
+    dest = rm_f64x4(rm_round_f64(v.x), rm_round_f64(v.y), rm_round_f64(v.z),
+                    rm_round_f64(v.w));
+#endif
+    return dest;
 }
-RM_INLINE f32
-rm_norm_i32x2(const i32x2 v) {
-    return rm_sqrt_f32(rm_norm2_i32x2(v));
+RM_INLINE f32x2
+rm_trunc_f32x2(const f32x2 v) {
+    return rm_f32x2(rm_trunc_f32(v.x), rm_trunc_f32(v.y));
 }
-RM_INLINE f32
-rm_norm_i32x3(const i32x3 v) {
-    return rm_sqrt_f32(rm_norm2_i32x3(v));
+RM_INLINE f32x3
+rm_trunc_f32x3(const f32x3 v) {
+    return rm_f32x3(rm_trunc_f32(v.x), rm_trunc_f32(v.y), rm_trunc_f32(v.z));
 }
-RM_INLINE f32
-rm_norm_i32x4(const i32x4 v) {
-    return rm_sqrt_f32(rm_norm2_i32x4(v));
+RM_INLINE f32x4
+rm_trunc_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_trunc(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_trunc_f32(v.x), rm_trunc_f32(v.y), rm_trunc_f32(v.z),
+                    rm_trunc_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE f64
-rm_norm_i64x2(const i64x2 v) {
-    return rm_sqrt_f64(rm_norm2_i64x2(v));
+RM_INLINE f64x2
+rm_trunc_f64x2(const f64x2 v) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, rmmd_trunc(rmmd_load(v.raw)));
+#else
+    dest = rm_f64x2(rm_trunc_f64(v.x), rm_trunc_f64(v.y));
+#endif
+    return dest;
 }
-RM_INLINE f64
-rm_norm_i64x3(const i64x3 v) {
-    return rm_sqrt_f64(rm_norm2_i64x3(v));
+RM_INLINE f64x3
+rm_trunc_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_trunc_f64(v.x), rm_trunc_f64(v.y), rm_trunc_f64(v.z));
 }
-RM_INLINE f64
-rm_norm_i64x4(const i64x4 v) {
-    return rm_sqrt_f64(rm_norm2_i64x4(v));
+RM_INLINE f64x4
+rm_trunc_f64x4(const f64x4 v) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, rmm256d_trunc(rmm256d_load(v.raw)));
+#else
+    dest = rm_f64x4(rm_trunc_f64(v.x), rm_trunc_f64(v.y), rm_trunc_f64(v.z),
+                    rm_trunc_f64(v.w));
+#endif
+    return dest;
 }
-RM_INLINE f32
-rm_norm_f32x2(const f32x2 v) {
-    return rm_sqrt_f32(rm_norm2_f32x2(v));
+RM_INLINE f32x2
+rm_fract_f32x2(const f32x2 v) {
+    return rm_f32x2(rm_fract_f32(v.x), rm_fract_f32(v.y));
 }
-RM_INLINE f32
-rm_norm_f32x3(const f32x3 v) {
-    return rm_sqrt_f32(rm_norm2_f32x3(v));
+RM_INLINE f32x3
+rm_fract_f32x3(const f32x3 v) {
+    return rm_f32x3(rm_fract_f32(v.x), rm_fract_f32(v.y), rm_fract_f32(v.z));
 }
-RM_INLINE f32
-rm_norm_f32x4(const f32x4 v) {
-#if defined(RM_SSE)
-    return rmm_norm(rmm_load(v.raw));
+RM_INLINE f32x4
+rm_fract_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmv_f32x4 x;
+
+    x = rmm_load(v.raw);
+    rmm_store(dest.raw, rmm_sub(x, rmm_floor(x)));
 #else
-    return rm_sqrt_f32(rm_norm2_f32x4(v));
+    dest = rm_f32x4(rm_fract_f32(v.x), rm_fract_f32(v.y), rm_fract_f32(v.z),
+                    rm_fract_f32(v.w));
 #endif
+    return dest;
 }
-RM_INLINE f64
-rm_norm_f64x2(const f64x2 v) {
-    return rm_sqrt_f64(rm_norm2_f64x2(v));
+RM_INLINE f64x2
+rm_fract_f64x2(const f64x2 v) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    __m128d x;
+
+    x = rmmd_load(v.raw);
+    rmmd_store(dest.raw, _mm_sub_pd(x, rmmd_floor(x)));
+#else
+    dest = rm_f64x2(rm_fract_f64(v.x), rm_fract_f64(v.y));
+#endif
+    return dest;
 }
-RM_INLINE f64
-rm_norm_f64x3(const f64x3 v) {
-    return rm_sqrt_f64(rm_norm2_f64x3(v));
+RM_INLINE f64x3
+rm_fract_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_fract_f64(v.x), rm_fract_f64(v.y), rm_fract_f64(v.z));
 }
-RM_INLINE f64
-rm_norm_f64x4(const f64x4 v) {
-    return rm_sqrt_f64(rm_norm2_f64x4(v));
+RM_INLINE f64x4
+rm_fract_f64x4(const f64x4 v) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    __m256d x;
+
+    x = rmm256d_load(v.raw);
+    rmm256d_store(dest.raw, _mm256_sub_pd(x, rmm256d_floor(x)));
+#else
+    dest = rm_f64x4(rm_fract_f64(v.x), rm_fract_f64(v.y), rm_fract_f64(v.z),
+                    rm_fract_f64(v.w));
+#endif
+    return dest;
 }
-RM_INLINE u8
-rm_norm_one_u8x2(const u8x2 v) {
-    return rm_hadd_u8x2(v);
-}
-RM_INLINE u8
-rm_norm_one_u8x3(const u8x3 v) {
-    return rm_hadd_u8x3(v);
+RM_INLINE f32x2
+rm_rsqrt_fast_f32x2(const f32x2 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_rsqrt(rmm_setr(v.x, v.y, 1, 1)));
+    return dest.xy;
+#else
+    return rm_f32x2(rm_rsqrt_fast_f32(v.x), rm_rsqrt_fast_f32(v.y));
+#endif
 }
-RM_INLINE u8
-rm_norm_one_u8x4(const u8x4 v) {
-    return rm_hadd_u8x4(v);
+RM_INLINE f32x3
+rm_rsqrt_fast_f32x3(const f32x3 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_rsqrt(rmm_setr(v.x, v.y, v.z, 1)));
+    return dest.xyz;
+#else
+    return rm_f32x3(rm_rsqrt_fast_f32(v.x), rm_rsqrt_fast_f32(v.y),
+                    rm_rsqrt_fast_f32(v.z));
+#endif
 }
-RM_INLINE u16
-rm_norm_one_u16x2(const u16x2 v) {
-    return rm_hadd_u16x2(v);
+RM_INLINE f32x4
+rm_rsqrt_fast_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_rsqrt(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_rsqrt_fast_f32(v.x), rm_rsqrt_fast_f32(v.y),
+                    rm_rsqrt_fast_f32(v.z), rm_rsqrt_fast_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE u16
-rm_norm_one_u16x3(const u16x3 v) {
-    return rm_hadd_u16x3(v);
+RM_INLINE f32x2
+rm_rsqrt_f32x2(const f32x2 v) {
+    return rm_f32x2(rm_rsqrt_f32(v.x), rm_rsqrt_f32(v.y));
 }
-RM_INLINE u16
-rm_norm_one_u16x4(const u16x4 v) {
-    return rm_hadd_u16x4(v);
+RM_INLINE f32x3
+rm_rsqrt_f32x3(const f32x3 v) {
+    return rm_f32x3(rm_rsqrt_f32(v.x), rm_rsqrt_f32(v.y), rm_rsqrt_f32(v.z));
 }
-RM_INLINE u32
-rm_norm_one_u32x2(const u32x2 v) {
-    return rm_hadd_u32x2(v);
+RM_INLINE f32x4
+rm_rsqrt_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_FAST_RSQRT) && defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_rsqrt(rmm_load(v.raw)));
+#elif defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_div(rmm_set1(1.0f), rmm_sqrt(rmm_load(v.raw))));
+#else
+    dest = rm_f32x4(rm_rsqrt_f32(v.x), rm_rsqrt_f32(v.y), rm_rsqrt_f32(v.z),
+                    rm_rsqrt_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE u32
-rm_norm_one_u32x3(const u32x3 v) {
-    return rm_hadd_u32x3(v);
+RM_INLINE f64x2
+rm_rsqrt_f64x2(const f64x2 v) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, _mm_div_pd(_mm_set1_pd(1.0),
+                                    _mm_sqrt_pd(rmmd_load(v.raw))));
+#else
+    dest = rm_f64x2(rm_rsqrt_f64(v.x), rm_rsqrt_f64(v.y));
+#endif
+    return dest;
 }
-RM_INLINE u32
-rm_norm_one_u32x4(const u32x4 v) {
-    return rm_hadd_u32x4(v);
+RM_INLINE f64x3
+rm_rsqrt_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_rsqrt_f64(v.x), rm_rsqrt_f64(v.y), rm_rsqrt_f64(v.z));
 }
-RM_INLINE u64
-rm_norm_one_u64x2(const u64x2 v) {
-    return rm_hadd_u64x2(v);
+RM_INLINE f64x4
+rm_rsqrt_f64x4(const f64x4 v) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw,
+                  _mm256_div_pd(_mm256_set1_pd(1.0),
+                                _mm256_sqrt_pd(rmm256d_load(v.raw))));
+#else
+    dest = rm_f64x4(rm_rsqrt_f64(v.x), rm_rsqrt_f64(v.y), rm_rsqrt_f64(v.z),
+                    rm_rsqrt_f64(v.w));
+#endif
+    return dest;
 }
-RM_INLINE u64
-rm_norm_one_u64x3(const u64x3 v) {
-    return rm_hadd_u64x3(v);
+RM_INLINE f64x2
+rm_rsqrt_fast_f64x2(const f64x2 v) {
+    return rm_rsqrt_f64x2(v);
 }
-RM_INLINE u64
-rm_norm_one_u64x4(const u64x4 v) {
-    return rm_hadd_u64x4(v);
+RM_INLINE f64x3
+rm_rsqrt_fast_f64x3(const f64x3 v) {
+    return rm_rsqrt_f64x3(v);
 }
-RM_INLINE i8
-rm_norm_one_i8x2(const i8x2 v) {
-    return rm_hadd_i8x2(rm_abs_i8x2(v));
+RM_INLINE f64x4
+rm_rsqrt_fast_f64x4(const f64x4 v) {
+    return rm_rsqrt_f64x4(v);
 }
-RM_INLINE i8
-rm_norm_one_i8x3(const i8x3 v) {
-    return rm_hadd_i8x3(rm_abs_i8x3(v));
+/* only good for |x| <= RM_TRIG_MAX, see rm_sin_fast_f32 */
+RM_INLINE f32x2
+rm_sin_fast_f32x2(const f32x2 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_sin_fast(rmm_setr(v.x, v.y, 0, 0)));
+    return dest.xy;
+#else
+    return rm_f32x2(rm_sin_fast_f32(v.x), rm_sin_fast_f32(v.y));
+#endif
 }
-RM_INLINE i8
-rm_norm_one_i8x4(const i8x4 v) {
-    return rm_hadd_i8x4(rm_abs_i8x4(v));
+RM_INLINE f32x3
+rm_sin_fast_f32x3(const f32x3 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_sin_fast(rmm_setr(v.x, v.y, v.z, 0)));
+    return dest.xyz;
+#else
+    return rm_f32x3(rm_sin_fast_f32(v.x), rm_sin_fast_f32(v.y),
+                    rm_sin_fast_f32(v.z));
+#endif
 }
-RM_INLINE i16
-rm_norm_one_i16x2(const i16x2 v) {
-    return rm_hadd_i16x2(rm_abs_i16x2(v));
+RM_INLINE f32x4
+rm_sin_fast_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_sin_fast(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_sin_fast_f32(v.x), rm_sin_fast_f32(v.y),
+                    rm_sin_fast_f32(v.z), rm_sin_fast_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE i16
-rm_norm_one_i16x3(const i16x3 v) {
-    return rm_hadd_i16x3(rm_abs_i16x3(v));
+RM_INLINE f64x2
+rm_sin_fast_f64x2(const f64x2 v) {
+    return rm_f64x2(rm_sin_fast_f64(v.x), rm_sin_fast_f64(v.y));
 }
-RM_INLINE i16
-rm_norm_one_i16x4(const i16x4 v) {
-    return rm_hadd_i16x4(rm_abs_i16x4(v));
+RM_INLINE f64x3
+rm_sin_fast_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_sin_fast_f64(v.x), rm_sin_fast_f64(v.y),
+                    rm_sin_fast_f64(v.z));
 }
-RM_INLINE i32
-rm_norm_one_i32x2(const i32x2 v) {
-    return rm_hadd_i32x2(rm_abs_i32x2(v));
+RM_INLINE f64x4
+rm_sin_fast_f64x4(const f64x4 v) {
+    return rm_f64x4(rm_sin_fast_f64(v.x), rm_sin_fast_f64(v.y),
+                    rm_sin_fast_f64(v.z), rm_sin_fast_f64(v.w));
 }
-RM_INLINE i32
-rm_norm_one_i32x3(const i32x3 v) {
-    return rm_hadd_i32x3(rm_abs_i32x3(v));
+RM_INLINE f32x2
+rm_sin_f32x2(const f32x2 v) {
+#if defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_sin(rmm_setr(v.x, v.y, 0, 0)));
+    return dest.xy;
+#else
+    return rm_f32x2(rm_sin_f32(v.x), rm_sin_f32(v.y));
+#endif
 }
-RM_INLINE i32
-rm_norm_one_i32x4(const i32x4 v) {
-    return rm_hadd_i32x4(rm_abs_i32x4(v));
+RM_INLINE f32x3
+rm_sin_f32x3(const f32x3 v) {
+#if defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_sin(rmm_setr(v.x, v.y, v.z, 0)));
+    return dest.xyz;
+#else
+    return rm_f32x3(rm_sin_f32(v.x), rm_sin_f32(v.y), rm_sin_f32(v.z));
+#endif
 }
-RM_INLINE i64
-rm_norm_one_i64x2(const i64x2 v) {
-    return rm_hadd_i64x2(rm_abs_i64x2(v));
+RM_INLINE f32x4
+rm_sin_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    rmm_store(dest.raw, rmm_sin(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_sin_f32(v.x), rm_sin_f32(v.y), rm_sin_f32(v.z),
+                    rm_sin_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE i64
-rm_norm_one_i64x3(const i64x3 v) {
-    return rm_hadd_i64x3(rm_abs_i64x3(v));
+RM_INLINE f64x2
+rm_sin_f64x2(const f64x2 v) {
+    return rm_f64x2(rm_sin_f64(v.x), rm_sin_f64(v.y));
 }
-RM_INLINE i64
-rm_norm_one_i64x4(const i64x4 v) {
-    return rm_hadd_i64x4(rm_abs_i64x4(v));
+RM_INLINE f64x3
+rm_sin_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_sin_f64(v.x), rm_sin_f64(v.y), rm_sin_f64(v.z));
 }
-RM_INLINE f32
-rm_norm_one_f32x2(const f32x2 v) {
-    return rm_hadd_f32x2(rm_abs_f32x2(v));
+RM_INLINE f64x4
+rm_sin_f64x4(const f64x4 v) {
+    return rm_f64x4(rm_sin_f64(v.x), rm_sin_f64(v.y), rm_sin_f64(v.z),
+                    rm_sin_f64(v.w));
 }
-RM_INLINE f32
-rm_norm_one_f32x3(const f32x3 v) {
-    return rm_hadd_f32x3(rm_abs_f32x3(v));
+RM_INLINE f32x2
+rm_cos_fast_f32x2(const f32x2 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_cos_fast(rmm_setr(v.x, v.y, 0, 0)));
+    return dest.xy;
+#else
+    return rm_f32x2(rm_cos_fast_f32(v.x), rm_cos_fast_f32(v.y));
+#endif
 }
-RM_INLINE f32
-rm_norm_one_f32x4(const f32x4 v) {
-#if defined(RM_SSE)
-    return rmm_norm_inf(rmm_load(v.raw));
+RM_INLINE f32x3
+rm_cos_fast_f32x3(const f32x3 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_cos_fast(rmm_setr(v.x, v.y, v.z, 0)));
+    return dest.xyz;
 #else
-    return rm_hadd_f32x4(rm_abs_f32x4(v));
+    return rm_f32x3(rm_cos_fast_f32(v.x), rm_cos_fast_f32(v.y),
+                    rm_cos_fast_f32(v.z));
 #endif
 }
-RM_INLINE f64
-rm_norm_one_f64x2(const f64x2 v) {
-    return rm_hadd_f64x2(rm_abs_f64x2(v));
+RM_INLINE f32x4
+rm_cos_fast_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_cos_fast(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_cos_fast_f32(v.x), rm_cos_fast_f32(v.y),
+                    rm_cos_fast_f32(v.z), rm_cos_fast_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE f64
-rm_norm_one_f64x3(const f64x3 v) {
-    return rm_hadd_f64x3(rm_abs_f64x3(v));
+RM_INLINE f64x2
+rm_cos_fast_f64x2(const f64x2 v) {
+    return rm_f64x2(rm_cos_fast_f64(v.x), rm_cos_fast_f64(v.y));
 }
-RM_INLINE f64
-rm_norm_one_f64x4(const f64x4 v) {
-    return rm_hadd_f64x4(rm_abs_f64x4(v));
+RM_INLINE f64x3
+rm_cos_fast_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_cos_fast_f64(v.x), rm_cos_fast_f64(v.y),
+                    rm_cos_fast_f64(v.z));
 }
-RM_INLINE u8
-rm_norm_inf_u8x2(const u8x2 v) {
-    return rm_maxv_u8x2(v);
+RM_INLINE f64x4
+rm_cos_fast_f64x4(const f64x4 v) {
+    return rm_f64x4(rm_cos_fast_f64(v.x), rm_cos_fast_f64(v.y),
+                    rm_cos_fast_f64(v.z), rm_cos_fast_f64(v.w));
 }
-RM_INLINE u8
-rm_norm_inf_u8x3(const u8x3 v) {
-    return rm_maxv_u8x3(v);
+RM_INLINE f32x2
+rm_cos_f32x2(const f32x2 v) {
+#if defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_cos(rmm_setr(v.x, v.y, 0, 0)));
+    return dest.xy;
+#else
+    return rm_f32x2(rm_cos_f32(v.x), rm_cos_f32(v.y));
+#endif
 }
-RM_INLINE u8
-rm_norm_inf_u8x4(const u8x4 v) {
-    return rm_maxv_u8x4(v);
+RM_INLINE f32x3
+rm_cos_f32x3(const f32x3 v) {
+#if defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_cos(rmm_setr(v.x, v.y, v.z, 0)));
+    return dest.xyz;
+#else
+    return rm_f32x3(rm_cos_f32(v.x), rm_cos_f32(v.y), rm_cos_f32(v.z));
+#endif
 }
-RM_INLINE u16
-rm_norm_inf_u16x2(const u16x2 v) {
-    return rm_maxv_u16x2(v);
+RM_INLINE f32x4
+rm_cos_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    rmm_store(dest.raw, rmm_cos(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_cos_f32(v.x), rm_cos_f32(v.y), rm_cos_f32(v.z),
+                    rm_cos_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE u16
-rm_norm_inf_u16x3(const u16x3 v) {
-    return rm_maxv_u16x3(v);
+RM_INLINE f64x2
+rm_cos_f64x2(const f64x2 v) {
+    return rm_f64x2(rm_cos_f64(v.x), rm_cos_f64(v.y));
 }
-RM_INLINE u16
-rm_norm_inf_u16x4(const u16x4 v) {
-    return rm_maxv_u16x4(v);
+RM_INLINE f64x3
+rm_cos_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_cos_f64(v.x), rm_cos_f64(v.y), rm_cos_f64(v.z));
 }
-RM_INLINE u32
-rm_norm_inf_u32x2(const u32x2 v) {
-    return rm_maxv_u32x2(v);
+RM_INLINE f64x4
+rm_cos_f64x4(const f64x4 v) {
+    return rm_f64x4(rm_cos_f64(v.x), rm_cos_f64(v.y), rm_cos_f64(v.z),
+                    rm_cos_f64(v.w));
+}
+RM_INLINE void
+rm_sincos_fast_f32x2(const f32x2 v, f32x2 *s, f32x2 *c) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 ts, tc;
+    rmv_f32x4 xs, xc;
+
+    rmm_sincos_fast(rmm_setr(v.x, v.y, 0, 0), &xs, &xc);
+    rmm_store(ts.raw, xs);
+    rmm_store(tc.raw, xc);
+
+    *s = ts.xy;
+    *c = tc.xy;
+#else
+    rm_sincos_fast_f32(v.x, &s->x, &c->x);
+    rm_sincos_fast_f32(v.y, &s->y, &c->y);
+#endif
 }
-RM_INLINE u32
-rm_norm_inf_u32x3(const u32x3 v) {
-    return rm_maxv_u32x3(v);
+RM_INLINE void
+rm_sincos_fast_f32x3(const f32x3 v, f32x3 *s, f32x3 *c) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 ts, tc;
+    rmv_f32x4 xs, xc;
+
+    rmm_sincos_fast(rmm_setr(v.x, v.y, v.z, 0), &xs, &xc);
+    rmm_store(ts.raw, xs);
+    rmm_store(tc.raw, xc);
+
+    *s = ts.xyz;
+    *c = tc.xyz;
+#else
+    rm_sincos_fast_f32(v.x, &s->x, &c->x);
+    rm_sincos_fast_f32(v.y, &s->y, &c->y);
+    rm_sincos_fast_f32(v.z, &s->z, &c->z);
+#endif
 }
-RM_INLINE u32
-rm_norm_inf_u32x4(const u32x4 v) {
-    return rm_maxv_u32x4(v);
+RM_INLINE void
+rm_sincos_fast_f32x4(const f32x4 v, f32x4 *s, f32x4 *c) {
+#if defined(RM_SIMD_F32X4)
+    rmv_f32x4 xs, xc;
+
+    rmm_sincos_fast(rmm_load(v.raw), &xs, &xc);
+    rmm_storeu(s->raw, xs);
+    rmm_storeu(c->raw, xc);
+#else
+    rm_sincos_fast_f32(v.x, &s->x, &c->x);
+    rm_sincos_fast_f32(v.y, &s->y, &c->y);
+    rm_sincos_fast_f32(v.z, &s->z, &c->z);
+    rm_sincos_fast_f32(v.w, &s->w, &c->w);
+#endif
 }
-RM_INLINE u64
-rm_norm_inf_u64x2(const u64x2 v) {
-    return rm_maxv_u64x2(v);
+RM_INLINE void
+rm_sincos_fast_f64x2(const f64x2 v, f64x2 *s, f64x2 *c) {
+    rm_sincos_fast_f64(v.x, &s->x, &c->x);
+    rm_sincos_fast_f64(v.y, &s->y, &c->y);
+}
+RM_INLINE void
+rm_sincos_fast_f64x3(const f64x3 v, f64x3 *s, f64x3 *c) {
+    rm_sincos_fast_f64(v.x, &s->x, &c->x);
+    rm_sincos_fast_f64(v.y, &s->y, &c->y);
+    rm_sincos_fast_f64(v.z, &s->z, &c->z);
+}
+RM_INLINE void
+rm_sincos_fast_f64x4(const f64x4 v, f64x4 *s, f64x4 *c) {
+    rm_sincos_fast_f64(v.x, &s->x, &c->x);
+    rm_sincos_fast_f64(v.y, &s->y, &c->y);
+    rm_sincos_fast_f64(v.z, &s->z, &c->z);
+    rm_sincos_fast_f64(v.w, &s->w, &c->w);
+}
+RM_INLINE void
+rm_sincos_f32x2(const f32x2 v, f32x2 *s, f32x2 *c) {
+#if defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    f32x4 ts, tc;
+    rmv_f32x4 xs, xc;
+
+    rmm_sincos(rmm_setr(v.x, v.y, 0, 0), &xs, &xc);
+    rmm_store(ts.raw, xs);
+    rmm_store(tc.raw, xc);
+
+    *s = ts.xy;
+    *c = tc.xy;
+#else
+    rm_sincos_f32(v.x, &s->x, &c->x);
+    rm_sincos_f32(v.y, &s->y, &c->y);
+#endif
 }
-RM_INLINE u64
-rm_norm_inf_u64x3(const u64x3 v) {
-    return rm_maxv_u64x3(v);
+RM_INLINE void
+rm_sincos_f32x3(const f32x3 v, f32x3 *s, f32x3 *c) {
+#if defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    f32x4 ts, tc;
+    rmv_f32x4 xs, xc;
+
+    rmm_sincos(rmm_setr(v.x, v.y, v.z, 0), &xs, &xc);
+    rmm_store(ts.raw, xs);
+    rmm_store(tc.raw, xc);
+
+    *s = ts.xyz;
+    *c = tc.xyz;
+#else
+    rm_sincos_f32(v.x, &s->x, &c->x);
+    rm_sincos_f32(v.y, &s->y, &c->y);
+    rm_sincos_f32(v.z, &s->z, &c->z);
+#endif
 }
-RM_INLINE u64
-rm_norm_inf_u64x4(const u64x4 v) {
-    return rm_maxv_u64x4(v);
+RM_INLINE void
+rm_sincos_f32x4(const f32x4 v, f32x4 *s, f32x4 *c) {
+#if defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    rmv_f32x4 xs, xc;
+
+    /* s and c can point anywhere so no aligned stores */
+    rmm_sincos(rmm_load(v.raw), &xs, &xc);
+    rmm_storeu(s->raw, xs);
+    rmm_storeu(c->raw, xc);
+#else
+    rm_sincos_f32(v.x, &s->x, &c->x);
+    rm_sincos_f32(v.y, &s->y, &c->y);
+    rm_sincos_f32(v.z, &s->z, &c->z);
+    rm_sincos_f32(v.w, &s->w, &c->w);
+#endif
 }
-RM_INLINE i8
-rm_norm_inf_i8x2(const i8x2 v) {
-    return rm_maxv_i8x2(rm_abs_i8x2(v));
-}
-RM_INLINE i8
-rm_norm_inf_i8x3(const i8x3 v) {
-    return rm_maxv_i8x3(rm_abs_i8x3(v));
-}
-RM_INLINE i8
-rm_norm_inf_i8x4(const i8x4 v) {
-    return rm_maxv_i8x4(rm_abs_i8x4(v));
-}
-RM_INLINE i16
-rm_norm_inf_i16x2(const i16x2 v) {
-    return rm_maxv_i16x2(rm_abs_i16x2(v));
+RM_INLINE void
+rm_sincos_f64x2(const f64x2 v, f64x2 *s, f64x2 *c) {
+    rm_sincos_f64(v.x, &s->x, &c->x);
+    rm_sincos_f64(v.y, &s->y, &c->y);
+}
+RM_INLINE void
+rm_sincos_f64x3(const f64x3 v, f64x3 *s, f64x3 *c) {
+    rm_sincos_f64(v.x, &s->x, &c->x);
+    rm_sincos_f64(v.y, &s->y, &c->y);
+    rm_sincos_f64(v.z, &s->z, &c->z);
+}
+RM_INLINE void
+rm_sincos_f64x4(const f64x4 v, f64x4 *s, f64x4 *c) {
+    rm_sincos_f64(v.x, &s->x, &c->x);
+    rm_sincos_f64(v.y, &s->y, &c->y);
+    rm_sincos_f64(v.z, &s->z, &c->z);
+    rm_sincos_f64(v.w, &s->w, &c->w);
+}
+/* the unused lanes get 1 so log does not go through its special cases */
+RM_INLINE f32x2
+rm_exp_fast_f32x2(const f32x2 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_exp_fast(rmm_setr(v.x, v.y, 1, 1)));
+    return dest.xy;
+#else
+    return rm_f32x2(rm_exp_fast_f32(v.x), rm_exp_fast_f32(v.y));
+#endif
 }
-RM_INLINE i16
-rm_norm_inf_i16x3(const i16x3 v) {
-    return rm_maxv_i16x3(rm_abs_i16x3(v));
+RM_INLINE f32x3
+rm_exp_fast_f32x3(const f32x3 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_exp_fast(rmm_setr(v.x, v.y, v.z, 1)));
+    return dest.xyz;
+#else
+    return rm_f32x3(rm_exp_fast_f32(v.x), rm_exp_fast_f32(v.y),
+                    rm_exp_fast_f32(v.z));
+#endif
 }
-RM_INLINE i16
-rm_norm_inf_i16x4(const i16x4 v) {
-    return rm_maxv_i16x4(rm_abs_i16x4(v));
+RM_INLINE f32x4
+rm_exp_fast_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_exp_fast(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_exp_fast_f32(v.x), rm_exp_fast_f32(v.y),
+                    rm_exp_fast_f32(v.z), rm_exp_fast_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE i32
-rm_norm_inf_i32x2(const i32x2 v) {
-    return rm_maxv_i32x2(rm_abs_i32x2(v));
+RM_INLINE f32x2
+rm_exp_f32x2(const f32x2 v) {
+#if defined(RM_PRECISION_FAST)
+    return rm_exp_fast_f32x2(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_exp(rmm_setr(v.x, v.y, 1, 1)));
+    return dest.xy;
+#else
+    return rm_f32x2(rm_exp_f32(v.x), rm_exp_f32(v.y));
+#endif
 }
-RM_INLINE i32
-rm_norm_inf_i32x3(const i32x3 v) {
-    return rm_maxv_i32x3(rm_abs_i32x3(v));
+RM_INLINE f32x3
+rm_exp_f32x3(const f32x3 v) {
+#if defined(RM_PRECISION_FAST)
+    return rm_exp_fast_f32x3(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_exp(rmm_setr(v.x, v.y, v.z, 1)));
+    return dest.xyz;
+#else
+    return rm_f32x3(rm_exp_f32(v.x), rm_exp_f32(v.y), rm_exp_f32(v.z));
+#endif
 }
-RM_INLINE i32
-rm_norm_inf_i32x4(const i32x4 v) {
-    return rm_maxv_i32x4(rm_abs_i32x4(v));
+RM_INLINE f32x4
+rm_exp_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_PRECISION_FAST)
+    dest = rm_exp_fast_f32x4(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    rmm_store(dest.raw, rmm_exp(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_exp_f32(v.x), rm_exp_f32(v.y), rm_exp_f32(v.z),
+                    rm_exp_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE i64
-rm_norm_inf_i64x2(const i64x2 v) {
-    return rm_maxv_i64x2(rm_abs_i64x2(v));
+RM_INLINE f64x2
+rm_exp_f64x2(const f64x2 v) {
+    f64x2 dest;
+#if defined(RM_SSE2) && !defined(RM_PRECISION_EXACT)
+    rmmd_store(dest.raw, rmmd_exp(rmmd_load(v.raw)));
+#else
+    dest = rm_f64x2(rm_exp_f64(v.x), rm_exp_f64(v.y));
+#endif
+    return dest;
 }
-RM_INLINE i64
-rm_norm_inf_i64x3(const i64x3 v) {
-    return rm_maxv_i64x3(rm_abs_i64x3(v));
+RM_INLINE f64x3
+rm_exp_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_exp_f64(v.x), rm_exp_f64(v.y), rm_exp_f64(v.z));
 }
-RM_INLINE i64
-rm_norm_inf_i64x4(const i64x4 v) {
-    return rm_maxv_i64x4(rm_abs_i64x4(v));
+RM_INLINE f64x4
+rm_exp_f64x4(const f64x4 v) {
+    f64x4 dest;
+#if defined(RM_AVX) && !defined(RM_PRECISION_EXACT)
+    rmm256d_store(dest.raw, rmm256d_exp(rmm256d_load(v.raw)));
+#else
+    dest = rm_f64x4(rm_exp_f64(v.x), rm_exp_f64(v.y), rm_exp_f64(v.z),
+                    rm_exp_f64(v.w));
+#endif
+    return dest;
 }
-RM_INLINE f32
-rm_norm_inf_f32x2(const f32x2 v) {
-    return rm_maxv_f32x2(rm_abs_f32x2(v));
+RM_INLINE f64x2
+rm_exp_fast_f64x2(const f64x2 v) {
+    return rm_exp_f64x2(v);
 }
-RM_INLINE f32
-rm_norm_inf_f32x3(const f32x3 v) {
-    return rm_maxv_f32x3(rm_abs_f32x3(v));
+RM_INLINE f64x3
+rm_exp_fast_f64x3(const f64x3 v) {
+    return rm_exp_f64x3(v);
 }
-RM_INLINE f32
-rm_norm_inf_f32x4(const f32x4 v) {
-    return rm_maxv_f32x4(rm_abs_f32x4(v));
+RM_INLINE f64x4
+rm_exp_fast_f64x4(const f64x4 v) {
+    return rm_exp_f64x4(v);
 }
-RM_INLINE f64
-rm_norm_inf_f64x2(const f64x2 v) {
-    return rm_maxv_f64x2(rm_abs_f64x2(v));
+RM_INLINE f32x2
+rm_exp2_fast_f32x2(const f32x2 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_exp2_fast(rmm_setr(v.x, v.y, 1, 1)));
+    return dest.xy;
+#else
+    return rm_f32x2(rm_exp2_fast_f32(v.x), rm_exp2_fast_f32(v.y));
+#endif
 }
-RM_INLINE f64
-rm_norm_inf_f64x3(const f64x3 v) {
-    return rm_maxv_f64x3(rm_abs_f64x3(v));
+RM_INLINE f32x3
+rm_exp2_fast_f32x3(const f32x3 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_exp2_fast(rmm_setr(v.x, v.y, v.z, 1)));
+    return dest.xyz;
+#else
+    return rm_f32x3(rm_exp2_fast_f32(v.x), rm_exp2_fast_f32(v.y),
+                    rm_exp2_fast_f32(v.z));
+#endif
 }
-RM_INLINE f64
-rm_norm_inf_f64x4(const f64x4 v) {
-    return rm_maxv_f64x4(rm_abs_f64x4(v));
+RM_INLINE f32x4
+rm_exp2_fast_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_exp2_fast(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_exp2_fast_f32(v.x), rm_exp2_fast_f32(v.y),
+                    rm_exp2_fast_f32(v.z), rm_exp2_fast_f32(v.w));
+#endif
+    return dest;
 }
 RM_INLINE f32x2
-rm_normalize_f32x2(const f32x2 v) {
-    f32 norm;
-
-    norm = rm_norm_f32x2(v);
-
-    if (norm == 0.0f) { return rm_zero_f32x2(); }
+rm_exp2_f32x2(const f32x2 v) {
+#if defined(RM_PRECISION_FAST)
+    return rm_exp2_fast_f32x2(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    f32x4 dest;
 
-    return rm_muls_f32x2(v, 1.0f / norm);
+    rmm_store(dest.raw, rmm_exp2(rmm_setr(v.x, v.y, 1, 1)));
+    return dest.xy;
+#else
+    return rm_f32x2(rm_exp2_f32(v.x), rm_exp2_f32(v.y));
+#endif
 }
 RM_INLINE f32x3
-rm_normalize_f32x3(const f32x3 v) {
-    f32 norm;
-
-    norm = rm_norm_f32x3(v);
-
-    if (norm == 0.0f) { return rm_zero_f32x3(); }
+rm_exp2_f32x3(const f32x3 v) {
+#if defined(RM_PRECISION_FAST)
+    return rm_exp2_fast_f32x3(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    f32x4 dest;
 
-    return rm_muls_f32x3(v, 1.0f / norm);
+    rmm_store(dest.raw, rmm_exp2(rmm_setr(v.x, v.y, v.z, 1)));
+    return dest.xyz;
+#else
+    return rm_f32x3(rm_exp2_f32(v.x), rm_exp2_f32(v.y), rm_exp2_f32(v.z));
+#endif
 }
 RM_INLINE f32x4
-rm_normalize_f32x4(const f32x4 v) {
-    f32 norm;
-
-    norm = rm_norm_f32x4(v);
-
-    if (norm == 0.0f) { return rm_zero_f32x4(); }
-
-    return rm_muls_f32x4(v, 1.0f / norm);
+rm_exp2_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_PRECISION_FAST)
+    dest = rm_exp2_fast_f32x4(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    rmm_store(dest.raw, rmm_exp2(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_exp2_f32(v.x), rm_exp2_f32(v.y), rm_exp2_f32(v.z),
+                    rm_exp2_f32(v.w));
+#endif
+    return dest;
 }
 RM_INLINE f64x2
-rm_normalize_f64x2(const f64x2 v) {
-    f64 norm;
-
-    norm = rm_norm_f64x2(v);
-
-    if (norm == 0.0f) { return rm_zero_f64x2(); }
-
-    return rm_muls_f64x2(v, 1.0 / norm);
+rm_exp2_f64x2(const f64x2 v) {
+    f64x2 dest;
+#if defined(RM_SSE2) && !defined(RM_PRECISION_EXACT)
+    rmmd_store(dest.raw, rmmd_exp2(rmmd_load(v.raw)));
+#else
+    dest = rm_f64x2(rm_exp2_f64(v.x), rm_exp2_f64(v.y));
+#endif
+    return dest;
 }
 RM_INLINE f64x3
-rm_normalize_f64x3(const f64x3 v) {
-    f64 norm;
-
-    norm = rm_norm_f64x3(v);
-
-    if (norm == 0.0f) { return rm_zero_f64x3(); }
-
-    return rm_muls_f64x3(v, 1.0 / norm);
+rm_exp2_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_exp2_f64(v.x), rm_exp2_f64(v.y), rm_exp2_f64(v.z));
 }
 RM_INLINE f64x4
-rm_normalize_f64x4(const f64x4 v) {
-    f64 norm;
+rm_exp2_f64x4(const f64x4 v) {
+    f64x4 dest;
+#if defined(RM_AVX) && !defined(RM_PRECISION_EXACT)
+    rmm256d_store(dest.raw, rmm256d_exp2(rmm256d_load(v.raw)));
+#else
+    dest = rm_f64x4(rm_exp2_f64(v.x), rm_exp2_f64(v.y), rm_exp2_f64(v.z),
+                    rm_exp2_f64(v.w));
+#endif
+    return dest;
+}
+RM_INLINE f64x2
+rm_exp2_fast_f64x2(const f64x2 v) {
+    return rm_exp2_f64x2(v);
+}
+RM_INLINE f64x3
+rm_exp2_fast_f64x3(const f64x3 v) {
+    return rm_exp2_f64x3(v);
+}
+RM_INLINE f64x4
+rm_exp2_fast_f64x4(const f64x4 v) {
+    return rm_exp2_f64x4(v);
+}
+RM_INLINE f32x2
+rm_log_fast_f32x2(const f32x2 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
 
-    norm = rm_norm_f64x4(v);
+    rmm_store(dest.raw, rmm_log_fast(rmm_setr(v.x, v.y, 1, 1)));
+    return dest.xy;
+#else
+    return rm_f32x2(rm_log_fast_f32(v.x), rm_log_fast_f32(v.y));
+#endif
+}
+RM_INLINE f32x3
+rm_log_fast_f32x3(const f32x3 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
 
-    if (norm == 0.0f) { return rm_zero_f64x4(); }
+    rmm_store(dest.raw, rmm_log_fast(rmm_setr(v.x, v.y, v.z, 1)));
+    return dest.xyz;
+#else
+    return rm_f32x3(rm_log_fast_f32(v.x), rm_log_fast_f32(v.y),
+                    rm_log_fast_f32(v.z));
+#endif
+}
+RM_INLINE f32x4
+rm_log_fast_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_log_fast(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_log_fast_f32(v.x), rm_log_fast_f32(v.y),
+                    rm_log_fast_f32(v.z), rm_log_fast_f32(v.w));
+#endif
+    return dest;
+}
+RM_INLINE f32x2
+rm_log_f32x2(const f32x2 v) {
+#if defined(RM_PRECISION_FAST)
+    return rm_log_fast_f32x2(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    f32x4 dest;
 
-    return rm_muls_f64x4(v, 1.0 / norm);
+    rmm_store(dest.raw, rmm_log(rmm_setr(v.x, v.y, 1, 1)));
+    return dest.xy;
+#else
+    return rm_f32x2(rm_log_f32(v.x), rm_log_f32(v.y));
+#endif
 }
-RM_INLINE u8
-rm_cross_u8x2(const u8x2 a, const u8x2 b) {
-    return a.x * b.y - a.y * b.x;
+RM_INLINE f32x3
+rm_log_f32x3(const f32x3 v) {
+#if defined(RM_PRECISION_FAST)
+    return rm_log_fast_f32x3(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_log(rmm_setr(v.x, v.y, v.z, 1)));
+    return dest.xyz;
+#else
+    return rm_f32x3(rm_log_f32(v.x), rm_log_f32(v.y), rm_log_f32(v.z));
+#endif
 }
-RM_INLINE u8x3
-rm_cross_u8x3(const u8x3 a, u8x3 b) {
-    return rm_u8x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
-                   a.x * b.y - a.y * b.x);
+RM_INLINE f32x4
+rm_log_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_PRECISION_FAST)
+    dest = rm_log_fast_f32x4(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    rmm_store(dest.raw, rmm_log(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_log_f32(v.x), rm_log_f32(v.y), rm_log_f32(v.z),
+                    rm_log_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE u16
-rm_cross_u16x2(const u16x2 a, const u16x2 b) {
-    return a.x * b.y - a.y * b.x;
+RM_INLINE f64x2
+rm_log_f64x2(const f64x2 v) {
+    f64x2 dest;
+#if defined(RM_SSE2) && !defined(RM_PRECISION_EXACT)
+    rmmd_store(dest.raw, rmmd_log(rmmd_load(v.raw)));
+#else
+    dest = rm_f64x2(rm_log_f64(v.x), rm_log_f64(v.y));
+#endif
+    return dest;
 }
-RM_INLINE u16x3
-rm_cross_u16x3(const u16x3 a, u16x3 b) {
-    return rm_u16x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
-                    a.x * b.y - a.y * b.x);
+RM_INLINE f64x3
+rm_log_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_log_f64(v.x), rm_log_f64(v.y), rm_log_f64(v.z));
 }
-RM_INLINE u32
-rm_cross_u32x2(const u32x2 a, const u32x2 b) {
-    return a.x * b.y - a.y * b.x;
+RM_INLINE f64x4
+rm_log_f64x4(const f64x4 v) {
+    f64x4 dest;
+#if defined(RM_AVX) && !defined(RM_PRECISION_EXACT)
+    rmm256d_store(dest.raw, rmm256d_log(rmm256d_load(v.raw)));
+#else
+    dest = rm_f64x4(rm_log_f64(v.x), rm_log_f64(v.y), rm_log_f64(v.z),
+                    rm_log_f64(v.w));
+#endif
+    return dest;
 }
-RM_INLINE u32x3
-rm_cross_u32x3(const u32x3 a, u32x3 b) {
-    return rm_u32x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
-                    a.x * b.y - a.y * b.x);
+RM_INLINE f64x2
+rm_log_fast_f64x2(const f64x2 v) {
+    return rm_log_f64x2(v);
 }
-RM_INLINE u64
-rm_cross_u64x2(const u64x2 a, const u64x2 b) {
-    return a.x * b.y - a.y * b.x;
+RM_INLINE f64x3
+rm_log_fast_f64x3(const f64x3 v) {
+    return rm_log_f64x3(v);
 }
-RM_INLINE u64x3
-rm_cross_u64x3(const u64x3 a, u64x3 b) {
-    return rm_u64x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
-                    a.x * b.y - a.y * b.x);
+RM_INLINE f64x4
+rm_log_fast_f64x4(const f64x4 v) {
+    return rm_log_f64x4(v);
 }
-RM_INLINE i8
-rm_cross_i8x2(const i8x2 a, const i8x2 b) {
-    return a.x * b.y - a.y * b.x;
-}
-RM_INLINE i8x3
-rm_cross_i8x3(const i8x3 a, i8x3 b) {
-    return rm_i8x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
-                   a.x * b.y - a.y * b.x);
-}
-RM_INLINE i16
-rm_cross_i16x2(const i16x2 a, const i16x2 b) {
-    return a.x * b.y - a.y * b.x;
-}
-RM_INLINE i16x3
-rm_cross_i16x3(const i16x3 a, i16x3 b) {
-    return rm_i16x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
-                    a.x * b.y - a.y * b.x);
-}
-RM_INLINE i32
-rm_cross_i32x2(const i32x2 a, const i32x2 b) {
-    return a.x * b.y - a.y * b.x;
-}
-RM_INLINE i32x3
-rm_cross_i32x3(const i32x3 a, i32x3 b) {
-    return rm_i32x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
-                    a.x * b.y - a.y * b.x);
+RM_INLINE f32x2
+rm_log2_fast_f32x2(const f32x2 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_log2_fast(rmm_setr(v.x, v.y, 1, 1)));
+    return dest.xy;
+#else
+    return rm_f32x2(rm_log2_fast_f32(v.x), rm_log2_fast_f32(v.y));
+#endif
 }
-RM_INLINE i64
-rm_cross_i64x2(const i64x2 a, const i64x2 b) {
-    return a.x * b.y - a.y * b.x;
+RM_INLINE f32x3
+rm_log2_fast_f32x3(const f32x3 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_log2_fast(rmm_setr(v.x, v.y, v.z, 1)));
+    return dest.xyz;
+#else
+    return rm_f32x3(rm_log2_fast_f32(v.x), rm_log2_fast_f32(v.y),
+                    rm_log2_fast_f32(v.z));
+#endif
 }
-RM_INLINE i64x3
-rm_cross_i64x3(const i64x3 a, i64x3 b) {
-    return rm_i64x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
-                    a.x * b.y - a.y * b.x);
+RM_INLINE f32x4
+rm_log2_fast_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_log2_fast(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_log2_fast_f32(v.x), rm_log2_fast_f32(v.y),
+                    rm_log2_fast_f32(v.z), rm_log2_fast_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE f32
-rm_cross_f32x2(const f32x2 a, const f32x2 b) {
-    return a.x * b.y - a.y * b.x;
+RM_INLINE f32x2
+rm_log2_f32x2(const f32x2 v) {
+#if defined(RM_PRECISION_FAST)
+    return rm_log2_fast_f32x2(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_log2(rmm_setr(v.x, v.y, 1, 1)));
+    return dest.xy;
+#else
+    return rm_f32x2(rm_log2_f32(v.x), rm_log2_f32(v.y));
+#endif
 }
 RM_INLINE f32x3
-rm_cross_f32x3(const f32x3 a, f32x3 b) {
-    return rm_f32x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
-                    a.x * b.y - a.y * b.x);
+rm_log2_f32x3(const f32x3 v) {
+#if defined(RM_PRECISION_FAST)
+    return rm_log2_fast_f32x3(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_log2(rmm_setr(v.x, v.y, v.z, 1)));
+    return dest.xyz;
+#else
+    return rm_f32x3(rm_log2_f32(v.x), rm_log2_f32(v.y), rm_log2_f32(v.z));
+#endif
 }
-RM_INLINE f32x3
-rm_crossn_f32x3(const f32x3 a, f32x3 b) {
-    return rm_normalize_f32x3(rm_cross_f32x3(a, b));
+RM_INLINE f32x4
+rm_log2_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_PRECISION_FAST)
+    dest = rm_log2_fast_f32x4(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    rmm_store(dest.raw, rmm_log2(rmm_load(v.raw)));
+#else
+    dest = rm_f32x4(rm_log2_f32(v.x), rm_log2_f32(v.y), rm_log2_f32(v.z),
+                    rm_log2_f32(v.w));
+#endif
+    return dest;
 }
-RM_INLINE f64
-rm_cross_f64x2(const f64x2 a, const f64x2 b) {
-    return a.x * b.y - a.y * b.x;
+RM_INLINE f64x2
+rm_log2_f64x2(const f64x2 v) {
+    f64x2 dest;
+#if defined(RM_SSE2) && !defined(RM_PRECISION_EXACT)
+    rmmd_store(dest.raw, rmmd_log2(rmmd_load(v.raw)));
+#else
+    dest = rm_f64x2(rm_log2_f64(v.x), rm_log2_f64(v.y));
+#endif
+    return dest;
 }
 RM_INLINE f64x3
-rm_cross_f64x3(const f64x3 a, f64x3 b) {
-    return rm_f64x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
-                    a.x * b.y - a.y * b.x);
+rm_log2_f64x3(const f64x3 v) {
+    return rm_f64x3(rm_log2_f64(v.x), rm_log2_f64(v.y), rm_log2_f64(v.z));
+}
+RM_INLINE f64x4
+rm_log2_f64x4(const f64x4 v) {
+    f64x4 dest;
+#if defined(RM_AVX) && !defined(RM_PRECISION_EXACT)
+    rmm256d_store(dest.raw, rmm256d_log2(rmm256d_load(v.raw)));
+#else
+    dest = rm_f64x4(rm_log2_f64(v.x), rm_log2_f64(v.y), rm_log2_f64(v.z),
+                    rm_log2_f64(v.w));
+#endif
+    return dest;
+}
+RM_INLINE f64x2
+rm_log2_fast_f64x2(const f64x2 v) {
+    return rm_log2_f64x2(v);
 }
 RM_INLINE f64x3
-rm_crossn_f64x3(const f64x3 a, f64x3 b) {
-    return rm_normalize_f64x3(rm_cross_f64x3(a, b));
+rm_log2_fast_f64x3(const f64x3 v) {
+    return rm_log2_f64x3(v);
 }
-RM_INLINE u8
-rm_distance2_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_pow2_u8(a.x - b.x) + rm_pow2_u8(a.y - b.y);
+RM_INLINE f64x4
+rm_log2_fast_f64x4(const f64x4 v) {
+    return rm_log2_f64x4(v);
 }
-RM_INLINE u8
-rm_distance2_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_pow2_u8(a.x - b.x) + rm_pow2_u8(a.y - b.y) +
-           rm_pow2_u8(a.z - b.z);
+RM_INLINE boolx2
+rm_copy_boolx2(const boolx2 v) {
+    return rm_boolx2(v.x, v.y);
 }
-RM_INLINE u8
-rm_distance2_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_pow2_u8(a.x - b.x) + rm_pow2_u8(a.y - b.y) +
-           rm_pow2_u8(a.z - b.z) + rm_pow2_u8(a.w - b.w);
+RM_INLINE boolx3
+rm_copy_boolx3(const boolx3 v) {
+    return rm_boolx3(v.x, v.y, v.z);
 }
-RM_INLINE u16
-rm_distance2_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_pow2_u16(a.x - b.x) + rm_pow2_u16(a.y - b.y);
+RM_INLINE boolx4
+rm_copy_boolx4(const boolx4 v) {
+    return rm_boolx4(v.x, v.y, v.z, v.w);
 }
-RM_INLINE u16
-rm_distance2_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_pow2_u16(a.x - b.x) + rm_pow2_u16(a.y - b.y) +
-           rm_pow2_u16(a.z - b.z);
+RM_INLINE u8x2
+rm_copy_u8x2(const u8x2 v) {
+    return rm_u8x2(v.x, v.y);
 }
-RM_INLINE u16
-rm_distance2_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_pow2_u16(a.x - b.x) + rm_pow2_u16(a.y - b.y) +
-           rm_pow2_u16(a.z - b.z) + rm_pow2_u16(a.w - b.w);
+RM_INLINE u8x3
+rm_copy_u8x3(const u8x3 v) {
+    return rm_u8x3(v.x, v.y, v.z);
 }
-RM_INLINE u32
-rm_distance2_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_pow2_u32(a.x - b.x) + rm_pow2_u32(a.y - b.y);
+RM_INLINE u8x4
+rm_copy_u8x4(const u8x4 v) {
+    return rm_u8x4(v.x, v.y, v.z, v.w);
 }
-RM_INLINE u32
-rm_distance2_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_pow2_u32(a.x - b.x) + rm_pow2_u32(a.y - b.y) +
-           rm_pow2_u32(a.z - b.z);
+RM_INLINE u16x2
+rm_copy_u16x2(const u16x2 v) {
+    return rm_u16x2(v.x, v.y);
 }
-RM_INLINE u32
-rm_distance2_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_pow2_u32(a.x - b.x) + rm_pow2_u32(a.y - b.y) +
-           rm_pow2_u32(a.z - b.z) + rm_pow2_u32(a.w - b.w);
+RM_INLINE u16x3
+rm_copy_u16x3(const u16x3 v) {
+    return rm_u16x3(v.x, v.y, v.z);
 }
-RM_INLINE u64
-rm_distance2_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_pow2_u64(a.x - b.x) + rm_pow2_u64(a.y - b.y);
+RM_INLINE u16x4
+rm_copy_u16x4(const u16x4 v) {
+    return rm_u16x4(v.x, v.y, v.z, v.w);
 }
-RM_INLINE u64
-rm_distance2_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_pow2_u64(a.x - b.x) + rm_pow2_u64(a.y - b.y) +
-           rm_pow2_u64(a.z - b.z);
+RM_INLINE u32x2
+rm_copy_u32x2(const u32x2 v) {
+    return rm_u32x2(v.x, v.y);
 }
-RM_INLINE u64
-rm_distance2_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_pow2_u64(a.x - b.x) + rm_pow2_u64(a.y - b.y) +
-           rm_pow2_u64(a.z - b.z) + rm_pow2_u64(a.w - b.w);
+RM_INLINE u32x3
+rm_copy_u32x3(const u32x3 v) {
+    return rm_u32x3(v.x, v.y, v.z);
 }
-RM_INLINE i8
-rm_distance2_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_pow2_i8(a.x - b.x) + rm_pow2_i8(a.y - b.y);
+RM_INLINE u32x4
+rm_copy_u32x4(const u32x4 v) {
+    return rm_u32x4(v.x, v.y, v.z, v.w);
 }
-RM_INLINE i8
-rm_distance2_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_pow2_i8(a.x - b.x) + rm_pow2_i8(a.y - b.y) +
-           rm_pow2_i8(a.z - b.z);
+RM_INLINE u64x2
+rm_copy_u64x2(const u64x2 v) {
+    return rm_u64x2(v.x, v.y);
 }
-RM_INLINE i8
-rm_distance2_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_pow2_i8(a.x - b.x) + rm_pow2_i8(a.y - b.y) +
-           rm_pow2_i8(a.z - b.z) + rm_pow2_i8(a.w - b.w);
+RM_INLINE u64x3
+rm_copy_u64x3(const u64x3 v) {
+    return rm_u64x3(v.x, v.y, v.z);
 }
-RM_INLINE i16
-rm_distance2_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_pow2_i16(a.x - b.x) + rm_pow2_i16(a.y - b.y);
+RM_INLINE u64x4
+rm_copy_u64x4(const u64x4 v) {
+    return rm_u64x4(v.x, v.y, v.z, v.w);
 }
-RM_INLINE i16
-rm_distance2_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_pow2_i16(a.x - b.x) + rm_pow2_i16(a.y - b.y) +
-           rm_pow2_i16(a.z - b.z);
+RM_INLINE i8x2
+rm_copy_i8x2(const i8x2 v) {
+    return rm_i8x2(v.x, v.y);
 }
-RM_INLINE i16
-rm_distance2_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_pow2_i16(a.x - b.x) + rm_pow2_i16(a.y - b.y) +
-           rm_pow2_i16(a.z - b.z) + rm_pow2_i16(a.w - b.w);
+RM_INLINE i8x3
+rm_copy_i8x3(const i8x3 v) {
+    return rm_i8x3(v.x, v.y, v.z);
 }
-RM_INLINE i32
-rm_distance2_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_pow2_i32(a.x - b.x) + rm_pow2_i32(a.y - b.y);
+RM_INLINE i8x4
+rm_copy_i8x4(const i8x4 v) {
+    return rm_i8x4(v.x, v.y, v.z, v.w);
 }
-RM_INLINE i32
-rm_distance2_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_pow2_i32(a.x - b.x) + rm_pow2_i32(a.y - b.y) +
-           rm_pow2_i32(a.z - b.z);
+RM_INLINE i16x2
+rm_copy_i16x2(const i16x2 v) {
+    return rm_i16x2(v.x, v.y);
 }
-RM_INLINE i32
-rm_distance2_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_pow2_i32(a.x - b.x) + rm_pow2_i32(a.y - b.y) +
-           rm_pow2_i32(a.z - b.z) + rm_pow2_i32(a.w - b.w);
+RM_INLINE i16x3
+rm_copy_i16x3(const i16x3 v) {
+    return rm_i16x3(v.x, v.y, v.z);
 }
-RM_INLINE i64
-rm_distance2_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_pow2_i64(a.x - b.x) + rm_pow2_i64(a.y - b.y);
+RM_INLINE i16x4
+rm_copy_i16x4(const i16x4 v) {
+    return rm_i16x4(v.x, v.y, v.z, v.w);
 }
-RM_INLINE i64
-rm_distance2_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_pow2_i64(a.x - b.x) + rm_pow2_i64(a.y - b.y) +
-           rm_pow2_i64(a.z - b.z);
+RM_INLINE i32x2
+rm_copy_i32x2(const i32x2 v) {
+    return rm_i32x2(v.x, v.y);
 }
-RM_INLINE i64
-rm_distance2_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_pow2_i64(a.x - b.x) + rm_pow2_i64(a.y - b.y) +
-           rm_pow2_i64(a.z - b.z) + rm_pow2_i64(a.w - b.w);
+RM_INLINE i32x3
+rm_copy_i32x3(const i32x3 v) {
+    return rm_i32x3(v.x, v.y, v.z);
 }
-RM_INLINE f32
-rm_distance2_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_pow2_f32(a.x - b.x) + rm_pow2_f32(a.y - b.y);
+RM_INLINE i32x4
+rm_copy_i32x4(const i32x4 v) {
+    return rm_i32x4(v.x, v.y, v.z, v.w);
 }
-RM_INLINE f32
-rm_distance2_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_pow2_f32(a.x - b.x) + rm_pow2_f32(a.y - b.y) +
-           rm_pow2_f32(a.z - b.z);
+RM_INLINE i64x2
+rm_copy_i64x2(const i64x2 v) {
+    return rm_i64x2(v.x, v.y);
 }
-RM_INLINE f32
-rm_distance2_f32x4(const f32x4 a, const f32x4 b) {
-#if defined(RM_SSE)
-    return rmm_norm2(_mm_sub_ps(rmm_load(a.raw), rmm_load(b.raw)));
+RM_INLINE i64x3
+rm_copy_i64x3(const i64x3 v) {
+    return rm_i64x3(v.x, v.y, v.z);
+}
+RM_INLINE i64x4
+rm_copy_i64x4(const i64x4 v) {
+    return rm_i64x4(v.x, v.y, v.z, v.w);
+}
+RM_INLINE f32x2
+rm_copy_f32x2(const f32x2 v) {
+    return rm_f32x2(v.x, v.y);
+}
+RM_INLINE f32x3
+rm_copy_f32x3(const f32x3 v) {
+    return rm_f32x3(v.x, v.y, v.z);
+}
+RM_INLINE f32x4
+rm_copy_f32x4(const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_load(v.raw));
 #else
-    return rm_pow2_f32(a.x - b.x) + rm_pow2_f32(a.y - b.y) +
-           rm_pow2_f32(a.z - b.z) + rm_pow2_f32(a.w - b.w);
+    dest = rm_f32x4(v.x, v.y, v.z, v.w);
 #endif
+    return dest;
 }
-RM_INLINE f64
-rm_distance2_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_pow2_f64(a.x - b.x) + rm_pow2_f64(a.y - b.y);
+RM_INLINE f64x2
+rm_copy_f64x2(const f64x2 v) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, rmmd_load(v.raw));
+#else
+    dest = rm_f64x2(v.x, v.y);
+#endif
+    return dest;
 }
-RM_INLINE f64
-rm_distance2_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_pow2_f64(a.x - b.x) + rm_pow2_f64(a.y - b.y) +
-           rm_pow2_f64(a.z - b.z);
+RM_INLINE f64x3
+rm_copy_f64x3(const f64x3 v) {
+    return rm_f64x3(v.x, v.y, v.z);
 }
-RM_INLINE f64
-rm_distance2_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_pow2_f64(a.x - b.x) + rm_pow2_f64(a.y - b.y) +
-           rm_pow2_f64(a.z - b.z) + rm_pow2_f64(a.w - b.w);
+RM_INLINE f64x4
+rm_copy_f64x4(const f64x4 v) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, rmm256d_load(v.raw));
+#else
+    dest = rm_f64x4(v.x, v.y, v.z, v.w);
+#endif
+    return dest;
 }
-RM_INLINE f32
-rm_distance_u8x2(const u8x2 a, const u8x2 b) {
-    return rm_sqrt_f32(rm_distance2_u8x2(a, b));
+RM_INLINE boolx2
+rm_zero_boolx2(void) {
+    return rm_boolx2s(0);
 }
-RM_INLINE f32
-rm_distance_u8x3(const u8x3 a, const u8x3 b) {
-    return rm_sqrt_f32(rm_distance2_u8x3(a, b));
+RM_INLINE boolx3
+rm_zero_boolx3(void) {
+    return rm_boolx3s(0);
 }
-RM_INLINE f32
-rm_distance_u8x4(const u8x4 a, const u8x4 b) {
-    return rm_sqrt_f32(rm_distance2_u8x4(a, b));
+RM_INLINE boolx4
+rm_zero_boolx4(void) {
+    return rm_boolx4s(0);
 }
-RM_INLINE f32
-rm_distance_u16x2(const u16x2 a, const u16x2 b) {
-    return rm_sqrt_f32(rm_distance2_u16x2(a, b));
+RM_INLINE u8x2
+rm_zero_u8x2(void) {
+    return rm_u8x2s(0);
 }
-RM_INLINE f32
-rm_distance_u16x3(const u16x3 a, const u16x3 b) {
-    return rm_sqrt_f32(rm_distance2_u16x3(a, b));
+RM_INLINE u8x3
+rm_zero_u8x3(void) {
+    return rm_u8x3s(0);
 }
-RM_INLINE f32
-rm_distance_u16x4(const u16x4 a, const u16x4 b) {
-    return rm_sqrt_f32(rm_distance2_u16x4(a, b));
+RM_INLINE u8x4
+rm_zero_u8x4(void) {
+    return rm_u8x4s(0);
 }
-RM_INLINE f32
-rm_distance_u32x2(const u32x2 a, const u32x2 b) {
-    return rm_sqrt_f32(rm_distance2_u32x2(a, b));
+RM_INLINE u16x2
+rm_zero_u16x2(void) {
+    return rm_u16x2s(0);
 }
-RM_INLINE f32
-rm_distance_u32x3(const u32x3 a, const u32x3 b) {
-    return rm_sqrt_f32(rm_distance2_u32x3(a, b));
+RM_INLINE u16x3
+rm_zero_u16x3(void) {
+    return rm_u16x3s(0);
 }
-RM_INLINE f32
-rm_distance_u32x4(const u32x4 a, const u32x4 b) {
-    return rm_sqrt_f32(rm_distance2_u32x4(a, b));
+RM_INLINE u16x4
+rm_zero_u16x4(void) {
+    return rm_u16x4s(0);
 }
-RM_INLINE f64
-rm_distance_u64x2(const u64x2 a, const u64x2 b) {
-    return rm_sqrt_f64(rm_distance2_u64x2(a, b));
+RM_INLINE u32x2
+rm_zero_u32x2(void) {
+    return rm_u32x2s(0);
 }
-RM_INLINE f64
-rm_distance_u64x3(const u64x3 a, const u64x3 b) {
-    return rm_sqrt_f64(rm_distance2_u64x3(a, b));
+RM_INLINE u32x3
+rm_zero_u32x3(void) {
+    return rm_u32x3s(0);
 }
-RM_INLINE f64
-rm_distance_u64x4(const u64x4 a, const u64x4 b) {
-    return rm_sqrt_f64(rm_distance2_u64x4(a, b));
+RM_INLINE u32x4
+rm_zero_u32x4(void) {
+    return rm_u32x4s(0);
 }
-RM_INLINE f32
-rm_distance_i8x2(const i8x2 a, const i8x2 b) {
-    return rm_sqrt_f32(rm_distance2_i8x2(a, b));
+RM_INLINE u64x2
+rm_zero_u64x2(void) {
+    return rm_u64x2s(0);
 }
-RM_INLINE f32
-rm_distance_i8x3(const i8x3 a, const i8x3 b) {
-    return rm_sqrt_f32(rm_distance2_i8x3(a, b));
+RM_INLINE u64x3
+rm_zero_u64x3(void) {
+    return rm_u64x3s(0);
 }
-RM_INLINE f32
-rm_distance_i8x4(const i8x4 a, const i8x4 b) {
-    return rm_sqrt_f32(rm_distance2_i8x4(a, b));
+RM_INLINE u64x4
+rm_zero_u64x4(void) {
+    return rm_u64x4s(0);
 }
-RM_INLINE f32
-rm_distance_i16x2(const i16x2 a, const i16x2 b) {
-    return rm_sqrt_f32(rm_distance2_i16x2(a, b));
+RM_INLINE i8x2
+rm_zero_i8x2(void) {
+    return rm_i8x2s(0);
 }
-RM_INLINE f32
-rm_distance_i16x3(const i16x3 a, const i16x3 b) {
-    return rm_sqrt_f32(rm_distance2_i16x3(a, b));
+RM_INLINE i8x3
+rm_zero_i8x3(void) {
+    return rm_i8x3s(0);
 }
-RM_INLINE f32
-rm_distance_i16x4(const i16x4 a, const i16x4 b) {
-    return rm_sqrt_f32(rm_distance2_i16x4(a, b));
+RM_INLINE i8x4
+rm_zero_i8x4(void) {
+    return rm_i8x4s(0);
 }
-RM_INLINE f32
-rm_distance_i32x2(const i32x2 a, const i32x2 b) {
-    return rm_sqrt_f32(rm_distance2_i32x2(a, b));
+RM_INLINE i16x2
+rm_zero_i16x2(void) {
+    return rm_i16x2s(0);
 }
-RM_INLINE f32
-rm_distance_i32x3(const i32x3 a, const i32x3 b) {
-    return rm_sqrt_f32(rm_distance2_i32x3(a, b));
+RM_INLINE i16x3
+rm_zero_i16x3(void) {
+    return rm_i16x3s(0);
 }
-RM_INLINE f32
-rm_distance_i32x4(const i32x4 a, const i32x4 b) {
-    return rm_sqrt_f32(rm_distance2_i32x4(a, b));
+RM_INLINE i16x4
+rm_zero_i16x4(void) {
+    return rm_i16x4s(0);
 }
-RM_INLINE f64
-rm_distance_i64x2(const i64x2 a, const i64x2 b) {
-    return rm_sqrt_f64(rm_distance2_i64x2(a, b));
+RM_INLINE i32x2
+rm_zero_i32x2(void) {
+    return rm_i32x2s(0);
 }
-RM_INLINE f64
-rm_distance_i64x3(const i64x3 a, const i64x3 b) {
-    return rm_sqrt_f64(rm_distance2_i64x3(a, b));
+RM_INLINE i32x3
+rm_zero_i32x3(void) {
+    return rm_i32x3s(0);
 }
-RM_INLINE f64
-rm_distance_i64x4(const i64x4 a, const i64x4 b) {
-    return rm_sqrt_f64(rm_distance2_i64x4(a, b));
+RM_INLINE i32x4
+rm_zero_i32x4(void) {
+    return rm_i32x4s(0);
 }
-RM_INLINE f32
-rm_distance_f32x2(const f32x2 a, const f32x2 b) {
-    return rm_sqrt_f32(rm_distance2_f32x2(a, b));
+RM_INLINE i64x2
+rm_zero_i64x2(void) {
+    return rm_i64x2s(0);
 }
-RM_INLINE f32
-rm_distance_f32x3(const f32x3 a, const f32x3 b) {
-    return rm_sqrt_f32(rm_distance2_f32x3(a, b));
+RM_INLINE i64x3
+rm_zero_i64x3(void) {
+    return rm_i64x3s(0);
 }
-RM_INLINE f32
-rm_distance_f32x4(const f32x4 a, const f32x4 b) {
-#if defined(RM_SSE)
-    return rmm_norm(_mm_sub_ps(rmm_load(a.raw), rmm_load(b.raw)));
-#else
-    return rm_sqrt_f32(rm_distance2_f32x4(a, b));
-#endif
+RM_INLINE i64x4
+rm_zero_i64x4(void) {
+    return rm_i64x4s(0);
 }
-RM_INLINE f64
-rm_distance_f64x2(const f64x2 a, const f64x2 b) {
-    return rm_sqrt_f64(rm_distance2_f64x2(a, b));
+RM_INLINE f32x2
+rm_zero_f32x2(void) {
+    return rm_f32x2s(0);
 }
-RM_INLINE f64
-rm_distance_f64x3(const f64x3 a, const f64x3 b) {
-    return rm_sqrt_f64(rm_distance2_f64x3(a, b));
+RM_INLINE f32x3
+rm_zero_f32x3(void) {
+    return rm_f32x3s(0);
 }
-RM_INLINE f64
-rm_distance_f64x4(const f64x4 a, const f64x4 b) {
-    return rm_sqrt_f64(rm_distance2_f64x4(a, b));
+RM_INLINE f32x4
+rm_zero_f32x4(void) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_setzero());
+#else
+    dest = rm_f32x4s(0);
+#endif
+    return dest;
 }
+RM_INLINE f64x2
+rm_zero_f64x2(void) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, _mm_setzero_pd());
+#else
+    dest = rm_f64x2s(0);
+#endif
+    return dest;
+}
+RM_INLINE f64x3
+rm_zero_f64x3(void) {
+    return rm_f64x3s(0);
+}
+RM_INLINE f64x4
+rm_zero_f64x4(void) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, _mm256_setzero_pd());
+#else
+    dest = rm_f64x4s(0);
+#endif
+    return dest;
+}
+RM_INLINE boolx2
+rm_one_boolx2(void) {
+    return rm_boolx2s(1);
+}
+RM_INLINE boolx3
+rm_one_boolx3(void) {
+    return rm_boolx3s(1);
+}
+RM_INLINE boolx4
+rm_one_boolx4(void) {
+    return rm_boolx4s(1);
+}
+RM_INLINE u8x2
+rm_one_u8x2(void) {
+    return rm_u8x2s(1);
+}
+RM_INLINE u8x3
+rm_one_u8x3(void) {
+    return rm_u8x3s(1);
+}
+RM_INLINE u8x4
+rm_one_u8x4(void) {
+    return rm_u8x4s(1);
+}
+RM_INLINE u16x2
+rm_one_u16x2(void) {
+    return rm_u16x2s(1);
+}
+RM_INLINE u16x3
+rm_one_u16x3(void) {
+    return rm_u16x3s(1);
+}
+RM_INLINE u16x4
+rm_one_u16x4(void) {
+    return rm_u16x4s(1);
+}
+RM_INLINE u32x2
+rm_one_u32x2(void) {
+    return rm_u32x2s(1);
+}
+RM_INLINE u32x3
+rm_one_u32x3(void) {
+    return rm_u32x3s(1);
+}
+RM_INLINE u32x4
+rm_one_u32x4(void) {
+    return rm_u32x4s(1);
+}
+RM_INLINE u64x2
+rm_one_u64x2(void) {
+    return rm_u64x2s(1);
+}
+RM_INLINE u64x3
+rm_one_u64x3(void) {
+    return rm_u64x3s(1);
+}
+RM_INLINE u64x4
+rm_one_u64x4(void) {
+    return rm_u64x4s(1);
+}
+RM_INLINE i8x2
+rm_one_i8x2(void) {
+    return rm_i8x2s(1);
+}
+RM_INLINE i8x3
+rm_one_i8x3(void) {
+    return rm_i8x3s(1);
+}
+RM_INLINE i8x4
+rm_one_i8x4(void) {
+    return rm_i8x4s(1);
+}
+RM_INLINE i16x2
+rm_one_i16x2(void) {
+    return rm_i16x2s(1);
+}
+RM_INLINE i16x3
+rm_one_i16x3(void) {
+    return rm_i16x3s(1);
+}
+RM_INLINE i16x4
+rm_one_i16x4(void) {
+    return rm_i16x4s(1);
+}
+RM_INLINE i32x2
+rm_one_i32x2(void) {
+    return rm_i32x2s(1);
+}
+RM_INLINE i32x3
+rm_one_i32x3(void) {
+    return rm_i32x3s(1);
+}
+RM_INLINE i32x4
+rm_one_i32x4(void) {
+    return rm_i32x4s(1);
+}
+RM_INLINE i64x2
+rm_one_i64x2(void) {
+    return rm_i64x2s(1);
+}
+RM_INLINE i64x3
+rm_one_i64x3(void) {
+    return rm_i64x3s(1);
+}
+RM_INLINE i64x4
+rm_one_i64x4(void) {
+    return rm_i64x4s(1);
+}
+RM_INLINE f32x2
+rm_one_f32x2(void) {
+    return rm_f32x2s(1);
+}
+RM_INLINE f32x3
+rm_one_f32x3(void) {
+    return rm_f32x3s(1);
+}
+RM_INLINE f32x4
+rm_one_f32x4(void) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_set1(1.0f));
+#else
+    dest = rm_f32x4s(1);
+#endif
+    return dest;
+}
+RM_INLINE f64x2
+rm_one_f64x2(void) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    rmmd_store(dest.raw, _mm_set1_pd(1.0));
+#else
+    dest = rm_f64x2s(1);
+#endif
+    return dest;
+}
+RM_INLINE f64x3
+rm_one_f64x3(void) {
+    return rm_f64x3s(1);
+}
+RM_INLINE f64x4
+rm_one_f64x4(void) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    rmm256d_store(dest.raw, _mm256_set1_pd(1.0));
+#else
+    dest = rm_f64x4s(1);
+#endif
+    return dest;
+}
+RM_INLINE u8
+rm_dot_u8x2(const u8x2 a, const u8x2 b) {
+    return a.x * b.x + a.y * b.y;
+}
+RM_INLINE u8
+rm_dot_u8x3(const u8x3 a, const u8x3 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+RM_INLINE u8
+rm_dot_u8x4(const u8x4 a, const u8x4 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+RM_INLINE u16
+rm_dot_u16x2(const u16x2 a, const u16x2 b) {
+    return a.x * b.x + a.y * b.y;
+}
+RM_INLINE u16
+rm_dot_u16x3(const u16x3 a, const u16x3 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+RM_INLINE u16
+rm_dot_u16x4(const u16x4 a, const u16x4 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+RM_INLINE u32
+rm_dot_u32x2(const u32x2 a, const u32x2 b) {
+    return a.x * b.x + a.y * b.y;
+}
+RM_INLINE u32
+rm_dot_u32x3(const u32x3 a, const u32x3 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+RM_INLINE u32
+rm_dot_u32x4(const u32x4 a, const u32x4 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+RM_INLINE u64
+rm_dot_u64x2(const u64x2 a, const u64x2 b) {
+    return a.x * b.x + a.y * b.y;
+}
+RM_INLINE u64
+rm_dot_u64x3(const u64x3 a, const u64x3 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+RM_INLINE u64
+rm_dot_u64x4(const u64x4 a, const u64x4 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+RM_INLINE i8
+rm_dot_i8x2(const i8x2 a, const i8x2 b) {
+    return a.x * b.x + a.y * b.y;
+}
+RM_INLINE i8
+rm_dot_i8x3(const i8x3 a, const i8x3 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+RM_INLINE i8
+rm_dot_i8x4(const i8x4 a, const i8x4 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+RM_INLINE i16
+rm_dot_i16x2(const i16x2 a, const i16x2 b) {
+    return a.x * b.x + a.y * b.y;
+}
+RM_INLINE i16
+rm_dot_i16x3(const i16x3 a, const i16x3 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+RM_INLINE i16
+rm_dot_i16x4(const i16x4 a, const i16x4 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+RM_INLINE i32
+rm_dot_i32x2(const i32x2 a, const i32x2 b) {
+    return a.x * b.x + a.y * b.y;
+}
+RM_INLINE i32
+rm_dot_i32x3(const i32x3 a, const i32x3 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+RM_INLINE i32
+rm_dot_i32x4(const i32x4 a, const i32x4 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+RM_INLINE i64
+rm_dot_i64x2(const i64x2 a, const i64x2 b) {
+    return a.x * b.x + a.y * b.y;
+}
+RM_INLINE i64
+rm_dot_i64x3(const i64x3 a, const i64x3 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+RM_INLINE i64
+rm_dot_i64x4(const i64x4 a, const i64x4 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+RM_INLINE f32
+rm_dot_f32x2(const f32x2 a, const f32x2 b) {
+    return a.x * b.x + a.y * b.y;
+}
+RM_INLINE f32
+rm_dot_f32x3(const f32x3 a, const f32x3 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+RM_INLINE f32
+rm_dot_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_dot(rmm_load(a.raw), rmm_load(b.raw));
+#else
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+#endif
+}
+RM_INLINE f64
+rm_dot_f64x2(const f64x2 a, const f64x2 b) {
+#if defined(RM_SSE2)
+    return rmmd_dot(rmmd_load(a.raw), rmmd_load(b.raw));
+#else
+    return a.x * b.x + a.y * b.y;
+#endif
+}
+RM_INLINE f64
+rm_dot_f64x3(const f64x3 a, const f64x3 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+RM_INLINE f64
+rm_dot_f64x4(const f64x4 a, const f64x4 b) {
+#if defined(RM_AVX)
+    return rmm256d_dot(rmm256d_load(a.raw), rmm256d_load(b.raw));
+#else
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+#endif
+}
+RM_INLINE u8
+rm_norm2_u8x2(const u8x2 v) {
+    return rm_dot_u8x2(v, v);
+}
+RM_INLINE u8
+rm_norm2_u8x3(const u8x3 v) {
+    return rm_dot_u8x3(v, v);
+}
+RM_INLINE u8
+rm_norm2_u8x4(const u8x4 v) {
+    return rm_dot_u8x4(v, v);
+}
+RM_INLINE u16
+rm_norm2_u16x2(const u16x2 v) {
+    return rm_dot_u16x2(v, v);
+}
+RM_INLINE u16
+rm_norm2_u16x3(const u16x3 v) {
+    return rm_dot_u16x3(v, v);
+}
+RM_INLINE u16
+rm_norm2_u16x4(const u16x4 v) {
+    return rm_dot_u16x4(v, v);
+}
+RM_INLINE u32
+rm_norm2_u32x2(const u32x2 v) {
+    return rm_dot_u32x2(v, v);
+}
+RM_INLINE u32
+rm_norm2_u32x3(const u32x3 v) {
+    return rm_dot_u32x3(v, v);
+}
+RM_INLINE u32
+rm_norm2_u32x4(const u32x4 v) {
+    return rm_dot_u32x4(v, v);
+}
+RM_INLINE u64
+rm_norm2_u64x2(const u64x2 v) {
+    return rm_dot_u64x2(v, v);
+}
+RM_INLINE u64
+rm_norm2_u64x3(const u64x3 v) {
+    return rm_dot_u64x3(v, v);
+}
+RM_INLINE u64
+rm_norm2_u64x4(const u64x4 v) {
+    return rm_dot_u64x4(v, v);
+}
+RM_INLINE i8
+rm_norm2_i8x2(const i8x2 v) {
+    return rm_dot_i8x2(v, v);
+}
+RM_INLINE i8
+rm_norm2_i8x3(const i8x3 v) {
+    return rm_dot_i8x3(v, v);
+}
+RM_INLINE i8
+rm_norm2_i8x4(const i8x4 v) {
+    return rm_dot_i8x4(v, v);
+}
+RM_INLINE i16
+rm_norm2_i16x2(const i16x2 v) {
+    return rm_dot_i16x2(v, v);
+}
+RM_INLINE i16
+rm_norm2_i16x3(const i16x3 v) {
+    return rm_dot_i16x3(v, v);
+}
+RM_INLINE i16
+rm_norm2_i16x4(const i16x4 v) {
+    return rm_dot_i16x4(v, v);
+}
+RM_INLINE i32
+rm_norm2_i32x2(const i32x2 v) {
+    return rm_dot_i32x2(v, v);
+}
+RM_INLINE i32
+rm_norm2_i32x3(const i32x3 v) {
+    return rm_dot_i32x3(v, v);
+}
+RM_INLINE i32
+rm_norm2_i32x4(const i32x4 v) {
+    return rm_dot_i32x4(v, v);
+}
+RM_INLINE i64
+rm_norm2_i64x2(const i64x2 v) {
+    return rm_dot_i64x2(v, v);
+}
+RM_INLINE i64
+rm_norm2_i64x3(const i64x3 v) {
+    return rm_dot_i64x3(v, v);
+}
+RM_INLINE i64
+rm_norm2_i64x4(const i64x4 v) {
+    return rm_dot_i64x4(v, v);
+}
+RM_INLINE f32
+rm_norm2_f32x2(const f32x2 v) {
+    return rm_dot_f32x2(v, v);
+}
+RM_INLINE f32
+rm_norm2_f32x3(const f32x3 v) {
+    return rm_dot_f32x3(v, v);
+}
+RM_INLINE f32
+rm_norm2_f32x4(const f32x4 v) {
+    return rm_dot_f32x4(v, v);
+}
+RM_INLINE f64
+rm_norm2_f64x2(const f64x2 v) {
+#if defined(RM_SSE2)
+    return rmmd_norm2(rmmd_load(v.raw));
+#else
+    return rm_dot_f64x2(v, v);
+#endif
+}
+RM_INLINE f64
+rm_norm2_f64x3(const f64x3 v) {
+    return rm_dot_f64x3(v, v);
+}
+RM_INLINE f64
+rm_norm2_f64x4(const f64x4 v) {
+#if defined(RM_AVX)
+    return rmm256d_norm2(rmm256d_load(v.raw));
+#else
+    return rm_dot_f64x4(v, v);
+#endif
+}
+RM_INLINE f32
+rm_norm_u8x2(const u8x2 v) {
+    return rm_sqrt_f32(rm_norm2_u8x2(v));
+}
+RM_INLINE f32
+rm_norm_u8x3(const u8x3 v) {
+    return rm_sqrt_f32(rm_norm2_u8x3(v));
+}
+RM_INLINE f32
+rm_norm_u8x4(const u8x4 v) {
+    return rm_sqrt_f32(rm_norm2_u8x4(v));
+}
+RM_INLINE f32
+rm_norm_u16x2(const u16x2 v) {
+    return rm_sqrt_f32(rm_norm2_u16x2(v));
+}
+RM_INLINE f32
+rm_norm_u16x3(const u16x3 v) {
+    return rm_sqrt_f32(rm_norm2_u16x3(v));
+}
+RM_INLINE f32
+rm_norm_u16x4(const u16x4 v) {
+    return rm_sqrt_f32(rm_norm2_u16x4(v));
+}
+RM_INLINE f32
+rm_norm_u32x2(const u32x2 v) {
+    return rm_sqrt_f32(rm_norm2_u32x2(v));
+}
+RM_INLINE f32
+rm_norm_u32x3(const u32x3 v) {
+    return rm_sqrt_f32(rm_norm2_u32x3(v));
+}
+RM_INLINE f32
+rm_norm_u32x4(const u32x4 v) {
+    return rm_sqrt_f32(rm_norm2_u32x4(v));
+}
+RM_INLINE f64
+rm_norm_u64x2(const u64x2 v) {
+    return rm_sqrt_f64(rm_norm2_u64x2(v));
+}
+RM_INLINE f64
+rm_norm_u64x3(const u64x3 v) {
+    return rm_sqrt_f64(rm_norm2_u64x3(v));
+}
+RM_INLINE f64
+rm_norm_u64x4(const u64x4 v) {
+    return rm_sqrt_f64(rm_norm2_u64x4(v));
+}
+RM_INLINE f32
+rm_norm_i8x2(const i8x2 v) {
+    return rm_sqrt_f32(rm_norm2_i8x2(v));
+}
+RM_INLINE f32
+rm_norm_i8x3(const i8x3 v) {
+    return rm_sqrt_f32(rm_norm2_i8x3(v));
+}
+RM_INLINE f32
+rm_norm_i8x4(const i8x4 v) {
+    return rm_sqrt_f32(rm_norm2_i8x4(v));
+}
+RM_INLINE f32
+rm_norm_i16x2(const i16x2 v) {
+    return rm_sqrt_f32(rm_norm2_i16x2(v));
+}
+RM_INLINE f32
+rm_norm_i16x3(const i16x3 v) {
+    return rm_sqrt_f32(rm_norm2_i16x3(v));
+}
+RM_INLINE f32
+rm_norm_i16x4(const i16x4 v) {
+    return rm_sqrt_f32(rm_norm2_i16x4(v));
+}
+RM_INLINE f32
+rm_norm_i32x2(const i32x2 v) {
+    return rm_sqrt_f32(rm_norm2_i32x2(v));
+}
+RM_INLINE f32
+rm_norm_i32x3(const i32x3 v) {
+    return rm_sqrt_f32(rm_norm2_i32x3(v));
+}
+RM_INLINE f32
+rm_norm_i32x4(const i32x4 v) {
+    return rm_sqrt_f32(rm_norm2_i32x4(v));
+}
+RM_INLINE f64
+rm_norm_i64x2(const i64x2 v) {
+    return rm_sqrt_f64(rm_norm2_i64x2(v));
+}
+RM_INLINE f64
+rm_norm_i64x3(const i64x3 v) {
+    return rm_sqrt_f64(rm_norm2_i64x3(v));
+}
+RM_INLINE f64
+rm_norm_i64x4(const i64x4 v) {
+    return rm_sqrt_f64(rm_norm2_i64x4(v));
+}
+RM_INLINE f32
+rm_norm_f32x2(const f32x2 v) {
+    return rm_sqrt_f32(rm_norm2_f32x2(v));
+}
+RM_INLINE f32
+rm_norm_f32x3(const f32x3 v) {
+    return rm_sqrt_f32(rm_norm2_f32x3(v));
+}
+RM_INLINE f32
+rm_norm_f32x4(const f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_norm(rmm_load(v.raw));
+#else
+    return rm_sqrt_f32(rm_norm2_f32x4(v));
+#endif
+}
+RM_INLINE f64
+rm_norm_f64x2(const f64x2 v) {
+#if defined(RM_SSE2)
+    return rmmd_norm(rmmd_load(v.raw));
+#else
+    return rm_sqrt_f64(rm_norm2_f64x2(v));
+#endif
+}
+RM_INLINE f64
+rm_norm_f64x3(const f64x3 v) {
+    return rm_sqrt_f64(rm_norm2_f64x3(v));
+}
+RM_INLINE f64
+rm_norm_f64x4(const f64x4 v) {
+#if defined(RM_AVX)
+    return rmm256d_norm(rmm256d_load(v.raw));
+#else
+    return rm_sqrt_f64(rm_norm2_f64x4(v));
+#endif
+}
+RM_INLINE u8
+rm_norm_one_u8x2(const u8x2 v) {
+    return rm_hadd_u8x2(v);
+}
+RM_INLINE u8
+rm_norm_one_u8x3(const u8x3 v) {
+    return rm_hadd_u8x3(v);
+}
+RM_INLINE u8
+rm_norm_one_u8x4(const u8x4 v) {
+    return rm_hadd_u8x4(v);
+}
+RM_INLINE u16
+rm_norm_one_u16x2(const u16x2 v) {
+    return rm_hadd_u16x2(v);
+}
+RM_INLINE u16
+rm_norm_one_u16x3(const u16x3 v) {
+    return rm_hadd_u16x3(v);
+}
+RM_INLINE u16
+rm_norm_one_u16x4(const u16x4 v) {
+    return rm_hadd_u16x4(v);
+}
+RM_INLINE u32
+rm_norm_one_u32x2(const u32x2 v) {
+    return rm_hadd_u32x2(v);
+}
+RM_INLINE u32
+rm_norm_one_u32x3(const u32x3 v) {
+    return rm_hadd_u32x3(v);
+}
+RM_INLINE u32
+rm_norm_one_u32x4(const u32x4 v) {
+    return rm_hadd_u32x4(v);
+}
+RM_INLINE u64
+rm_norm_one_u64x2(const u64x2 v) {
+    return rm_hadd_u64x2(v);
+}
+RM_INLINE u64
+rm_norm_one_u64x3(const u64x3 v) {
+    return rm_hadd_u64x3(v);
+}
+RM_INLINE u64
+rm_norm_one_u64x4(const u64x4 v) {
+    return rm_hadd_u64x4(v);
+}
+RM_INLINE i8
+rm_norm_one_i8x2(const i8x2 v) {
+    return rm_hadd_i8x2(rm_abs_i8x2(v));
+}
+RM_INLINE i8
+rm_norm_one_i8x3(const i8x3 v) {
+    return rm_hadd_i8x3(rm_abs_i8x3(v));
+}
+RM_INLINE i8
+rm_norm_one_i8x4(const i8x4 v) {
+    return rm_hadd_i8x4(rm_abs_i8x4(v));
+}
+RM_INLINE i16
+rm_norm_one_i16x2(const i16x2 v) {
+    return rm_hadd_i16x2(rm_abs_i16x2(v));
+}
+RM_INLINE i16
+rm_norm_one_i16x3(const i16x3 v) {
+    return rm_hadd_i16x3(rm_abs_i16x3(v));
+}
+RM_INLINE i16
+rm_norm_one_i16x4(const i16x4 v) {
+    return rm_hadd_i16x4(rm_abs_i16x4(v));
+}
+RM_INLINE i32
+rm_norm_one_i32x2(const i32x2 v) {
+    return rm_hadd_i32x2(rm_abs_i32x2(v));
+}
+RM_INLINE i32
+rm_norm_one_i32x3(const i32x3 v) {
+    return rm_hadd_i32x3(rm_abs_i32x3(v));
+}
+RM_INLINE i32
+rm_norm_one_i32x4(const i32x4 v) {
+    return rm_hadd_i32x4(rm_abs_i32x4(v));
+}
+RM_INLINE i64
+rm_norm_one_i64x2(const i64x2 v) {
+    return rm_hadd_i64x2(rm_abs_i64x2(v));
+}
+RM_INLINE i64
+rm_norm_one_i64x3(const i64x3 v) {
+    return rm_hadd_i64x3(rm_abs_i64x3(v));
+}
+RM_INLINE i64
+rm_norm_one_i64x4(const i64x4 v) {
+    return rm_hadd_i64x4(rm_abs_i64x4(v));
+}
+RM_INLINE f32
+rm_norm_one_f32x2(const f32x2 v) {
+    return rm_hadd_f32x2(rm_abs_f32x2(v));
+}
+RM_INLINE f32
+rm_norm_one_f32x3(const f32x3 v) {
+    return rm_hadd_f32x3(rm_abs_f32x3(v));
+}
+RM_INLINE f32
+rm_norm_one_f32x4(const f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_norm_one(rmm_load(v.raw));
+#else
+    return rm_hadd_f32x4(rm_abs_f32x4(v));
+#endif
+}
+RM_INLINE f64
+rm_norm_one_f64x2(const f64x2 v) {
+#if defined(RM_SSE2)
+    return rmmd_norm_one(rmmd_load(v.raw));
+#else
+    return rm_hadd_f64x2(rm_abs_f64x2(v));
+#endif
+}
+RM_INLINE f64
+rm_norm_one_f64x3(const f64x3 v) {
+    return rm_hadd_f64x3(rm_abs_f64x3(v));
+}
+RM_INLINE f64
+rm_norm_one_f64x4(const f64x4 v) {
+#if defined(RM_AVX)
+    return rmm256d_norm_one(rmm256d_load(v.raw));
+#else
+    return rm_hadd_f64x4(rm_abs_f64x4(v));
+#endif
+}
+RM_INLINE u8
+rm_norm_inf_u8x2(const u8x2 v) {
+    return rm_maxv_u8x2(v);
+}
+RM_INLINE u8
+rm_norm_inf_u8x3(const u8x3 v) {
+    return rm_maxv_u8x3(v);
+}
+RM_INLINE u8
+rm_norm_inf_u8x4(const u8x4 v) {
+    return rm_maxv_u8x4(v);
+}
+RM_INLINE u16
+rm_norm_inf_u16x2(const u16x2 v) {
+    return rm_maxv_u16x2(v);
+}
+RM_INLINE u16
+rm_norm_inf_u16x3(const u16x3 v) {
+    return rm_maxv_u16x3(v);
+}
+RM_INLINE u16
+rm_norm_inf_u16x4(const u16x4 v) {
+    return rm_maxv_u16x4(v);
+}
+RM_INLINE u32
+rm_norm_inf_u32x2(const u32x2 v) {
+    return rm_maxv_u32x2(v);
+}
+RM_INLINE u32
+rm_norm_inf_u32x3(const u32x3 v) {
+    return rm_maxv_u32x3(v);
+}
+RM_INLINE u32
+rm_norm_inf_u32x4(const u32x4 v) {
+    return rm_maxv_u32x4(v);
+}
+RM_INLINE u64
+rm_norm_inf_u64x2(const u64x2 v) {
+    return rm_maxv_u64x2(v);
+}
+RM_INLINE u64
+rm_norm_inf_u64x3(const u64x3 v) {
+    return rm_maxv_u64x3(v);
+}
+RM_INLINE u64
+rm_norm_inf_u64x4(const u64x4 v) {
+    return rm_maxv_u64x4(v);
+}
+RM_INLINE i8
+rm_norm_inf_i8x2(const i8x2 v) {
+    return rm_maxv_i8x2(rm_abs_i8x2(v));
+}
+RM_INLINE i8
+rm_norm_inf_i8x3(const i8x3 v) {
+    return rm_maxv_i8x3(rm_abs_i8x3(v));
+}
+RM_INLINE i8
+rm_norm_inf_i8x4(const i8x4 v) {
+    return rm_maxv_i8x4(rm_abs_i8x4(v));
+}
+RM_INLINE i16
+rm_norm_inf_i16x2(const i16x2 v) {
+    return rm_maxv_i16x2(rm_abs_i16x2(v));
+}
+RM_INLINE i16
+rm_norm_inf_i16x3(const i16x3 v) {
+    return rm_maxv_i16x3(rm_abs_i16x3(v));
+}
+RM_INLINE i16
+rm_norm_inf_i16x4(const i16x4 v) {
+    return rm_maxv_i16x4(rm_abs_i16x4(v));
+}
+RM_INLINE i32
+rm_norm_inf_i32x2(const i32x2 v) {
+    return rm_maxv_i32x2(rm_abs_i32x2(v));
+}
+RM_INLINE i32
+rm_norm_inf_i32x3(const i32x3 v) {
+    return rm_maxv_i32x3(rm_abs_i32x3(v));
+}
+RM_INLINE i32
+rm_norm_inf_i32x4(const i32x4 v) {
+    return rm_maxv_i32x4(rm_abs_i32x4(v));
+}
+RM_INLINE i64
+rm_norm_inf_i64x2(const i64x2 v) {
+    return rm_maxv_i64x2(rm_abs_i64x2(v));
+}
+RM_INLINE i64
+rm_norm_inf_i64x3(const i64x3 v) {
+    return rm_maxv_i64x3(rm_abs_i64x3(v));
+}
+RM_INLINE i64
+rm_norm_inf_i64x4(const i64x4 v) {
+    return rm_maxv_i64x4(rm_abs_i64x4(v));
+}
+RM_INLINE f32
+rm_norm_inf_f32x2(const f32x2 v) {
+    return rm_maxv_f32x2(rm_abs_f32x2(v));
+}
+RM_INLINE f32
+rm_norm_inf_f32x3(const f32x3 v) {
+    return rm_maxv_f32x3(rm_abs_f32x3(v));
+}
+RM_INLINE f32
+rm_norm_inf_f32x4(const f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_norm_inf(rmm_load(v.raw));
+#else
+    return rm_maxv_f32x4(rm_abs_f32x4(v));
+#endif
+}
+RM_INLINE f64
+rm_norm_inf_f64x2(const f64x2 v) {
+#if defined(RM_SSE2)
+    return rmmd_norm_inf(rmmd_load(v.raw));
+#else
+    return rm_maxv_f64x2(rm_abs_f64x2(v));
+#endif
+}
+RM_INLINE f64
+rm_norm_inf_f64x3(const f64x3 v) {
+    return rm_maxv_f64x3(rm_abs_f64x3(v));
+}
+RM_INLINE f64
+rm_norm_inf_f64x4(const f64x4 v) {
+#if defined(RM_AVX)
+    return rmm256d_norm_inf(rmm256d_load(v.raw));
+#else
+    return rm_maxv_f64x4(rm_abs_f64x4(v));
+#endif
+}
+RM_INLINE f32x2
+rm_normalize_f32x2(const f32x2 v) {
+#if defined(RM_FAST_RSQRT)
+    f32 norm2;
+
+    norm2 = rm_norm2_f32x2(v);
+
+    if (norm2 == 0.0f) { return rm_zero_f32x2(); }
+
+    return rm_muls_f32x2(v, rm_rsqrt_f32(norm2));
+#else
+    f32 norm;
+
+    norm = rm_norm_f32x2(v);
+
+    if (norm == 0.0f) { return rm_zero_f32x2(); }
+
+    return rm_muls_f32x2(v, 1.0f / norm);
+#endif
+}
+RM_INLINE f32x3
+rm_normalize_f32x3(const f32x3 v) {
+#if defined(RM_FAST_RSQRT)
+    f32 norm2;
+
+    norm2 = rm_norm2_f32x3(v);
+
+    if (norm2 == 0.0f) { return rm_zero_f32x3(); }
+
+    return rm_muls_f32x3(v, rm_rsqrt_f32(norm2));
+#else
+    f32 norm;
+
+    norm = rm_norm_f32x3(v);
+
+    if (norm == 0.0f) { return rm_zero_f32x3(); }
+
+    return rm_muls_f32x3(v, 1.0f / norm);
+#endif
+}
+RM_INLINE f32x4
+rm_normalize_f32x4(const f32x4 v) {
+#if defined(RM_FAST_RSQRT) && defined(RM_SIMD_F32X4)
+    f32x4 dest;
+    rmv_f32x4 x, n;
+
+    x = rmm_load(v.raw);
+    n = rmm_vdots(x, x);
+
+    /* the mask keeps a zero vector at zero instead of 0 * inf */
+    rmm_store(dest.raw, rmm_and(rmm_mul(x, rmm_rsqrt(n)),
+                                rmm_cmpneq(n, rmm_setzero())));
+    return dest;
+#elif defined(RM_FAST_RSQRT)
+    f32 norm2;
+
+    norm2 = rm_norm2_f32x4(v);
+
+    if (norm2 == 0.0f) { return rm_zero_f32x4(); }
+
+    return rm_muls_f32x4(v, rm_rsqrt_f32(norm2));
+#else
+    f32 norm;
+
+    norm = rm_norm_f32x4(v);
+
+    if (norm == 0.0f) { return rm_zero_f32x4(); }
+
+    return rm_muls_f32x4(v, 1.0f / norm);
+#endif
+}
+RM_INLINE f64x2
+rm_normalize_f64x2(const f64x2 v) {
+#if defined(RM_SSE2)
+    f64x2 dest;
+    __m128d x, n;
+
+    x = rmmd_load(v.raw);
+    n = _mm_sqrt_pd(rmmd_vdots(x, x));
+
+    /* the mask keeps a zero vector at zero instead of 0 / 0 */
+    rmmd_store(dest.raw, _mm_and_pd(_mm_div_pd(x, n),
+                                    _mm_cmpneq_pd(n, _mm_setzero_pd())));
+    return dest;
+#else
+    f64 norm;
+
+    norm = rm_norm_f64x2(v);
+
+    if (norm == 0.0f) { return rm_zero_f64x2(); }
+
+    return rm_muls_f64x2(v, 1.0 / norm);
+#endif
+}
+RM_INLINE f64x3
+rm_normalize_f64x3(const f64x3 v) {
+    f64 norm;
+
+    norm = rm_norm_f64x3(v);
+
+    if (norm == 0.0f) { return rm_zero_f64x3(); }
+
+    return rm_muls_f64x3(v, 1.0 / norm);
+}
+RM_INLINE f64x4
+rm_normalize_f64x4(const f64x4 v) {
+#if defined(RM_AVX)
+    f64x4 dest;
+    __m256d x, n;
+
+    x = rmm256d_load(v.raw);
+    n = _mm256_sqrt_pd(rmm256d_vdots(x, x));
+
+    /* the mask keeps a zero vector at zero instead of 0 / 0 */
+    rmm256d_store(dest.raw,
+                  _mm256_and_pd(_mm256_div_pd(x, n),
+                                _mm256_cmp_pd(n, _mm256_setzero_pd(),
+                                              _CMP_NEQ_UQ)));
+    return dest;
+#else
+    f64 norm;
+
+    norm = rm_norm_f64x4(v);
+
+    if (norm == 0.0f) { return rm_zero_f64x4(); }
+
+    return rm_muls_f64x4(v, 1.0 / norm);
+#endif
+}
+RM_INLINE u8
+rm_cross_u8x2(const u8x2 a, const u8x2 b) {
+    return a.x * b.y - a.y * b.x;
+}
+RM_INLINE u8x3
+rm_cross_u8x3(const u8x3 a, u8x3 b) {
+    return rm_u8x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+                   a.x * b.y - a.y * b.x);
+}
+RM_INLINE u16
+rm_cross_u16x2(const u16x2 a, const u16x2 b) {
+    return a.x * b.y - a.y * b.x;
+}
+RM_INLINE u16x3
+rm_cross_u16x3(const u16x3 a, u16x3 b) {
+    return rm_u16x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+                    a.x * b.y - a.y * b.x);
+}
+RM_INLINE u32
+rm_cross_u32x2(const u32x2 a, const u32x2 b) {
+    return a.x * b.y - a.y * b.x;
+}
+RM_INLINE u32x3
+rm_cross_u32x3(const u32x3 a, u32x3 b) {
+    return rm_u32x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+                    a.x * b.y - a.y * b.x);
+}
+RM_INLINE u64
+rm_cross_u64x2(const u64x2 a, const u64x2 b) {
+    return a.x * b.y - a.y * b.x;
+}
+RM_INLINE u64x3
+rm_cross_u64x3(const u64x3 a, u64x3 b) {
+    return rm_u64x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+                    a.x * b.y - a.y * b.x);
+}
+RM_INLINE i8
+rm_cross_i8x2(const i8x2 a, const i8x2 b) {
+    return a.x * b.y - a.y * b.x;
+}
+RM_INLINE i8x3
+rm_cross_i8x3(const i8x3 a, i8x3 b) {
+    return rm_i8x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+                   a.x * b.y - a.y * b.x);
+}
+RM_INLINE i16
+rm_cross_i16x2(const i16x2 a, const i16x2 b) {
+    return a.x * b.y - a.y * b.x;
+}
+RM_INLINE i16x3
+rm_cross_i16x3(const i16x3 a, i16x3 b) {
+    return rm_i16x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+                    a.x * b.y - a.y * b.x);
+}
+RM_INLINE i32
+rm_cross_i32x2(const i32x2 a, const i32x2 b) {
+    return a.x * b.y - a.y * b.x;
+}
+RM_INLINE i32x3
+rm_cross_i32x3(const i32x3 a, i32x3 b) {
+    return rm_i32x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+                    a.x * b.y - a.y * b.x);
+}
+RM_INLINE i64
+rm_cross_i64x2(const i64x2 a, const i64x2 b) {
+    return a.x * b.y - a.y * b.x;
+}
+RM_INLINE i64x3
+rm_cross_i64x3(const i64x3 a, i64x3 b) {
+    return rm_i64x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+                    a.x * b.y - a.y * b.x);
+}
+RM_INLINE f32
+rm_cross_f32x2(const f32x2 a, const f32x2 b) {
+    return a.x * b.y - a.y * b.x;
+}
+RM_INLINE f32x3
+rm_cross_f32x3(const f32x3 a, f32x3 b) {
+    return rm_f32x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+                    a.x * b.y - a.y * b.x);
+}
+RM_INLINE f32x3
+rm_crossn_f32x3(const f32x3 a, f32x3 b) {
+    return rm_normalize_f32x3(rm_cross_f32x3(a, b));
+}
+RM_INLINE f64
+rm_cross_f64x2(const f64x2 a, const f64x2 b) {
+#if defined(RM_SSE2)
+    __m128d xb, x0;
+
+    xb = rmmd_load(b.raw);
+    x0 = _mm_mul_pd(rmmd_load(a.raw), _mm_shuffle_pd(xb, xb, 1));
+
+    return _mm_cvtsd_f64(_mm_sub_sd(x0, _mm_unpackhi_pd(x0, x0)));
+#else
+    return a.x * b.y - a.y * b.x;
+#endif
+}
+RM_INLINE f64x3
+rm_cross_f64x3(const f64x3 a, f64x3 b) {
+    return rm_f64x3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+                    a.x * b.y - a.y * b.x);
+}
+RM_INLINE f64x3
+rm_crossn_f64x3(const f64x3 a, f64x3 b) {
+    return rm_normalize_f64x3(rm_cross_f64x3(a, b));
+}
+RM_INLINE u8
+rm_distance2_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_pow2_u8(a.x - b.x) + rm_pow2_u8(a.y - b.y);
+}
+RM_INLINE u8
+rm_distance2_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_pow2_u8(a.x - b.x) + rm_pow2_u8(a.y - b.y) +
+           rm_pow2_u8(a.z - b.z);
+}
+RM_INLINE u8
+rm_distance2_u8x4(const u8x4 a, const u8x4 b) {
+    return rm_pow2_u8(a.x - b.x) + rm_pow2_u8(a.y - b.y) +
+           rm_pow2_u8(a.z - b.z) + rm_pow2_u8(a.w - b.w);
+}
+RM_INLINE u16
+rm_distance2_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_pow2_u16(a.x - b.x) + rm_pow2_u16(a.y - b.y);
+}
+RM_INLINE u16
+rm_distance2_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_pow2_u16(a.x - b.x) + rm_pow2_u16(a.y - b.y) +
+           rm_pow2_u16(a.z - b.z);
+}
+RM_INLINE u16
+rm_distance2_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_pow2_u16(a.x - b.x) + rm_pow2_u16(a.y - b.y) +
+           rm_pow2_u16(a.z - b.z) + rm_pow2_u16(a.w - b.w);
+}
+RM_INLINE u32
+rm_distance2_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_pow2_u32(a.x - b.x) + rm_pow2_u32(a.y - b.y);
+}
+RM_INLINE u32
+rm_distance2_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_pow2_u32(a.x - b.x) + rm_pow2_u32(a.y - b.y) +
+           rm_pow2_u32(a.z - b.z);
+}
+RM_INLINE u32
+rm_distance2_u32x4(const u32x4 a, const u32x4 b) {
+    return rm_pow2_u32(a.x - b.x) + rm_pow2_u32(a.y - b.y) +
+           rm_pow2_u32(a.z - b.z) + rm_pow2_u32(a.w - b.w);
+}
+RM_INLINE u64
+rm_distance2_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_pow2_u64(a.x - b.x) + rm_pow2_u64(a.y - b.y);
+}
+RM_INLINE u64
+rm_distance2_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_pow2_u64(a.x - b.x) + rm_pow2_u64(a.y - b.y) +
+           rm_pow2_u64(a.z - b.z);
+}
+RM_INLINE u64
+rm_distance2_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_pow2_u64(a.x - b.x) + rm_pow2_u64(a.y - b.y) +
+           rm_pow2_u64(a.z - b.z) + rm_pow2_u64(a.w - b.w);
+}
+RM_INLINE i8
+rm_distance2_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_pow2_i8(a.x - b.x) + rm_pow2_i8(a.y - b.y);
+}
+RM_INLINE i8
+rm_distance2_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_pow2_i8(a.x - b.x) + rm_pow2_i8(a.y - b.y) +
+           rm_pow2_i8(a.z - b.z);
+}
+RM_INLINE i8
+rm_distance2_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_pow2_i8(a.x - b.x) + rm_pow2_i8(a.y - b.y) +
+           rm_pow2_i8(a.z - b.z) + rm_pow2_i8(a.w - b.w);
+}
+RM_INLINE i16
+rm_distance2_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_pow2_i16(a.x - b.x) + rm_pow2_i16(a.y - b.y);
+}
+RM_INLINE i16
+rm_distance2_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_pow2_i16(a.x - b.x) + rm_pow2_i16(a.y - b.y) +
+           rm_pow2_i16(a.z - b.z);
+}
+RM_INLINE i16
+rm_distance2_i16x4(const i16x4 a, const i16x4 b) {
+    return rm_pow2_i16(a.x - b.x) + rm_pow2_i16(a.y - b.y) +
+           rm_pow2_i16(a.z - b.z) + rm_pow2_i16(a.w - b.w);
+}
+RM_INLINE i32
+rm_distance2_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_pow2_i32(a.x - b.x) + rm_pow2_i32(a.y - b.y);
+}
+RM_INLINE i32
+rm_distance2_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_pow2_i32(a.x - b.x) + rm_pow2_i32(a.y - b.y) +
+           rm_pow2_i32(a.z - b.z);
+}
+RM_INLINE i32
+rm_distance2_i32x4(const i32x4 a, const i32x4 b) {
+    return rm_pow2_i32(a.x - b.x) + rm_pow2_i32(a.y - b.y) +
+           rm_pow2_i32(a.z - b.z) + rm_pow2_i32(a.w - b.w);
+}
+RM_INLINE i64
+rm_distance2_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_pow2_i64(a.x - b.x) + rm_pow2_i64(a.y - b.y);
+}
+RM_INLINE i64
+rm_distance2_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_pow2_i64(a.x - b.x) + rm_pow2_i64(a.y - b.y) +
+           rm_pow2_i64(a.z - b.z);
+}
+RM_INLINE i64
+rm_distance2_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_pow2_i64(a.x - b.x) + rm_pow2_i64(a.y - b.y) +
+           rm_pow2_i64(a.z - b.z) + rm_pow2_i64(a.w - b.w);
+}
+RM_INLINE f32
+rm_distance2_f32x2(const f32x2 a, const f32x2 b) {
+    return rm_pow2_f32(a.x - b.x) + rm_pow2_f32(a.y - b.y);
+}
+RM_INLINE f32
+rm_distance2_f32x3(const f32x3 a, const f32x3 b) {
+    return rm_pow2_f32(a.x - b.x) + rm_pow2_f32(a.y - b.y) +
+           rm_pow2_f32(a.z - b.z);
+}
+RM_INLINE f32
+rm_distance2_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_norm2(rmm_sub(rmm_load(a.raw), rmm_load(b.raw)));
+#else
+    return rm_pow2_f32(a.x - b.x) + rm_pow2_f32(a.y - b.y) +
+           rm_pow2_f32(a.z - b.z) + rm_pow2_f32(a.w - b.w);
+#endif
+}
+RM_INLINE f64
+rm_distance2_f64x2(const f64x2 a, const f64x2 b) {
+#if defined(RM_SSE2)
+    return rmmd_norm2(_mm_sub_pd(rmmd_load(a.raw), rmmd_load(b.raw)));
+#else
+    return rm_pow2_f64(a.x - b.x) + rm_pow2_f64(a.y - b.y);
+#endif
+}
+RM_INLINE f64
+rm_distance2_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_pow2_f64(a.x - b.x) + rm_pow2_f64(a.y - b.y) +
+           rm_pow2_f64(a.z - b.z);
+}
+RM_INLINE f64
+rm_distance2_f64x4(const f64x4 a, const f64x4 b) {
+#if defined(RM_AVX)
+    return rmm256d_norm2(_mm256_sub_pd(rmm256d_load(a.raw),
+                                       rmm256d_load(b.raw)));
+#else
+    return rm_pow2_f64(a.x - b.x) + rm_pow2_f64(a.y - b.y) +
+           rm_pow2_f64(a.z - b.z) + rm_pow2_f64(a.w - b.w);
+#endif
+}
+RM_INLINE f32
+rm_distance_u8x2(const u8x2 a, const u8x2 b) {
+    return rm_sqrt_f32(rm_distance2_u8x2(a, b));
+}
+RM_INLINE f32
+rm_distance_u8x3(const u8x3 a, const u8x3 b) {
+    return rm_sqrt_f32(rm_distance2_u8x3(a, b));
+}
+RM_INLINE f32
+rm_distance_u8x4(const u8x4 a, const u8x4 b) {
+    return rm_sqrt_f32(rm_distance2_u8x4(a, b));
+}
+RM_INLINE f32
+rm_distance_u16x2(const u16x2 a, const u16x2 b) {
+    return rm_sqrt_f32(rm_distance2_u16x2(a, b));
+}
+RM_INLINE f32
+rm_distance_u16x3(const u16x3 a, const u16x3 b) {
+    return rm_sqrt_f32(rm_distance2_u16x3(a, b));
+}
+RM_INLINE f32
+rm_distance_u16x4(const u16x4 a, const u16x4 b) {
+    return rm_sqrt_f32(rm_distance2_u16x4(a, b));
+}
+RM_INLINE f32
+rm_distance_u32x2(const u32x2 a, const u32x2 b) {
+    return rm_sqrt_f32(rm_distance2_u32x2(a, b));
+}
+RM_INLINE f32
+rm_distance_u32x3(const u32x3 a, const u32x3 b) {
+    return rm_sqrt_f32(rm_distance2_u32x3(a, b));
+}
+RM_INLINE f32
+rm_distance_u32x4(const u32x4 a, const u32x4 b) {
+    return rm_sqrt_f32(rm_distance2_u32x4(a, b));
+}
+RM_INLINE f64
+rm_distance_u64x2(const u64x2 a, const u64x2 b) {
+    return rm_sqrt_f64(rm_distance2_u64x2(a, b));
+}
+RM_INLINE f64
+rm_distance_u64x3(const u64x3 a, const u64x3 b) {
+    return rm_sqrt_f64(rm_distance2_u64x3(a, b));
+}
+RM_INLINE f64
+rm_distance_u64x4(const u64x4 a, const u64x4 b) {
+    return rm_sqrt_f64(rm_distance2_u64x4(a, b));
+}
+RM_INLINE f32
+rm_distance_i8x2(const i8x2 a, const i8x2 b) {
+    return rm_sqrt_f32(rm_distance2_i8x2(a, b));
+}
+RM_INLINE f32
+rm_distance_i8x3(const i8x3 a, const i8x3 b) {
+    return rm_sqrt_f32(rm_distance2_i8x3(a, b));
+}
+RM_INLINE f32
+rm_distance_i8x4(const i8x4 a, const i8x4 b) {
+    return rm_sqrt_f32(rm_distance2_i8x4(a, b));
+}
+RM_INLINE f32
+rm_distance_i16x2(const i16x2 a, const i16x2 b) {
+    return rm_sqrt_f32(rm_distance2_i16x2(a, b));
+}
+RM_INLINE f32
+rm_distance_i16x3(const i16x3 a, const i16x3 b) {
+    return rm_sqrt_f32(rm_distance2_i16x3(a, b));
+}
+RM_INLINE f32
+rm_distance_i16x4(const i16x4 a, const i16x4 b) {
+    return rm_sqrt_f32(rm_distance2_i16x4(a, b));
+}
+RM_INLINE f32
+rm_distance_i32x2(const i32x2 a, const i32x2 b) {
+    return rm_sqrt_f32(rm_distance2_i32x2(a, b));
+}
+RM_INLINE f32
+rm_distance_i32x3(const i32x3 a, const i32x3 b) {
+    return rm_sqrt_f32(rm_distance2_i32x3(a, b));
+}
+RM_INLINE f32
+rm_distance_i32x4(const i32x4 a, const i32x4 b) {
+    return rm_sqrt_f32(rm_distance2_i32x4(a, b));
+}
+RM_INLINE f64
+rm_distance_i64x2(const i64x2 a, const i64x2 b) {
+    return rm_sqrt_f64(rm_distance2_i64x2(a, b));
+}
+RM_INLINE f64
+rm_distance_i64x3(const i64x3 a, const i64x3 b) {
+    return rm_sqrt_f64(rm_distance2_i64x3(a, b));
+}
+RM_INLINE f64
+rm_distance_i64x4(const i64x4 a, const i64x4 b) {
+    return rm_sqrt_f64(rm_distance2_i64x4(a, b));
+}
+RM_INLINE f32
+rm_distance_f32x2(const f32x2 a, const f32x2 b) {
+#if defined(RM_FAST_RSQRT)
+    f32 d2;
+
+    d2 = rm_distance2_f32x2(a, b);
+
+    return (d2 == 0.0f) ? 0.0f : d2 * rm_rsqrt_f32(d2);
+#else
+    return rm_sqrt_f32(rm_distance2_f32x2(a, b));
+#endif
+}
+RM_INLINE f32
+rm_distance_f32x3(const f32x3 a, const f32x3 b) {
+#if defined(RM_FAST_RSQRT)
+    f32 d2;
+
+    d2 = rm_distance2_f32x3(a, b);
+
+    return (d2 == 0.0f) ? 0.0f : d2 * rm_rsqrt_f32(d2);
+#else
+    return rm_sqrt_f32(rm_distance2_f32x3(a, b));
+#endif
+}
+RM_INLINE f32
+rm_distance_f32x4(const f32x4 a, const f32x4 b) {
+#if defined(RM_FAST_RSQRT) && defined(RM_SIMD_F32X4)
+    rmv_f32x4 d, d2;
+
+    d  = rmm_sub(rmm_load(a.raw), rmm_load(b.raw));
+    d2 = rmm_vdots(d, d);
+
+    return rmm_cvtf32(rmm_and(rmm_mul(d2, rmm_rsqrt(d2)),
+                              rmm_cmpneq(d2, rmm_setzero())));
+#elif defined(RM_FAST_RSQRT)
+    f32 d2;
+
+    d2 = rm_distance2_f32x4(a, b);
+
+    return (d2 == 0.0f) ? 0.0f : d2 * rm_rsqrt_f32(d2);
+#elif defined(RM_SIMD_F32X4)
+    return rmm_norm(rmm_sub(rmm_load(a.raw), rmm_load(b.raw)));
+#else
+    return rm_sqrt_f32(rm_distance2_f32x4(a, b));
+#endif
+}
+RM_INLINE f64
+rm_distance_f64x2(const f64x2 a, const f64x2 b) {
+#if defined(RM_SSE2)
+    return rmmd_norm(_mm_sub_pd(rmmd_load(a.raw), rmmd_load(b.raw)));
+#else
+    return rm_sqrt_f64(rm_distance2_f64x2(a, b));
+#endif
+}
+RM_INLINE f64
+rm_distance_f64x3(const f64x3 a, const f64x3 b) {
+    return rm_sqrt_f64(rm_distance2_f64x3(a, b));
+}
+RM_INLINE f64
+rm_distance_f64x4(const f64x4 a, const f64x4 b) {
+#if defined(RM_AVX)
+    return rmm256d_norm(_mm256_sub_pd(rmm256d_load(a.raw),
+                                      rmm256d_load(b.raw)));
+#else
+    return rm_sqrt_f64(rm_distance2_f64x4(a, b));
+#endif
+}
+
+// REGISTERS
+/*
+ * the f32x4 api on rmv_f32x4 (__m128 or float32x4_t) instead of the struct,
+ * so a chain of calls never goes through memory in between. rmv_from_f32x4
+ * and rmv_to_f32x4 convert at the ends
+ */
+RM_INLINE rmv_f32x4
+rmv_from_f32x4(const f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_load(v.raw);
+#else
+    return v;
+#endif
+}
+RM_INLINE f32x4
+rmv_to_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
+    rmm_store(dest.raw, v);
+    return dest;
+#else
+    return v;
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_loadu_f32x4(const f32 *p) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_loadu(p);
+#else
+    return rm_f32x4(p[0], p[1], p[2], p[3]);
+#endif
+}
+RM_INLINE void
+rmv_storeu_f32x4(f32 *p, const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    rmm_storeu(p, v);
+#else
+    p[0] = v.x;
+    p[1] = v.y;
+    p[2] = v.z;
+    p[3] = v.w;
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_set1_f32x4(const f32 s) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_set1(s);
+#else
+    return rm_f32x4s(s);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_setr_f32x4(const f32 x, const f32 y, const f32 z, const f32 w) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_setr(x, y, z, w);
+#else
+    return rm_f32x4(x, y, z, w);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_zero_f32x4(void) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_setzero();
+#else
+    return rm_zero_f32x4();
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_add_f32x4(const rmv_f32x4 a, const rmv_f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_add(a, b);
+#else
+    return rm_add_f32x4(a, b);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_sub_f32x4(const rmv_f32x4 a, const rmv_f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_sub(a, b);
+#else
+    return rm_sub_f32x4(a, b);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_mul_f32x4(const rmv_f32x4 a, const rmv_f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_mul(a, b);
+#else
+    return rm_mul_f32x4(a, b);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_div_f32x4(const rmv_f32x4 a, const rmv_f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_div(a, b);
+#else
+    return rm_div_f32x4(a, b);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_min_f32x4(const rmv_f32x4 a, const rmv_f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_min(a, b);
+#else
+    return rm_min_f32x4(a, b);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_max_f32x4(const rmv_f32x4 a, const rmv_f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_max(a, b);
+#else
+    return rm_max_f32x4(a, b);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_adds_f32x4(const rmv_f32x4 v, const f32 s) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_add(v, rmm_set1(s));
+#else
+    return rm_adds_f32x4(v, s);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_muls_f32x4(const rmv_f32x4 v, const f32 s) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_mul(v, rmm_set1(s));
+#else
+    return rm_muls_f32x4(v, s);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_fma_f32x4(const rmv_f32x4 a, const rmv_f32x4 b, const rmv_f32x4 c) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_fmadd(a, b, c);
+#else
+    return rm_fma_f32x4(a, b, c);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_clamp_f32x4(const rmv_f32x4 v, const rmv_f32x4 min, const rmv_f32x4 max) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_min(rmm_max(v, min), max);
+#else
+    return rm_clamp_f32x4(v, min, max);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_neg_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_neg(v);
+#else
+    return rm_neg_f32x4(v);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_abs_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_abs(v);
+#else
+    return rm_abs_f32x4(v);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_floor_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_floor(v);
+#else
+    return rm_floor_f32x4(v);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_ceil_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_ceil(v);
+#else
+    return rm_ceil_f32x4(v);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_round_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_round(v);
+#else
+    return rm_round_f32x4(v);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_trunc_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_trunc(v);
+#else
+    return rm_trunc_f32x4(v);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_sin_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    return rmm_sin(v);
+#else
+    return rmv_from_f32x4(rm_sin_f32x4(rmv_to_f32x4(v)));
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_cos_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    return rmm_cos(v);
+#else
+    return rmv_from_f32x4(rm_cos_f32x4(rmv_to_f32x4(v)));
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_exp_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4) && defined(RM_PRECISION_FAST)
+    return rmm_exp_fast(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    return rmm_exp(v);
+#else
+    return rmv_from_f32x4(rm_exp_f32x4(rmv_to_f32x4(v)));
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_exp2_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4) && defined(RM_PRECISION_FAST)
+    return rmm_exp2_fast(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    return rmm_exp2(v);
+#else
+    return rmv_from_f32x4(rm_exp2_f32x4(rmv_to_f32x4(v)));
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_log_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4) && defined(RM_PRECISION_FAST)
+    return rmm_log_fast(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    return rmm_log(v);
+#else
+    return rmv_from_f32x4(rm_log_f32x4(rmv_to_f32x4(v)));
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_log2_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4) && defined(RM_PRECISION_FAST)
+    return rmm_log2_fast(v);
+#elif defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    return rmm_log2(v);
+#else
+    return rmv_from_f32x4(rm_log2_f32x4(rmv_to_f32x4(v)));
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_fract_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_sub(v, rmm_floor(v));
+#else
+    return rm_fract_f32x4(v);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_sqrt_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4) && defined(RM_PRECISION_FAST)
+    return rmm_sqrt_fast(v);
+#elif defined(RM_SIMD_F32X4)
+    return rmm_sqrt(v);
+#else
+    return rm_f32x4(rm_sqrt_f32(v.x), rm_sqrt_f32(v.y), rm_sqrt_f32(v.z),
+                    rm_sqrt_f32(v.w));
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_rsqrt_f32x4(const rmv_f32x4 v) {
+#if defined(RM_FAST_RSQRT) && defined(RM_SIMD_F32X4)
+    return rmm_rsqrt(v);
+#elif defined(RM_SIMD_F32X4)
+    return rmm_div(rmm_set1(1.0f), rmm_sqrt(v));
+#else
+    return rm_rsqrt_f32x4(v);
+#endif
+}
+RM_INLINE void
+rmv_sincos_f32x4(const rmv_f32x4 v, rmv_f32x4 *s, rmv_f32x4 *c) {
+#if defined(RM_SIMD_F32X4) && !defined(RM_PRECISION_EXACT)
+    rmm_sincos(v, s, c);
+#elif defined(RM_SIMD_F32X4)
+    f32x4 ts, tc;
+
+    rm_sincos_f32x4(rmv_to_f32x4(v), &ts, &tc);
+    *s = rmv_from_f32x4(ts);
+    *c = rmv_from_f32x4(tc);
+#else
+    rm_sincos_f32x4(v, s, c);
+#endif
+}
+/*
+ * the _fast versions, see the precision tiers at the top. sin, cos and
+ * sincos are only good for |x| <= RM_TRIG_MAX_F32
+ */
+RM_INLINE rmv_f32x4
+rmv_sqrt_fast_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_sqrt_fast(v);
+#else
+    return rm_f32x4(rm_sqrt_fast_f32(v.x), rm_sqrt_fast_f32(v.y),
+                    rm_sqrt_fast_f32(v.z), rm_sqrt_fast_f32(v.w));
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_rsqrt_fast_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_rsqrt(v);
+#else
+    return rm_rsqrt_fast_f32x4(v);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_sin_fast_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_sin_fast(v);
+#else
+    return rm_sin_fast_f32x4(v);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_cos_fast_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_cos_fast(v);
+#else
+    return rm_cos_fast_f32x4(v);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_exp_fast_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_exp_fast(v);
+#else
+    return rm_exp_fast_f32x4(v);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_exp2_fast_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_exp2_fast(v);
+#else
+    return rm_exp2_fast_f32x4(v);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_log_fast_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_log_fast(v);
+#else
+    return rm_log_fast_f32x4(v);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_log2_fast_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_log2_fast(v);
+#else
+    return rm_log2_fast_f32x4(v);
+#endif
+}
+RM_INLINE void
+rmv_sincos_fast_f32x4(const rmv_f32x4 v, rmv_f32x4 *s, rmv_f32x4 *c) {
+#if defined(RM_SIMD_F32X4)
+    rmm_sincos_fast(v, s, c);
+#else
+    rm_sincos_fast_f32x4(v, s, c);
+#endif
+}
+RM_INLINE maskf32x4
+rmv_eq_f32x4(const rmv_f32x4 a, const rmv_f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_cmpeq(a, b);
+#else
+    return rm_eqm_f32x4(a, b);
+#endif
+}
+RM_INLINE maskf32x4
+rmv_neq_f32x4(const rmv_f32x4 a, const rmv_f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_cmpneq(a, b);
+#else
+    return rm_neqm_f32x4(a, b);
+#endif
+}
+RM_INLINE maskf32x4
+rmv_lt_f32x4(const rmv_f32x4 a, const rmv_f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_cmplt(a, b);
+#else
+    return rm_ltm_f32x4(a, b);
+#endif
+}
+RM_INLINE maskf32x4
+rmv_lteq_f32x4(const rmv_f32x4 a, const rmv_f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_cmple(a, b);
+#else
+    return rm_lteqm_f32x4(a, b);
+#endif
+}
+RM_INLINE maskf32x4
+rmv_gt_f32x4(const rmv_f32x4 a, const rmv_f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_cmpgt(a, b);
+#else
+    return rm_gtm_f32x4(a, b);
+#endif
+}
+RM_INLINE maskf32x4
+rmv_gteq_f32x4(const rmv_f32x4 a, const rmv_f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_cmpge(a, b);
+#else
+    return rm_gteqm_f32x4(a, b);
+#endif
+}
+/* a where the mask is set, b elsewhere */
+RM_INLINE rmv_f32x4
+rmv_select_f32x4(const maskf32x4 mask, const rmv_f32x4 a, const rmv_f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_blendv(b, a, mask);
+#else
+    return rm_select_f32x4(mask, a, b);
+#endif
+}
+RM_INLINE f32
+rmv_hadd_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_hadd(v);
+#else
+    return rm_hadd_f32x4(v);
+#endif
+}
+RM_INLINE f32
+rmv_dot_f32x4(const rmv_f32x4 a, const rmv_f32x4 b) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_dot(a, b);
+#else
+    return rm_dot_f32x4(a, b);
+#endif
+}
+RM_INLINE f32
+rmv_norm_f32x4(const rmv_f32x4 v) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_norm(v);
+#else
+    return rm_norm_f32x4(v);
+#endif
+}
+RM_INLINE rmv_f32x4
+rmv_normalize_f32x4(const rmv_f32x4 v) {
+#if defined(RM_FAST_RSQRT) && defined(RM_SIMD_F32X4)
+    rmv_f32x4 n;
+
+    /* the mask keeps a zero vector at zero, same as rm_normalize_f32x4 */
+    n = rmm_vdots(v, v);
+    return rmm_and(rmm_mul(v, rmm_rsqrt(n)), rmm_cmpneq(n, rmm_setzero()));
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 n;
+
+    n = rmm_sqrt(rmm_vdots(v, v));
+    return rmm_and(rmm_mul(v, rmm_div(rmm_set1(1.0f), n)),
+                   rmm_cmpneq(n, rmm_setzero()));
+#else
+    return rm_normalize_f32x4(v);
+#endif
+}
+
+// MATRICES
+RM_INLINE f32x2x2
+rm_zero_f32x2x2(void) {
+    f32x2x2 dest;
+
+    dest.cols[0] = rm_zero_f32x2();
+    dest.cols[1] = rm_zero_f32x2();
+    return dest;
+}
+RM_INLINE f32x2x3
+rm_zero_f32x2x3(void) {
+    f32x2x3 dest;
+
+    dest.cols[0] = rm_zero_f32x2();
+    dest.cols[1] = rm_zero_f32x2();
+    dest.cols[2] = rm_zero_f32x2();
+    return dest;
+}
+RM_INLINE f32x2x4
+rm_zero_f32x2x4(void) {
+    f32x2x4 dest;
+
+    dest.cols[0] = rm_zero_f32x2();
+    dest.cols[1] = rm_zero_f32x2();
+    dest.cols[2] = rm_zero_f32x2();
+    dest.cols[3] = rm_zero_f32x2();
+    return dest;
+}
+RM_INLINE f32x3x2
+rm_zero_f32x3x2(void) {
+    f32x3x2 dest;
+
+    dest.cols[0] = rm_zero_f32x3();
+    dest.cols[1] = rm_zero_f32x3();
+    return dest;
+}
+RM_INLINE f32x3x3
+rm_zero_f32x3x3(void) {
+    f32x3x3 dest;
+
+    dest.cols[0] = rm_zero_f32x3();
+    dest.cols[1] = rm_zero_f32x3();
+    dest.cols[2] = rm_zero_f32x3();
+    return dest;
+}
+RM_INLINE f32x3x4
+rm_zero_f32x3x4(void) {
+    f32x3x4 dest;
+
+    dest.cols[0] = rm_zero_f32x3();
+    dest.cols[1] = rm_zero_f32x3();
+    dest.cols[2] = rm_zero_f32x3();
+    dest.cols[3] = rm_zero_f32x3();
+    return dest;
+}
+RM_INLINE f32x4x2
+rm_zero_f32x4x2(void) {
+    f32x4x2 dest;
+
+    dest.cols[0] = rm_zero_f32x4();
+    dest.cols[1] = rm_zero_f32x4();
+    return dest;
+}
+RM_INLINE f32x4x3
+rm_zero_f32x4x3(void) {
+    f32x4x3 dest;
+
+    dest.cols[0] = rm_zero_f32x4();
+    dest.cols[1] = rm_zero_f32x4();
+    dest.cols[2] = rm_zero_f32x4();
+    return dest;
+}
+RM_INLINE f32x4x4
+rm_zero_f32x4x4(void) {
+    f32x4x4 dest;
+
+    dest.cols[0] = rm_zero_f32x4();
+    dest.cols[1] = rm_zero_f32x4();
+    dest.cols[2] = rm_zero_f32x4();
+    dest.cols[3] = rm_zero_f32x4();
+    return dest;
+}
+RM_INLINE f64x2x2
+rm_zero_f64x2x2(void) {
+    f64x2x2 dest;
+
+    dest.cols[0] = rm_zero_f64x2();
+    dest.cols[1] = rm_zero_f64x2();
+    return dest;
+}
+RM_INLINE f64x2x3
+rm_zero_f64x2x3(void) {
+    f64x2x3 dest;
+
+    dest.cols[0] = rm_zero_f64x2();
+    dest.cols[1] = rm_zero_f64x2();
+    dest.cols[2] = rm_zero_f64x2();
+    return dest;
+}
+RM_INLINE f64x2x4
+rm_zero_f64x2x4(void) {
+    f64x2x4 dest;
+
+    dest.cols[0] = rm_zero_f64x2();
+    dest.cols[1] = rm_zero_f64x2();
+    dest.cols[2] = rm_zero_f64x2();
+    dest.cols[3] = rm_zero_f64x2();
+    return dest;
+}
+RM_INLINE f64x3x2
+rm_zero_f64x3x2(void) {
+    f64x3x2 dest;
+
+    dest.cols[0] = rm_zero_f64x3();
+    dest.cols[1] = rm_zero_f64x3();
+    return dest;
+}
+RM_INLINE f64x3x3
+rm_zero_f64x3x3(void) {
+    f64x3x3 dest;
+
+    dest.cols[0] = rm_zero_f64x3();
+    dest.cols[1] = rm_zero_f64x3();
+    dest.cols[2] = rm_zero_f64x3();
+    return dest;
+}
+RM_INLINE f64x3x4
+rm_zero_f64x3x4(void) {
+    f64x3x4 dest;
+
+    dest.cols[0] = rm_zero_f64x3();
+    dest.cols[1] = rm_zero_f64x3();
+    dest.cols[2] = rm_zero_f64x3();
+    dest.cols[3] = rm_zero_f64x3();
+    return dest;
+}
+RM_INLINE f64x4x2
+rm_zero_f64x4x2(void) {
+    f64x4x2 dest;
+
+    dest.cols[0] = rm_zero_f64x4();
+    dest.cols[1] = rm_zero_f64x4();
+    return dest;
+}
+RM_INLINE f64x4x3
+rm_zero_f64x4x3(void) {
+    f64x4x3 dest;
+
+    dest.cols[0] = rm_zero_f64x4();
+    dest.cols[1] = rm_zero_f64x4();
+    dest.cols[2] = rm_zero_f64x4();
+    return dest;
+}
+RM_INLINE f64x4x4
+rm_zero_f64x4x4(void) {
+    f64x4x4 dest;
+
+    dest.cols[0] = rm_zero_f64x4();
+    dest.cols[1] = rm_zero_f64x4();
+    dest.cols[2] = rm_zero_f64x4();
+    dest.cols[3] = rm_zero_f64x4();
+    return dest;
+}
+RM_INLINE f32x2x2
+rm_identity_f32x2x2(void) {
+    f32x2x2 dest;
+
+    dest.cols[0] = rm_f32x2(1.0f, 0.0f);
+    dest.cols[1] = rm_f32x2(0.0f, 1.0f);
+    return dest;
+}
+RM_INLINE f32x3x3
+rm_identity_f32x3x3(void) {
+    f32x3x3 dest;
+
+    dest.cols[0] = rm_f32x3(1.0f, 0.0f, 0.0f);
+    dest.cols[1] = rm_f32x3(0.0f, 1.0f, 0.0f);
+    dest.cols[2] = rm_f32x3(0.0f, 0.0f, 1.0f);
+    return dest;
+}
+RM_INLINE f32x4x4
+rm_identity_f32x4x4(void) {
+    f32x4x4 dest;
+
+    dest.cols[0] = rm_f32x4(1.0f, 0.0f, 0.0f, 0.0f);
+    dest.cols[1] = rm_f32x4(0.0f, 1.0f, 0.0f, 0.0f);
+    dest.cols[2] = rm_f32x4(0.0f, 0.0f, 1.0f, 0.0f);
+    dest.cols[3] = rm_f32x4(0.0f, 0.0f, 0.0f, 1.0f);
+    return dest;
+}
+RM_INLINE f64x2x2
+rm_identity_f64x2x2(void) {
+    f64x2x2 dest;
+
+    dest.cols[0] = rm_f64x2(1.0, 0.0);
+    dest.cols[1] = rm_f64x2(0.0, 1.0);
+    return dest;
+}
+RM_INLINE f64x3x3
+rm_identity_f64x3x3(void) {
+    f64x3x3 dest;
+
+    dest.cols[0] = rm_f64x3(1.0, 0.0, 0.0);
+    dest.cols[1] = rm_f64x3(0.0, 1.0, 0.0);
+    dest.cols[2] = rm_f64x3(0.0, 0.0, 1.0);
+    return dest;
+}
+RM_INLINE f64x4x4
+rm_identity_f64x4x4(void) {
+    f64x4x4 dest;
+
+    dest.cols[0] = rm_f64x4(1.0, 0.0, 0.0, 0.0);
+    dest.cols[1] = rm_f64x4(0.0, 1.0, 0.0, 0.0);
+    dest.cols[2] = rm_f64x4(0.0, 0.0, 1.0, 0.0);
+    dest.cols[3] = rm_f64x4(0.0, 0.0, 0.0, 1.0);
+    return dest;
+}
+RM_INLINE f32x2x2
+rm_transpose_f32x2x2(const f32x2x2 m) {
+    f32x2x2 dest;
+
+    dest.cols[0] = rm_f32x2(m.cols[0].x, m.cols[1].x);
+    dest.cols[1] = rm_f32x2(m.cols[0].y, m.cols[1].y);
+    return dest;
+}
+RM_INLINE f32x3x2
+rm_transpose_f32x2x3(const f32x2x3 m) {
+    f32x3x2 dest;
+
+    dest.cols[0] = rm_f32x3(m.cols[0].x, m.cols[1].x, m.cols[2].x);
+    dest.cols[1] = rm_f32x3(m.cols[0].y, m.cols[1].y, m.cols[2].y);
+    return dest;
+}
+RM_INLINE f32x4x2
+rm_transpose_f32x2x4(const f32x2x4 m) {
+    f32x4x2 dest;
+
+    dest.cols[0] = rm_f32x4(m.cols[0].x, m.cols[1].x, m.cols[2].x, m.cols[3].x);
+    dest.cols[1] = rm_f32x4(m.cols[0].y, m.cols[1].y, m.cols[2].y, m.cols[3].y);
+    return dest;
+}
+RM_INLINE f32x2x3
+rm_transpose_f32x3x2(const f32x3x2 m) {
+    f32x2x3 dest;
+
+    dest.cols[0] = rm_f32x2(m.cols[0].x, m.cols[1].x);
+    dest.cols[1] = rm_f32x2(m.cols[0].y, m.cols[1].y);
+    dest.cols[2] = rm_f32x2(m.cols[0].z, m.cols[1].z);
+    return dest;
+}
+RM_INLINE f32x3x3
+rm_transpose_f32x3x3(const f32x3x3 m) {
+    f32x3x3 dest;
+
+    dest.cols[0] = rm_f32x3(m.cols[0].x, m.cols[1].x, m.cols[2].x);
+    dest.cols[1] = rm_f32x3(m.cols[0].y, m.cols[1].y, m.cols[2].y);
+    dest.cols[2] = rm_f32x3(m.cols[0].z, m.cols[1].z, m.cols[2].z);
+    return dest;
+}
+RM_INLINE f32x4x3
+rm_transpose_f32x3x4(const f32x3x4 m) {
+    f32x4x3 dest;
+
+    dest.cols[0] = rm_f32x4(m.cols[0].x, m.cols[1].x, m.cols[2].x, m.cols[3].x);
+    dest.cols[1] = rm_f32x4(m.cols[0].y, m.cols[1].y, m.cols[2].y, m.cols[3].y);
+    dest.cols[2] = rm_f32x4(m.cols[0].z, m.cols[1].z, m.cols[2].z, m.cols[3].z);
+    return dest;
+}
+RM_INLINE f32x2x4
+rm_transpose_f32x4x2(const f32x4x2 m) {
+    f32x2x4 dest;
+
+    dest.cols[0] = rm_f32x2(m.cols[0].x, m.cols[1].x);
+    dest.cols[1] = rm_f32x2(m.cols[0].y, m.cols[1].y);
+    dest.cols[2] = rm_f32x2(m.cols[0].z, m.cols[1].z);
+    dest.cols[3] = rm_f32x2(m.cols[0].w, m.cols[1].w);
+    return dest;
+}
+RM_INLINE f32x3x4
+rm_transpose_f32x4x3(const f32x4x3 m) {
+    f32x3x4 dest;
+
+    dest.cols[0] = rm_f32x3(m.cols[0].x, m.cols[1].x, m.cols[2].x);
+    dest.cols[1] = rm_f32x3(m.cols[0].y, m.cols[1].y, m.cols[2].y);
+    dest.cols[2] = rm_f32x3(m.cols[0].z, m.cols[1].z, m.cols[2].z);
+    dest.cols[3] = rm_f32x3(m.cols[0].w, m.cols[1].w, m.cols[2].w);
+    return dest;
+}
+RM_INLINE f32x4x4
+rm_transpose_f32x4x4(const f32x4x4 m) {
+    f32x4x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmv_f32x4 c0, c1, c2, c3;
+
+    c0 = rmm_load(m.cols[0].raw);
+    c1 = rmm_load(m.cols[1].raw);
+    c2 = rmm_load(m.cols[2].raw);
+    c3 = rmm_load(m.cols[3].raw);
+    rmm_transpose(&c0, &c1, &c2, &c3);
+    rmm_store(dest.cols[0].raw, c0);
+    rmm_store(dest.cols[1].raw, c1);
+    rmm_store(dest.cols[2].raw, c2);
+    rmm_store(dest.cols[3].raw, c3);
+#else
+    dest.cols[0] = rm_f32x4(m.cols[0].x, m.cols[1].x, m.cols[2].x, m.cols[3].x);
+    dest.cols[1] = rm_f32x4(m.cols[0].y, m.cols[1].y, m.cols[2].y, m.cols[3].y);
+    dest.cols[2] = rm_f32x4(m.cols[0].z, m.cols[1].z, m.cols[2].z, m.cols[3].z);
+    dest.cols[3] = rm_f32x4(m.cols[0].w, m.cols[1].w, m.cols[2].w, m.cols[3].w);
+#endif
+    return dest;
+}
+RM_INLINE f64x2x2
+rm_transpose_f64x2x2(const f64x2x2 m) {
+    f64x2x2 dest;
+#if defined(RM_SSE2)
+    __m128d c0, c1;
+
+    c0 = rmmd_load(m.cols[0].raw);
+    c1 = rmmd_load(m.cols[1].raw);
+    rmmd_store(dest.cols[0].raw, _mm_unpacklo_pd(c0, c1));
+    rmmd_store(dest.cols[1].raw, _mm_unpackhi_pd(c0, c1));
+#else
+    dest.cols[0] = rm_f64x2(m.cols[0].x, m.cols[1].x);
+    dest.cols[1] = rm_f64x2(m.cols[0].y, m.cols[1].y);
+#endif
+    return dest;
+}
+RM_INLINE f64x3x2
+rm_transpose_f64x2x3(const f64x2x3 m) {
+    f64x3x2 dest;
+
+    dest.cols[0] = rm_f64x3(m.cols[0].x, m.cols[1].x, m.cols[2].x);
+    dest.cols[1] = rm_f64x3(m.cols[0].y, m.cols[1].y, m.cols[2].y);
+    return dest;
+}
+RM_INLINE f64x4x2
+rm_transpose_f64x2x4(const f64x2x4 m) {
+    f64x4x2 dest;
+
+    dest.cols[0] = rm_f64x4(m.cols[0].x, m.cols[1].x, m.cols[2].x, m.cols[3].x);
+    dest.cols[1] = rm_f64x4(m.cols[0].y, m.cols[1].y, m.cols[2].y, m.cols[3].y);
+    return dest;
+}
+RM_INLINE f64x2x3
+rm_transpose_f64x3x2(const f64x3x2 m) {
+    f64x2x3 dest;
+
+    dest.cols[0] = rm_f64x2(m.cols[0].x, m.cols[1].x);
+    dest.cols[1] = rm_f64x2(m.cols[0].y, m.cols[1].y);
+    dest.cols[2] = rm_f64x2(m.cols[0].z, m.cols[1].z);
+    return dest;
+}
+RM_INLINE f64x3x3
+rm_transpose_f64x3x3(const f64x3x3 m) {
+    f64x3x3 dest;
+
+    dest.cols[0] = rm_f64x3(m.cols[0].x, m.cols[1].x, m.cols[2].x);
+    dest.cols[1] = rm_f64x3(m.cols[0].y, m.cols[1].y, m.cols[2].y);
+    dest.cols[2] = rm_f64x3(m.cols[0].z, m.cols[1].z, m.cols[2].z);
+    return dest;
+}
+RM_INLINE f64x4x3
+rm_transpose_f64x3x4(const f64x3x4 m) {
+    f64x4x3 dest;
+
+    dest.cols[0] = rm_f64x4(m.cols[0].x, m.cols[1].x, m.cols[2].x, m.cols[3].x);
+    dest.cols[1] = rm_f64x4(m.cols[0].y, m.cols[1].y, m.cols[2].y, m.cols[3].y);
+    dest.cols[2] = rm_f64x4(m.cols[0].z, m.cols[1].z, m.cols[2].z, m.cols[3].z);
+    return dest;
+}
+RM_INLINE f64x2x4
+rm_transpose_f64x4x2(const f64x4x2 m) {
+    f64x2x4 dest;
+
+    dest.cols[0] = rm_f64x2(m.cols[0].x, m.cols[1].x);
+    dest.cols[1] = rm_f64x2(m.cols[0].y, m.cols[1].y);
+    dest.cols[2] = rm_f64x2(m.cols[0].z, m.cols[1].z);
+    dest.cols[3] = rm_f64x2(m.cols[0].w, m.cols[1].w);
+    return dest;
+}
+RM_INLINE f64x3x4
+rm_transpose_f64x4x3(const f64x4x3 m) {
+    f64x3x4 dest;
+
+    dest.cols[0] = rm_f64x3(m.cols[0].x, m.cols[1].x, m.cols[2].x);
+    dest.cols[1] = rm_f64x3(m.cols[0].y, m.cols[1].y, m.cols[2].y);
+    dest.cols[2] = rm_f64x3(m.cols[0].z, m.cols[1].z, m.cols[2].z);
+    dest.cols[3] = rm_f64x3(m.cols[0].w, m.cols[1].w, m.cols[2].w);
+    return dest;
+}
+RM_INLINE f64x4x4
+rm_transpose_f64x4x4(const f64x4x4 m) {
+    f64x4x4 dest;
+#if defined(RM_AVX)
+    __m256d c0, c1, c2, c3, t0, t1, t2, t3;
+
+    c0 = rmm256d_load(m.cols[0].raw);
+    c1 = rmm256d_load(m.cols[1].raw);
+    c2 = rmm256d_load(m.cols[2].raw);
+    c3 = rmm256d_load(m.cols[3].raw);
+
+    /* [0x, 1x, 0z, 1z], [0y, 1y, 0w, 1w] and the same for 2 and 3 */
+    t0 = _mm256_unpacklo_pd(c0, c1);
+    t1 = _mm256_unpackhi_pd(c0, c1);
+    t2 = _mm256_unpacklo_pd(c2, c3);
+    t3 = _mm256_unpackhi_pd(c2, c3);
+    rmm256d_store(dest.cols[0].raw, _mm256_permute2f128_pd(t0, t2, 0x20));
+    rmm256d_store(dest.cols[1].raw, _mm256_permute2f128_pd(t1, t3, 0x20));
+    rmm256d_store(dest.cols[2].raw, _mm256_permute2f128_pd(t0, t2, 0x31));
+    rmm256d_store(dest.cols[3].raw, _mm256_permute2f128_pd(t1, t3, 0x31));
+#else
+    dest.cols[0] = rm_f64x4(m.cols[0].x, m.cols[1].x, m.cols[2].x, m.cols[3].x);
+    dest.cols[1] = rm_f64x4(m.cols[0].y, m.cols[1].y, m.cols[2].y, m.cols[3].y);
+    dest.cols[2] = rm_f64x4(m.cols[0].z, m.cols[1].z, m.cols[2].z, m.cols[3].z);
+    dest.cols[3] = rm_f64x4(m.cols[0].w, m.cols[1].w, m.cols[2].w, m.cols[3].w);
+#endif
+    return dest;
+}
+RM_INLINE f32x2x2
+rm_muls_f32x2x2(const f32x2x2 m, const f32 s) {
+    f32x2x2 dest;
+
+    dest.cols[0] = rm_muls_f32x2(m.cols[0], s);
+    dest.cols[1] = rm_muls_f32x2(m.cols[1], s);
+    return dest;
+}
+RM_INLINE f32x2x3
+rm_muls_f32x2x3(const f32x2x3 m, const f32 s) {
+    f32x2x3 dest;
+
+    dest.cols[0] = rm_muls_f32x2(m.cols[0], s);
+    dest.cols[1] = rm_muls_f32x2(m.cols[1], s);
+    dest.cols[2] = rm_muls_f32x2(m.cols[2], s);
+    return dest;
+}
+RM_INLINE f32x2x4
+rm_muls_f32x2x4(const f32x2x4 m, const f32 s) {
+    f32x2x4 dest;
+
+    dest.cols[0] = rm_muls_f32x2(m.cols[0], s);
+    dest.cols[1] = rm_muls_f32x2(m.cols[1], s);
+    dest.cols[2] = rm_muls_f32x2(m.cols[2], s);
+    dest.cols[3] = rm_muls_f32x2(m.cols[3], s);
+    return dest;
+}
+RM_INLINE f32x3x2
+rm_muls_f32x3x2(const f32x3x2 m, const f32 s) {
+    f32x3x2 dest;
+
+    dest.cols[0] = rm_muls_f32x3(m.cols[0], s);
+    dest.cols[1] = rm_muls_f32x3(m.cols[1], s);
+    return dest;
+}
+RM_INLINE f32x3x3
+rm_muls_f32x3x3(const f32x3x3 m, const f32 s) {
+    f32x3x3 dest;
+
+    dest.cols[0] = rm_muls_f32x3(m.cols[0], s);
+    dest.cols[1] = rm_muls_f32x3(m.cols[1], s);
+    dest.cols[2] = rm_muls_f32x3(m.cols[2], s);
+    return dest;
+}
+RM_INLINE f32x3x4
+rm_muls_f32x3x4(const f32x3x4 m, const f32 s) {
+    f32x3x4 dest;
+
+    dest.cols[0] = rm_muls_f32x3(m.cols[0], s);
+    dest.cols[1] = rm_muls_f32x3(m.cols[1], s);
+    dest.cols[2] = rm_muls_f32x3(m.cols[2], s);
+    dest.cols[3] = rm_muls_f32x3(m.cols[3], s);
+    return dest;
+}
+RM_INLINE f32x4x2
+rm_muls_f32x4x2(const f32x4x2 m, const f32 s) {
+    f32x4x2 dest;
+
+    dest.cols[0] = rm_muls_f32x4(m.cols[0], s);
+    dest.cols[1] = rm_muls_f32x4(m.cols[1], s);
+    return dest;
+}
+RM_INLINE f32x4x3
+rm_muls_f32x4x3(const f32x4x3 m, const f32 s) {
+    f32x4x3 dest;
+
+    dest.cols[0] = rm_muls_f32x4(m.cols[0], s);
+    dest.cols[1] = rm_muls_f32x4(m.cols[1], s);
+    dest.cols[2] = rm_muls_f32x4(m.cols[2], s);
+    return dest;
+}
+RM_INLINE f32x4x4
+rm_muls_f32x4x4(const f32x4x4 m, const f32 s) {
+    f32x4x4 dest;
+
+    dest.cols[0] = rm_muls_f32x4(m.cols[0], s);
+    dest.cols[1] = rm_muls_f32x4(m.cols[1], s);
+    dest.cols[2] = rm_muls_f32x4(m.cols[2], s);
+    dest.cols[3] = rm_muls_f32x4(m.cols[3], s);
+    return dest;
+}
+RM_INLINE f64x2x2
+rm_muls_f64x2x2(const f64x2x2 m, const f64 s) {
+    f64x2x2 dest;
+
+    dest.cols[0] = rm_muls_f64x2(m.cols[0], s);
+    dest.cols[1] = rm_muls_f64x2(m.cols[1], s);
+    return dest;
+}
+RM_INLINE f64x2x3
+rm_muls_f64x2x3(const f64x2x3 m, const f64 s) {
+    f64x2x3 dest;
+
+    dest.cols[0] = rm_muls_f64x2(m.cols[0], s);
+    dest.cols[1] = rm_muls_f64x2(m.cols[1], s);
+    dest.cols[2] = rm_muls_f64x2(m.cols[2], s);
+    return dest;
+}
+RM_INLINE f64x2x4
+rm_muls_f64x2x4(const f64x2x4 m, const f64 s) {
+    f64x2x4 dest;
+
+    dest.cols[0] = rm_muls_f64x2(m.cols[0], s);
+    dest.cols[1] = rm_muls_f64x2(m.cols[1], s);
+    dest.cols[2] = rm_muls_f64x2(m.cols[2], s);
+    dest.cols[3] = rm_muls_f64x2(m.cols[3], s);
+    return dest;
+}
+RM_INLINE f64x3x2
+rm_muls_f64x3x2(const f64x3x2 m, const f64 s) {
+    f64x3x2 dest;
+
+    dest.cols[0] = rm_muls_f64x3(m.cols[0], s);
+    dest.cols[1] = rm_muls_f64x3(m.cols[1], s);
+    return dest;
+}
+RM_INLINE f64x3x3
+rm_muls_f64x3x3(const f64x3x3 m, const f64 s) {
+    f64x3x3 dest;
+
+    dest.cols[0] = rm_muls_f64x3(m.cols[0], s);
+    dest.cols[1] = rm_muls_f64x3(m.cols[1], s);
+    dest.cols[2] = rm_muls_f64x3(m.cols[2], s);
+    return dest;
+}
+RM_INLINE f64x3x4
+rm_muls_f64x3x4(const f64x3x4 m, const f64 s) {
+    f64x3x4 dest;
+
+    dest.cols[0] = rm_muls_f64x3(m.cols[0], s);
+    dest.cols[1] = rm_muls_f64x3(m.cols[1], s);
+    dest.cols[2] = rm_muls_f64x3(m.cols[2], s);
+    dest.cols[3] = rm_muls_f64x3(m.cols[3], s);
+    return dest;
+}
+RM_INLINE f64x4x2
+rm_muls_f64x4x2(const f64x4x2 m, const f64 s) {
+    f64x4x2 dest;
+
+    dest.cols[0] = rm_muls_f64x4(m.cols[0], s);
+    dest.cols[1] = rm_muls_f64x4(m.cols[1], s);
+    return dest;
+}
+RM_INLINE f64x4x3
+rm_muls_f64x4x3(const f64x4x3 m, const f64 s) {
+    f64x4x3 dest;
+
+    dest.cols[0] = rm_muls_f64x4(m.cols[0], s);
+    dest.cols[1] = rm_muls_f64x4(m.cols[1], s);
+    dest.cols[2] = rm_muls_f64x4(m.cols[2], s);
+    return dest;
+}
+RM_INLINE f64x4x4
+rm_muls_f64x4x4(const f64x4x4 m, const f64 s) {
+    f64x4x4 dest;
+
+    dest.cols[0] = rm_muls_f64x4(m.cols[0], s);
+    dest.cols[1] = rm_muls_f64x4(m.cols[1], s);
+    dest.cols[2] = rm_muls_f64x4(m.cols[2], s);
+    dest.cols[3] = rm_muls_f64x4(m.cols[3], s);
+    return dest;
+}
+RM_INLINE f32x2
+rm_mulv_f32x2x2(const f32x2x2 m, const f32x2 v) {
+    f32x2 dest;
+
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y;
+    return dest;
+}
+RM_INLINE f32x2
+rm_mulv_f32x2x3(const f32x2x3 m, const f32x3 v) {
+    f32x2 dest;
+
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y + m.cols[2].x * v.z;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y + m.cols[2].y * v.z;
+    return dest;
+}
+RM_INLINE f32x2
+rm_mulv_f32x2x4(const f32x2x4 m, const f32x4 v) {
+    f32x2 dest;
+
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y + m.cols[2].x * v.z +
+             m.cols[3].x * v.w;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y + m.cols[2].y * v.z +
+             m.cols[3].y * v.w;
+    return dest;
+}
+RM_INLINE f32x3
+rm_mulv_f32x3x2(const f32x3x2 m, const f32x2 v) {
+    f32x3 dest;
+
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y;
+    dest.z = m.cols[0].z * v.x + m.cols[1].z * v.y;
+    return dest;
+}
+RM_INLINE f32x3
+rm_mulv_f32x3x3(const f32x3x3 m, const f32x3 v) {
+    f32x3 dest;
+
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y + m.cols[2].x * v.z;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y + m.cols[2].y * v.z;
+    dest.z = m.cols[0].z * v.x + m.cols[1].z * v.y + m.cols[2].z * v.z;
+    return dest;
+}
+RM_INLINE f32x3
+rm_mulv_f32x3x4(const f32x3x4 m, const f32x4 v) {
+    f32x3 dest;
+
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y + m.cols[2].x * v.z +
+             m.cols[3].x * v.w;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y + m.cols[2].y * v.z +
+             m.cols[3].y * v.w;
+    dest.z = m.cols[0].z * v.x + m.cols[1].z * v.y + m.cols[2].z * v.z +
+             m.cols[3].z * v.w;
+    return dest;
+}
+RM_INLINE f32x4
+rm_mulv_f32x4x2(const f32x4x2 m, const f32x2 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmv_f32x4 x0;
+
+    x0 = rmm_mul(rmm_load(m.cols[0].raw), rmm_set1(v.x));
+    x0 = rmm_fmadd(rmm_load(m.cols[1].raw), rmm_set1(v.y), x0);
+    rmm_store(dest.raw, x0);
+#else
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y;
+    dest.z = m.cols[0].z * v.x + m.cols[1].z * v.y;
+    dest.w = m.cols[0].w * v.x + m.cols[1].w * v.y;
+#endif
+    return dest;
+}
+RM_INLINE f32x4
+rm_mulv_f32x4x3(const f32x4x3 m, const f32x3 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmv_f32x4 x0;
+
+    x0 = rmm_mul(rmm_load(m.cols[0].raw), rmm_set1(v.x));
+    x0 = rmm_fmadd(rmm_load(m.cols[1].raw), rmm_set1(v.y), x0);
+    x0 = rmm_fmadd(rmm_load(m.cols[2].raw), rmm_set1(v.z), x0);
+    rmm_store(dest.raw, x0);
+#else
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y + m.cols[2].x * v.z;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y + m.cols[2].y * v.z;
+    dest.z = m.cols[0].z * v.x + m.cols[1].z * v.y + m.cols[2].z * v.z;
+    dest.w = m.cols[0].w * v.x + m.cols[1].w * v.y + m.cols[2].w * v.z;
+#endif
+    return dest;
+}
+RM_INLINE f32x4
+rm_mulv_f32x4x4(const f32x4x4 m, const f32x4 v) {
+    f32x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw,
+              rmm_mulv4(rmm_load(m.cols[0].raw), rmm_load(m.cols[1].raw),
+                        rmm_load(m.cols[2].raw), rmm_load(m.cols[3].raw),
+                        rmm_load(v.raw)));
+#else
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y + m.cols[2].x * v.z +
+             m.cols[3].x * v.w;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y + m.cols[2].y * v.z +
+             m.cols[3].y * v.w;
+    dest.z = m.cols[0].z * v.x + m.cols[1].z * v.y + m.cols[2].z * v.z +
+             m.cols[3].z * v.w;
+    dest.w = m.cols[0].w * v.x + m.cols[1].w * v.y + m.cols[2].w * v.z +
+             m.cols[3].w * v.w;
+#endif
+    return dest;
+}
+RM_INLINE f64x2
+rm_mulv_f64x2x2(const f64x2x2 m, const f64x2 v) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    __m128d x0;
+
+    x0 = _mm_mul_pd(rmmd_load(m.cols[0].raw), _mm_set1_pd(v.x));
+    x0 = rmmd_fmadd(rmmd_load(m.cols[1].raw), _mm_set1_pd(v.y), x0);
+    rmmd_store(dest.raw, x0);
+#else
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y;
+#endif
+    return dest;
+}
+RM_INLINE f64x2
+rm_mulv_f64x2x3(const f64x2x3 m, const f64x3 v) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    __m128d x0;
+
+    x0 = _mm_mul_pd(rmmd_load(m.cols[0].raw), _mm_set1_pd(v.x));
+    x0 = rmmd_fmadd(rmmd_load(m.cols[1].raw), _mm_set1_pd(v.y), x0);
+    x0 = rmmd_fmadd(rmmd_load(m.cols[2].raw), _mm_set1_pd(v.z), x0);
+    rmmd_store(dest.raw, x0);
+#else
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y + m.cols[2].x * v.z;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y + m.cols[2].y * v.z;
+#endif
+    return dest;
+}
+RM_INLINE f64x2
+rm_mulv_f64x2x4(const f64x2x4 m, const f64x4 v) {
+    f64x2 dest;
+#if defined(RM_SSE2)
+    __m128d x0;
+
+    x0 = _mm_mul_pd(rmmd_load(m.cols[0].raw), _mm_set1_pd(v.x));
+    x0 = rmmd_fmadd(rmmd_load(m.cols[1].raw), _mm_set1_pd(v.y), x0);
+    x0 = rmmd_fmadd(rmmd_load(m.cols[2].raw), _mm_set1_pd(v.z), x0);
+    x0 = rmmd_fmadd(rmmd_load(m.cols[3].raw), _mm_set1_pd(v.w), x0);
+    rmmd_store(dest.raw, x0);
+#else
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y + m.cols[2].x * v.z +
+             m.cols[3].x * v.w;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y + m.cols[2].y * v.z +
+             m.cols[3].y * v.w;
+#endif
+    return dest;
+}
+RM_INLINE f64x3
+rm_mulv_f64x3x2(const f64x3x2 m, const f64x2 v) {
+    f64x3 dest;
+
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y;
+    dest.z = m.cols[0].z * v.x + m.cols[1].z * v.y;
+    return dest;
+}
+RM_INLINE f64x3
+rm_mulv_f64x3x3(const f64x3x3 m, const f64x3 v) {
+    f64x3 dest;
+
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y + m.cols[2].x * v.z;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y + m.cols[2].y * v.z;
+    dest.z = m.cols[0].z * v.x + m.cols[1].z * v.y + m.cols[2].z * v.z;
+    return dest;
+}
+RM_INLINE f64x3
+rm_mulv_f64x3x4(const f64x3x4 m, const f64x4 v) {
+    f64x3 dest;
+
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y + m.cols[2].x * v.z +
+             m.cols[3].x * v.w;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y + m.cols[2].y * v.z +
+             m.cols[3].y * v.w;
+    dest.z = m.cols[0].z * v.x + m.cols[1].z * v.y + m.cols[2].z * v.z +
+             m.cols[3].z * v.w;
+    return dest;
+}
+RM_INLINE f64x4
+rm_mulv_f64x4x2(const f64x4x2 m, const f64x2 v) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    __m256d x0;
+
+    x0 = _mm256_mul_pd(rmm256d_load(m.cols[0].raw), _mm256_set1_pd(v.x));
+    x0 = rmm256d_fmadd(rmm256d_load(m.cols[1].raw), _mm256_set1_pd(v.y), x0);
+    rmm256d_store(dest.raw, x0);
+#else
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y;
+    dest.z = m.cols[0].z * v.x + m.cols[1].z * v.y;
+    dest.w = m.cols[0].w * v.x + m.cols[1].w * v.y;
+#endif
+    return dest;
+}
+RM_INLINE f64x4
+rm_mulv_f64x4x3(const f64x4x3 m, const f64x3 v) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    __m256d x0;
+
+    x0 = _mm256_mul_pd(rmm256d_load(m.cols[0].raw), _mm256_set1_pd(v.x));
+    x0 = rmm256d_fmadd(rmm256d_load(m.cols[1].raw), _mm256_set1_pd(v.y), x0);
+    x0 = rmm256d_fmadd(rmm256d_load(m.cols[2].raw), _mm256_set1_pd(v.z), x0);
+    rmm256d_store(dest.raw, x0);
+#else
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y + m.cols[2].x * v.z;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y + m.cols[2].y * v.z;
+    dest.z = m.cols[0].z * v.x + m.cols[1].z * v.y + m.cols[2].z * v.z;
+    dest.w = m.cols[0].w * v.x + m.cols[1].w * v.y + m.cols[2].w * v.z;
+#endif
+    return dest;
+}
+RM_INLINE f64x4
+rm_mulv_f64x4x4(const f64x4x4 m, const f64x4 v) {
+    f64x4 dest;
+#if defined(RM_AVX)
+    __m256d x0;
+
+    x0 = _mm256_mul_pd(rmm256d_load(m.cols[0].raw), _mm256_set1_pd(v.x));
+    x0 = rmm256d_fmadd(rmm256d_load(m.cols[1].raw), _mm256_set1_pd(v.y), x0);
+    x0 = rmm256d_fmadd(rmm256d_load(m.cols[2].raw), _mm256_set1_pd(v.z), x0);
+    x0 = rmm256d_fmadd(rmm256d_load(m.cols[3].raw), _mm256_set1_pd(v.w), x0);
+    rmm256d_store(dest.raw, x0);
+#else
+    dest.x = m.cols[0].x * v.x + m.cols[1].x * v.y + m.cols[2].x * v.z +
+             m.cols[3].x * v.w;
+    dest.y = m.cols[0].y * v.x + m.cols[1].y * v.y + m.cols[2].y * v.z +
+             m.cols[3].y * v.w;
+    dest.z = m.cols[0].z * v.x + m.cols[1].z * v.y + m.cols[2].z * v.z +
+             m.cols[3].z * v.w;
+    dest.w = m.cols[0].w * v.x + m.cols[1].w * v.y + m.cols[2].w * v.z +
+             m.cols[3].w * v.w;
+#endif
+    return dest;
+}
+RM_INLINE f32x2x2
+rm_mul_f32x2x2(const f32x2x2 a, const f32x2x2 b) {
+    f32x2x2 dest;
+
+    dest.cols[0] = rm_mulv_f32x2x2(a, b.cols[0]);
+    dest.cols[1] = rm_mulv_f32x2x2(a, b.cols[1]);
+    return dest;
+}
+RM_INLINE f32x3x3
+rm_mul_f32x3x3(const f32x3x3 a, const f32x3x3 b) {
+    f32x3x3 dest;
+
+    dest.cols[0] = rm_mulv_f32x3x3(a, b.cols[0]);
+    dest.cols[1] = rm_mulv_f32x3x3(a, b.cols[1]);
+    dest.cols[2] = rm_mulv_f32x3x3(a, b.cols[2]);
+    return dest;
+}
+RM_INLINE f32x4x4
+rm_mul_f32x4x4(const f32x4x4 a, const f32x4x4 b) {
+    f32x4x4 dest;
+#if defined(RM_AVX)
+    __m256 a0, a1, a2, a3, b0, b1;
+
+    /* every column of a in both halves, two columns of b per register */
+    a0 = _mm256_broadcast_ps((const __m128 *)a.cols[0].raw);
+    a1 = _mm256_broadcast_ps((const __m128 *)a.cols[1].raw);
+    a2 = _mm256_broadcast_ps((const __m128 *)a.cols[2].raw);
+    a3 = _mm256_broadcast_ps((const __m128 *)a.cols[3].raw);
+    b0 = _mm256_loadu_ps(b.cols[0].raw);
+    b1 = _mm256_loadu_ps(b.cols[2].raw);
+
+    _mm256_storeu_ps(dest.cols[0].raw, rmm256_mulv4(a0, a1, a2, a3, b0));
+    _mm256_storeu_ps(dest.cols[2].raw, rmm256_mulv4(a0, a1, a2, a3, b1));
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 a0, a1, a2, a3;
+
+    a0 = rmm_load(a.cols[0].raw);
+    a1 = rmm_load(a.cols[1].raw);
+    a2 = rmm_load(a.cols[2].raw);
+    a3 = rmm_load(a.cols[3].raw);
+    rmm_store(dest.cols[0].raw,
+              rmm_mulv4(a0, a1, a2, a3, rmm_load(b.cols[0].raw)));
+    rmm_store(dest.cols[1].raw,
+              rmm_mulv4(a0, a1, a2, a3, rmm_load(b.cols[1].raw)));
+    rmm_store(dest.cols[2].raw,
+              rmm_mulv4(a0, a1, a2, a3, rmm_load(b.cols[2].raw)));
+    rmm_store(dest.cols[3].raw,
+              rmm_mulv4(a0, a1, a2, a3, rmm_load(b.cols[3].raw)));
+#else
+    dest.cols[0] = rm_mulv_f32x4x4(a, b.cols[0]);
+    dest.cols[1] = rm_mulv_f32x4x4(a, b.cols[1]);
+    dest.cols[2] = rm_mulv_f32x4x4(a, b.cols[2]);
+    dest.cols[3] = rm_mulv_f32x4x4(a, b.cols[3]);
+#endif
+    return dest;
+}
+RM_INLINE f64x2x2
+rm_mul_f64x2x2(const f64x2x2 a, const f64x2x2 b) {
+    f64x2x2 dest;
+#if defined(RM_SSE2)
+    __m128d a0, a1, x0;
+    i32 j;
+
+    a0 = rmmd_load(a.cols[0].raw);
+    a1 = rmmd_load(a.cols[1].raw);
+    for (j = 0; j < 2; ++j) {
+        x0 = _mm_mul_pd(a0, _mm_set1_pd(b.cols[j].x));
+        x0 = rmmd_fmadd(a1, _mm_set1_pd(b.cols[j].y), x0);
+        rmmd_store(dest.cols[j].raw, x0);
+    }
+#else
+    dest.cols[0] = rm_mulv_f64x2x2(a, b.cols[0]);
+    dest.cols[1] = rm_mulv_f64x2x2(a, b.cols[1]);
+#endif
+    return dest;
+}
+RM_INLINE f64x3x3
+rm_mul_f64x3x3(const f64x3x3 a, const f64x3x3 b) {
+    f64x3x3 dest;
+
+    dest.cols[0] = rm_mulv_f64x3x3(a, b.cols[0]);
+    dest.cols[1] = rm_mulv_f64x3x3(a, b.cols[1]);
+    dest.cols[2] = rm_mulv_f64x3x3(a, b.cols[2]);
+    return dest;
+}
+RM_INLINE f64x4x4
+rm_mul_f64x4x4(const f64x4x4 a, const f64x4x4 b) {
+    f64x4x4 dest;
+#if defined(RM_AVX)
+    __m256d a0, a1, a2, a3, x0;
+    i32 j;
+
+    a0 = rmm256d_load(a.cols[0].raw);
+    a1 = rmm256d_load(a.cols[1].raw);
+    a2 = rmm256d_load(a.cols[2].raw);
+    a3 = rmm256d_load(a.cols[3].raw);
+    for (j = 0; j < 4; ++j) {
+        x0 = _mm256_mul_pd(a0, _mm256_broadcast_sd(&b.cols[j].x));
+        x0 = rmm256d_fmadd(a1, _mm256_broadcast_sd(&b.cols[j].y), x0);
+        x0 = rmm256d_fmadd(a2, _mm256_broadcast_sd(&b.cols[j].z), x0);
+        x0 = rmm256d_fmadd(a3, _mm256_broadcast_sd(&b.cols[j].w), x0);
+        rmm256d_store(dest.cols[j].raw, x0);
+    }
+#else
+    dest.cols[0] = rm_mulv_f64x4x4(a, b.cols[0]);
+    dest.cols[1] = rm_mulv_f64x4x4(a, b.cols[1]);
+    dest.cols[2] = rm_mulv_f64x4x4(a, b.cols[2]);
+    dest.cols[3] = rm_mulv_f64x4x4(a, b.cols[3]);
+#endif
+    return dest;
+}
+RM_INLINE f32
+rm_det_f32x2x2(const f32x2x2 m) {
+    return m.cols[0].x * m.cols[1].y - m.cols[1].x * m.cols[0].y;
+}
+RM_INLINE f32
+rm_det_f32x3x3(const f32x3x3 m) {
+    return rm_dot_f32x3(m.cols[0], rm_cross_f32x3(m.cols[1], m.cols[2]));
+}
+RM_INLINE f32
+rm_det_f32x4x4(const f32x4x4 m) {
+#if defined(RM_SIMD_F32X4)
+    return rmm_det4(rmm_load(m.cols[0].raw), rmm_load(m.cols[1].raw),
+                    rmm_load(m.cols[2].raw), rmm_load(m.cols[3].raw));
+#else
+    f32 s0, s1, s2, s3, s4, s5, c0, c1, c2, c3, c4, c5;
+
+    s0 = m.cols[0].x * m.cols[1].y - m.cols[1].x * m.cols[0].y;
+    s1 = m.cols[0].x * m.cols[1].z - m.cols[1].x * m.cols[0].z;
+    s2 = m.cols[0].x * m.cols[1].w - m.cols[1].x * m.cols[0].w;
+    s3 = m.cols[0].y * m.cols[1].z - m.cols[1].y * m.cols[0].z;
+    s4 = m.cols[0].y * m.cols[1].w - m.cols[1].y * m.cols[0].w;
+    s5 = m.cols[0].z * m.cols[1].w - m.cols[1].z * m.cols[0].w;
+    c0 = m.cols[2].x * m.cols[3].y - m.cols[3].x * m.cols[2].y;
+    c1 = m.cols[2].x * m.cols[3].z - m.cols[3].x * m.cols[2].z;
+    c2 = m.cols[2].x * m.cols[3].w - m.cols[3].x * m.cols[2].w;
+    c3 = m.cols[2].y * m.cols[3].z - m.cols[3].y * m.cols[2].z;
+    c4 = m.cols[2].y * m.cols[3].w - m.cols[3].y * m.cols[2].w;
+    c5 = m.cols[2].z * m.cols[3].w - m.cols[3].z * m.cols[2].w;
+
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+#endif
+}
+/* singular matrices give inf or nan, check rm_det first if that can happen */
+RM_INLINE f32x2x2
+rm_inverse_f32x2x2(const f32x2x2 m) {
+    f32x2x2 dest;
+
+    dest.cols[0] = rm_f32x2(m.cols[1].y, -m.cols[0].y);
+    dest.cols[1] = rm_f32x2(-m.cols[1].x, m.cols[0].x);
+    return rm_muls_f32x2x2(dest, 1.0f / rm_det_f32x2x2(m));
+}
+/* the rows of the inverse are the cross products of the columns over det */
+RM_INLINE f32x3x3
+rm_inverse_f32x3x3(const f32x3x3 m) {
+    f32x3x3 rows;
+
+    rows.cols[0] = rm_cross_f32x3(m.cols[1], m.cols[2]);
+    rows.cols[1] = rm_cross_f32x3(m.cols[2], m.cols[0]);
+    rows.cols[2] = rm_cross_f32x3(m.cols[0], m.cols[1]);
+    return rm_muls_f32x3x3(rm_transpose_f32x3x3(rows),
+                          1.0f / rm_dot_f32x3(m.cols[0], rows.cols[0]));
+}
+RM_INLINE f32x4x4
+rm_inverse_f32x4x4(const f32x4x4 m) {
+#if defined(RM_SIMD_F32X4)
+    f32x4x4 dest;
+    rmv_f32x4 c0, c1, c2, c3;
+
+    c0 = rmm_load(m.cols[0].raw);
+    c1 = rmm_load(m.cols[1].raw);
+    c2 = rmm_load(m.cols[2].raw);
+    c3 = rmm_load(m.cols[3].raw);
+    rmm_inverse4(&c0, &c1, &c2, &c3);
+    rmm_store(dest.cols[0].raw, c0);
+    rmm_store(dest.cols[1].raw, c1);
+    rmm_store(dest.cols[2].raw, c2);
+    rmm_store(dest.cols[3].raw, c3);
+    return dest;
+#else
+    f32x4x4 dest;
+    f32 s0, s1, s2, s3, s4, s5, c0, c1, c2, c3, c4, c5, det;
+
+    s0 = m.cols[0].x * m.cols[1].y - m.cols[1].x * m.cols[0].y;
+    s1 = m.cols[0].x * m.cols[1].z - m.cols[1].x * m.cols[0].z;
+    s2 = m.cols[0].x * m.cols[1].w - m.cols[1].x * m.cols[0].w;
+    s3 = m.cols[0].y * m.cols[1].z - m.cols[1].y * m.cols[0].z;
+    s4 = m.cols[0].y * m.cols[1].w - m.cols[1].y * m.cols[0].w;
+    s5 = m.cols[0].z * m.cols[1].w - m.cols[1].z * m.cols[0].w;
+    c0 = m.cols[2].x * m.cols[3].y - m.cols[3].x * m.cols[2].y;
+    c1 = m.cols[2].x * m.cols[3].z - m.cols[3].x * m.cols[2].z;
+    c2 = m.cols[2].x * m.cols[3].w - m.cols[3].x * m.cols[2].w;
+    c3 = m.cols[2].y * m.cols[3].z - m.cols[3].y * m.cols[2].z;
+    c4 = m.cols[2].y * m.cols[3].w - m.cols[3].y * m.cols[2].w;
+    c5 = m.cols[2].z * m.cols[3].w - m.cols[3].z * m.cols[2].w;
+
+    det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+    dest.cols[0].x = m.cols[1].y * c5 - m.cols[1].z * c4 + m.cols[1].w * c3;
+    dest.cols[0].y = -m.cols[0].y * c5 + m.cols[0].z * c4 - m.cols[0].w * c3;
+    dest.cols[0].z = m.cols[3].y * s5 - m.cols[3].z * s4 + m.cols[3].w * s3;
+    dest.cols[0].w = -m.cols[2].y * s5 + m.cols[2].z * s4 - m.cols[2].w * s3;
+    dest.cols[1].x = -m.cols[1].x * c5 + m.cols[1].z * c2 - m.cols[1].w * c1;
+    dest.cols[1].y = m.cols[0].x * c5 - m.cols[0].z * c2 + m.cols[0].w * c1;
+    dest.cols[1].z = -m.cols[3].x * s5 + m.cols[3].z * s2 - m.cols[3].w * s1;
+    dest.cols[1].w = m.cols[2].x * s5 - m.cols[2].z * s2 + m.cols[2].w * s1;
+    dest.cols[2].x = m.cols[1].x * c4 - m.cols[1].y * c2 + m.cols[1].w * c0;
+    dest.cols[2].y = -m.cols[0].x * c4 + m.cols[0].y * c2 - m.cols[0].w * c0;
+    dest.cols[2].z = m.cols[3].x * s4 - m.cols[3].y * s2 + m.cols[3].w * s0;
+    dest.cols[2].w = -m.cols[2].x * s4 + m.cols[2].y * s2 - m.cols[2].w * s0;
+    dest.cols[3].x = -m.cols[1].x * c3 + m.cols[1].y * c1 - m.cols[1].z * c0;
+    dest.cols[3].y = m.cols[0].x * c3 - m.cols[0].y * c1 + m.cols[0].z * c0;
+    dest.cols[3].z = -m.cols[3].x * s3 + m.cols[3].y * s1 - m.cols[3].z * s0;
+    dest.cols[3].w = m.cols[2].x * s3 - m.cols[2].y * s1 + m.cols[2].z * s0;
+    return rm_muls_f32x4x4(dest, 1.0f / det);
+#endif
+}
+/*
+ * inverse of a rotation + scale + translation matrix, the columns of the
+ * upper 3x3 have to be orthogonal which is the case for T * R * S. the
+ * bottom row is assumed to be [0, 0, 0, 1]
+ */
+RM_INLINE f32x4x4
+rm_inverse_affine_f32x4x4(const f32x4x4 m) {
+#if defined(RM_SIMD_F32X4)
+    f32x4x4 dest;
+    rmv_f32x4 c0, c1, c2, c3, s, t;
+
+    /* rows of the upper 3x3, the w lanes end up as 0 */
+    c0 = rmm_load(m.cols[0].raw);
+    c1 = rmm_load(m.cols[1].raw);
+    c2 = rmm_load(m.cols[2].raw);
+    c3 = rmm_setzero();
+    rmm_transpose(&c0, &c1, &c2, &c3);
+
+    /* 1 / squared column norms, 0 in w so the rows keep w = 0 */
+    s = rmm_fmadd(c1, c1, rmm_mul(c0, c0));
+    s = rmm_fmadd(c2, c2, s);
+    s = rmm_div(rmm_setr(1.0f, 1.0f, 1.0f, 0.0f),
+                rmm_add(s, rmm_setr(0.0f, 0.0f, 0.0f, 1.0f)));
+    c0 = rmm_mul(c0, s);
+    c1 = rmm_mul(c1, s);
+    c2 = rmm_mul(c2, s);
+
+    t = rmm_load(m.cols[3].raw);
+    t = rmm_mulv4(c0, c1, c2, rmm_setzero(), t);
+    rmm_store(dest.cols[0].raw, c0);
+    rmm_store(dest.cols[1].raw, c1);
+    rmm_store(dest.cols[2].raw, c2);
+    rmm_store(dest.cols[3].raw,
+              rmm_sub(rmm_setr(0.0f, 0.0f, 0.0f, 1.0f), t));
+    return dest;
+#else
+    f32x4x4 dest;
+    f32x3x3 r;
+    f32x3 s;
+
+    /* the rows of the inverse are the columns over their squared norms */
+    r.cols[0] = m.cols[0].xyz;
+    r.cols[1] = m.cols[1].xyz;
+    r.cols[2] = m.cols[2].xyz;
+    s = rm_sdiv_f32x3(1.0f, rm_f32x3(rm_norm2_f32x3(r.cols[0]),
+                                   rm_norm2_f32x3(r.cols[1]),
+                                   rm_norm2_f32x3(r.cols[2])));
+    r = rm_transpose_f32x3x3(r);
+    r.cols[0] = rm_mul_f32x3(r.cols[0], s);
+    r.cols[1] = rm_mul_f32x3(r.cols[1], s);
+    r.cols[2] = rm_mul_f32x3(r.cols[2], s);
+
+    dest.cols[0] = rm_f32x4v3s(r.cols[0], 0.0f);
+    dest.cols[1] = rm_f32x4v3s(r.cols[1], 0.0f);
+    dest.cols[2] = rm_f32x4v3s(r.cols[2], 0.0f);
+    dest.cols[3] =
+        rm_f32x4v3s(rm_neg_f32x3(rm_mulv_f32x3x3(r, m.cols[3].xyz)), 1.0f);
+    return dest;
+#endif
+}
+RM_INLINE f64
+rm_det_f64x2x2(const f64x2x2 m) {
+    return m.cols[0].x * m.cols[1].y - m.cols[1].x * m.cols[0].y;
+}
+RM_INLINE f64
+rm_det_f64x3x3(const f64x3x3 m) {
+    return rm_dot_f64x3(m.cols[0], rm_cross_f64x3(m.cols[1], m.cols[2]));
+}
+RM_INLINE f64
+rm_det_f64x4x4(const f64x4x4 m) {
+    f64 s0, s1, s2, s3, s4, s5, c0, c1, c2, c3, c4, c5;
+
+    s0 = m.cols[0].x * m.cols[1].y - m.cols[1].x * m.cols[0].y;
+    s1 = m.cols[0].x * m.cols[1].z - m.cols[1].x * m.cols[0].z;
+    s2 = m.cols[0].x * m.cols[1].w - m.cols[1].x * m.cols[0].w;
+    s3 = m.cols[0].y * m.cols[1].z - m.cols[1].y * m.cols[0].z;
+    s4 = m.cols[0].y * m.cols[1].w - m.cols[1].y * m.cols[0].w;
+    s5 = m.cols[0].z * m.cols[1].w - m.cols[1].z * m.cols[0].w;
+    c0 = m.cols[2].x * m.cols[3].y - m.cols[3].x * m.cols[2].y;
+    c1 = m.cols[2].x * m.cols[3].z - m.cols[3].x * m.cols[2].z;
+    c2 = m.cols[2].x * m.cols[3].w - m.cols[3].x * m.cols[2].w;
+    c3 = m.cols[2].y * m.cols[3].z - m.cols[3].y * m.cols[2].z;
+    c4 = m.cols[2].y * m.cols[3].w - m.cols[3].y * m.cols[2].w;
+    c5 = m.cols[2].z * m.cols[3].w - m.cols[3].z * m.cols[2].w;
+
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+/* singular matrices give inf or nan, check rm_det first if that can happen */
+RM_INLINE f64x2x2
+rm_inverse_f64x2x2(const f64x2x2 m) {
+    f64x2x2 dest;
+
+    dest.cols[0] = rm_f64x2(m.cols[1].y, -m.cols[0].y);
+    dest.cols[1] = rm_f64x2(-m.cols[1].x, m.cols[0].x);
+    return rm_muls_f64x2x2(dest, 1.0 / rm_det_f64x2x2(m));
+}
+/* the rows of the inverse are the cross products of the columns over det */
+RM_INLINE f64x3x3
+rm_inverse_f64x3x3(const f64x3x3 m) {
+    f64x3x3 rows;
+
+    rows.cols[0] = rm_cross_f64x3(m.cols[1], m.cols[2]);
+    rows.cols[1] = rm_cross_f64x3(m.cols[2], m.cols[0]);
+    rows.cols[2] = rm_cross_f64x3(m.cols[0], m.cols[1]);
+    return rm_muls_f64x3x3(rm_transpose_f64x3x3(rows),
+                          1.0 / rm_dot_f64x3(m.cols[0], rows.cols[0]));
+}
+RM_INLINE f64x4x4
+rm_inverse_f64x4x4(const f64x4x4 m) {
+    f64x4x4 dest;
+    f64 s0, s1, s2, s3, s4, s5, c0, c1, c2, c3, c4, c5, det;
+
+    s0 = m.cols[0].x * m.cols[1].y - m.cols[1].x * m.cols[0].y;
+    s1 = m.cols[0].x * m.cols[1].z - m.cols[1].x * m.cols[0].z;
+    s2 = m.cols[0].x * m.cols[1].w - m.cols[1].x * m.cols[0].w;
+    s3 = m.cols[0].y * m.cols[1].z - m.cols[1].y * m.cols[0].z;
+    s4 = m.cols[0].y * m.cols[1].w - m.cols[1].y * m.cols[0].w;
+    s5 = m.cols[0].z * m.cols[1].w - m.cols[1].z * m.cols[0].w;
+    c0 = m.cols[2].x * m.cols[3].y - m.cols[3].x * m.cols[2].y;
+    c1 = m.cols[2].x * m.cols[3].z - m.cols[3].x * m.cols[2].z;
+    c2 = m.cols[2].x * m.cols[3].w - m.cols[3].x * m.cols[2].w;
+    c3 = m.cols[2].y * m.cols[3].z - m.cols[3].y * m.cols[2].z;
+    c4 = m.cols[2].y * m.cols[3].w - m.cols[3].y * m.cols[2].w;
+    c5 = m.cols[2].z * m.cols[3].w - m.cols[3].z * m.cols[2].w;
+
+    det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+    dest.cols[0].x = m.cols[1].y * c5 - m.cols[1].z * c4 + m.cols[1].w * c3;
+    dest.cols[0].y = -m.cols[0].y * c5 + m.cols[0].z * c4 - m.cols[0].w * c3;
+    dest.cols[0].z = m.cols[3].y * s5 - m.cols[3].z * s4 + m.cols[3].w * s3;
+    dest.cols[0].w = -m.cols[2].y * s5 + m.cols[2].z * s4 - m.cols[2].w * s3;
+    dest.cols[1].x = -m.cols[1].x * c5 + m.cols[1].z * c2 - m.cols[1].w * c1;
+    dest.cols[1].y = m.cols[0].x * c5 - m.cols[0].z * c2 + m.cols[0].w * c1;
+    dest.cols[1].z = -m.cols[3].x * s5 + m.cols[3].z * s2 - m.cols[3].w * s1;
+    dest.cols[1].w = m.cols[2].x * s5 - m.cols[2].z * s2 + m.cols[2].w * s1;
+    dest.cols[2].x = m.cols[1].x * c4 - m.cols[1].y * c2 + m.cols[1].w * c0;
+    dest.cols[2].y = -m.cols[0].x * c4 + m.cols[0].y * c2 - m.cols[0].w * c0;
+    dest.cols[2].z = m.cols[3].x * s4 - m.cols[3].y * s2 + m.cols[3].w * s0;
+    dest.cols[2].w = -m.cols[2].x * s4 + m.cols[2].y * s2 - m.cols[2].w * s0;
+    dest.cols[3].x = -m.cols[1].x * c3 + m.cols[1].y * c1 - m.cols[1].z * c0;
+    dest.cols[3].y = m.cols[0].x * c3 - m.cols[0].y * c1 + m.cols[0].z * c0;
+    dest.cols[3].z = -m.cols[3].x * s3 + m.cols[3].y * s1 - m.cols[3].z * s0;
+    dest.cols[3].w = m.cols[2].x * s3 - m.cols[2].y * s1 + m.cols[2].z * s0;
+    return rm_muls_f64x4x4(dest, 1.0 / det);
+}
+/*
+ * inverse of a rotation + scale + translation matrix, the columns of the
+ * upper 3x3 have to be orthogonal which is the case for T * R * S. the
+ * bottom row is assumed to be [0, 0, 0, 1]
+ */
+RM_INLINE f64x4x4
+rm_inverse_affine_f64x4x4(const f64x4x4 m) {
+    f64x4x4 dest;
+    f64x3x3 r;
+    f64x3 s;
+
+    /* the rows of the inverse are the columns over their squared norms */
+    r.cols[0] = m.cols[0].xyz;
+    r.cols[1] = m.cols[1].xyz;
+    r.cols[2] = m.cols[2].xyz;
+    s = rm_sdiv_f64x3(1.0, rm_f64x3(rm_norm2_f64x3(r.cols[0]),
+                                   rm_norm2_f64x3(r.cols[1]),
+                                   rm_norm2_f64x3(r.cols[2])));
+    r = rm_transpose_f64x3x3(r);
+    r.cols[0] = rm_mul_f64x3(r.cols[0], s);
+    r.cols[1] = rm_mul_f64x3(r.cols[1], s);
+    r.cols[2] = rm_mul_f64x3(r.cols[2], s);
+
+    dest.cols[0] = rm_f64x4v3s(r.cols[0], 0.0);
+    dest.cols[1] = rm_f64x4v3s(r.cols[1], 0.0);
+    dest.cols[2] = rm_f64x4v3s(r.cols[2], 0.0);
+    dest.cols[3] =
+        rm_f64x4v3s(rm_neg_f64x3(rm_mulv_f64x3x3(r, m.cols[3].xyz)), 1.0);
+    return dest;
+}
+/*
+ * m * [p, 1] for n packed points, there is no divide by w so the matrix
+ * should be affine. in and out may be the same array but not overlap
+ * otherwise
+ */
+RM_INLINE void
+rm_transform_points_f32x4x4(const f32x4x4 *m,
+                            const f32x3 *in,
+                            f32x3 *out,
+                            const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 m00, m01, m02, m10, m11, m12, m20, m21, m22, m30, m31, m32;
+    __m256 x, y, z;
+
+    m00 = _mm256_set1_ps(m->cols[0].x);
+    m01 = _mm256_set1_ps(m->cols[0].y);
+    m02 = _mm256_set1_ps(m->cols[0].z);
+    m10 = _mm256_set1_ps(m->cols[1].x);
+    m11 = _mm256_set1_ps(m->cols[1].y);
+    m12 = _mm256_set1_ps(m->cols[1].z);
+    m20 = _mm256_set1_ps(m->cols[2].x);
+    m21 = _mm256_set1_ps(m->cols[2].y);
+    m22 = _mm256_set1_ps(m->cols[2].z);
+    m30 = _mm256_set1_ps(m->cols[3].x);
+    m31 = _mm256_set1_ps(m->cols[3].y);
+    m32 = _mm256_set1_ps(m->cols[3].z);
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        rmm256_load3(in[i].raw, &x, &y, &z);
+        rmm256_store3(out[i].raw,
+                      rmm256_fmadd(m20, z,
+                                   rmm256_fmadd(m10, y,
+                                                rmm256_fmadd(m00, x, m30))),
+                      rmm256_fmadd(m21, z,
+                                   rmm256_fmadd(m11, y,
+                                                rmm256_fmadd(m01, x, m31))),
+                      rmm256_fmadd(m22, z,
+                                   rmm256_fmadd(m12, y,
+                                                rmm256_fmadd(m02, x, m32))));
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 m00, m01, m02, m10, m11, m12, m20, m21, m22, m30, m31, m32;
+    rmv_f32x4 x, y, z;
+
+    m00 = rmm_set1(m->cols[0].x);
+    m01 = rmm_set1(m->cols[0].y);
+    m02 = rmm_set1(m->cols[0].z);
+    m10 = rmm_set1(m->cols[1].x);
+    m11 = rmm_set1(m->cols[1].y);
+    m12 = rmm_set1(m->cols[1].z);
+    m20 = rmm_set1(m->cols[2].x);
+    m21 = rmm_set1(m->cols[2].y);
+    m22 = rmm_set1(m->cols[2].z);
+    m30 = rmm_set1(m->cols[3].x);
+    m31 = rmm_set1(m->cols[3].y);
+    m32 = rmm_set1(m->cols[3].z);
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        rmm_load3(in[i].raw, &x, &y, &z);
+        rmm_store3(out[i].raw,
+                   rmm_fmadd(m20, z, rmm_fmadd(m10, y, rmm_fmadd(m00, x, m30))),
+                   rmm_fmadd(m21, z, rmm_fmadd(m11, y, rmm_fmadd(m01, x, m31))),
+                   rmm_fmadd(m22, z,
+                             rmm_fmadd(m12, y, rmm_fmadd(m02, x, m32))));
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) {
+        out[i] = rm_mulv_f32x4x4(*m, rm_f32x4v3s(in[i], 1.0f)).xyz;
+    }
+}
+/*
+ * transforms n packed normals by the inverse transpose of the upper 3x3 of
+ * m, the results are not normalized
+ */
+RM_INLINE void
+rm_transform_normals_f32x4x4(const f32x4x4 *m,
+                             const f32x3 *in,
+                             f32x3 *out,
+                             const size_t n) {
+    f32x4x4 nm;
+    f32x3x3 l;
+
+    l.cols[0] = m->cols[0].xyz;
+    l.cols[1] = m->cols[1].xyz;
+    l.cols[2] = m->cols[2].xyz;
+    l         = rm_transpose_f32x3x3(rm_inverse_f32x3x3(l));
+
+    nm.cols[0] = rm_f32x4v3s(l.cols[0], 0.0f);
+    nm.cols[1] = rm_f32x4v3s(l.cols[1], 0.0f);
+    nm.cols[2] = rm_f32x4v3s(l.cols[2], 0.0f);
+    nm.cols[3] = rm_zero_f32x4();
+    rm_transform_points_f32x4x4(&nm, in, out, n);
+}
+/*
+ * the top three rows of the affine m, one per column. that is the bone
+ * layout rm_skin_f32x4x3 takes, 48 bytes instead of 64
+ */
+RM_INLINE f32x4x3
+rm_affine_rows_f32x4x4(const f32x4x4 m) {
+    f32x4x3 dest;
+#if defined(RM_SIMD_F32X4)
+    rmv_f32x4 c0, c1, c2, c3;
+
+    c0 = rmm_load(m.cols[0].raw);
+    c1 = rmm_load(m.cols[1].raw);
+    c2 = rmm_load(m.cols[2].raw);
+    c3 = rmm_load(m.cols[3].raw);
+    rmm_transpose(&c0, &c1, &c2, &c3);
+    rmm_store(dest.cols[0].raw, c0);
+    rmm_store(dest.cols[1].raw, c1);
+    rmm_store(dest.cols[2].raw, c2);
+#else
+    dest.cols[0] = rm_f32x4(m.cols[0].x, m.cols[1].x, m.cols[2].x, m.cols[3].x);
+    dest.cols[1] = rm_f32x4(m.cols[0].y, m.cols[1].y, m.cols[2].y, m.cols[3].y);
+    dest.cols[2] = rm_f32x4(m.cols[0].z, m.cols[1].z, m.cols[2].z, m.cols[3].z);
+#endif
+    return dest;
+}
+/* the bones idx.x to idx.w weighted by w.x to w.w and summed */
+RM_INLINE f32x4x3
+rm_blend_f32x4x3(const f32x4x3 *bones, const u16x4 idx, const f32x4 w) {
+    f32x4x3 dest;
+    size_t i;
+
+    for (i = 0; i < 3; ++i) {
+        dest.cols[i] = rm_muls_f32x4(bones[idx.x].cols[i], w.x);
+        dest.cols[i] = rm_fma_f32x4(bones[idx.y].cols[i], rm_f32x4s(w.y),
+                                    dest.cols[i]);
+        dest.cols[i] = rm_fma_f32x4(bones[idx.z].cols[i], rm_f32x4s(w.z),
+                                    dest.cols[i]);
+        dest.cols[i] = rm_fma_f32x4(bones[idx.w].cols[i], rm_f32x4s(w.w),
+                                    dest.cols[i]);
+    }
+    return dest;
+}
+/*
+ * linear blend skinning of n vertices. every vertex has 4 bone indices and
+ * 4 weights (unused slots get weight 0 and any valid index), the weights
+ * should add up to 1. bones are in the rm_affine_rows_f32x4x4 layout.
+ *
+ * normals go through the upper 3x3 of the blended matrix, which is right
+ * for rotation and uniform scale, and come out unnormalized. normals and
+ * out_normals may be NULL. in and out may be the same array
+ */
+RM_INLINE void
+rm_skin_f32x4x3(const f32x4x3 *bones,
+                const u16x4 *indices,
+                const f32x4 *weights,
+                const f32x3 *points,
+                f32x3 *out_points,
+                const f32x3 *normals,
+                f32x3 *out_normals,
+                const size_t n) {
+    f32x4x3 m;
+    f32x4 p;
+    size_t i;
+#if defined(RM_AVX)
+    __m256 r0[4], r1[4], r2[4], x, y, z;
+    __m128 a0, a1, a2, b0, b1, b2;
+    size_t k;
+
+    /*
+     * vertex i + k goes in the low half and i + k + 4 in the high half, the
+     * blended rows are transposed so every register holds one matrix
+     * element for all 8 in the same split rmm256_load3 gives
+     */
+    for (i = 0; i < n - n % 8; i += 8) {
+        for (k = 0; k < 4; ++k) {
+            rmm_skin_rows(bones, indices[i + k], &weights[i + k], &a0, &a1,
+                          &a2);
+            rmm_skin_rows(bones, indices[i + k + 4], &weights[i + k + 4], &b0,
+                          &b1, &b2);
+            r0[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(a0), b0, 1);
+            r1[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(a1), b1, 1);
+            r2[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(a2), b2, 1);
+        }
+        rmm256_transpose(&r0[0], &r0[1], &r0[2], &r0[3]);
+        rmm256_transpose(&r1[0], &r1[1], &r1[2], &r1[3]);
+        rmm256_transpose(&r2[0], &r2[1], &r2[2], &r2[3]);
+
+        rmm256_load3(points[i].raw, &x, &y, &z);
+        rmm256_store3(out_points[i].raw,
+                      rmm256_fmadd(r0[2], z,
+                                   rmm256_fmadd(r0[1], y,
+                                                rmm256_fmadd(r0[0], x,
+                                                             r0[3]))),
+                      rmm256_fmadd(r1[2], z,
+                                   rmm256_fmadd(r1[1], y,
+                                                rmm256_fmadd(r1[0], x,
+                                                             r1[3]))),
+                      rmm256_fmadd(r2[2], z,
+                                   rmm256_fmadd(r2[1], y,
+                                                rmm256_fmadd(r2[0], x,
+                                                             r2[3]))));
+        if (normals != NULL) {
+            rmm256_load3(normals[i].raw, &x, &y, &z);
+            rmm256_store3(
+                out_normals[i].raw,
+                rmm256_fmadd(r0[2], z,
+                             rmm256_fmadd(r0[1], y, _mm256_mul_ps(r0[0], x))),
+                rmm256_fmadd(r1[2], z,
+                             rmm256_fmadd(r1[1], y, _mm256_mul_ps(r1[0], x))),
+                rmm256_fmadd(r2[2], z,
+                             rmm256_fmadd(r2[1], y, _mm256_mul_ps(r2[0], x))));
+        }
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 r0[4], r1[4], r2[4], x, y, z;
+    size_t k;
+
+    /*
+     * the blended rows of 4 vertices are transposed so every register holds
+     * one matrix element for all 4 and the transform needs no shuffles
+     */
+    for (i = 0; i < n - n % 4; i += 4) {
+        for (k = 0; k < 4; ++k) {
+            rmm_skin_rows(bones, indices[i + k], &weights[i + k], &r0[k],
+                          &r1[k], &r2[k]);
+        }
+        rmm_transpose(&r0[0], &r0[1], &r0[2], &r0[3]);
+        rmm_transpose(&r1[0], &r1[1], &r1[2], &r1[3]);
+        rmm_transpose(&r2[0], &r2[1], &r2[2], &r2[3]);
+
+        rmm_load3(points[i].raw, &x, &y, &z);
+        rmm_store3(out_points[i].raw,
+                   rmm_fmadd(r0[2], z,
+                             rmm_fmadd(r0[1], y, rmm_fmadd(r0[0], x, r0[3]))),
+                   rmm_fmadd(r1[2], z,
+                             rmm_fmadd(r1[1], y, rmm_fmadd(r1[0], x, r1[3]))),
+                   rmm_fmadd(r2[2], z,
+                             rmm_fmadd(r2[1], y, rmm_fmadd(r2[0], x, r2[3]))));
+        if (normals != NULL) {
+            rmm_load3(normals[i].raw, &x, &y, &z);
+            rmm_store3(out_normals[i].raw,
+                       rmm_fmadd(r0[2], z,
+                                 rmm_fmadd(r0[1], y, rmm_mul(r0[0], x))),
+                       rmm_fmadd(r1[2], z,
+                                 rmm_fmadd(r1[1], y, rmm_mul(r1[0], x))),
+                       rmm_fmadd(r2[2], z,
+                                 rmm_fmadd(r2[1], y, rmm_mul(r2[0], x))));
+        }
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) {
+        m = rm_blend_f32x4x3(bones, indices[i], weights[i]);
+        p = rm_f32x4v3s(points[i], 1.0f);
+        out_points[i] = rm_f32x3(rm_dot_f32x4(m.cols[0], p),
+                                 rm_dot_f32x4(m.cols[1], p),
+                                 rm_dot_f32x4(m.cols[2], p));
+        if (normals != NULL) {
+            p = rm_f32x4v3s(normals[i], 0.0f);
+            out_normals[i] = rm_f32x3(rm_dot_f32x4(m.cols[0], p),
+                                      rm_dot_f32x4(m.cols[1], p),
+                                      rm_dot_f32x4(m.cols[2], p));
+        }
+    }
+}
+/* m * v for n vectors, in and out may be the same array */
+RM_INLINE void
+rm_transform_f32x4x4(const f32x4x4 *m,
+                     const f32x4 *in,
+                     f32x4 *out,
+                     const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 c0, c1, c2, c3;
+
+    c0 = _mm256_broadcast_ps((const __m128 *)m->cols[0].raw);
+    c1 = _mm256_broadcast_ps((const __m128 *)m->cols[1].raw);
+    c2 = _mm256_broadcast_ps((const __m128 *)m->cols[2].raw);
+    c3 = _mm256_broadcast_ps((const __m128 *)m->cols[3].raw);
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        _mm256_storeu_ps(out[i].raw,
+                         rmm256_mulv4(c0, c1, c2, c3,
+                                      _mm256_loadu_ps(in[i].raw)));
+        _mm256_storeu_ps(out[i + 2].raw,
+                         rmm256_mulv4(c0, c1, c2, c3,
+                                      _mm256_loadu_ps(in[i + 2].raw)));
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 c0, c1, c2, c3;
+
+    c0 = rmm_loadu(m->cols[0].raw);
+    c1 = rmm_loadu(m->cols[1].raw);
+    c2 = rmm_loadu(m->cols[2].raw);
+    c3 = rmm_loadu(m->cols[3].raw);
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        rmm_storeu(out[i].raw,
+                   rmm_mulv4(c0, c1, c2, c3, rmm_loadu(in[i].raw)));
+        rmm_storeu(out[i + 1].raw,
+                   rmm_mulv4(c0, c1, c2, c3, rmm_loadu(in[i + 1].raw)));
+        rmm_storeu(out[i + 2].raw,
+                   rmm_mulv4(c0, c1, c2, c3, rmm_loadu(in[i + 2].raw)));
+        rmm_storeu(out[i + 3].raw,
+                   rmm_mulv4(c0, c1, c2, c3, rmm_loadu(in[i + 3].raw)));
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) { out[i] = rm_mulv_f32x4x4(*m, in[i]); }
+}
+
+// QUATERNIONS
+RM_INLINE quatf32
+rm_identity_quatf32(void) {
+    return rm_quatf32(0.0f, 0.0f, 0.0f, 1.0f);
+}
+RM_INLINE quatf64
+rm_identity_quatf64(void) {
+    return rm_quatf64(0.0, 0.0, 0.0, 1.0);
+}
+/* a * b applies b first, then a */
+RM_INLINE quatf32
+rm_mul_quatf32(const quatf32 a, const quatf32 b) {
+#if defined(RM_SIMD_F32X4)
+    quatf32 dest;
+
+    rmm_store(dest.raw, rmm_quat_mul(rmm_load(a.raw), rmm_load(b.raw)));
+    return dest;
+#else
+    return rm_quatf32(a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                      a.w * b.y + a.y * b.w + a.z * b.x - a.x * b.z,
+                      a.w * b.z + a.z * b.w + a.x * b.y - a.y * b.x,
+                      a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+#endif
+}
+RM_INLINE quatf64
+rm_mul_quatf64(const quatf64 a, const quatf64 b) {
+    return rm_quatf64(a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                      a.w * b.y + a.y * b.w + a.z * b.x - a.x * b.z,
+                      a.w * b.z + a.z * b.w + a.x * b.y - a.y * b.x,
+                      a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+}
+RM_INLINE quatf32
+rm_conjugate_quatf32(const quatf32 q) {
+    return rm_quatf32v(
+        rm_mul_f32x4(q.v, rm_f32x4(-1.0f, -1.0f, -1.0f, 1.0f)));
+}
+RM_INLINE quatf64
+rm_conjugate_quatf64(const quatf64 q) {
+    return rm_quatf64(-q.x, -q.y, -q.z, q.w);
+}
+RM_INLINE f32
+rm_dot_quatf32(const quatf32 a, const quatf32 b) {
+    return rm_dot_f32x4(a.v, b.v);
+}
+RM_INLINE f64
+rm_dot_quatf64(const quatf64 a, const quatf64 b) {
+    return rm_dot_f64x4(a.v, b.v);
+}
+/* the zero quaternion stays zero */
+RM_INLINE quatf32
+rm_normalize_quatf32(const quatf32 q) {
+    return rm_quatf32v(rm_normalize_f32x4(q.v));
+}
+RM_INLINE quatf64
+rm_normalize_quatf64(const quatf64 q) {
+    return rm_quatf64v(rm_normalize_f64x4(q.v));
+}
+/* conjugate / |q|^2, for unit q rm_conjugate_quatf32 is enough */
+RM_INLINE quatf32
+rm_inverse_quatf32(const quatf32 q) {
+    f32 s;
+
+    s = 1.0f / rm_dot_quatf32(q, q);
+    return rm_quatf32v(rm_mul_f32x4(q.v, rm_f32x4(-s, -s, -s, s)));
+}
+RM_INLINE quatf64
+rm_inverse_quatf64(const quatf64 q) {
+    f64 s;
+
+    s = 1.0 / rm_dot_quatf64(q, q);
+    return rm_quatf64(-q.x * s, -q.y * s, -q.z * s, q.w * s);
+}
+/* q * v * q^-1, q has to be unit length */
+RM_INLINE f32x3
+rm_rotate_quatf32(const quatf32 q, const f32x3 v) {
+#if defined(RM_SIMD_F32X4)
+    f32x4 dest;
+
+    rmm_store(dest.raw, rmm_quat_rotate(rmm_load(q.raw),
+                                        rmm_setr(v.x, v.y, v.z, 0.0f)));
+    return dest.xyz;
+#else
+    f32x3 t;
+
+    t = rm_cross_f32x3(q.xyz, v);
+    t = rm_add_f32x3(t, t);
+    return rm_add_f32x3(rm_add_f32x3(v, rm_muls_f32x3(t, q.w)),
+                        rm_cross_f32x3(q.xyz, t));
+#endif
+}
+RM_INLINE f64x3
+rm_rotate_quatf64(const quatf64 q, const f64x3 v) {
+    f64x3 t;
+
+    t = rm_cross_f64x3(q.xyz, v);
+    t = rm_add_f64x3(t, t);
+    return rm_add_f64x3(rm_add_f64x3(v, rm_muls_f64x3(t, q.w)),
+                        rm_cross_f64x3(q.xyz, t));
+}
+/* axis has to be unit length, angle is in radians */
+RM_INLINE quatf32
+rm_axis_angle_quatf32(const f32x3 axis, const f32 angle) {
+    f32 s, c;
+
+    rm_sincos_f32(angle * 0.5f, &s, &c);
+    return rm_quatf32(axis.x * s, axis.y * s, axis.z * s, c);
+}
+RM_INLINE quatf64
+rm_axis_angle_quatf64(const f64x3 axis, const f64 angle) {
+    f64 s, c;
+
+    rm_sincos_f64(angle * 0.5, &s, &c);
+    return rm_quatf64(axis.x * s, axis.y * s, axis.z * s, c);
+}
+/* returns the angle, the axis is +x when the angle is close to 0 */
+RM_INLINE f32
+rm_to_axis_angle_quatf32(const quatf32 q, f32x3 *axis) {
+    f32 w, s;
+
+    w = rm_clamp_f32(q.w, -1.0f, 1.0f);
+    s = rm_sqrt_f32(1.0f - w * w);
+
+    if (s < 1e-6f) {
+        *axis = rm_f32x3(1.0f, 0.0f, 0.0f);
+    } else {
+        *axis = rm_muls_f32x3(q.xyz, 1.0f / s);
+    }
+
+    return 2.0f * rm_acos_f32(w);
+}
+RM_INLINE f64
+rm_to_axis_angle_quatf64(const quatf64 q, f64x3 *axis) {
+    f64 w, s;
+
+    w = rm_clamp_f64(q.w, -1.0, 1.0);
+    s = rm_sqrt_f64(1.0 - w * w);
+
+    if (s < 1e-12) {
+        *axis = rm_f64x3(1.0, 0.0, 0.0);
+    } else {
+        *axis = rm_muls_f64x3(q.xyz, 1.0 / s);
+    }
+
+    return 2.0 * rm_acos_f64(w);
+}
+/* rotation matrix of unit q */
+RM_INLINE f32x3x3
+rm_to_f32x3x3_quatf32(const quatf32 q) {
+    f32x3x3 dest;
+#if defined(RM_SIMD_F32X4)
+    rmv_f32x4 c0, c1, c2;
+    f32x4 t;
+
+    rmm_quat_cols(rmm_load(q.raw), &c0, &c1, &c2);
+    rmm_store(t.raw, c0);
+    dest.cols[0] = t.xyz;
+    rmm_store(t.raw, c1);
+    dest.cols[1] = t.xyz;
+    rmm_store(t.raw, c2);
+    dest.cols[2] = t.xyz;
+#else
+    f32 xx, yy, zz, xy, xz, yz, wx, wy, wz;
+
+    xx = q.x * q.x * 2.0f;
+    yy = q.y * q.y * 2.0f;
+    zz = q.z * q.z * 2.0f;
+    xy = q.x * q.y * 2.0f;
+    xz = q.x * q.z * 2.0f;
+    yz = q.y * q.z * 2.0f;
+    wx = q.w * q.x * 2.0f;
+    wy = q.w * q.y * 2.0f;
+    wz = q.w * q.z * 2.0f;
+
+    dest.cols[0] = rm_f32x3(1.0f - yy - zz, xy + wz, xz - wy);
+    dest.cols[1] = rm_f32x3(xy - wz, 1.0f - xx - zz, yz + wx);
+    dest.cols[2] = rm_f32x3(xz + wy, yz - wx, 1.0f - xx - yy);
+#endif
+    return dest;
+}
+RM_INLINE f64x3x3
+rm_to_f64x3x3_quatf64(const quatf64 q) {
+    f64x3x3 dest;
+    f64 xx, yy, zz, xy, xz, yz, wx, wy, wz;
+
+    xx = q.x * q.x * 2.0;
+    yy = q.y * q.y * 2.0;
+    zz = q.z * q.z * 2.0;
+    xy = q.x * q.y * 2.0;
+    xz = q.x * q.z * 2.0;
+    yz = q.y * q.z * 2.0;
+    wx = q.w * q.x * 2.0;
+    wy = q.w * q.y * 2.0;
+    wz = q.w * q.z * 2.0;
+
+    dest.cols[0] = rm_f64x3(1.0 - yy - zz, xy + wz, xz - wy);
+    dest.cols[1] = rm_f64x3(xy - wz, 1.0 - xx - zz, yz + wx);
+    dest.cols[2] = rm_f64x3(xz + wy, yz - wx, 1.0 - xx - yy);
+    return dest;
+}
+/* rotation part from q, no translation */
+RM_INLINE f32x4x4
+rm_to_f32x4x4_quatf32(const quatf32 q) {
+    f32x4x4 dest;
+#if defined(RM_SIMD_F32X4)
+    rmv_f32x4 c0, c1, c2;
+
+    rmm_quat_cols(rmm_load(q.raw), &c0, &c1, &c2);
+    rmm_store(dest.cols[0].raw, c0);
+    rmm_store(dest.cols[1].raw, c1);
+    rmm_store(dest.cols[2].raw, c2);
+#else
+    f32x3x3 m;
+
+    m            = rm_to_f32x3x3_quatf32(q);
+    dest.cols[0] = rm_f32x4v3s(m.cols[0], 0.0f);
+    dest.cols[1] = rm_f32x4v3s(m.cols[1], 0.0f);
+    dest.cols[2] = rm_f32x4v3s(m.cols[2], 0.0f);
+#endif
+    dest.cols[3] = rm_f32x4(0.0f, 0.0f, 0.0f, 1.0f);
+    return dest;
+}
+RM_INLINE f64x4x4
+rm_to_f64x4x4_quatf64(const quatf64 q) {
+    f64x4x4 dest;
+    f64x3x3 m;
+
+    m            = rm_to_f64x3x3_quatf64(q);
+    dest.cols[0] = rm_f64x4v3s(m.cols[0], 0.0);
+    dest.cols[1] = rm_f64x4v3s(m.cols[1], 0.0);
+    dest.cols[2] = rm_f64x4v3s(m.cols[2], 0.0);
+    dest.cols[3] = rm_f64x4(0.0, 0.0, 0.0, 1.0);
+    return dest;
+}
+/*
+ * unit q from a pure rotation matrix. divides by the largest of 4w, 4x,
+ * 4y and 4z so the result stays accurate near 180 degrees
+ */
+RM_INLINE quatf32
+rm_from_f32x3x3_quatf32(const f32x3x3 m) {
+    f32 t, s;
+
+    t = m.raw[0][0] + m.raw[1][1] + m.raw[2][2];
+
+    if (t > 0.0f) {
+        s = 0.5f / rm_sqrt_f32(t + 1.0f);
+        return rm_quatf32((m.raw[1][2] - m.raw[2][1]) * s,
+                          (m.raw[2][0] - m.raw[0][2]) * s,
+                          (m.raw[0][1] - m.raw[1][0]) * s, 0.25f / s);
+    }
+
+    if (m.raw[0][0] > m.raw[1][1] && m.raw[0][0] > m.raw[2][2]) {
+        t = 1.0f + m.raw[0][0] - m.raw[1][1] - m.raw[2][2];
+        s = 0.5f / rm_sqrt_f32(t);
+        return rm_quatf32(0.25f / s, (m.raw[1][0] + m.raw[0][1]) * s,
+                          (m.raw[2][0] + m.raw[0][2]) * s,
+                          (m.raw[1][2] - m.raw[2][1]) * s);
+    }
+
+    if (m.raw[1][1] > m.raw[2][2]) {
+        t = 1.0f + m.raw[1][1] - m.raw[0][0] - m.raw[2][2];
+        s = 0.5f / rm_sqrt_f32(t);
+        return rm_quatf32((m.raw[1][0] + m.raw[0][1]) * s, 0.25f / s,
+                          (m.raw[2][1] + m.raw[1][2]) * s,
+                          (m.raw[2][0] - m.raw[0][2]) * s);
+    }
+
+    t = 1.0f + m.raw[2][2] - m.raw[0][0] - m.raw[1][1];
+    s = 0.5f / rm_sqrt_f32(t);
+    return rm_quatf32((m.raw[2][0] + m.raw[0][2]) * s,
+                      (m.raw[2][1] + m.raw[1][2]) * s, 0.25f / s,
+                      (m.raw[0][1] - m.raw[1][0]) * s);
+}
+RM_INLINE quatf64
+rm_from_f64x3x3_quatf64(const f64x3x3 m) {
+    f64 t, s;
+
+    t = m.raw[0][0] + m.raw[1][1] + m.raw[2][2];
+
+    if (t > 0.0) {
+        s = 0.5 / rm_sqrt_f64(t + 1.0);
+        return rm_quatf64((m.raw[1][2] - m.raw[2][1]) * s,
+                          (m.raw[2][0] - m.raw[0][2]) * s,
+                          (m.raw[0][1] - m.raw[1][0]) * s, 0.25 / s);
+    }
+
+    if (m.raw[0][0] > m.raw[1][1] && m.raw[0][0] > m.raw[2][2]) {
+        t = 1.0 + m.raw[0][0] - m.raw[1][1] - m.raw[2][2];
+        s = 0.5 / rm_sqrt_f64(t);
+        return rm_quatf64(0.25 / s, (m.raw[1][0] + m.raw[0][1]) * s,
+                          (m.raw[2][0] + m.raw[0][2]) * s,
+                          (m.raw[1][2] - m.raw[2][1]) * s);
+    }
+
+    if (m.raw[1][1] > m.raw[2][2]) {
+        t = 1.0 + m.raw[1][1] - m.raw[0][0] - m.raw[2][2];
+        s = 0.5 / rm_sqrt_f64(t);
+        return rm_quatf64((m.raw[1][0] + m.raw[0][1]) * s, 0.25 / s,
+                          (m.raw[2][1] + m.raw[1][2]) * s,
+                          (m.raw[2][0] - m.raw[0][2]) * s);
+    }
+
+    t = 1.0 + m.raw[2][2] - m.raw[0][0] - m.raw[1][1];
+    s = 0.5 / rm_sqrt_f64(t);
+    return rm_quatf64((m.raw[2][0] + m.raw[0][2]) * s,
+                      (m.raw[2][1] + m.raw[1][2]) * s, 0.25 / s,
+                      (m.raw[0][1] - m.raw[1][0]) * s);
+}
+/* the upper 3x3 has to be a pure rotation */
+RM_INLINE quatf32
+rm_from_f32x4x4_quatf32(const f32x4x4 m) {
+    f32x3x3 r;
+
+    r.cols[0] = m.cols[0].xyz;
+    r.cols[1] = m.cols[1].xyz;
+    r.cols[2] = m.cols[2].xyz;
+    return rm_from_f32x3x3_quatf32(r);
+}
+RM_INLINE quatf64
+rm_from_f64x4x4_quatf64(const f64x4x4 m) {
+    f64x3x3 r;
+
+    r.cols[0] = m.cols[0].xyz;
+    r.cols[1] = m.cols[1].xyz;
+    r.cols[2] = m.cols[2].xyz;
+    return rm_from_f64x3x3_quatf64(r);
+}
+/* normalized lerp along the shorter arc, a and b have to be unit length */
+RM_INLINE quatf32
+rm_nlerp_quatf32(const quatf32 a, const quatf32 b, const f32 t) {
+    quatf32 dest;
+    f32 wb;
+
+    wb = rm_dot_quatf32(a, b) < 0.0f ? -t : t;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_fmadd(rmm_load(b.raw), rmm_set1(wb),
+                                  rmm_mul(rmm_load(a.raw),
+                                          rmm_set1(1.0f - t))));
+#else
+    dest.v = rm_add_f32x4(rm_muls_f32x4(a.v, 1.0f - t),
+                          rm_muls_f32x4(b.v, wb));
+#endif
+    return rm_normalize_quatf32(dest);
+}
+RM_INLINE quatf64
+rm_nlerp_quatf64(const quatf64 a, const quatf64 b, const f64 t) {
+    f64 wb;
+
+    wb = rm_dot_quatf64(a, b) < 0.0 ? -t : t;
+    return rm_normalize_quatf64(rm_quatf64v(rm_add_f64x4(
+        rm_muls_f64x4(a.v, 1.0 - t), rm_muls_f64x4(b.v, wb))));
+}
+/*
+ * spherical lerp along the shorter arc, a and b have to be unit length.
+ * falls back to nlerp when they are almost parallel, where sin(theta) is
+ * too small to divide by
+ */
+RM_INLINE quatf32
+rm_slerp_quatf32(const quatf32 a, const quatf32 b, const f32 t) {
+    quatf32 dest;
+    f32x4 s;
+    f32 d, sb, theta, wa, wb;
+
+    d  = rm_dot_quatf32(a, b);
+    sb = d < 0.0f ? -1.0f : 1.0f;
+    d  = d * sb;
+
+    if (d > 0.9995f) { return rm_nlerp_quatf32(a, b, t); }
+
+    /* all three sines in one go */
+    theta = rm_acos_f32(d);
+    s     = rm_sin_f32x4(rm_f32x4((1.0f - t) * theta, t * theta, theta, 0.0f));
+    wa    = s.x / s.z;
+    wb    = s.y / s.z * sb;
+#if defined(RM_SIMD_F32X4)
+    rmm_store(dest.raw, rmm_fmadd(rmm_load(b.raw), rmm_set1(wb),
+                                  rmm_mul(rmm_load(a.raw), rmm_set1(wa))));
+#else
+    dest.v = rm_add_f32x4(rm_muls_f32x4(a.v, wa), rm_muls_f32x4(b.v, wb));
+#endif
+    return dest;
+}
+RM_INLINE quatf64
+rm_slerp_quatf64(const quatf64 a, const quatf64 b, const f64 t) {
+    f64x4 s;
+    f64 d, sb, theta;
+
+    d  = rm_dot_quatf64(a, b);
+    sb = d < 0.0 ? -1.0 : 1.0;
+    d  = d * sb;
+
+    if (d > 0.9999995) { return rm_nlerp_quatf64(a, b, t); }
+
+    theta = rm_acos_f64(d);
+    s     = rm_sin_f64x4(rm_f64x4((1.0 - t) * theta, t * theta, theta, 0.0));
+    return rm_quatf64v(rm_add_f64x4(rm_muls_f64x4(a.v, s.x / s.z),
+                                    rm_muls_f64x4(b.v, s.y / s.z * sb)));
+}
+/*
+ * rm_nlerp_quatf32 for n pairs, each with its own t. works on 8 (avx) or 4
+ * quaternions at a time split into x, y, z and w. out may be a or b
+ */
+RM_INLINE void
+rm_nlerp_batch_quatf32(const quatf32 *a,
+                       const quatf32 *b,
+                       const f32 *t,
+                       quatf32 *out,
+                       const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 ax, ay, az, aw, bx, by, bz, bw, wa, wb, l;
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        rmm256_load4(a[i].raw, &ax, &ay, &az, &aw);
+        rmm256_load4(b[i].raw, &bx, &by, &bz, &bw);
+
+        l  = _mm256_mul_ps(ax, bx);
+        l  = rmm256_fmadd(ay, by, l);
+        l  = rmm256_fmadd(az, bz, l);
+        l  = rmm256_fmadd(aw, bw, l);
+        wb = _mm256_loadu_ps(t + i);
+        wa = _mm256_sub_ps(_mm256_set1_ps(1.0f), wb);
+        wb = _mm256_xor_ps(wb, _mm256_and_ps(l, _mm256_set1_ps(-0.0f)));
+
+        ax = rmm256_fmadd(bx, wb, _mm256_mul_ps(ax, wa));
+        ay = rmm256_fmadd(by, wb, _mm256_mul_ps(ay, wa));
+        az = rmm256_fmadd(bz, wb, _mm256_mul_ps(az, wa));
+        aw = rmm256_fmadd(bw, wb, _mm256_mul_ps(aw, wa));
+
+        l = _mm256_mul_ps(ax, ax);
+        l = rmm256_fmadd(ay, ay, l);
+        l = rmm256_fmadd(az, az, l);
+        l = rmm256_rsqrt(rmm256_fmadd(aw, aw, l));
+        rmm256_store4(out[i].raw, _mm256_mul_ps(ax, l), _mm256_mul_ps(ay, l),
+                      _mm256_mul_ps(az, l), _mm256_mul_ps(aw, l));
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 ax, ay, az, aw, bx, by, bz, bw, wa, wb, l;
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        rmm_load4(a[i].raw, &ax, &ay, &az, &aw);
+        rmm_load4(b[i].raw, &bx, &by, &bz, &bw);
+
+        l  = rmm_mul(ax, bx);
+        l  = rmm_fmadd(ay, by, l);
+        l  = rmm_fmadd(az, bz, l);
+        l  = rmm_fmadd(aw, bw, l);
+        wb = rmm_loadu(t + i);
+        wa = rmm_sub(rmm_set1(1.0f), wb);
+        wb = rmm_blendv(wb, rmm_neg(wb), rmm_cmplt(l, rmm_setzero()));
+
+        ax = rmm_fmadd(bx, wb, rmm_mul(ax, wa));
+        ay = rmm_fmadd(by, wb, rmm_mul(ay, wa));
+        az = rmm_fmadd(bz, wb, rmm_mul(az, wa));
+        aw = rmm_fmadd(bw, wb, rmm_mul(aw, wa));
+
+        l = rmm_mul(ax, ax);
+        l = rmm_fmadd(ay, ay, l);
+        l = rmm_fmadd(az, az, l);
+        l = rmm_rsqrt(rmm_fmadd(aw, aw, l));
+        rmm_store4(out[i].raw, rmm_mul(ax, l), rmm_mul(ay, l), rmm_mul(az, l),
+                   rmm_mul(aw, l));
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) { out[i] = rm_nlerp_quatf32(a[i], b[i], t[i]); }
+}
+/*
+ * rm_slerp_quatf32 for n pairs, each with its own t in [0, 1]. one acos and
+ * one sincos per lane, sin((1 - t) theta) comes from the angle difference
+ * formula. out may be a or b
+ */
+RM_INLINE void
+rm_slerp_batch_quatf32(const quatf32 *a,
+                       const quatf32 *b,
+                       const f32 *t,
+                       quatf32 *out,
+                       const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 ax, ay, az, aw, bx, by, bz, bw, wa, wb, l, near;
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        rmm256_load4(a[i].raw, &ax, &ay, &az, &aw);
+        rmm256_load4(b[i].raw, &bx, &by, &bz, &bw);
+
+        l    = _mm256_mul_ps(ax, bx);
+        l    = rmm256_fmadd(ay, by, l);
+        l    = rmm256_fmadd(az, bz, l);
+        l    = rmm256_fmadd(aw, bw, l);
+        near = rmm256_slerp_weights(l, _mm256_loadu_ps(t + i), &wa, &wb);
+
+        ax = rmm256_fmadd(bx, wb, _mm256_mul_ps(ax, wa));
+        ay = rmm256_fmadd(by, wb, _mm256_mul_ps(ay, wa));
+        az = rmm256_fmadd(bz, wb, _mm256_mul_ps(az, wa));
+        aw = rmm256_fmadd(bw, wb, _mm256_mul_ps(aw, wa));
+
+        /* only the nlerp lanes need normalizing */
+        if (_mm256_movemask_ps(near)) {
+            l  = _mm256_mul_ps(ax, ax);
+            l  = rmm256_fmadd(ay, ay, l);
+            l  = rmm256_fmadd(az, az, l);
+            l  = rmm256_rsqrt(rmm256_fmadd(aw, aw, l));
+            l  = _mm256_blendv_ps(_mm256_set1_ps(1.0f), l, near);
+            ax = _mm256_mul_ps(ax, l);
+            ay = _mm256_mul_ps(ay, l);
+            az = _mm256_mul_ps(az, l);
+            aw = _mm256_mul_ps(aw, l);
+        }
+        rmm256_store4(out[i].raw, ax, ay, az, aw);
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 ax, ay, az, aw, bx, by, bz, bw, wa, wb, l, near;
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        rmm_load4(a[i].raw, &ax, &ay, &az, &aw);
+        rmm_load4(b[i].raw, &bx, &by, &bz, &bw);
+
+        l    = rmm_mul(ax, bx);
+        l    = rmm_fmadd(ay, by, l);
+        l    = rmm_fmadd(az, bz, l);
+        l    = rmm_fmadd(aw, bw, l);
+        near = rmm_slerp_weights(l, rmm_loadu(t + i), &wa, &wb);
+
+        ax = rmm_fmadd(bx, wb, rmm_mul(ax, wa));
+        ay = rmm_fmadd(by, wb, rmm_mul(ay, wa));
+        az = rmm_fmadd(bz, wb, rmm_mul(az, wa));
+        aw = rmm_fmadd(bw, wb, rmm_mul(aw, wa));
+
+        /* only the nlerp lanes need normalizing */
+        if (rmm_any(near)) {
+            l  = rmm_mul(ax, ax);
+            l  = rmm_fmadd(ay, ay, l);
+            l  = rmm_fmadd(az, az, l);
+            l  = rmm_rsqrt(rmm_fmadd(aw, aw, l));
+            l  = rmm_blendv(rmm_set1(1.0f), l, near);
+            ax = rmm_mul(ax, l);
+            ay = rmm_mul(ay, l);
+            az = rmm_mul(az, l);
+            aw = rmm_mul(aw, l);
+        }
+        rmm_store4(out[i].raw, ax, ay, az, aw);
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) { out[i] = rm_slerp_quatf32(a[i], b[i], t[i]); }
+}
+
+// BOUNDING VOLUMES
+RM_INLINE f32x3
+rm_center_aabbf32(const aabbf32 b) {
+    return rm_muls_f32x3(rm_add_f32x3(b.min, b.max), 0.5f);
+}
+/* half the size on every axis */
+RM_INLINE f32x3
+rm_extent_aabbf32(const aabbf32 b) {
+    return rm_muls_f32x3(rm_sub_f32x3(b.max, b.min), 0.5f);
+}
+RM_INLINE aabbf32
+rm_merge_aabbf32(const aabbf32 a, const aabbf32 b) {
+    return rm_aabbf32(rm_min_f32x3(a.min, b.min), rm_max_f32x3(a.max, b.max));
+}
+/*
+ * the frustum planes of a view projection matrix in the order left, right,
+ * bottom, top, near, far. xyz is the normal pointing inwards and w the
+ * offset, scaled to a unit normal. near assumes -w <= z <= w clip space,
+ * with a 0..w depth range it ends up behind the real near plane which only
+ * keeps a few more boxes
+ */
+RM_INLINE void
+rm_frustum_planes_f32x4x4(const f32x4x4 m, f32x4 *planes) {
+    f32x4x4 t;
+    size_t i;
+
+    t         = rm_transpose_f32x4x4(m);
+    planes[0] = rm_add_f32x4(t.cols[3], t.cols[0]);
+    planes[1] = rm_sub_f32x4(t.cols[3], t.cols[0]);
+    planes[2] = rm_add_f32x4(t.cols[3], t.cols[1]);
+    planes[3] = rm_sub_f32x4(t.cols[3], t.cols[1]);
+    planes[4] = rm_add_f32x4(t.cols[3], t.cols[2]);
+    planes[5] = rm_sub_f32x4(t.cols[3], t.cols[2]);
+    for (i = 0; i < 6; ++i) {
+        planes[i] =
+            rm_muls_f32x4(planes[i], 1.0f / rm_norm_f32x3(planes[i].xyz));
+    }
+}
+/*
+ * false when the box is completely outside one of the 6 planes. only tests
+ * the corner furthest along each normal, so boxes near the frustum edges
+ * can pass without touching it
+ */
+RM_INLINE bool
+rm_frustum_test_aabbf32(const f32x4 *planes, const aabbf32 b) {
+    f32x4 hi, lo;
+    size_t i;
+
+    for (i = 0; i < 6; ++i) {
+        hi = rm_max_f32x4(planes[i], rm_zero_f32x4());
+        lo = rm_min_f32x4(planes[i], rm_zero_f32x4());
+        if (planes[i].w + rm_dot_f32x3(hi.xyz, b.max) +
+                rm_dot_f32x3(lo.xyz, b.min) <
+            0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+/*
+ * rm_frustum_test_aabbf32 for n boxes, bit i % 8 of visible[i / 8] is set
+ * when box i passes. visible needs (n + 7) / 8 bytes, the unused high bits
+ * of the last one are cleared. every plane term is broadcast once up front
+ * and the boxes are transposed so each plane costs 6 fmas per 8 or 4 boxes
+ */
+RM_INLINE void
+rm_frustum_cull_batch_aabbf32(const f32x4 *planes,
+                              const aabbf32 *boxes,
+                              u8 *visible,
+                              const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 w[6], hx[6], hy[6], hz[6], lx[6], ly[6], lz[6];
+    __m256 mn[3], mx[3], d, out;
+    f32x4 hi, lo;
+    size_t j;
+    int m;
+
+    for (j = 0; j < 6; ++j) {
+        hi    = rm_max_f32x4(planes[j], rm_zero_f32x4());
+        lo    = rm_min_f32x4(planes[j], rm_zero_f32x4());
+        w[j]  = _mm256_set1_ps(planes[j].w);
+        hx[j] = _mm256_set1_ps(hi.x);
+        hy[j] = _mm256_set1_ps(hi.y);
+        hz[j] = _mm256_set1_ps(hi.z);
+        lx[j] = _mm256_set1_ps(lo.x);
+        ly[j] = _mm256_set1_ps(lo.y);
+        lz[j] = _mm256_set1_ps(lo.z);
+    }
+    for (i = 0; i < n - n % 8; i += 8) {
+        /* the lanes are boxes 0 1 4 5 2 3 6 7, fixed up in the mask */
+        rmm256_load_aabbf32(boxes + i, mn, mx);
+
+        out = _mm256_setzero_ps();
+        for (j = 0; j < 6; ++j) {
+            d   = rmm256_fmadd(mx[0], hx[j], w[j]);
+            d   = rmm256_fmadd(mn[0], lx[j], d);
+            d   = rmm256_fmadd(mx[1], hy[j], d);
+            d   = rmm256_fmadd(mn[1], ly[j], d);
+            d   = rmm256_fmadd(mx[2], hz[j], d);
+            d   = rmm256_fmadd(mn[2], lz[j], d);
+            out = _mm256_or_ps(
+                out, _mm256_cmp_ps(d, _mm256_setzero_ps(), _CMP_LT_OQ));
+        }
+        m              = ~_mm256_movemask_ps(out);
+        visible[i / 8] = (u8)((m & 0xC3) | (m & 0x0C) << 2 | (m & 0x30) >> 2);
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 w[6], hx[6], hy[6], hz[6], lx[6], ly[6], lz[6];
+    rmv_f32x4 mn[3], mx[3], d, out;
+    f32x4 hi, lo;
+    size_t j, k;
+    int m;
+
+    for (j = 0; j < 6; ++j) {
+        hi    = rm_max_f32x4(planes[j], rm_zero_f32x4());
+        lo    = rm_min_f32x4(planes[j], rm_zero_f32x4());
+        w[j]  = rmm_set1(planes[j].w);
+        hx[j] = rmm_set1(hi.x);
+        hy[j] = rmm_set1(hi.y);
+        hz[j] = rmm_set1(hi.z);
+        lx[j] = rmm_set1(lo.x);
+        ly[j] = rmm_set1(lo.y);
+        lz[j] = rmm_set1(lo.z);
+    }
+    for (i = 0; i < n - n % 8; i += 8) {
+        m = 0;
+        for (k = 0; k < 8; k += 4) {
+            rmm_load_aabbf32(boxes + i + k, mn, mx);
+
+            out = rmm_setzero();
+            for (j = 0; j < 6; ++j) {
+                d   = rmm_fmadd(mx[0], hx[j], w[j]);
+                d   = rmm_fmadd(mn[0], lx[j], d);
+                d   = rmm_fmadd(mx[1], hy[j], d);
+                d   = rmm_fmadd(mn[1], ly[j], d);
+                d   = rmm_fmadd(mx[2], hz[j], d);
+                d   = rmm_fmadd(mn[2], lz[j], d);
+                out = rmm_or(out, rmm_cmplt(d, rmm_setzero()));
+            }
+            m |= rmm_movemask(out) << k;
+        }
+        visible[i / 8] = (u8)~m;
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) {
+        if (i % 8 == 0) { visible[i / 8] = 0; }
+        if (rm_frustum_test_aabbf32(planes, boxes[i])) {
+            visible[i / 8] |= (u8)(1u << i % 8);
+        }
+    }
+}
+/* a ray from a direction, the direction does not need to be normalized */
+RM_INLINE rayf32
+rm_dir_rayf32(const f32x3 origin,
+              const f32x3 dir,
+              const f32 tmin,
+              const f32 tmax) {
+    return rm_rayf32(origin, rm_sdiv_f32x3(1.0f, dir), tmin, tmax);
+}
+RM_INLINE rayf32
+rm_get_ray_packetf32(const ray_packetf32 *p, const size_t i) {
+    return rm_rayf32(rm_f32x3(p->ox[i], p->oy[i], p->oz[i]),
+                     rm_f32x3(p->ix[i], p->iy[i], p->iz[i]), p->tmin[i],
+                     p->tmax[i]);
+}
+RM_INLINE void
+rm_set_ray_packetf32(ray_packetf32 *p, const size_t i, const rayf32 r) {
+    p->ox[i]   = r.origin.x;
+    p->oy[i]   = r.origin.y;
+    p->oz[i]   = r.origin.z;
+    p->ix[i]   = r.inv_dir.x;
+    p->iy[i]   = r.inv_dir.y;
+    p->iz[i]   = r.inv_dir.z;
+    p->tmin[i] = r.tmin;
+    p->tmax[i] = r.tmax;
+}
+/*
+ * slab test, true when the ray enters the box within [tmin, tmax]. *t gets
+ * the entry distance, clamped to tmin when the origin is inside, or
+ * RM_INF_F32 on a miss
+ */
+RM_INLINE bool
+rm_raycast_aabbf32(const rayf32 r, const aabbf32 b, f32 *t) {
+    f32x3 t0, t1, lo, hi;
+    f32 tn, tf;
+
+    t0 = rm_mul_f32x3(rm_sub_f32x3(b.min, r.origin), r.inv_dir);
+    t1 = rm_mul_f32x3(rm_sub_f32x3(b.max, r.origin), r.inv_dir);
+    lo = rm_min_f32x3(t0, t1);
+    hi = rm_max_f32x3(t0, t1);
+    tn = rm_max_f32(lo.z, rm_max_f32(lo.y, rm_max_f32(lo.x, r.tmin)));
+    tf = rm_min_f32(hi.z, rm_min_f32(hi.y, rm_min_f32(hi.x, r.tmax)));
+    *t = tn <= tf ? tn : RM_INF_F32;
+    return tn <= tf;
+}
+/*
+ * rm_raycast_aabbf32 for one ray against the 4 boxes of a wide bvh node,
+ * bit i of the result is set when box i is hit and t[i] gets its entry
+ * distance
+ */
+RM_INLINE int
+rm_raycast4_aabbf32(const rayf32 r, const aabbf32 *boxes, f32 *t) {
+#if defined(RM_SIMD_F32X4)
+    rmv_f32x4 mn[3], mx[3], tn, tf, hit;
+
+    rmm_load_aabbf32(boxes, mn, mx);
+    tn = rmm_set1(r.tmin);
+    tf = rmm_set1(r.tmax);
+    rmm_slab(mn[0], mx[0], rmm_set1(r.origin.x), rmm_set1(r.inv_dir.x), &tn,
+             &tf);
+    rmm_slab(mn[1], mx[1], rmm_set1(r.origin.y), rmm_set1(r.inv_dir.y), &tn,
+             &tf);
+    rmm_slab(mn[2], mx[2], rmm_set1(r.origin.z), rmm_set1(r.inv_dir.z), &tn,
+             &tf);
+    hit = rmm_cmple(tn, tf);
+    rmm_storeu(t, rmm_blendv(rmm_set1(RM_INF_F32), tn, hit));
+    return rmm_movemask(hit);
+#else
+    int i, mask;
+
+    mask = 0;
+    for (i = 0; i < 4; ++i) {
+        mask |= rm_raycast_aabbf32(r, boxes[i], t + i) << i;
+    }
+    return mask;
+#endif
+}
+/*
+ * rm_raycast_aabbf32 for the RM_RAY_PACKET rays of a packet against one
+ * box, bit i of the result is set when ray i hits and t[i] gets its entry
+ * distance. avx does the packet at once, sse and neon in two halves
+ */
+RM_INLINE int
+rm_raycast_packet_aabbf32(const ray_packetf32 *p, const aabbf32 b, f32 *t) {
+#if defined(RM_AVX)
+    __m256 tn, tf, hit;
+
+    tn = _mm256_loadu_ps(p->tmin);
+    tf = _mm256_loadu_ps(p->tmax);
+    rmm256_slab(_mm256_set1_ps(b.min.x), _mm256_set1_ps(b.max.x),
+                _mm256_loadu_ps(p->ox), _mm256_loadu_ps(p->ix), &tn, &tf);
+    rmm256_slab(_mm256_set1_ps(b.min.y), _mm256_set1_ps(b.max.y),
+                _mm256_loadu_ps(p->oy), _mm256_loadu_ps(p->iy), &tn, &tf);
+    rmm256_slab(_mm256_set1_ps(b.min.z), _mm256_set1_ps(b.max.z),
+                _mm256_loadu_ps(p->oz), _mm256_loadu_ps(p->iz), &tn, &tf);
+    hit = _mm256_cmp_ps(tn, tf, _CMP_LE_OQ);
+    _mm256_storeu_ps(t, _mm256_blendv_ps(_mm256_set1_ps(RM_INF_F32), tn, hit));
+    return _mm256_movemask_ps(hit);
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 tn, tf, hit;
+    int i, mask;
+
+    mask = 0;
+    for (i = 0; i < RM_RAY_PACKET; i += 4) {
+        tn = rmm_loadu(p->tmin + i);
+        tf = rmm_loadu(p->tmax + i);
+        rmm_slab(rmm_set1(b.min.x), rmm_set1(b.max.x), rmm_loadu(p->ox + i),
+                 rmm_loadu(p->ix + i), &tn, &tf);
+        rmm_slab(rmm_set1(b.min.y), rmm_set1(b.max.y), rmm_loadu(p->oy + i),
+                 rmm_loadu(p->iy + i), &tn, &tf);
+        rmm_slab(rmm_set1(b.min.z), rmm_set1(b.max.z), rmm_loadu(p->oz + i),
+                 rmm_loadu(p->iz + i), &tn, &tf);
+        hit = rmm_cmple(tn, tf);
+        rmm_storeu(t + i, rmm_blendv(rmm_set1(RM_INF_F32), tn, hit));
+        mask |= rmm_movemask(hit) << i;
+    }
+    return mask;
+#else
+    int i, mask;
+
+    mask = 0;
+    for (i = 0; i < RM_RAY_PACKET; ++i) {
+        mask |= rm_raycast_aabbf32(rm_get_ray_packetf32(p, i), b, t + i) << i;
+    }
+    return mask;
+#endif
+}
+
+// STRUCTURE OF ARRAYS
+RM_INLINE f32x3
+rm_get_f32x3_soa(const f32x3_soa s, const size_t i) {
+    return rm_f32x3(s.x[i], s.y[i], s.z[i]);
+}
+RM_INLINE void
+rm_set_f32x3_soa(const f32x3_soa s, const size_t i, const f32x3 v) {
+    s.x[i] = v.x;
+    s.y[i] = v.y;
+    s.z[i] = v.z;
+}
+RM_INLINE f32x4
+rm_get_f32x4_soa(const f32x4_soa s, const size_t i) {
+    return rm_f32x4(s.x[i], s.y[i], s.z[i], s.w[i]);
+}
+RM_INLINE void
+rm_set_f32x4_soa(const f32x4_soa s, const size_t i, const f32x4 v) {
+    s.x[i] = v.x;
+    s.y[i] = v.y;
+    s.z[i] = v.z;
+    s.w[i] = v.w;
+}
+RM_INLINE u8x4
+rm_get_u8x4_soa(const u8x4_soa s, const size_t i) {
+    return rm_u8x4(s.x[i], s.y[i], s.z[i], s.w[i]);
+}
+RM_INLINE void
+rm_set_u8x4_soa(const u8x4_soa s, const size_t i, const u8x4 v) {
+    s.x[i] = v.x;
+    s.y[i] = v.y;
+    s.z[i] = v.z;
+    s.w[i] = v.w;
+}
+/* array of structures to structure of arrays */
+RM_INLINE void
+rm_deinterleave_f32x3(const f32x3 *in, f32x3_soa out, const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 x, y, z;
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        rmm256_load3(in[i].raw, &x, &y, &z);
+        _mm256_storeu_ps(out.x + i, x);
+        _mm256_storeu_ps(out.y + i, y);
+        _mm256_storeu_ps(out.z + i, z);
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 x, y, z;
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        rmm_load3(in[i].raw, &x, &y, &z);
+        rmm_storeu(out.x + i, x);
+        rmm_storeu(out.y + i, y);
+        rmm_storeu(out.z + i, z);
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) { rm_set_f32x3_soa(out, i, in[i]); }
+}
+RM_INLINE void
+rm_interleave_f32x3(const f32x3_soa in, f32x3 *out, const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    for (i = 0; i < n - n % 8; i += 8) {
+        rmm256_store3(out[i].raw, _mm256_loadu_ps(in.x + i),
+                      _mm256_loadu_ps(in.y + i), _mm256_loadu_ps(in.z + i));
+    }
+#elif defined(RM_SIMD_F32X4)
+    for (i = 0; i < n - n % 4; i += 4) {
+        rmm_store3(out[i].raw, rmm_loadu(in.x + i), rmm_loadu(in.y + i),
+                   rmm_loadu(in.z + i));
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) { out[i] = rm_get_f32x3_soa(in, i); }
+}
+RM_INLINE void
+rm_deinterleave_f32x4(const f32x4 *in, f32x4_soa out, const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 x, y, z, w;
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        rmm256_load4(in[i].raw, &x, &y, &z, &w);
+        _mm256_storeu_ps(out.x + i, x);
+        _mm256_storeu_ps(out.y + i, y);
+        _mm256_storeu_ps(out.z + i, z);
+        _mm256_storeu_ps(out.w + i, w);
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 x, y, z, w;
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        rmm_load4(in[i].raw, &x, &y, &z, &w);
+        rmm_storeu(out.x + i, x);
+        rmm_storeu(out.y + i, y);
+        rmm_storeu(out.z + i, z);
+        rmm_storeu(out.w + i, w);
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) { rm_set_f32x4_soa(out, i, in[i]); }
+}
+RM_INLINE void
+rm_interleave_f32x4(const f32x4_soa in, f32x4 *out, const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    for (i = 0; i < n - n % 8; i += 8) {
+        rmm256_store4(out[i].raw, _mm256_loadu_ps(in.x + i),
+                      _mm256_loadu_ps(in.y + i), _mm256_loadu_ps(in.z + i),
+                      _mm256_loadu_ps(in.w + i));
+    }
+#elif defined(RM_SIMD_F32X4)
+    for (i = 0; i < n - n % 4; i += 4) {
+        rmm_store4(out[i].raw, rmm_loadu(in.x + i), rmm_loadu(in.y + i),
+                   rmm_loadu(in.z + i), rmm_loadu(in.w + i));
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) { out[i] = rm_get_f32x4_soa(in, i); }
+}
+/* splits packed rgba8 style data into one plane per channel */
+RM_INLINE void
+rm_deinterleave_u8x4(const u8x4 *in, u8x4_soa out, const size_t n) {
+    size_t i;
+#if defined(RM_AVX2)
+    __m256i x, y, z, w;
+
+    for (i = 0; i < n - n % 32; i += 32) {
+        rmm256i_load4_u8(in[i].raw, &x, &y, &z, &w);
+        _mm256_storeu_si256((__m256i *)(out.x + i), x);
+        _mm256_storeu_si256((__m256i *)(out.y + i), y);
+        _mm256_storeu_si256((__m256i *)(out.z + i), z);
+        _mm256_storeu_si256((__m256i *)(out.w + i), w);
+    }
+#elif defined(RM_SSE2)
+    __m128i x, y, z, w;
+
+    for (i = 0; i < n - n % 16; i += 16) {
+        rmmi_load4_u8(in[i].raw, &x, &y, &z, &w);
+        rmmi_store(out.x + i, x);
+        rmmi_store(out.y + i, y);
+        rmmi_store(out.z + i, z);
+        rmmi_store(out.w + i, w);
+    }
+#elif defined(RM_NEON)
+    uint8x16x4_t v;
+
+    for (i = 0; i < n - n % 16; i += 16) {
+        v = vld4q_u8(in[i].raw);
+        vst1q_u8(out.x + i, v.val[0]);
+        vst1q_u8(out.y + i, v.val[1]);
+        vst1q_u8(out.z + i, v.val[2]);
+        vst1q_u8(out.w + i, v.val[3]);
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) { rm_set_u8x4_soa(out, i, in[i]); }
+}
+RM_INLINE void
+rm_interleave_u8x4(const u8x4_soa in, u8x4 *out, const size_t n) {
+    size_t i;
+#if defined(RM_AVX2)
+    for (i = 0; i < n - n % 32; i += 32) {
+        rmm256i_store4_u8(out[i].raw,
+                          _mm256_loadu_si256((const __m256i *)(in.x + i)),
+                          _mm256_loadu_si256((const __m256i *)(in.y + i)),
+                          _mm256_loadu_si256((const __m256i *)(in.z + i)),
+                          _mm256_loadu_si256((const __m256i *)(in.w + i)));
+    }
+#elif defined(RM_SSE2)
+    for (i = 0; i < n - n % 16; i += 16) {
+        rmmi_store4_u8(out[i].raw, rmmi_load(in.x + i), rmmi_load(in.y + i),
+                       rmmi_load(in.z + i), rmmi_load(in.w + i));
+    }
+#elif defined(RM_NEON)
+    uint8x16x4_t v;
+
+    for (i = 0; i < n - n % 16; i += 16) {
+        v.val[0] = vld1q_u8(in.x + i);
+        v.val[1] = vld1q_u8(in.y + i);
+        v.val[2] = vld1q_u8(in.z + i);
+        v.val[3] = vld1q_u8(in.w + i);
+        vst4q_u8(out[i].raw, v);
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) { out[i] = rm_get_u8x4_soa(in, i); }
+}
+RM_INLINE void
+rm_add_f32x3_soa(const f32x3_soa a,
+                 const f32x3_soa b,
+                 f32x3_soa dest,
+                 const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 ax, ay, az, bx, by, bz;
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        ax = _mm256_loadu_ps(a.x + i);
+        ay = _mm256_loadu_ps(a.y + i);
+        az = _mm256_loadu_ps(a.z + i);
+        bx = _mm256_loadu_ps(b.x + i);
+        by = _mm256_loadu_ps(b.y + i);
+        bz = _mm256_loadu_ps(b.z + i);
+        _mm256_storeu_ps(dest.x + i, _mm256_add_ps(ax, bx));
+        _mm256_storeu_ps(dest.y + i, _mm256_add_ps(ay, by));
+        _mm256_storeu_ps(dest.z + i, _mm256_add_ps(az, bz));
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 ax, ay, az, bx, by, bz;
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        ax = rmm_loadu(a.x + i);
+        ay = rmm_loadu(a.y + i);
+        az = rmm_loadu(a.z + i);
+        bx = rmm_loadu(b.x + i);
+        by = rmm_loadu(b.y + i);
+        bz = rmm_loadu(b.z + i);
+        rmm_storeu(dest.x + i, rmm_add(ax, bx));
+        rmm_storeu(dest.y + i, rmm_add(ay, by));
+        rmm_storeu(dest.z + i, rmm_add(az, bz));
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) {
+        rm_set_f32x3_soa(dest, i, rm_add_f32x3(rm_get_f32x3_soa(a, i),
+                                               rm_get_f32x3_soa(b, i)));
+    }
+}
+RM_INLINE void
+rm_sub_f32x3_soa(const f32x3_soa a,
+                 const f32x3_soa b,
+                 f32x3_soa dest,
+                 const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 ax, ay, az, bx, by, bz;
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        ax = _mm256_loadu_ps(a.x + i);
+        ay = _mm256_loadu_ps(a.y + i);
+        az = _mm256_loadu_ps(a.z + i);
+        bx = _mm256_loadu_ps(b.x + i);
+        by = _mm256_loadu_ps(b.y + i);
+        bz = _mm256_loadu_ps(b.z + i);
+        _mm256_storeu_ps(dest.x + i, _mm256_sub_ps(ax, bx));
+        _mm256_storeu_ps(dest.y + i, _mm256_sub_ps(ay, by));
+        _mm256_storeu_ps(dest.z + i, _mm256_sub_ps(az, bz));
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 ax, ay, az, bx, by, bz;
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        ax = rmm_loadu(a.x + i);
+        ay = rmm_loadu(a.y + i);
+        az = rmm_loadu(a.z + i);
+        bx = rmm_loadu(b.x + i);
+        by = rmm_loadu(b.y + i);
+        bz = rmm_loadu(b.z + i);
+        rmm_storeu(dest.x + i, rmm_sub(ax, bx));
+        rmm_storeu(dest.y + i, rmm_sub(ay, by));
+        rmm_storeu(dest.z + i, rmm_sub(az, bz));
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) {
+        rm_set_f32x3_soa(dest, i, rm_sub_f32x3(rm_get_f32x3_soa(a, i),
+                                               rm_get_f32x3_soa(b, i)));
+    }
+}
+RM_INLINE void
+rm_mul_f32x3_soa(const f32x3_soa a,
+                 const f32x3_soa b,
+                 f32x3_soa dest,
+                 const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 ax, ay, az, bx, by, bz;
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        ax = _mm256_loadu_ps(a.x + i);
+        ay = _mm256_loadu_ps(a.y + i);
+        az = _mm256_loadu_ps(a.z + i);
+        bx = _mm256_loadu_ps(b.x + i);
+        by = _mm256_loadu_ps(b.y + i);
+        bz = _mm256_loadu_ps(b.z + i);
+        _mm256_storeu_ps(dest.x + i, _mm256_mul_ps(ax, bx));
+        _mm256_storeu_ps(dest.y + i, _mm256_mul_ps(ay, by));
+        _mm256_storeu_ps(dest.z + i, _mm256_mul_ps(az, bz));
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 ax, ay, az, bx, by, bz;
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        ax = rmm_loadu(a.x + i);
+        ay = rmm_loadu(a.y + i);
+        az = rmm_loadu(a.z + i);
+        bx = rmm_loadu(b.x + i);
+        by = rmm_loadu(b.y + i);
+        bz = rmm_loadu(b.z + i);
+        rmm_storeu(dest.x + i, rmm_mul(ax, bx));
+        rmm_storeu(dest.y + i, rmm_mul(ay, by));
+        rmm_storeu(dest.z + i, rmm_mul(az, bz));
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) {
+        rm_set_f32x3_soa(dest, i, rm_mul_f32x3(rm_get_f32x3_soa(a, i),
+                                               rm_get_f32x3_soa(b, i)));
+    }
+}
+RM_INLINE void
+rm_muls_f32x3_soa(const f32x3_soa v,
+                  const f32 s,
+                  f32x3_soa dest,
+                  const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 vx, vy, vz, vs;
+
+    vs = _mm256_set1_ps(s);
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        vx = _mm256_loadu_ps(v.x + i);
+        vy = _mm256_loadu_ps(v.y + i);
+        vz = _mm256_loadu_ps(v.z + i);
+        _mm256_storeu_ps(dest.x + i, _mm256_mul_ps(vx, vs));
+        _mm256_storeu_ps(dest.y + i, _mm256_mul_ps(vy, vs));
+        _mm256_storeu_ps(dest.z + i, _mm256_mul_ps(vz, vs));
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 vx, vy, vz, vs;
+
+    vs = rmm_set1(s);
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        vx = rmm_loadu(v.x + i);
+        vy = rmm_loadu(v.y + i);
+        vz = rmm_loadu(v.z + i);
+        rmm_storeu(dest.x + i, rmm_mul(vx, vs));
+        rmm_storeu(dest.y + i, rmm_mul(vy, vs));
+        rmm_storeu(dest.z + i, rmm_mul(vz, vs));
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) {
+        rm_set_f32x3_soa(dest, i, rm_muls_f32x3(rm_get_f32x3_soa(v, i), s));
+    }
+}
+/* a * b + c */
+RM_INLINE void
+rm_fma_f32x3_soa(const f32x3_soa a,
+                 const f32x3_soa b,
+                 const f32x3_soa c,
+                 f32x3_soa dest,
+                 const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 ax, ay, az, bx, by, bz, cx, cy, cz;
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        ax = _mm256_loadu_ps(a.x + i);
+        ay = _mm256_loadu_ps(a.y + i);
+        az = _mm256_loadu_ps(a.z + i);
+        bx = _mm256_loadu_ps(b.x + i);
+        by = _mm256_loadu_ps(b.y + i);
+        bz = _mm256_loadu_ps(b.z + i);
+        cx = _mm256_loadu_ps(c.x + i);
+        cy = _mm256_loadu_ps(c.y + i);
+        cz = _mm256_loadu_ps(c.z + i);
+        _mm256_storeu_ps(dest.x + i, rmm256_fmadd(ax, bx, cx));
+        _mm256_storeu_ps(dest.y + i, rmm256_fmadd(ay, by, cy));
+        _mm256_storeu_ps(dest.z + i, rmm256_fmadd(az, bz, cz));
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 ax, ay, az, bx, by, bz, cx, cy, cz;
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        ax = rmm_loadu(a.x + i);
+        ay = rmm_loadu(a.y + i);
+        az = rmm_loadu(a.z + i);
+        bx = rmm_loadu(b.x + i);
+        by = rmm_loadu(b.y + i);
+        bz = rmm_loadu(b.z + i);
+        cx = rmm_loadu(c.x + i);
+        cy = rmm_loadu(c.y + i);
+        cz = rmm_loadu(c.z + i);
+        rmm_storeu(dest.x + i, rmm_fmadd(ax, bx, cx));
+        rmm_storeu(dest.y + i, rmm_fmadd(ay, by, cy));
+        rmm_storeu(dest.z + i, rmm_fmadd(az, bz, cz));
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) {
+        rm_set_f32x3_soa(dest, i, rm_fma_f32x3(rm_get_f32x3_soa(a, i),
+                                               rm_get_f32x3_soa(b, i),
+                                               rm_get_f32x3_soa(c, i)));
+    }
+}
+/* clamps every vector to the box [min, max] */
+RM_INLINE void
+rm_clamp_f32x3_soa(const f32x3_soa v,
+                   const f32x3 min,
+                   const f32x3 max,
+                   f32x3_soa dest,
+                   const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 vx, vy, vz, lox, loy, loz, hix, hiy, hiz;
+
+    lox = _mm256_set1_ps(min.x);
+    loy = _mm256_set1_ps(min.y);
+    loz = _mm256_set1_ps(min.z);
+    hix = _mm256_set1_ps(max.x);
+    hiy = _mm256_set1_ps(max.y);
+    hiz = _mm256_set1_ps(max.z);
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        vx = _mm256_loadu_ps(v.x + i);
+        vy = _mm256_loadu_ps(v.y + i);
+        vz = _mm256_loadu_ps(v.z + i);
+        _mm256_storeu_ps(dest.x + i,
+                         _mm256_min_ps(_mm256_max_ps(vx, lox), hix));
+        _mm256_storeu_ps(dest.y + i,
+                         _mm256_min_ps(_mm256_max_ps(vy, loy), hiy));
+        _mm256_storeu_ps(dest.z + i,
+                         _mm256_min_ps(_mm256_max_ps(vz, loz), hiz));
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 vx, vy, vz, lox, loy, loz, hix, hiy, hiz;
+
+    lox = rmm_set1(min.x);
+    loy = rmm_set1(min.y);
+    loz = rmm_set1(min.z);
+    hix = rmm_set1(max.x);
+    hiy = rmm_set1(max.y);
+    hiz = rmm_set1(max.z);
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        vx = rmm_loadu(v.x + i);
+        vy = rmm_loadu(v.y + i);
+        vz = rmm_loadu(v.z + i);
+        rmm_storeu(dest.x + i, rmm_min(rmm_max(vx, lox), hix));
+        rmm_storeu(dest.y + i, rmm_min(rmm_max(vy, loy), hiy));
+        rmm_storeu(dest.z + i, rmm_min(rmm_max(vz, loz), hiz));
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) {
+        rm_set_f32x3_soa(dest, i,
+                         rm_clamp_f32x3(rm_get_f32x3_soa(v, i), min, max));
+    }
+}
+RM_INLINE void
+rm_dot_f32x3_soa(const f32x3_soa a,
+                 const f32x3_soa b,
+                 f32 *dest,
+                 const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 ax, ay, az, bx, by, bz;
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        ax = _mm256_loadu_ps(a.x + i);
+        ay = _mm256_loadu_ps(a.y + i);
+        az = _mm256_loadu_ps(a.z + i);
+        bx = _mm256_loadu_ps(b.x + i);
+        by = _mm256_loadu_ps(b.y + i);
+        bz = _mm256_loadu_ps(b.z + i);
+        ax = rmm256_fmadd(ay, by, _mm256_mul_ps(ax, bx));
+        _mm256_storeu_ps(dest + i, rmm256_fmadd(az, bz, ax));
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 ax, ay, az, bx, by, bz;
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        ax = rmm_loadu(a.x + i);
+        ay = rmm_loadu(a.y + i);
+        az = rmm_loadu(a.z + i);
+        bx = rmm_loadu(b.x + i);
+        by = rmm_loadu(b.y + i);
+        bz = rmm_loadu(b.z + i);
+        ax = rmm_fmadd(ay, by, rmm_mul(ax, bx));
+        rmm_storeu(dest + i, rmm_fmadd(az, bz, ax));
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) {
+        dest[i] = rm_dot_f32x3(rm_get_f32x3_soa(a, i), rm_get_f32x3_soa(b, i));
+    }
+}
+RM_INLINE void
+rm_cross_f32x3_soa(const f32x3_soa a,
+                   const f32x3_soa b,
+                   f32x3_soa dest,
+                   const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 ax, ay, az, bx, by, bz;
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        ax = _mm256_loadu_ps(a.x + i);
+        ay = _mm256_loadu_ps(a.y + i);
+        az = _mm256_loadu_ps(a.z + i);
+        bx = _mm256_loadu_ps(b.x + i);
+        by = _mm256_loadu_ps(b.y + i);
+        bz = _mm256_loadu_ps(b.z + i);
+        _mm256_storeu_ps(dest.x + i,
+                         _mm256_sub_ps(_mm256_mul_ps(ay, bz),
+                                       _mm256_mul_ps(az, by)));
+        _mm256_storeu_ps(dest.y + i,
+                         _mm256_sub_ps(_mm256_mul_ps(az, bx),
+                                       _mm256_mul_ps(ax, bz)));
+        _mm256_storeu_ps(dest.z + i,
+                         _mm256_sub_ps(_mm256_mul_ps(ax, by),
+                                       _mm256_mul_ps(ay, bx)));
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 ax, ay, az, bx, by, bz;
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        ax = rmm_loadu(a.x + i);
+        ay = rmm_loadu(a.y + i);
+        az = rmm_loadu(a.z + i);
+        bx = rmm_loadu(b.x + i);
+        by = rmm_loadu(b.y + i);
+        bz = rmm_loadu(b.z + i);
+        rmm_storeu(dest.x + i, rmm_sub(rmm_mul(ay, bz), rmm_mul(az, by)));
+        rmm_storeu(dest.y + i, rmm_sub(rmm_mul(az, bx), rmm_mul(ax, bz)));
+        rmm_storeu(dest.z + i, rmm_sub(rmm_mul(ax, by), rmm_mul(ay, bx)));
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) {
+        rm_set_f32x3_soa(dest, i, rm_cross_f32x3(rm_get_f32x3_soa(a, i),
+                                                 rm_get_f32x3_soa(b, i)));
+    }
+}
+/* zero vectors stay zero, same as rm_normalize_f32x3 */
+RM_INLINE void
+rm_normalize_f32x3_soa(const f32x3_soa v, f32x3_soa dest, const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 x, y, z, n2, r;
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        x  = _mm256_loadu_ps(v.x + i);
+        y  = _mm256_loadu_ps(v.y + i);
+        z  = _mm256_loadu_ps(v.z + i);
+        n2 = rmm256_fmadd(z, z, rmm256_fmadd(y, y, _mm256_mul_ps(x, x)));
+#if defined(RM_FAST_RSQRT)
+        r = rmm256_rsqrt(n2);
+#else
+        r = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(n2));
+#endif
+        r = _mm256_and_ps(r, _mm256_cmp_ps(n2, _mm256_setzero_ps(),
+                                           _CMP_NEQ_OQ));
+        _mm256_storeu_ps(dest.x + i, _mm256_mul_ps(x, r));
+        _mm256_storeu_ps(dest.y + i, _mm256_mul_ps(y, r));
+        _mm256_storeu_ps(dest.z + i, _mm256_mul_ps(z, r));
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 x, y, z, n2, r;
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        x  = rmm_loadu(v.x + i);
+        y  = rmm_loadu(v.y + i);
+        z  = rmm_loadu(v.z + i);
+        n2 = rmm_fmadd(z, z, rmm_fmadd(y, y, rmm_mul(x, x)));
+#if defined(RM_FAST_RSQRT)
+        r = rmm_rsqrt(n2);
+#else
+        r = rmm_div(rmm_set1(1.0f), rmm_sqrt(n2));
+#endif
+        /* the mask turns 0 * inf into 0 */
+        r = rmm_and(r, rmm_cmpneq(n2, rmm_setzero()));
+        rmm_storeu(dest.x + i, rmm_mul(x, r));
+        rmm_storeu(dest.y + i, rmm_mul(y, r));
+        rmm_storeu(dest.z + i, rmm_mul(z, r));
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) {
+        rm_set_f32x3_soa(dest, i, rm_normalize_f32x3(rm_get_f32x3_soa(v, i)));
+    }
+}
+RM_INLINE void
+rm_distance_f32x3_soa(const f32x3_soa a,
+                      const f32x3_soa b,
+                      f32 *dest,
+                      const size_t n) {
+    size_t i;
+#if defined(RM_AVX)
+    __m256 x, y, z, d2;
+
+    for (i = 0; i < n - n % 8; i += 8) {
+        x  = _mm256_sub_ps(_mm256_loadu_ps(a.x + i), _mm256_loadu_ps(b.x + i));
+        y  = _mm256_sub_ps(_mm256_loadu_ps(a.y + i), _mm256_loadu_ps(b.y + i));
+        z  = _mm256_sub_ps(_mm256_loadu_ps(a.z + i), _mm256_loadu_ps(b.z + i));
+        d2 = rmm256_fmadd(z, z, rmm256_fmadd(y, y, _mm256_mul_ps(x, x)));
+#if defined(RM_FAST_RSQRT)
+        d2 = _mm256_and_ps(_mm256_mul_ps(d2, rmm256_rsqrt(d2)),
+                           _mm256_cmp_ps(d2, _mm256_setzero_ps(), _CMP_NEQ_OQ));
+#else
+        d2 = _mm256_sqrt_ps(d2);
+#endif
+        _mm256_storeu_ps(dest + i, d2);
+    }
+#elif defined(RM_SIMD_F32X4)
+    rmv_f32x4 x, y, z, d2;
+
+    for (i = 0; i < n - n % 4; i += 4) {
+        x  = rmm_sub(rmm_loadu(a.x + i), rmm_loadu(b.x + i));
+        y  = rmm_sub(rmm_loadu(a.y + i), rmm_loadu(b.y + i));
+        z  = rmm_sub(rmm_loadu(a.z + i), rmm_loadu(b.z + i));
+        d2 = rmm_fmadd(z, z, rmm_fmadd(y, y, rmm_mul(x, x)));
+#if defined(RM_FAST_RSQRT)
+        d2 = rmm_and(rmm_mul(d2, rmm_rsqrt(d2)), rmm_cmpneq(d2, rmm_setzero()));
+#else
+        d2 = rmm_sqrt(d2);
+#endif
+        rmm_storeu(dest + i, d2);
+    }
+#else
+    i = 0;
+#endif
+    for (; i < n; ++i) {
+        dest[i] = rm_distance_f32x3(rm_get_f32x3_soa(a, i),
+                                    rm_get_f32x3_soa(b, i));
+    }
+}
+
+// DISPATCH
+#define RM_CPU_SSE2    (1 << 0)
+#define RM_CPU_SSE4_1  (1 << 1)
+#define RM_CPU_AVX     (1 << 2)
+#define RM_CPU_FMA     (1 << 3)
+#define RM_CPU_AVX2    (1 << 4)
+#define RM_CPU_AVX512F (1 << 5)
+
+#if RM_ARCH == RM_ARCH_X86
+/* r gets eax, ebx, ecx and edx */
+RM_INLINE void
+rm_cpuid(const u32 leaf, const u32 sub, u32 *r) {
+#if defined(_MSC_VER)
+    int v[4];
+
+    __cpuidex(v, (int)leaf, (int)sub);
+    r[0] = (u32)v[0];
+    r[1] = (u32)v[1];
+    r[2] = (u32)v[2];
+    r[3] = (u32)v[3];
+#else
+    __cpuid_count(leaf, sub, r[0], r[1], r[2], r[3]);
+#endif
+}
+RM_INLINE u64
+rm_xgetbv(void) {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    u32 lo, hi;
+
+    __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return (u64)hi << 32 | lo;
+#endif
+}
+/*
+ * the RM_CPU_* bits the cpu and os support, the avx bits are only set when
+ * the os saves the ymm (and for avx-512 the zmm and opmask) state
+ */
+RM_INLINE u32
+rm_cpu_features(void) {
+    u32 r[4], max, dest;
+    u64 xcr0;
+
+    dest = 0;
+    rm_cpuid(0, 0, r);
+    max = r[0];
+    if (max < 1) { return dest; }
+
+    rm_cpuid(1, 0, r);
+    if (r[3] & (1u << 26)) { dest |= RM_CPU_SSE2; }
+    if (r[2] & (1u << 19)) { dest |= RM_CPU_SSE4_1; }
+    /* osxsave */
+    if (!(r[2] & (1u << 27))) { return dest; }
+
+    xcr0 = rm_xgetbv();
+    if ((xcr0 & 0x6) != 0x6) { return dest; }
+    if (r[2] & (1u << 28)) { dest |= RM_CPU_AVX; }
+    if (r[2] & (1u << 12)) { dest |= RM_CPU_FMA; }
+    if (max < 7) { return dest; }
+
+    rm_cpuid(7, 0, r);
+    if (r[1] & (1u << 5)) { dest |= RM_CPU_AVX2; }
+    if ((r[1] & (1u << 16)) && (xcr0 & 0xE6) == 0xE6) {
+        dest |= RM_CPU_AVX512F;
+    }
+    return dest;
+}
+#endif
+
+/*
+ * runtime dispatch for the batch kernels, so one binary can pick the best
+ * code path instead of the one the whole program was compiled for.
+ *
+ * every kernel in RM_DISPATCH_KERNELS is built once per target in its own
+ * translation unit, which only has to define RM_DISPATCH_VARIANT and include
+ * this file. the target comes from the compiler flags:
+ *
+ *     -msse2            rm_<kernel>_sse2
+ *     -msse4.1          rm_<kernel>_sse4_1
+ *     -mavx             rm_<kernel>_avx
+ *     -mavx2 -mfma      rm_<kernel>_avx2
+ *     -mavx512f -mfma   rm_<kernel>_avx512
+ *
+ * exactly one translation unit defines RM_DISPATCH_IMPLEMENTATION, that one
+ * provides rm_<kernel>_dispatch which probes the cpu on the first call and
+ * then always goes through the picked variant. define RM_DISPATCH anywhere
+ * else to get the declarations. on arm the _dispatch functions just call the
+ * regular kernels and no variants are needed.
+ *
+ * there are no avx-512 kernels yet, that variant is the avx2 code compiled
+ * for avx-512 so the compiler is free to use the extra registers and evex.
+ */
+#define RM_DISPATCH_KERNELS(X)                                                 \
+    X(transform_points_f32x4x4,                                                \
+      (const f32x4x4 *m, const f32x3 *in, f32x3 *out, const size_t n),         \
+      (m, in, out, n))                                                         \
+    X(transform_normals_f32x4x4,                                               \
+      (const f32x4x4 *m, const f32x3 *in, f32x3 *out, const size_t n),         \
+      (m, in, out, n))                                                         \
+    X(transform_f32x4x4,                                                       \
+      (const f32x4x4 *m, const f32x4 *in, f32x4 *out, const size_t n),         \
+      (m, in, out, n))                                                         \
+    X(add_f32x3_soa,                                                           \
+      (const f32x3_soa a, const f32x3_soa b, f32x3_soa dest, const size_t n),  \
+      (a, b, dest, n))                                                         \
+    X(sub_f32x3_soa,                                                           \
+      (const f32x3_soa a, const f32x3_soa b, f32x3_soa dest, const size_t n),  \
+      (a, b, dest, n))                                                         \
+    X(mul_f32x3_soa,                                                           \
+      (const f32x3_soa a, const f32x3_soa b, f32x3_soa dest, const size_t n),  \
+      (a, b, dest, n))                                                         \
+    X(muls_f32x3_soa,                                                          \
+      (const f32x3_soa v, const f32 s, f32x3_soa dest, const size_t n),        \
+      (v, s, dest, n))                                                         \
+    X(fma_f32x3_soa,                                                           \
+      (const f32x3_soa a, const f32x3_soa b, const f32x3_soa c,                \
+       f32x3_soa dest, const size_t n),                                        \
+      (a, b, c, dest, n))                                                      \
+    X(clamp_f32x3_soa,                                                         \
+      (const f32x3_soa v, const f32x3 min, const f32x3 max, f32x3_soa dest,    \
+       const size_t n),                                                        \
+      (v, min, max, dest, n))                                                  \
+    X(dot_f32x3_soa,                                                           \
+      (const f32x3_soa a, const f32x3_soa b, f32 *dest, const size_t n),       \
+      (a, b, dest, n))                                                         \
+    X(cross_f32x3_soa,                                                         \
+      (const f32x3_soa a, const f32x3_soa b, f32x3_soa dest, const size_t n),  \
+      (a, b, dest, n))                                                         \
+    X(normalize_f32x3_soa,                                                     \
+      (const f32x3_soa v, f32x3_soa dest, const size_t n),                     \
+      (v, dest, n))                                                            \
+    X(distance_f32x3_soa,                                                      \
+      (const f32x3_soa a, const f32x3_soa b, f32 *dest, const size_t n),       \
+      (a, b, dest, n))                                                         \
+    X(deinterleave_f32x3,                                                      \
+      (const f32x3 *in, f32x3_soa out, const size_t n),                        \
+      (in, out, n))                                                            \
+    X(interleave_f32x3,                                                        \
+      (const f32x3_soa in, f32x3 *out, const size_t n),                        \
+      (in, out, n))                                                            \
+    X(deinterleave_f32x4,                                                      \
+      (const f32x4 *in, f32x4_soa out, const size_t n),                        \
+      (in, out, n))                                                            \
+    X(interleave_f32x4,                                                        \
+      (const f32x4_soa in, f32x4 *out, const size_t n),                        \
+      (in, out, n))                                                            \
+    X(deinterleave_u8x4,                                                       \
+      (const u8x4 *in, u8x4_soa out, const size_t n),                          \
+      (in, out, n))                                                            \
+    X(interleave_u8x4,                                                         \
+      (const u8x4_soa in, u8x4 *out, const size_t n),                          \
+      (in, out, n))                                                            \
+    X(skin_f32x4x3,                                                            \
+      (const f32x4x3 *bones, const u16x4 *indices, const f32x4 *weights,       \
+       const f32x3 *points, f32x3 *out_points, const f32x3 *normals,           \
+       f32x3 *out_normals, const size_t n),                                    \
+      (bones, indices, weights, points, out_points, normals, out_normals, n))  \
+    X(nlerp_batch_quatf32,                                                     \
+      (const quatf32 *a, const quatf32 *b, const f32 *t, quatf32 *out,         \
+       const size_t n),                                                        \
+      (a, b, t, out, n))                                                       \
+    X(slerp_batch_quatf32,                                                     \
+      (const quatf32 *a, const quatf32 *b, const f32 *t, quatf32 *out,         \
+       const size_t n),                                                        \
+      (a, b, t, out, n))                                                       \
+    X(frustum_cull_batch_aabbf32,                                              \
+      (const f32x4 *planes, const aabbf32 *boxes, u8 *visible,                 \
+       const size_t n),                                                        \
+      (planes, boxes, visible, n))
+
+#if defined(RM_DISPATCH_VARIANT)
+#if defined(__AVX512F__) && defined(RM_FMA)
+#define RM_DISPATCH_TARGET avx512
+#elif defined(__AVX512F__)
+#error the avx512 variant needs -mfma
+#elif defined(RM_AVX2) && defined(RM_FMA)
+#define RM_DISPATCH_TARGET avx2
+#elif defined(RM_AVX2)
+#error the avx2 variant needs -mfma
+#elif defined(RM_AVX)
+#define RM_DISPATCH_TARGET avx
+#elif defined(RM_SSE4_1)
+#define RM_DISPATCH_TARGET sse4_1
+#elif defined(RM_SSE2)
+#define RM_DISPATCH_TARGET sse2
+#else
+#error RM_DISPATCH_VARIANT needs at least sse2
+#endif
+
+#define RM_DISPATCH_NAME_(_name, _target) rm_##_name##_##_target
+#define RM_DISPATCH_NAME(_name, _target)  RM_DISPATCH_NAME_(_name, _target)
+#define RM_DISPATCH_VARIANT_DEFINE(_name, _params, _args)                      \
+    void RM_DISPATCH_NAME(_name, RM_DISPATCH_TARGET) _params {                 \
+        rm_##_name _args;                                                      \
+    }
+RM_DISPATCH_KERNELS(RM_DISPATCH_VARIANT_DEFINE)
+#endif /* RM_DISPATCH_VARIANT */
+
+#if defined(RM_DISPATCH) || defined(RM_DISPATCH_IMPLEMENTATION)
+#define RM_DISPATCH_DECLARE(_name, _params, _args)                             \
+    void rm_##_name##_dispatch _params;
+RM_DISPATCH_KERNELS(RM_DISPATCH_DECLARE)
+
+/* the name of the picked variant, "sse2" to "avx512" or "native" on arm */
+const char *rm_dispatch_target(void);
+#endif
+
+#if defined(RM_DISPATCH_IMPLEMENTATION)
+#if RM_ARCH == RM_ARCH_X86
+#include <stdatomic.h>
+
+#define RM_DISPATCH_EXTERN(_name, _params, _args)                              \
+    void rm_##_name##_sse2 _params;                                            \
+    void rm_##_name##_sse4_1 _params;                                          \
+    void rm_##_name##_avx _params;                                             \
+    void rm_##_name##_avx2 _params;                                            \
+    void rm_##_name##_avx512 _params;
+RM_DISPATCH_KERNELS(RM_DISPATCH_EXTERN)
+
+#define RM_DISPATCH_FIELD(_name, _params, _args) void (*_name) _params;
+struct rm_dispatch_t {
+    const char *target;
+    RM_DISPATCH_KERNELS(RM_DISPATCH_FIELD)
+};
+
+#define RM_DISPATCH_SSE2(_name, _params, _args)   ._name = rm_##_name##_sse2,
+#define RM_DISPATCH_SSE4_1(_name, _params, _args) ._name = rm_##_name##_sse4_1,
+#define RM_DISPATCH_AVX(_name, _params, _args)    ._name = rm_##_name##_avx,
+#define RM_DISPATCH_AVX2(_name, _params, _args)   ._name = rm_##_name##_avx2,
+#define RM_DISPATCH_AVX512(_name, _params, _args) ._name = rm_##_name##_avx512,
+/* ordered from worst to best */
+static const struct rm_dispatch_t rm_dispatch_variants[] = {
+    {.target = "sse2", RM_DISPATCH_KERNELS(RM_DISPATCH_SSE2)},
+    {.target = "sse4_1", RM_DISPATCH_KERNELS(RM_DISPATCH_SSE4_1)},
+    {.target = "avx", RM_DISPATCH_KERNELS(RM_DISPATCH_AVX)},
+    {.target = "avx2", RM_DISPATCH_KERNELS(RM_DISPATCH_AVX2)},
+    {.target = "avx512", RM_DISPATCH_KERNELS(RM_DISPATCH_AVX512)},
+};
+/*
+ * a single pointer that is set once, threads racing on the first call all
+ * store the same value. the variants are constant so relaxed is enough
+ */
+static const struct rm_dispatch_t *_Atomic rm_dispatch_picked;
+
+static const struct rm_dispatch_t *
+rm_dispatch_get(void) {
+    const struct rm_dispatch_t *d;
+    u32 f;
+    size_t i;
+
+    d = atomic_load_explicit(&rm_dispatch_picked, memory_order_relaxed);
+    if (d != NULL) { return d; }
+
+    f = rm_cpu_features();
+    if ((f & RM_CPU_AVX512F) && (f & RM_CPU_AVX2) && (f & RM_CPU_FMA)) {
+        i = 4;
+    } else if ((f & RM_CPU_AVX2) && (f & RM_CPU_FMA)) {
+        i = 3;
+    } else if (f & RM_CPU_AVX) {
+        i = 2;
+    } else if (f & RM_CPU_SSE4_1) {
+        i = 1;
+    } else {
+        i = 0;
+    }
+    d = &rm_dispatch_variants[i];
+    atomic_store_explicit(&rm_dispatch_picked, d, memory_order_relaxed);
+    return d;
+}
+
+#define RM_DISPATCH_DEFINE(_name, _params, _args)                              \
+    void rm_##_name##_dispatch _params { rm_dispatch_get()->_name _args; }
+RM_DISPATCH_KERNELS(RM_DISPATCH_DEFINE)
+
+const char *
+rm_dispatch_target(void) {
+    return rm_dispatch_get()->target;
+}
+#else
+#define RM_DISPATCH_DEFINE(_name, _params, _args)                              \
+    void rm_##_name##_dispatch _params { rm_##_name _args; }
+RM_DISPATCH_KERNELS(RM_DISPATCH_DEFINE)
+
+const char *
+rm_dispatch_target(void) {
+    return "native";
+}
+#endif
+#endif /* RM_DISPATCH_IMPLEMENTATION */
 
 #endif /* _RANMATH_H_ */
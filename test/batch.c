@@ -0,0 +1,855 @@
+/*
+ * the batch kernels against their per element functions, build it once per
+ * backend (see test/build.sh).
+ *
+ * every buffer starts 4 bytes past a 64 byte boundary so no simd path can
+ * get away with aligned loads, and every kernel runs for n = 0 up to twice
+ * the widest vector plus one so both the vector loops and the scalar tails
+ * are hit. the bytes past n are filled with a canary and have to come back
+ * untouched.
+ *
+ * usage: batch, exits with 1 when any check failed
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../ranmath.h"
+
+#if defined(RM_AVX2)
+#define BATCH_BACKEND "avx2"
+#elif defined(RM_AVX)
+#define BATCH_BACKEND "avx"
+#elif defined(RM_SSE4_1)
+#define BATCH_BACKEND "sse4_1"
+#elif defined(RM_SSE2)
+#define BATCH_BACKEND "sse2"
+#elif defined(RM_NEON)
+#define BATCH_BACKEND "neon"
+#else
+#define BATCH_BACKEND "scalar"
+#endif
+
+#define BATCH_MAX 17
+#define BATCH_BUFFERS 24
+#define BATCH_BYTES (BATCH_MAX * 64 + 128)
+#define BATCH_CANARY 0x5A
+
+static u8 batch_pool[BATCH_BUFFERS][BATCH_BYTES];
+static u32 batch_failures;
+static u64 batch_seed = 0x9E3779B97F4A7C15ULL;
+
+/* buffer k, misaligned and filled with the canary */
+static void *
+batch_buffer(const size_t k) {
+    u8 *p;
+
+    p = (u8 *)(((uintptr_t)batch_pool[k] + 63) & ~(uintptr_t)63) + 4;
+    memset(p, BATCH_CANARY, BATCH_BYTES - 68);
+    return p;
+}
+/* uniform in [lo, hi) */
+static f32
+batch_rand(const f32 lo, const f32 hi) {
+    batch_seed ^= batch_seed >> 12;
+    batch_seed ^= batch_seed << 25;
+    batch_seed ^= batch_seed >> 27;
+    return lo + (hi - lo) * (f32)((batch_seed * 0x2545F4914F6CDD1DULL) >> 40) *
+                    0x1p-24f;
+}
+static f32x3
+batch_rand_f32x3(void) {
+    return rm_f32x3(batch_rand(-2.0f, 2.0f), batch_rand(-2.0f, 2.0f),
+                    batch_rand(-2.0f, 2.0f));
+}
+static void
+batch_fail(const char *name,
+           const size_t n,
+           const size_t i,
+           const f64 got,
+           const f64 ref) {
+    printf("%s,%s,n=%zu,i=%zu,got=%a,ref=%a\n", BATCH_BACKEND, name, n, i,
+           got, ref);
+    batch_failures++;
+}
+/* count floats, fma and the simd reductions are allowed a few ulp */
+static void
+batch_expect(const char *name,
+             const size_t n,
+             const f32 *got,
+             const f32 *ref,
+             const size_t count) {
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        if (isnan(got[i]) && isnan(ref[i])) { continue; }
+        if (fabsf(got[i] - ref[i]) > 1e-5f * RM_MAX(1.0f, fabsf(ref[i]))) {
+            batch_fail(name, n, i, got[i], ref[i]);
+            return;
+        }
+    }
+}
+static void
+batch_expect64(const char *name,
+               const size_t n,
+               const f64 *got,
+               const f64 *ref,
+               const size_t count) {
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        if (isnan(got[i]) && isnan(ref[i])) { continue; }
+        if (fabs(got[i] - ref[i]) > 1e-12 * RM_MAX(1.0, fabs(ref[i]))) {
+            batch_fail(name, n, i, got[i], ref[i]);
+            return;
+        }
+    }
+}
+/* the bytes from p + from up to the end of the buffer still hold the canary */
+static void
+batch_untouched(const char *name,
+                const size_t n,
+                const void *p,
+                const size_t from) {
+    const u8 *b;
+    size_t i;
+
+    b = p;
+    for (i = from; i < BATCH_MAX * 64; ++i) {
+        if (b[i] != BATCH_CANARY) {
+            batch_fail(name, n, i, b[i], BATCH_CANARY);
+            return;
+        }
+    }
+}
+
+/* a structure of arrays view over buffers k to k + 2 */
+static f32x3_soa
+batch_soa3(const size_t k) {
+    return rm_f32x3_soa((f32 *)batch_buffer(k), (f32 *)batch_buffer(k + 1),
+                        (f32 *)batch_buffer(k + 2));
+}
+static f32x3_soa
+batch_rand_soa3(const size_t k, const size_t n) {
+    f32x3_soa s;
+    size_t i;
+
+    s = batch_soa3(k);
+    for (i = 0; i < n; ++i) { rm_set_f32x3_soa(s, i, batch_rand_f32x3()); }
+    return s;
+}
+static void
+batch_expect_soa3(const char *name,
+                  const size_t n,
+                  const f32x3_soa got,
+                  const size_t i,
+                  const f32x3 ref) {
+    f32x3 v;
+
+    v = rm_get_f32x3_soa(got, i);
+    batch_expect(name, n, v.raw, ref.raw, 3);
+}
+static void
+batch_untouched_soa3(const char *name, const size_t n, const f32x3_soa s) {
+    batch_untouched(name, n, s.x, n * sizeof(f32));
+    batch_untouched(name, n, s.y, n * sizeof(f32));
+    batch_untouched(name, n, s.z, n * sizeof(f32));
+}
+static f32x4x4
+batch_rand_f32x4x4(void) {
+    f32x4x4 m;
+    size_t c;
+
+    /* the identity plus noise, far enough from singular to invert */
+    m = rm_identity_f32x4x4();
+    for (c = 0; c < 4; ++c) {
+        m.cols[c] = rm_add_f32x4(m.cols[c],
+                                 rm_f32x4v3s(rm_muls_f32x3(batch_rand_f32x3(),
+                                                           0.25f),
+                                             c == 3 ? 1.0f : 0.0f));
+    }
+    return m;
+}
+/*
+ * column major dim x dim in f64, the determinant by expanding along the
+ * first row and the inverse as the adjugate over it. slow but shares
+ * nothing with ranmath, so it can check every det and inverse
+ */
+static f64
+batch_det_ref(const f64 *m, const size_t dim) {
+    f64 minor[9], det;
+    size_t c, k, r, i;
+
+    if (dim == 1) { return m[0]; }
+    det = 0.0;
+    for (c = 0; c < dim; ++c) {
+        for (i = 0, k = 0; k < dim; ++k) {
+            if (k == c) { continue; }
+            for (r = 1; r < dim; ++r) { minor[i++] = m[k * dim + r]; }
+        }
+        det += (c % 2 ? -1.0 : 1.0) * m[c * dim] *
+               batch_det_ref(minor, dim - 1);
+    }
+    return det;
+}
+static f64
+batch_inverse_ref(const f64 *m, const size_t dim, f64 *dest) {
+    f64 minor[9], det;
+    size_t c, r, k, l, i;
+
+    det = batch_det_ref(m, dim);
+    for (c = 0; c < dim; ++c) {
+        for (r = 0; r < dim; ++r) {
+            /* the cofactor of row r, column c lands in row c, column r */
+            for (i = 0, k = 0; k < dim; ++k) {
+                if (k == c) { continue; }
+                for (l = 0; l < dim; ++l) {
+                    if (l != r) { minor[i++] = m[k * dim + l]; }
+                }
+            }
+            dest[r * dim + c] = ((r + c) % 2 ? -1.0 : 1.0) *
+                                batch_det_ref(minor, dim - 1) / det;
+        }
+    }
+    return det;
+}
+
+/*
+ * det, inverse and m * inverse against the cofactor reference. the inputs
+ * are 4 * identity plus noise in every element, so the simd 4x4 paths get
+ * a full matrix and not just an affine one
+ */
+#define BATCH_INVERSE(_T, _S, _N, _expect)                                     \
+    static void batch_inverse_##_T(void) {                                     \
+        _T m, inv, id, one;                                                    \
+        f64 a[16], ref[16];                                                    \
+        _S got[16], want[16], det, rdet;                                       \
+        size_t i;                                                              \
+                                                                               \
+        for (i = 0; i < _N * _N; ++i) {                                        \
+            m.raw[i / _N][i % _N] =                                            \
+                (_S)((i % (_N + 1) == 0 ? 4.0f : 0.0f) +                       \
+                     batch_rand(-1.0f, 1.0f));                                 \
+            a[i] = m.raw[i / _N][i % _N];                                      \
+        }                                                                      \
+        rdet = (_S)batch_inverse_ref(a, _N, ref);                              \
+        det  = rm_det_##_T(m);                                                 \
+        _expect("det_" #_T, _N, &det, &rdet, 1);                               \
+        inv = rm_inverse_##_T(m);                                              \
+        id  = rm_mul_##_T(m, inv);                                             \
+        one = rm_identity_##_T();                                              \
+        for (i = 0; i < _N * _N; ++i) { want[i] = (_S)ref[i]; }                \
+        _expect("inverse_" #_T, _N, &inv.raw[0][0], want, _N * _N);            \
+        for (i = 0; i < _N * _N; ++i) {                                        \
+            got[i]  = id.raw[i / _N][i % _N];                                  \
+            want[i] = one.raw[i / _N][i % _N];                                 \
+        }                                                                      \
+        _expect("mul_inverse_" #_T, _N, got, want, _N * _N);                   \
+    }
+
+BATCH_INVERSE(f32x2x2, f32, 2, batch_expect)
+BATCH_INVERSE(f32x3x3, f32, 3, batch_expect)
+BATCH_INVERSE(f32x4x4, f32, 4, batch_expect)
+BATCH_INVERSE(f64x2x2, f64, 2, batch_expect64)
+BATCH_INVERSE(f64x3x3, f64, 3, batch_expect64)
+BATCH_INVERSE(f64x4x4, f64, 4, batch_expect64)
+
+/* t * r * s against the general inverse, which is checked above */
+static void
+batch_inverse_affine_f32x4x4(void) {
+    f32x4x4 m, got, ref;
+    size_t c;
+
+    m = rm_to_f32x4x4_quatf32(rm_normalize_quatf32(rm_axis_angle_quatf32(
+        rm_normalize_f32x3(batch_rand_f32x3()), batch_rand(-3.0f, 3.0f))));
+    for (c = 0; c < 3; ++c) {
+        m.cols[c] = rm_muls_f32x4(m.cols[c], batch_rand(0.5f, 2.0f));
+    }
+    m.cols[3] = rm_f32x4v3s(batch_rand_f32x3(), 1.0f);
+    got       = rm_inverse_affine_f32x4x4(m);
+    ref       = rm_inverse_f32x4x4(m);
+    batch_expect("inverse_affine_f32x4x4", 4, &got.raw[0][0], &ref.raw[0][0],
+                 16);
+}
+static void
+batch_inverse_affine_f64x4x4(void) {
+    f64x4x4 m, got, ref;
+    size_t c;
+
+    m = rm_to_f64x4x4_quatf64(rm_axis_angle_quatf64(
+        rm_normalize_f64x3(rm_f64x3(batch_rand(-2.0f, 2.0f),
+                                    batch_rand(-2.0f, 2.0f),
+                                    batch_rand(-2.0f, 2.0f))),
+        batch_rand(-3.0f, 3.0f)));
+    for (c = 0; c < 3; ++c) {
+        m.cols[c] = rm_muls_f64x4(m.cols[c], batch_rand(0.5f, 2.0f));
+    }
+    m.cols[3] = rm_f64x4(batch_rand(-2.0f, 2.0f), batch_rand(-2.0f, 2.0f),
+                         batch_rand(-2.0f, 2.0f), 1.0);
+    got       = rm_inverse_affine_f64x4x4(m);
+    ref       = rm_inverse_f64x4x4(m);
+    batch_expect64("inverse_affine_f64x4x4", 4, &got.raw[0][0],
+                   &ref.raw[0][0], 16);
+}
+
+static void
+batch_transform_points_f32x4x4(const size_t n) {
+    f32x4x4 *m;
+    f32x3 *in, *out, ref;
+    size_t i;
+
+    m   = batch_buffer(0);
+    in  = batch_buffer(1);
+    out = batch_buffer(2);
+    *m  = batch_rand_f32x4x4();
+    for (i = 0; i < n; ++i) { in[i] = batch_rand_f32x3(); }
+    rm_transform_points_f32x4x4(m, in, out, n);
+    for (i = 0; i < n; ++i) {
+        ref = rm_mulv_f32x4x4(*m, rm_f32x4v3s(in[i], 1.0f)).xyz;
+        batch_expect("transform_points_f32x4x4", n, out[i].raw, ref.raw, 3);
+    }
+    batch_untouched("transform_points_f32x4x4", n, out, n * sizeof(*out));
+}
+static void
+batch_transform_normals_f32x4x4(const size_t n) {
+    f32x4x4 *m;
+    f32x3x3 l;
+    f32x3 *in, *out, ref;
+    size_t i;
+
+    m   = batch_buffer(0);
+    in  = batch_buffer(1);
+    out = batch_buffer(2);
+    *m  = batch_rand_f32x4x4();
+    for (i = 0; i < n; ++i) { in[i] = batch_rand_f32x3(); }
+    rm_transform_normals_f32x4x4(m, in, out, n);
+    l.cols[0] = m->cols[0].xyz;
+    l.cols[1] = m->cols[1].xyz;
+    l.cols[2] = m->cols[2].xyz;
+    l         = rm_transpose_f32x3x3(rm_inverse_f32x3x3(l));
+    for (i = 0; i < n; ++i) {
+        ref = rm_mulv_f32x3x3(l, in[i]);
+        batch_expect("transform_normals_f32x4x4", n, out[i].raw, ref.raw, 3);
+    }
+    batch_untouched("transform_normals_f32x4x4", n, out, n * sizeof(*out));
+}
+static void
+batch_transform_f32x4x4(const size_t n) {
+    f32x4x4 *m;
+    f32x4 *in, *out, ref;
+    size_t i;
+
+    m   = batch_buffer(0);
+    in  = batch_buffer(1);
+    out = batch_buffer(2);
+    *m  = batch_rand_f32x4x4();
+    for (i = 0; i < n; ++i) {
+        in[i] = rm_f32x4v3s(batch_rand_f32x3(), batch_rand(-2.0f, 2.0f));
+    }
+    rm_transform_f32x4x4(m, in, out, n);
+    for (i = 0; i < n; ++i) {
+        ref = rm_mulv_f32x4x4(*m, in[i]);
+        batch_expect("transform_f32x4x4", n, out[i].raw, ref.raw, 4);
+    }
+    batch_untouched("transform_f32x4x4", n, out, n * sizeof(*out));
+}
+/* the soa kernels that map two f32x3 to one */
+static void
+batch_soa3_binary(const char *name,
+                  const size_t n,
+                  void (*kernel)(const f32x3_soa,
+                                 const f32x3_soa,
+                                 f32x3_soa,
+                                 const size_t),
+                  f32x3 (*ref)(const f32x3, const f32x3)) {
+    f32x3_soa a, b, dest;
+    size_t i;
+
+    a    = batch_rand_soa3(0, n);
+    b    = batch_rand_soa3(3, n);
+    dest = batch_soa3(6);
+    kernel(a, b, dest, n);
+    for (i = 0; i < n; ++i) {
+        batch_expect_soa3(name, n, dest, i,
+                          ref(rm_get_f32x3_soa(a, i), rm_get_f32x3_soa(b, i)));
+    }
+    batch_untouched_soa3(name, n, dest);
+}
+static void
+batch_muls_f32x3_soa(const size_t n) {
+    f32x3_soa v, dest;
+    size_t i;
+
+    v    = batch_rand_soa3(0, n);
+    dest = batch_soa3(3);
+    rm_muls_f32x3_soa(v, 1.5f, dest, n);
+    for (i = 0; i < n; ++i) {
+        batch_expect_soa3("muls_f32x3_soa", n, dest, i,
+                          rm_muls_f32x3(rm_get_f32x3_soa(v, i), 1.5f));
+    }
+    batch_untouched_soa3("muls_f32x3_soa", n, dest);
+}
+static void
+batch_fma_f32x3_soa(const size_t n) {
+    f32x3_soa a, b, c, dest;
+    size_t i;
+
+    a    = batch_rand_soa3(0, n);
+    b    = batch_rand_soa3(3, n);
+    c    = batch_rand_soa3(6, n);
+    dest = batch_soa3(9);
+    rm_fma_f32x3_soa(a, b, c, dest, n);
+    for (i = 0; i < n; ++i) {
+        batch_expect_soa3("fma_f32x3_soa", n, dest, i,
+                          rm_fma_f32x3(rm_get_f32x3_soa(a, i),
+                                       rm_get_f32x3_soa(b, i),
+                                       rm_get_f32x3_soa(c, i)));
+    }
+    batch_untouched_soa3("fma_f32x3_soa", n, dest);
+}
+static void
+batch_clamp_f32x3_soa(const size_t n) {
+    f32x3_soa v, dest;
+    f32x3 lo, hi;
+    size_t i;
+
+    v    = batch_rand_soa3(0, n);
+    dest = batch_soa3(3);
+    lo   = rm_f32x3(-1.0f, -0.5f, 0.0f);
+    hi   = rm_f32x3(1.0f, 0.5f, 1.5f);
+    rm_clamp_f32x3_soa(v, lo, hi, dest, n);
+    for (i = 0; i < n; ++i) {
+        batch_expect_soa3("clamp_f32x3_soa", n, dest, i,
+                          rm_clamp_f32x3(rm_get_f32x3_soa(v, i), lo, hi));
+    }
+    batch_untouched_soa3("clamp_f32x3_soa", n, dest);
+}
+static void
+batch_normalize_f32x3_soa(const size_t n) {
+    f32x3_soa v, dest;
+    size_t i;
+
+    v    = batch_rand_soa3(0, n);
+    dest = batch_soa3(3);
+    rm_normalize_f32x3_soa(v, dest, n);
+    for (i = 0; i < n; ++i) {
+        batch_expect_soa3("normalize_f32x3_soa", n, dest, i,
+                          rm_normalize_f32x3(rm_get_f32x3_soa(v, i)));
+    }
+    batch_untouched_soa3("normalize_f32x3_soa", n, dest);
+}
+/* the soa kernels that reduce two f32x3 to one f32 */
+static void
+batch_soa3_reduce(const char *name,
+                  const size_t n,
+                  void (*kernel)(const f32x3_soa,
+                                 const f32x3_soa,
+                                 f32 *,
+                                 const size_t),
+                  f32 (*ref)(const f32x3, const f32x3)) {
+    f32x3_soa a, b;
+    f32 *dest, r;
+    size_t i;
+
+    a    = batch_rand_soa3(0, n);
+    b    = batch_rand_soa3(3, n);
+    dest = batch_buffer(6);
+    kernel(a, b, dest, n);
+    for (i = 0; i < n; ++i) {
+        r = ref(rm_get_f32x3_soa(a, i), rm_get_f32x3_soa(b, i));
+        batch_expect(name, n, dest + i, &r, 1);
+    }
+    batch_untouched(name, n, dest, n * sizeof(f32));
+}
+static void
+batch_interleave_f32x3(const size_t n) {
+    f32x3_soa soa;
+    f32x3 *aos, *in, v;
+    size_t i;
+
+    in  = batch_buffer(0);
+    soa = batch_soa3(1);
+    aos = batch_buffer(4);
+    for (i = 0; i < n; ++i) { in[i] = batch_rand_f32x3(); }
+    rm_deinterleave_f32x3(in, soa, n);
+    rm_interleave_f32x3(soa, aos, n);
+    for (i = 0; i < n; ++i) {
+        v = rm_get_f32x3_soa(soa, i);
+        batch_expect("deinterleave_f32x3", n, v.raw, in[i].raw, 3);
+        batch_expect("interleave_f32x3", n, aos[i].raw, in[i].raw, 3);
+    }
+    batch_untouched_soa3("deinterleave_f32x3", n, soa);
+    batch_untouched("interleave_f32x3", n, aos, n * sizeof(*aos));
+}
+static void
+batch_interleave_f32x4(const size_t n) {
+    f32x4_soa soa;
+    f32x4 *aos, *in, v;
+    size_t i;
+
+    in  = batch_buffer(0);
+    soa = rm_f32x4_soa((f32 *)batch_buffer(1), (f32 *)batch_buffer(2),
+                       (f32 *)batch_buffer(3), (f32 *)batch_buffer(4));
+    aos = batch_buffer(5);
+    for (i = 0; i < n; ++i) {
+        in[i] = rm_f32x4v3s(batch_rand_f32x3(), batch_rand(-2.0f, 2.0f));
+    }
+    rm_deinterleave_f32x4(in, soa, n);
+    rm_interleave_f32x4(soa, aos, n);
+    for (i = 0; i < n; ++i) {
+        v = rm_get_f32x4_soa(soa, i);
+        batch_expect("deinterleave_f32x4", n, v.raw, in[i].raw, 4);
+        batch_expect("interleave_f32x4", n, aos[i].raw, in[i].raw, 4);
+    }
+    batch_untouched("deinterleave_f32x4", n, soa.x, n * sizeof(f32));
+    batch_untouched("deinterleave_f32x4", n, soa.y, n * sizeof(f32));
+    batch_untouched("deinterleave_f32x4", n, soa.z, n * sizeof(f32));
+    batch_untouched("deinterleave_f32x4", n, soa.w, n * sizeof(f32));
+    batch_untouched("interleave_f32x4", n, aos, n * sizeof(*aos));
+}
+static void
+batch_interleave_u8x4(const size_t n) {
+    u8x4_soa soa;
+    u8x4 *aos, *in, v;
+    size_t i;
+
+    in  = batch_buffer(0);
+    soa = rm_u8x4_soa((u8 *)batch_buffer(1), (u8 *)batch_buffer(2),
+                      (u8 *)batch_buffer(3), (u8 *)batch_buffer(4));
+    aos = batch_buffer(5);
+    for (i = 0; i < n; ++i) {
+        in[i] = rm_u8x4((u8)(i * 3), (u8)(255 - i), (u8)(i * 7), (u8)(i + 1));
+    }
+    rm_deinterleave_u8x4(in, soa, n);
+    rm_interleave_u8x4(soa, aos, n);
+    for (i = 0; i < n; ++i) {
+        v = rm_get_u8x4_soa(soa, i);
+        if (memcmp(v.raw, in[i].raw, 4) != 0) {
+            batch_fail("deinterleave_u8x4", n, i, v.x, in[i].x);
+        }
+        if (memcmp(aos[i].raw, in[i].raw, 4) != 0) {
+            batch_fail("interleave_u8x4", n, i, aos[i].x, in[i].x);
+        }
+    }
+    batch_untouched("deinterleave_u8x4", n, soa.x, n);
+    batch_untouched("deinterleave_u8x4", n, soa.y, n);
+    batch_untouched("deinterleave_u8x4", n, soa.z, n);
+    batch_untouched("deinterleave_u8x4", n, soa.w, n);
+    batch_untouched("interleave_u8x4", n, aos, n * sizeof(*aos));
+}
+static void
+batch_skin_f32x4x3(const size_t n) {
+
+    f32x4x3 *bones, m;
+    u16x4 *idx;
+    f32x4 *w, p;
+    f32x3 *pts, *nrm, *op, *on, rp, rn;
+    size_t i, k;
+
+    bones = batch_buffer(0);
+    idx   = batch_buffer(1);
+    w     = batch_buffer(2);
+    pts   = batch_buffer(3);
+    nrm   = batch_buffer(4);
+    op    = batch_buffer(5);
+    on    = batch_buffer(6);
+    for (i = 0; i < 8; ++i) {
+        for (k = 0; k < 3; ++k) {
+            bones[i].cols[k] =
+                rm_f32x4v3s(batch_rand_f32x3(), batch_rand(-2.0f, 2.0f));
+        }
+    }
+    for (i = 0; i < n; ++i) {
+        idx[i] = rm_u16x4(i % 8, (i * 3) % 8, (i * 5) % 8, (i * 7) % 8);
+        w[i]   = rm_f32x4(0.4f, 0.3f, 0.2f, 0.1f);
+        pts[i] = batch_rand_f32x3();
+        nrm[i] = batch_rand_f32x3();
+    }
+    rm_skin_f32x4x3(bones, idx, w, pts, op, nrm, on, n);
+    for (i = 0; i < n; ++i) {
+        m  = rm_blend_f32x4x3(bones, idx[i], w[i]);
+        p  = rm_f32x4v3s(pts[i], 1.0f);
+        rp = rm_f32x3(rm_dot_f32x4(m.cols[0], p), rm_dot_f32x4(m.cols[1], p),
+                      rm_dot_f32x4(m.cols[2], p));
+        p  = rm_f32x4v3s(nrm[i], 0.0f);
+        rn = rm_f32x3(rm_dot_f32x4(m.cols[0], p), rm_dot_f32x4(m.cols[1], p),
+                      rm_dot_f32x4(m.cols[2], p));
+        batch_expect("skin_f32x4x3", n, op[i].raw, rp.raw, 3);
+        batch_expect("skin_f32x4x3", n, on[i].raw, rn.raw, 3);
+    }
+    batch_untouched("skin_f32x4x3", n, op, n * sizeof(*op));
+    batch_untouched("skin_f32x4x3", n, on, n * sizeof(*on));
+}
+
+static void
+batch_lerp_quatf32(const size_t n) {
+    quatf32 *a, *b, *out, ref;
+    f32 *t;
+    size_t i;
+
+    a   = batch_buffer(0);
+    b   = batch_buffer(1);
+    t   = batch_buffer(2);
+    out = batch_buffer(3);
+    for (i = 0; i < n; ++i) {
+        a[i] = rm_axis_angle_quatf32(rm_normalize_f32x3(batch_rand_f32x3()),
+                                     batch_rand(-3.0f, 3.0f));
+        /* every third pair is close enough for the nlerp fallback */
+        b[i] = (i % 3 == 0) ? rm_normalize_quatf32(rm_quatf32v(rm_add_f32x4(
+                                  a[i].v, rm_f32x4s(0.001f))))
+                            : rm_axis_angle_quatf32(
+                                  rm_normalize_f32x3(batch_rand_f32x3()),
+                                  batch_rand(-3.0f, 3.0f));
+        t[i] = batch_rand(0.0f, 1.0f);
+    }
+    rm_nlerp_batch_quatf32(a, b, t, out, n);
+    for (i = 0; i < n; ++i) {
+        ref = rm_nlerp_quatf32(a[i], b[i], t[i]);
+        batch_expect("nlerp_batch_quatf32", n, out[i].raw, ref.raw, 4);
+    }
+    batch_untouched("nlerp_batch_quatf32", n, out, n * sizeof(*out));
+    rm_slerp_batch_quatf32(a, b, t, out, n);
+    for (i = 0; i < n; ++i) {
+        ref = rm_slerp_quatf32(a[i], b[i], t[i]);
+        batch_expect("slerp_batch_quatf32", n, out[i].raw, ref.raw, 4);
+    }
+    batch_untouched("slerp_batch_quatf32", n, out, n * sizeof(*out));
+}
+/* a * b written out in f64, the simd rm_mul_quatf32 gets there by shuffles */
+static quatf32
+batch_mul_quat_ref(const quatf32 a, const quatf32 b) {
+    f64 ax, ay, az, aw, bx, by, bz, bw;
+
+    ax = a.x, ay = a.y, az = a.z, aw = a.w;
+    bx = b.x, by = b.y, bz = b.z, bw = b.w;
+    return rm_quatf32((f32)(aw * bx + ax * bw + ay * bz - az * by),
+                      (f32)(aw * by + ay * bw + az * bx - ax * bz),
+                      (f32)(aw * bz + az * bw + ax * by - ay * bx),
+                      (f32)(aw * bw - ax * bx - ay * by - az * bz));
+}
+/*
+ * unit q through the matrix and back, and v rotated by q, by its matrix and
+ * by q * v * conjugate(q). q and -q are the same rotation
+ */
+static void
+batch_quatf32(const quatf32 q, const f32x3 v) {
+    f32x3x3 m;
+    quatf32 back, r;
+    f32x3 got, ref;
+
+    m    = rm_to_f32x3x3_quatf32(q);
+    back = rm_from_f32x3x3_quatf32(m);
+    if (rm_dot_quatf32(back, q) < 0.0f) {
+        back = rm_quatf32v(rm_neg_f32x4(back.v));
+    }
+    batch_expect("from_f32x3x3_quatf32", 0, back.raw, q.raw, 4);
+    back = rm_from_f32x4x4_quatf32(rm_to_f32x4x4_quatf32(q));
+    if (rm_dot_quatf32(back, q) < 0.0f) {
+        back = rm_quatf32v(rm_neg_f32x4(back.v));
+    }
+    batch_expect("from_f32x4x4_quatf32", 0, back.raw, q.raw, 4);
+
+    r   = batch_mul_quat_ref(batch_mul_quat_ref(q, rm_quatf32(v.x, v.y, v.z,
+                                                              0.0f)),
+                             rm_conjugate_quatf32(q));
+    ref = rm_mulv_f32x3x3(m, v);
+    batch_expect("to_f32x3x3_quatf32", 0, ref.raw, r.raw, 3);
+    got = rm_rotate_quatf32(q, v);
+    batch_expect("rotate_quatf32", 0, got.raw, ref.raw, 3);
+}
+static void
+batch_rand_quatf32(void) {
+    quatf32 a, b, got, ref;
+
+    a   = rm_quatf32v(rm_f32x4v3s(batch_rand_f32x3(), batch_rand(-2.0f, 2.0f)));
+    b   = rm_quatf32v(rm_f32x4v3s(batch_rand_f32x3(), batch_rand(-2.0f, 2.0f)));
+    got = rm_mul_quatf32(a, b);
+    ref = batch_mul_quat_ref(a, b);
+    batch_expect("mul_quatf32", 0, got.raw, ref.raw, 4);
+
+    batch_quatf32(rm_axis_angle_quatf32(rm_normalize_f32x3(batch_rand_f32x3()),
+                                        batch_rand(-3.14f, 3.14f)),
+                  batch_rand_f32x3());
+    /* close to 180 degrees the trace is near -1 */
+    batch_quatf32(rm_axis_angle_quatf32(rm_normalize_f32x3(batch_rand_f32x3()),
+                                        batch_rand(3.1f, 3.14f)),
+                  batch_rand_f32x3());
+}
+/* half turns and near half turns, one per branch of rm_from_f32x3x3_quatf32 */
+static void
+batch_half_turn_quatf32(void) {
+    static const f32 axes[][3] = {
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.70710678f, 0.70710678f, 0.0f},
+        {0.0f, 0.70710678f, -0.70710678f},
+    };
+    static const f32 angles[] = {3.14159265f, 3.1f, -3.1f, 3.14f, 0.5f};
+    f32x3 a;
+    size_t i, k;
+
+    for (i = 0; i < sizeof(axes) / sizeof(axes[0]); ++i) {
+        a = rm_f32x3(axes[i][0], axes[i][1], axes[i][2]);
+        /* exactly 180 degrees, w = 0 */
+        batch_quatf32(rm_quatf32(a.x, a.y, a.z, 0.0f), batch_rand_f32x3());
+        for (k = 0; k < sizeof(angles) / sizeof(angles[0]); ++k) {
+            batch_quatf32(rm_axis_angle_quatf32(a, angles[k]),
+                          batch_rand_f32x3());
+        }
+    }
+}
+static aabbf32
+batch_rand_aabbf32(const f32 spread) {
+    f32x3 c, e;
+
+    c = rm_muls_f32x3(batch_rand_f32x3(), spread);
+    e = rm_f32x3(batch_rand(0.1f, 1.0f), batch_rand(0.1f, 1.0f),
+                 batch_rand(0.1f, 1.0f));
+    return rm_aabbf32(rm_sub_f32x3(c, e), rm_add_f32x3(c, e));
+}
+static void
+batch_frustum_cull_batch_aabbf32(const size_t n) {
+    f32x4x4 m;
+    f32x4 *planes;
+    aabbf32 *boxes;
+    u8 *visible;
+    size_t i;
+    int got;
+
+    planes  = batch_buffer(0);
+    boxes   = batch_buffer(1);
+    visible = batch_buffer(2);
+    /* a frustum looking down -z, near 0.1 and far 10 */
+    m             = rm_zero_f32x4x4();
+    m.cols[0].x   = 1.0f;
+    m.cols[1].y   = 1.0f;
+    m.cols[2].z   = -10.1f / 9.9f;
+    m.cols[2].w   = -1.0f;
+    m.cols[3].z   = -2.0f / 9.9f;
+    rm_frustum_planes_f32x4x4(m, planes);
+    for (i = 0; i < n; ++i) { boxes[i] = batch_rand_aabbf32(4.0f); }
+    rm_frustum_cull_batch_aabbf32(planes, boxes, visible, n);
+    for (i = 0; i < n; ++i) {
+        got = (visible[i / 8] >> i % 8) & 1;
+        if (got != rm_frustum_test_aabbf32(planes, boxes[i])) {
+            batch_fail("frustum_cull_batch_aabbf32", n, i, got, !got);
+        }
+    }
+    if (n % 8 != 0 && visible[n / 8] >> n % 8 != 0) {
+        batch_fail("frustum_cull_batch_aabbf32", n, n, visible[n / 8], 0);
+    }
+    batch_untouched("frustum_cull_batch_aabbf32", n, visible, (n + 7) / 8);
+}
+static rayf32
+batch_rand_rayf32(void) {
+    f32x3 d;
+
+    d = batch_rand_f32x3();
+    /* rays parallel to a slab take the 1 / 0 path */
+    if (batch_rand(0.0f, 1.0f) < 0.2f) { d.y = 0.0f; }
+    return rm_dir_rayf32(rm_muls_f32x3(batch_rand_f32x3(), 2.0f), d,
+                         batch_rand(0.0f, 1.0f), batch_rand(1.0f, 8.0f));
+}
+static void
+batch_raycast4_aabbf32(void) {
+    aabbf32 *boxes;
+    rayf32 r;
+    f32 *t, ref;
+    size_t i;
+    int mask, hit;
+
+    boxes = batch_buffer(0);
+    t     = batch_buffer(1);
+    r     = batch_rand_rayf32();
+    for (i = 0; i < 4; ++i) { boxes[i] = batch_rand_aabbf32(2.0f); }
+    mask = rm_raycast4_aabbf32(r, boxes, t);
+    for (i = 0; i < 4; ++i) {
+        hit = rm_raycast_aabbf32(r, boxes[i], &ref);
+        if (((mask >> i) & 1) != hit) {
+            batch_fail("raycast4_aabbf32", 4, i, (mask >> i) & 1, hit);
+        }
+        batch_expect("raycast4_aabbf32", 4, t + i, &ref, 1);
+    }
+    if (mask >> 4 != 0) { batch_fail("raycast4_aabbf32", 4, 4, mask, 0); }
+    batch_untouched("raycast4_aabbf32", 4, t, 4 * sizeof(f32));
+}
+static void
+batch_raycast_packet_aabbf32(void) {
+    ray_packetf32 *p;
+    aabbf32 b;
+    f32 *t, ref;
+    size_t i;
+    int mask, hit;
+
+    p = batch_buffer(0);
+    t = batch_buffer(1);
+    b = batch_rand_aabbf32(2.0f);
+    for (i = 0; i < RM_RAY_PACKET; ++i) {
+        rm_set_ray_packetf32(p, i, batch_rand_rayf32());
+    }
+    mask = rm_raycast_packet_aabbf32(p, b, t);
+    for (i = 0; i < RM_RAY_PACKET; ++i) {
+        hit = rm_raycast_aabbf32(rm_get_ray_packetf32(p, i), b, &ref);
+        if (((mask >> i) & 1) != hit) {
+            batch_fail("raycast_packet_aabbf32", RM_RAY_PACKET, i,
+                       (mask >> i) & 1, hit);
+        }
+        batch_expect("raycast_packet_aabbf32", RM_RAY_PACKET, t + i, &ref, 1);
+    }
+    if (mask >> RM_RAY_PACKET != 0) {
+        batch_fail("raycast_packet_aabbf32", RM_RAY_PACKET, RM_RAY_PACKET,
+                   mask, 0);
+    }
+    batch_untouched("raycast_packet_aabbf32", RM_RAY_PACKET, t,
+                    RM_RAY_PACKET * sizeof(f32));
+}
+
+int
+main(void) {
+    size_t n, k;
+
+    for (n = 0; n <= BATCH_MAX; ++n) {
+        batch_transform_points_f32x4x4(n);
+        batch_transform_normals_f32x4x4(n);
+        batch_transform_f32x4x4(n);
+        batch_soa3_binary("add_f32x3_soa", n, rm_add_f32x3_soa, rm_add_f32x3);
+        batch_soa3_binary("sub_f32x3_soa", n, rm_sub_f32x3_soa, rm_sub_f32x3);
+        batch_soa3_binary("mul_f32x3_soa", n, rm_mul_f32x3_soa, rm_mul_f32x3);
+        batch_soa3_binary("cross_f32x3_soa", n, rm_cross_f32x3_soa,
+                          rm_cross_f32x3);
+        batch_muls_f32x3_soa(n);
+        batch_fma_f32x3_soa(n);
+        batch_clamp_f32x3_soa(n);
+        batch_normalize_f32x3_soa(n);
+        batch_soa3_reduce("dot_f32x3_soa", n, rm_dot_f32x3_soa, rm_dot_f32x3);
+        batch_soa3_reduce("distance_f32x3_soa", n, rm_distance_f32x3_soa,
+                          rm_distance_f32x3);
+        batch_interleave_f32x3(n);
+        batch_interleave_f32x4(n);
+        batch_interleave_u8x4(n);
+        batch_skin_f32x4x3(n);
+        batch_lerp_quatf32(n);
+        batch_frustum_cull_batch_aabbf32(n);
+    }
+    /*
+     * the ray kernels and the matrix functions have a fixed width, so they
+     * get more random inputs
+     */
+    for (k = 0; k < 256; ++k) {
+        batch_inverse_f32x2x2();
+        batch_inverse_f32x3x3();
+        batch_inverse_f32x4x4();
+        batch_inverse_f64x2x2();
+        batch_inverse_f64x3x3();
+        batch_inverse_f64x4x4();
+        batch_inverse_affine_f32x4x4();
+        batch_inverse_affine_f64x4x4();
+        batch_rand_quatf32();
+        batch_raycast4_aabbf32();
+        batch_raycast_packet_aabbf32();
+    }
+    batch_half_turn_quatf32();
+    printf("%s,failures,%u\n", BATCH_BACKEND, batch_failures);
+    return batch_failures != 0;
+}
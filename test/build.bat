@@ -11,3 +11,7 @@ set BIN_DIR=test\
 clang -Wall -Wpedantic -ggdb -std=c11 -O2 -mavx2 -march=native %BIN_DIR%test.c -o %BIN_DIR%test.exe
 
 .\%BIN_DIR%test.exe
+
+clang -Wall -Wpedantic -ggdb -std=c11 -O2 -mavx2 -mfma %BIN_DIR%batch.c -o %BIN_DIR%batch.exe
+
+.\%BIN_DIR%batch.exe
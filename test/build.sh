@@ -4,10 +4,76 @@
 if [ "`basename $PWD`" != "test" ];
 then
 BIN_DIR="test/"
+BENCH_DIR="bench/"
 else
 BIN_DIR=""
+BENCH_DIR="../bench/"
 fi
 
-gcc -Wall -Wpedantic -ggdb -std=c11 -O2 -mavx2 ${BIN_DIR}test.c -o ${BIN_DIR}test
+# sh test/build.sh bench [--json] builds and runs bench/bench.c once per
+# backend and writes bench/bench_<backend>.csv (or .json)
+if [ "$1" = "bench" ];
+then
+EXT="csv"
+if [ "$2" = "--json" ];
+then
+EXT="json"
+fi
+
+for BACKEND in scalar sse2 sse4_1 avx avx2
+do
+case $BACKEND in
+    scalar) FLAGS="-DRM_NO_INTRINSICS" ;;
+    sse2)   FLAGS="-msse2" ;;
+    sse4_1) FLAGS="-msse4.1" ;;
+    avx)    FLAGS="-mavx" ;;
+    avx2)   FLAGS="-mavx2 -mfma" ;;
+esac
+
+gcc -Wall -Wpedantic -std=c11 -O2 ${FLAGS} ${BENCH_DIR}bench.c -o ${BENCH_DIR}bench_${BACKEND} -lm || exit 1
+./${BENCH_DIR}bench_${BACKEND} $2 > ${BENCH_DIR}bench_${BACKEND}.${EXT}
+done
+exit 0
+fi
+
+# sh test/build.sh ulp [--step n] [--samples n] [--threads n] builds and runs
+# test/ulp.c once per backend and writes test/ulp_<backend>.csv
+if [ "$1" = "ulp" ];
+then
+shift
+for BACKEND in scalar sse2 sse4_1 avx avx2
+do
+case $BACKEND in
+    scalar) FLAGS="-DRM_NO_INTRINSICS" ;;
+    sse2)   FLAGS="-msse2" ;;
+    sse4_1) FLAGS="-msse4.1" ;;
+    avx)    FLAGS="-mavx" ;;
+    avx2)   FLAGS="-mavx2 -mfma" ;;
+esac
+
+gcc -Wall -Wpedantic -std=c11 -O2 ${FLAGS} ${BIN_DIR}ulp.c -o ${BIN_DIR}ulp_${BACKEND} -lm -lpthread || exit 1
+./${BIN_DIR}ulp_${BACKEND} "$@" > ${BIN_DIR}ulp_${BACKEND}.csv
+done
+exit 0
+fi
+
+gcc -Wall -Wpedantic -ggdb -std=c11 -O2 -mavx2 ${BIN_DIR}test.c -o ${BIN_DIR}test -lm
+
+./${BIN_DIR}test || exit 1
+
+# the batch kernels against their scalar versions, once per backend. ubsan
+# turns an aligned load from a caller array into an error even where -O2
+# folds it into an instruction that tolerates it
+for BACKEND in scalar sse2 sse4_1 avx avx2
+do
+case $BACKEND in
+    scalar) FLAGS="-DRM_NO_INTRINSICS" ;;
+    sse2)   FLAGS="-msse2" ;;
+    sse4_1) FLAGS="-msse4.1" ;;
+    avx)    FLAGS="-mavx" ;;
+    avx2)   FLAGS="-mavx2 -mfma" ;;
+esac
 
-./${BIN_DIR}test
+gcc -Wall -Wpedantic -ggdb -std=c11 -O2 -fsanitize=undefined -fno-sanitize-recover=all ${FLAGS} ${BIN_DIR}batch.c -o ${BIN_DIR}batch_${BACKEND} -lm || exit 1
+./${BIN_DIR}batch_${BACKEND} || exit 1
+done
@@ -30,6 +30,9 @@ main(void) {
     f32x4 v2 = rm_f32x4(1, 1, 1, 1);
 
     printf("%f\n", rm_dot_f32x4(v1, v2));
+    print_vec4(rm_sin_f32x4(v1));
+    print_vec4(rm_cos_f32x4(v1));
+    print_vec4(rm_mulv_f32x4x4(rm_identity_f32x4x4(), v1));
 
     i32x4 test;
     _mm_store_si128((__m128i *)test.raw,
@@ -0,0 +1,535 @@
+/*
+ * ulp error of the scalar functions against libm, build it once per backend
+ * (see test/build.sh).
+ *
+ * the f32 functions go over every one of the 2^32 inputs (or every n-th with
+ * --step n) and are checked against the f64 libm result, the f64 functions
+ * go over random samples of a few ranges and are checked against the long
+ * double libm result, which is only wider than f64 on x86. the simd
+ * functions are checked through lane 0 so every backend gets its own
+ * numbers. mismatches count results that differ from the correctly rounded
+ * reference, special counts nan/inf results and zeros whose sign differs
+ * from the reference. the edges rows check a few inputs the sweeps can miss.
+ *
+ * usage: ulp [--step n] [--samples n] [--threads n]
+ */
+#include <float.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#include "../ranmath.h"
+
+#if RM_PLATFORM == RM_PLATFORM_LINUX
+#include <unistd.h>
+#else
+#include <windows.h>
+#endif
+
+#if defined(RM_AVX2)
+#define ULP_BACKEND "avx2"
+#elif defined(RM_AVX)
+#define ULP_BACKEND "avx"
+#elif defined(RM_SSE4_1)
+#define ULP_BACKEND "sse4_1"
+#elif defined(RM_SSE2)
+#define ULP_BACKEND "sse2"
+#elif defined(RM_NEON)
+#define ULP_BACKEND "neon"
+#else
+#define ULP_BACKEND "scalar"
+#endif
+
+#define ULP_MAX_THREADS 256
+
+typedef struct ulp_stats_t ulp_stats;
+typedef struct ulp_fn32_t ulp_fn32;
+typedef struct ulp_fn64_t ulp_fn64;
+typedef struct ulp_range_t ulp_range;
+typedef struct ulp_job_t ulp_job;
+
+struct ulp_stats_t {
+    f64 max, sum;
+    u64 count, mismatches, special;
+    u64 worst;
+};
+/* inputs outside [lo, hi] are skipped, lo == hi means all of them */
+struct ulp_fn32_t {
+    const char *name;
+    f32 (*fn)(f32);
+    f64 (*ref)(f64);
+    f32 lo, hi;
+};
+struct ulp_fn64_t {
+    const char *name;
+    f64 (*fn)(f64);
+    long double (*ref)(long double);
+};
+/* lo == hi means every bit pattern */
+struct ulp_range_t {
+    const char *name;
+    f64 lo, hi;
+};
+struct ulp_job_t {
+    const ulp_fn32 *f32;
+    const ulp_fn64 *f64;
+    const ulp_range *range;
+    u64 begin, end, step;
+    ulp_stats stats;
+};
+
+/* the simd versions through lane 0 */
+static f32
+ulp_sin_f32x4(const f32 x) {
+    return rm_sin_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_cos_f32x4(const f32 x) {
+    return rm_cos_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_rsqrt_f32x4(const f32 x) {
+    return rm_rsqrt_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_floor_f32x4(const f32 x) {
+    return rm_floor_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_ceil_f32x4(const f32 x) {
+    return rm_ceil_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_round_f32x4(const f32 x) {
+    return rm_round_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_trunc_f32x4(const f32 x) {
+    return rm_trunc_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_exp_f32x4(const f32 x) {
+    return rm_exp_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_exp2_f32x4(const f32 x) {
+    return rm_exp2_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_log_f32x4(const f32 x) {
+    return rm_log_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_log2_f32x4(const f32 x) {
+    return rm_log2_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_sqrt_fast_f32x4(const f32 x) {
+    return rmv_to_f32x4(rmv_sqrt_fast_f32x4(rmv_set1_f32x4(x))).x;
+}
+static f32
+ulp_rsqrt_fast_f32x4(const f32 x) {
+    return rm_rsqrt_fast_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_sin_fast_f32x4(const f32 x) {
+    return rm_sin_fast_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_cos_fast_f32x4(const f32 x) {
+    return rm_cos_fast_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_exp_fast_f32x4(const f32 x) {
+    return rm_exp_fast_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_exp2_fast_f32x4(const f32 x) {
+    return rm_exp2_fast_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_log_fast_f32x4(const f32 x) {
+    return rm_log_fast_f32x4(rm_f32x4s(x)).x;
+}
+static f32
+ulp_log2_fast_f32x4(const f32 x) {
+    return rm_log2_fast_f32x4(rm_f32x4s(x)).x;
+}
+static f64
+ulp_sin_f64x2(const f64 x) {
+    return rm_sin_f64x2(rm_f64x2s(x)).x;
+}
+static f64
+ulp_cos_f64x2(const f64 x) {
+    return rm_cos_f64x2(rm_f64x2s(x)).x;
+}
+static f64
+ulp_floor_f64x2(const f64 x) {
+    return rm_floor_f64x2(rm_f64x2s(x)).x;
+}
+static f64
+ulp_ceil_f64x2(const f64 x) {
+    return rm_ceil_f64x2(rm_f64x2s(x)).x;
+}
+static f64
+ulp_round_f64x2(const f64 x) {
+    return rm_round_f64x2(rm_f64x2s(x)).x;
+}
+static f64
+ulp_trunc_f64x2(const f64 x) {
+    return rm_trunc_f64x2(rm_f64x2s(x)).x;
+}
+static f64
+ulp_exp_f64x2(const f64 x) {
+    return rm_exp_f64x2(rm_f64x2s(x)).x;
+}
+static f64
+ulp_exp2_f64x2(const f64 x) {
+    return rm_exp2_f64x2(rm_f64x2s(x)).x;
+}
+static f64
+ulp_log_f64x2(const f64 x) {
+    return rm_log_f64x2(rm_f64x2s(x)).x;
+}
+static f64
+ulp_log2_f64x2(const f64 x) {
+    return rm_log2_f64x2(rm_f64x2s(x)).x;
+}
+
+/* the references, sqrt and friends are exact in the wider type */
+static f64
+ulp_rsqrt(const f64 x) {
+    return 1.0 / sqrt(x);
+}
+static f64
+ulp_fract(const f64 x) {
+    return x - floor(x);
+}
+static long double
+ulp_rsqrtl(const long double x) {
+    return 1.0L / sqrtl(x);
+}
+
+/* the _fast rows only go over the inputs they are meant for */
+static const ulp_fn32 ulp_fns32[] = {
+    {"sqrt_f32",         rm_sqrt_f32,          sqrt,      0.0f,      0.0f},
+    {"rsqrt_f32",        rm_rsqrt_f32,         ulp_rsqrt, 0.0f,      0.0f},
+    {"sin_f32",          rm_sin_f32,           sin,       0.0f,      0.0f},
+    {"cos_f32",          rm_cos_f32,           cos,       0.0f,      0.0f},
+    {"tan_f32",          rm_tan_f32,           tan,       0.0f,      0.0f},
+    {"floor_f32",        rm_floor_f32,         floor,     0.0f,      0.0f},
+    {"ceil_f32",         rm_ceil_f32,          ceil,      0.0f,      0.0f},
+    {"round_f32",        rm_round_f32,         round,     0.0f,      0.0f},
+    {"trunc_f32",        rm_trunc_f32,         trunc,     0.0f,      0.0f},
+    {"fract_f32",        rm_fract_f32,         ulp_fract, 0.0f,      0.0f},
+    {"exp_f32",          rm_exp_f32,           exp,       0.0f,      0.0f},
+    {"exp2_f32",         rm_exp2_f32,          exp2,      0.0f,      0.0f},
+    {"log_f32",          rm_log_f32,           log,       0.0f,      0.0f},
+    {"log2_f32",         rm_log2_f32,          log2,      0.0f,      0.0f},
+    {"sqrt_fast_f32",    rm_sqrt_fast_f32,     sqrt,      0.0f,      0.0f},
+    {"rsqrt_fast_f32",   rm_rsqrt_fast_f32,    ulp_rsqrt, 0.0f,      FLT_MAX},
+    {"sin_fast_f32",     rm_sin_fast_f32,      sin,       -8192.0f,  8192.0f},
+    {"cos_fast_f32",     rm_cos_fast_f32,      cos,       -8192.0f,  8192.0f},
+    {"tan_fast_f32",     rm_tan_fast_f32,      tan,       -8192.0f,  8192.0f},
+    {"exp_fast_f32",     rm_exp_fast_f32,      exp,       0.0f,      0.0f},
+    {"exp2_fast_f32",    rm_exp2_fast_f32,     exp2,      0.0f,      0.0f},
+    {"log_fast_f32",     rm_log_fast_f32,      log,       0x1p-126f, FLT_MAX},
+    {"log2_fast_f32",    rm_log2_fast_f32,     log2,      0x1p-126f, FLT_MAX},
+    {"sin_f32x4",        ulp_sin_f32x4,        sin,       0.0f,      0.0f},
+    {"cos_f32x4",        ulp_cos_f32x4,        cos,       0.0f,      0.0f},
+    {"rsqrt_f32x4",      ulp_rsqrt_f32x4,      ulp_rsqrt, 0.0f,      0.0f},
+    {"floor_f32x4",      ulp_floor_f32x4,      floor,     0.0f,      0.0f},
+    {"ceil_f32x4",       ulp_ceil_f32x4,       ceil,      0.0f,      0.0f},
+    {"round_f32x4",      ulp_round_f32x4,      round,     0.0f,      0.0f},
+    {"trunc_f32x4",      ulp_trunc_f32x4,      trunc,     0.0f,      0.0f},
+    {"exp_f32x4",        ulp_exp_f32x4,        exp,       0.0f,      0.0f},
+    {"exp2_f32x4",       ulp_exp2_f32x4,       exp2,      0.0f,      0.0f},
+    {"log_f32x4",        ulp_log_f32x4,        log,       0.0f,      0.0f},
+    {"log2_f32x4",       ulp_log2_f32x4,       log2,      0.0f,      0.0f},
+    {"sqrt_fast_f32x4",  ulp_sqrt_fast_f32x4,  sqrt,      0.0f,      0.0f},
+    {"rsqrt_fast_f32x4", ulp_rsqrt_fast_f32x4, ulp_rsqrt, 0.0f,      FLT_MAX},
+    {"sin_fast_f32x4",   ulp_sin_fast_f32x4,   sin,       -8192.0f,  8192.0f},
+    {"cos_fast_f32x4",   ulp_cos_fast_f32x4,   cos,       -8192.0f,  8192.0f},
+    {"exp_fast_f32x4",   ulp_exp_fast_f32x4,   exp,       0.0f,      0.0f},
+    {"exp2_fast_f32x4",  ulp_exp2_fast_f32x4,  exp2,      0.0f,      0.0f},
+    {"log_fast_f32x4",   ulp_log_fast_f32x4,   log,       0x1p-126f, FLT_MAX},
+    {"log2_fast_f32x4",  ulp_log2_fast_f32x4,  log2,      0x1p-126f, FLT_MAX},
+};
+static const ulp_fn64 ulp_fns64[] = {
+    {"sqrt_f64",     rm_sqrt_f64,     sqrtl     },
+    {"rsqrt_f64",    rm_rsqrt_f64,    ulp_rsqrtl},
+    {"sin_f64",      rm_sin_f64,      sinl      },
+    {"cos_f64",      rm_cos_f64,      cosl      },
+    {"tan_f64",      rm_tan_f64,      tanl      },
+    {"floor_f64",    rm_floor_f64,    floorl    },
+    {"ceil_f64",     rm_ceil_f64,     ceill     },
+    {"round_f64",    rm_round_f64,    roundl    },
+    {"trunc_f64",    rm_trunc_f64,    truncl    },
+    {"exp_f64",      rm_exp_f64,      expl      },
+    {"exp2_f64",     rm_exp2_f64,     exp2l     },
+    {"log_f64",      rm_log_f64,      logl      },
+    {"log2_f64",     rm_log2_f64,     log2l     },
+    {"sin_fast_f64", rm_sin_fast_f64, sinl      },
+    {"cos_fast_f64", rm_cos_fast_f64, cosl      },
+    {"tan_fast_f64", rm_tan_fast_f64, tanl      },
+    {"sin_f64x2",    ulp_sin_f64x2,   sinl      },
+    {"cos_f64x2",    ulp_cos_f64x2,   cosl      },
+    {"floor_f64x2",  ulp_floor_f64x2, floorl    },
+    {"ceil_f64x2",   ulp_ceil_f64x2,  ceill     },
+    {"round_f64x2",  ulp_round_f64x2, roundl    },
+    {"trunc_f64x2",  ulp_trunc_f64x2, truncl    },
+    {"exp_f64x2",    ulp_exp_f64x2,   expl      },
+    {"exp2_f64x2",   ulp_exp2_f64x2,  exp2l     },
+    {"log_f64x2",    ulp_log_f64x2,   logl      },
+    {"log2_f64x2",   ulp_log2_f64x2,  log2l     },
+};
+/*
+ * signed zeros and the values around them the rounding functions get wrong,
+ * exp and exp2 right below overflow, where 2^k alone would be inf, and the
+ * non-finite inputs
+ */
+static const f64 ulp_edges[] = {
+    0.0,  -0.0, 0.3,  -0.3, 0.5,  -0.5,      0.7,       -0.7, 1.0,
+    -1.0, 1.5,  -1.5, 88.5, 127.7, INFINITY, -INFINITY, NAN,
+};
+static const ulp_range ulp_ranges64[] = {
+    {"bits",  0.0,     0.0    },
+    {"pi",    -RM_PI_F64, RM_PI_F64},
+    {"1e3",   -1e3,    1e3    },
+    {"1e9",   -1e9,    1e9    },
+};
+
+static void
+ulp_stats_add(ulp_stats *s, const f64 ulp, const bool exact, const u64 bits) {
+    s->count++;
+    if (!exact) { s->mismatches++; }
+    if (ulp < 0.0) {
+        s->special++;
+        return;
+    }
+    s->sum += ulp;
+    if (ulp > s->max) {
+        s->max   = ulp;
+        s->worst = bits;
+    }
+}
+static void
+ulp_stats_merge(ulp_stats *dest, const ulp_stats *s) {
+    dest->sum        += s->sum;
+    dest->count      += s->count;
+    dest->mismatches += s->mismatches;
+    dest->special    += s->special;
+    if (s->max > dest->max || dest->count == s->count) {
+        dest->max   = s->max;
+        dest->worst = s->worst;
+    }
+}
+
+/* -1 when only one side is nan/inf, or both are but they differ */
+static f64
+ulp_error(const long double got,
+          const long double ref,
+          const i32 mant,
+          const i32 emin,
+          const i32 emax) {
+    int e;
+
+    if (isnan(got) || isnan(ref)) { return (isnan(got) && isnan(ref)) ? 0 : -1; }
+    /* a finite ref past the largest value plus half an ulp rounds to inf */
+    if (isinf(got) &&
+        fabsl(ref) >= ldexpl(1.0L - ldexpl(1.0L, -mant - 1), emax)) {
+        return (signbit(got) == signbit(ref)) ? 0 : -1;
+    }
+    if (isinf(got) || isinf(ref)) { return (got == ref) ? 0 : -1; }
+    if (got == 0 && ref == 0) {
+        return (signbit(got) == signbit(ref)) ? 0 : -1;
+    }
+
+    frexpl(ref, &e);
+    e = RM_CLAMP(e, emin, emax);
+    return (f64)(fabsl(got - ref) / ldexpl(1.0L, e - mant));
+}
+
+static u64
+ulp_xorshift(u64 *s) {
+    *s ^= *s >> 12;
+    *s ^= *s << 25;
+    *s ^= *s >> 27;
+    return *s * 0x2545F4914F6CDD1DULL;
+}
+
+/* one input, f32 ones outside the row's [lo, hi] are skipped */
+static void
+ulp_check32(ulp_stats *s, const ulp_fn32 *fn, const f32 x) {
+    f32 got;
+    f64 ref;
+
+    if (fn->lo != fn->hi && !(x >= fn->lo && x <= fn->hi)) { return; }
+    got = fn->fn(x);
+    ref = fn->ref((f64)x);
+    ulp_stats_add(s, ulp_error(got, ref, 24, -125, 128),
+                  got == (f32)ref || (isnan(got) && isnan(ref)),
+                  f32_as_u32(x));
+}
+static void
+ulp_check64(ulp_stats *s, const ulp_fn64 *fn, const f64 x) {
+    f64 got;
+    long double ref;
+
+    got = fn->fn(x);
+    ref = fn->ref((long double)x);
+    ulp_stats_add(s, ulp_error(got, ref, 53, -1021, 1024),
+                  got == (f64)ref || (isnan(got) && isnan(ref)),
+                  f64_as_u64(x));
+}
+
+static int
+ulp_run(void *arg) {
+    ulp_job *job;
+    u64 i, bits, seed;
+    f64 x;
+
+    job  = arg;
+    seed = 0x9E3779B97F4A7C15ULL ^ job->begin;
+    for (i = job->begin; i < job->end; i += job->step) {
+        if (job->f32 != NULL) {
+            ulp_check32(&job->stats, job->f32, u32_as_f32((u32)i));
+            continue;
+        }
+        bits = ulp_xorshift(&seed);
+        if (job->range->lo == job->range->hi) {
+            x = u64_as_f64(bits);
+        } else {
+            x = job->range->lo + (job->range->hi - job->range->lo) *
+                                     ((f64)(bits >> 11) * 0x1p-53);
+        }
+        ulp_check64(&job->stats, job->f64, x);
+    }
+    return 0;
+}
+
+/* splits [0, n) over the threads and merges the results */
+static ulp_stats
+ulp_sweep(const ulp_fn32 *f32,
+          const ulp_fn64 *f64,
+          const ulp_range *range,
+          const u64 n,
+          const u64 step,
+          const u32 threads) {
+    ulp_job jobs[ULP_MAX_THREADS];
+    thrd_t ids[ULP_MAX_THREADS];
+    ulp_stats dest;
+    u64 chunk;
+    u32 t;
+
+    memset(&dest, 0, sizeof(dest));
+    /* chunks are a multiple of step so the strided sweep has no seams */
+    chunk = (n / threads + step - 1) / step * step;
+    for (t = 0; t < threads; ++t) {
+        memset(&jobs[t], 0, sizeof(jobs[t]));
+        jobs[t].f32   = f32;
+        jobs[t].f64   = f64;
+        jobs[t].range = range;
+        jobs[t].begin = RM_MIN(n, chunk * t);
+        jobs[t].end   = (t == threads - 1) ? n : RM_MIN(n, chunk * (t + 1));
+        jobs[t].step  = step;
+        thrd_create(&ids[t], ulp_run, &jobs[t]);
+    }
+    for (t = 0; t < threads; ++t) {
+        thrd_join(ids[t], NULL);
+        ulp_stats_merge(&dest, &jobs[t].stats);
+    }
+    return dest;
+}
+/* the ulp_edges inputs, one thread is plenty */
+static ulp_stats
+ulp_edge(const ulp_fn32 *fn32, const ulp_fn64 *fn64) {
+    ulp_stats dest;
+    size_t i;
+
+    memset(&dest, 0, sizeof(dest));
+    for (i = 0; i < sizeof(ulp_edges) / sizeof(ulp_edges[0]); ++i) {
+        if (fn32 != NULL) {
+            ulp_check32(&dest, fn32, (f32)ulp_edges[i]);
+        } else {
+            ulp_check64(&dest, fn64, ulp_edges[i]);
+        }
+    }
+    return dest;
+}
+
+static void
+ulp_report(const char *type,
+           const char *name,
+           const char *range,
+           const ulp_stats *s,
+           const f64 worst) {
+    printf("%s,%s,%s,%s,%llu,%.3f,%a,%.6f,%llu,%llu\n", ULP_BACKEND, type,
+           name, range, (unsigned long long)s->count, s->max, worst,
+           s->sum / RM_MAX(1, s->count - s->special),
+           (unsigned long long)s->mismatches,
+           (unsigned long long)s->special);
+    fflush(stdout);
+}
+
+static u32
+ulp_cores(void) {
+#if RM_PLATFORM == RM_PLATFORM_LINUX
+    long n;
+
+    n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 0) ? (u32)n : 1;
+#else
+    SYSTEM_INFO info;
+
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+#endif
+}
+
+int
+main(int argc, char **argv) {
+    u64 step, samples;
+    u32 threads;
+    size_t i, k;
+    int a;
+    ulp_stats s;
+
+    step    = 1;
+    samples = 1 << 24;
+    threads = ulp_cores();
+    for (a = 1; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "--step") == 0) {
+            step = strtoull(argv[a + 1], NULL, 0);
+        } else if (strcmp(argv[a], "--samples") == 0) {
+            samples = strtoull(argv[a + 1], NULL, 0);
+        } else if (strcmp(argv[a], "--threads") == 0) {
+            threads = (u32)strtoul(argv[a + 1], NULL, 0);
+        }
+    }
+    step    = RM_MAX(1, step);
+    threads = RM_CLAMP(threads, 1, ULP_MAX_THREADS);
+
+    printf("backend,type,name,range,count,max_ulp,worst_input,mean_ulp,"
+           "mismatches,special\n");
+    for (i = 0; i < sizeof(ulp_fns32) / sizeof(ulp_fns32[0]); ++i) {
+        s = ulp_sweep(&ulp_fns32[i], NULL, NULL, (u64)1 << 32, step, threads);
+        ulp_report("f32", ulp_fns32[i].name, "bits", &s,
+                   u32_as_f32((u32)s.worst));
+        s = ulp_edge(&ulp_fns32[i], NULL);
+        ulp_report("f32", ulp_fns32[i].name, "edges", &s,
+                   u32_as_f32((u32)s.worst));
+    }
+    for (i = 0; i < sizeof(ulp_fns64) / sizeof(ulp_fns64[0]); ++i) {
+        for (k = 0; k < sizeof(ulp_ranges64) / sizeof(ulp_ranges64[0]); ++k) {
+            s = ulp_sweep(NULL, &ulp_fns64[i], &ulp_ranges64[k], samples, 1,
+                          threads);
+            ulp_report("f64", ulp_fns64[i].name, ulp_ranges64[k].name, &s,
+                       u64_as_f64(s.worst));
+        }
+        s = ulp_edge(NULL, &ulp_fns64[i]);
+        ulp_report("f64", ulp_fns64[i].name, "edges", &s, u64_as_f64(s.worst));
+    }
+    return 0;
+}